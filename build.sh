@@ -183,6 +183,10 @@ copy_headers(){
     mkdir -p $BASE_DIR/io
     cp src/cpp/io/*.hpp          $BASE_DIR/io/
 
+    #  Copy Terrain Module
+    mkdir -p $BASE_DIR/terrain
+    cp src/cpp/terrain/*.hpp     $BASE_DIR/terrain/
+
     #  Copy Utilities Module
     mkdir -p $BASE_DIR/utilities
     cp src/cpp/utilities/*.hpp   $BASE_DIR/utilities/
@@ -14,30 +14,68 @@
 /// Coordinate Module
 #include <GeoExplore/coordinate/CoordinateBase.hpp>
 #include <GeoExplore/coordinate/CoordinateConversion.hpp>
+#include <GeoExplore/coordinate/CoordinateECEF.hpp>
+#include <GeoExplore/coordinate/CoordinateFrame.hpp>
 #include <GeoExplore/coordinate/CoordinateGeodetic.hpp>
+#include <GeoExplore/coordinate/CoordinateLocal.hpp>
+#include <GeoExplore/coordinate/CoordinateMGRS.hpp>
 #include <GeoExplore/coordinate/CoordinateUTM.hpp>
+#include <GeoExplore/coordinate/GeoidModel.hpp>
 
 /// Image Module
+#include <GeoExplore/image/BandReductions.hpp>
 #include <GeoExplore/image/BaseResource.hpp>
 #include <GeoExplore/image/ChannelType.hpp>
+#include <GeoExplore/image/GeoTransform.hpp>
 #include <GeoExplore/image/Image.hpp>
+#include <GeoExplore/image/ImageSampling.hpp>
+#include <GeoExplore/image/ImageStatistics.hpp>
+#include <GeoExplore/image/MemoryAllocator.hpp>
 #include <GeoExplore/image/MemoryResource.hpp>
 #include <GeoExplore/image/MetadataContainer.hpp>
 #include <GeoExplore/image/MetadataContainerBase.hpp>
+#include <GeoExplore/image/MultibandImage.hpp>
 #include <GeoExplore/image/PixelBase.hpp>
 #include <GeoExplore/image/PixelCast.hpp>
+#include <GeoExplore/image/PixelCopy.hpp>
 #include <GeoExplore/image/PixelGray.hpp>
+#include <GeoExplore/image/PixelN.hpp>
 #include <GeoExplore/image/PixelRGB.hpp>
+#include <GeoExplore/image/PlanarBuffer.hpp>
+#include <GeoExplore/image/PlanarResource.hpp>
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/image/TiledResource.hpp>
+#include <GeoExplore/image/ViewResource.hpp>
 
 /// IO Module
+#include <GeoExplore/io/AsyncTileReader.hpp>
+#include <GeoExplore/io/GDAL_DatasetInfo.hpp>
+#include <GeoExplore/io/GDAL_DatasetPool.hpp>
 #include <GeoExplore/io/GDAL_Driver.hpp>
 #include <GeoExplore/io/ImageDriverBase.hpp>
 #include <GeoExplore/io/ImageIO.hpp>
 #include <GeoExplore/io/NETPBM_Driver.hpp>
 #include <GeoExplore/io/OpenCV_Driver.hpp>
 
+/// Terrain Module
+#include <GeoExplore/terrain/BoundingBox.hpp>
+#include <GeoExplore/terrain/ElevationGrid.hpp>
+#include <GeoExplore/terrain/TerrainMesh.hpp>
+#include <GeoExplore/terrain/TerrainMeshBuilder.hpp>
+#include <GeoExplore/terrain/TerrainMeshCache.hpp>
+#include <GeoExplore/terrain/QuantizedMesh.hpp>
+#include <GeoExplore/terrain/TerrainQuadtree.hpp>
+#include <GeoExplore/terrain/TerrainCulling.hpp>
+#include <GeoExplore/terrain/TileCache.hpp>
+#include <GeoExplore/terrain/TileStreamer.hpp>
+#include <GeoExplore/terrain/VirtualTexture.hpp>
+
 /// Utility Module
+#include <GeoExplore/utilities/BoundedQueue.hpp>
 #include <GeoExplore/utilities/FilesystemUtilities.hpp>
+#include <GeoExplore/utilities/LoaderPool.hpp>
+#include <GeoExplore/utilities/SpaceFillingCurves.hpp>
 #include <GeoExplore/utilities/StringUtilities.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
 
 #endif
@@ -93,6 +93,28 @@ void convert_coordinates( Options const& options ){
 
         }
 
+        // convert the string to mgrs
+        else if( ctype == "-mgrs" ){
+
+            // make sure there is a grid reference
+            if( components.size() < 2 ){
+                throw std::runtime_error("(MGRS) Not enough components in the input line to provide the grid reference.");
+            }
+
+            // set the altitude if given
+            double altitude = 0;
+            if( components.size() >= 3 ){
+                altitude = GEO::str2num<double>(components[2]);
+            }
+
+            // create our coordinate
+            GEO::CoordinateMGRS_d::ptr_t point( new GEO::CoordinateMGRS_d( components[1], altitude ));
+
+            // add the point to our list
+            input_coordinates.push_back(point);
+
+        }
+
         // convert the string to geodetic dm
         else if( ctype == "-geod-dm" ){
             
@@ -143,6 +165,11 @@ void convert_coordinates( Options const& options ){
         else if( converted_coordinate->type() == GEO::CoordinateType::Geodetic ){
             GEO::CoordinateGeodetic_d::ptr_t output = boost::static_pointer_cast<GEO::CoordinateGeodetic_d>(converted_coordinate);
             cout << std::fixed << output->latitude() << "," << output->longitude() << "," << output->altitude() << endl;
+        }
+        // mgrs
+        else if( converted_coordinate->type() == GEO::CoordinateType::MGRS ){
+            GEO::CoordinateMGRS_d::ptr_t output = boost::static_pointer_cast<GEO::CoordinateMGRS_d>(converted_coordinate);
+            cout << output->toString() << "," << (int64_t)output->altitude() << endl;
         } else {
             throw std::runtime_error("Unknown coordinate type");
         }
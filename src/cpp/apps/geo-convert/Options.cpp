@@ -38,7 +38,7 @@ void usage( const std::string& appName ){
     std::cerr << "        -o <value>   : Set the desired output given the conversion type." << std::endl;
     std::cerr << "            Output Formats" << std::endl;
     std::cerr << "                Coordinates:  Specify the output coordinate type." << std::endl;
-    std::cerr << "                -utm, -geod-dd, -geod-dm, -geod-dms" << std::endl;
+    std::cerr << "                -utm, -geod-dd, -geod-dm, -geod-dms, -mgrs" << std::endl;
     std::cerr << std::endl;
     std::cerr << "        Image/Raster Conversion Flags" << std::endl;
     std::cerr << "        -i <filename>   : Set the input image to be converted." << std::endl;
@@ -15,6 +15,11 @@ GEO::CoordinateType String2CoordinateType( std::string const& ctype ){
         return GEO::CoordinateType::UTM;
     }
 
+    // check for mgrs
+    else if( ctype == "-mgrs" ){
+        return GEO::CoordinateType::MGRS;
+    }
+
     // check for geodd
     else if( ctype == "-geod-dd" || "-geod-dm" || "-geod-dms" ){
         return GEO::CoordinateType::Geodetic;
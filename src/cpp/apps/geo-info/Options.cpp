@@ -5,11 +5,28 @@
 */
 #include "Options.hpp"
 
+/// C++ Standard Library
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * Default Constructor
+*/
+Options::Options(){
+    setDefaults();
+}
+
 /**
  * Set Default Options
 */
 void Options::setDefaults(){
-
+    m_inputs.clear();
+    m_recursive = false;
+    m_compute_statistics = false;
+    m_exact_statistics = false;
+    m_thread_count = 0;
 }
 
 /**
@@ -27,7 +44,96 @@ std::string Options::getAppName()const{
 }
 
 /**
- * Parse the Command-Line 
+ * Add an input
+*/
+void Options::addInput( boost::filesystem::path const& input ){
+    m_inputs.push_back( input );
+}
+
+/**
+ * Get the inputs
+*/
+std::vector<boost::filesystem::path> const& Options::getInputs()const{
+    return m_inputs;
+}
+
+/**
+ * Set the recursive flag
+*/
+void Options::setRecursive( const bool& recursive ){
+    m_recursive = recursive;
+}
+
+/**
+ * Get the recursive flag
+*/
+bool Options::getRecursive()const{
+    return m_recursive;
+}
+
+/**
+ * Set the statistics flag
+*/
+void Options::setComputeStatistics( const bool& compute_statistics ){
+    m_compute_statistics = compute_statistics;
+}
+
+/**
+ * Get the statistics flag
+*/
+bool Options::getComputeStatistics()const{
+    return m_compute_statistics;
+}
+
+/**
+ * Set the exact statistics flag
+*/
+void Options::setExactStatistics( const bool& exact_statistics ){
+    m_exact_statistics = exact_statistics;
+}
+
+/**
+ * Get the exact statistics flag
+*/
+bool Options::getExactStatistics()const{
+    return m_exact_statistics;
+}
+
+/**
+ * Set the thread count
+*/
+void Options::setThreadCount( const int& thread_count ){
+    m_thread_count = thread_count;
+}
+
+/**
+ * Get the thread count
+*/
+int Options::getThreadCount()const{
+    return m_thread_count;
+}
+
+/**
+ * Print usage instructions for geo-info
+*/
+void usage( const std::string& appName ){
+
+    std::cerr << "usage: " << appName << " [options] <file or directory> [more files or directories]" << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "    Reports size, bands, data type, block layout, georeferencing, metadata" << std::endl;
+    std::cerr << "    and overviews from the file headers without reading pixels." << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "    optional flags: " << std::endl;
+    std::cerr << "        -r, --recursive : Search directories recursively." << std::endl;
+    std::cerr << "        --stats         : Compute approximate band statistics from overviews or sampling." << std::endl;
+    std::cerr << "        --exact         : Visit every pixel when computing statistics." << std::endl;
+    std::cerr << "        -j <threads>    : Number of files to read at once.  Default is one per core." << std::endl;
+    std::cerr << "        -h, --help      : Print usage instructions." << std::endl;
+    std::cerr << std::endl;
+}
+
+/**
+ * Parse the Command-Line
 */
 Options parse_command_line( int argc, char* argv[] ){
 
@@ -37,8 +143,64 @@ Options parse_command_line( int argc, char* argv[] ){
     // set the app name
     options.setAppName( argv[0] );
 
+    // create a list of arguments to parse
+    std::deque<std::string> args;
+    for( int i=1; i<argc; i++ ){
+        args.push_back(argv[i]);
+    }
+
+    // begin parsing command-line options
+    while( args.size() > 0 ){
+
+        // pop the next argument
+        std::string arg = args.front();
+        args.pop_front();
+
+        // test if help was requested
+        if( arg == "-h" || arg == "--help" ){
+            usage( options.getAppName() );
+            exit(1);
+        }
+
+        // recursive search
+        else if( arg == "-r" || arg == "--recursive" ){
+            options.setRecursive( true );
+        }
+
+        // statistics
+        else if( arg == "--stats" ){
+            options.setComputeStatistics( true );
+        }
+        else if( arg == "--exact" ){
+            options.setExactStatistics( true );
+        }
+
+        // thread count
+        else if( arg == "-j" ){
+            if( args.size() <= 0 ){
+                throw std::runtime_error("Thread count was specified with no argument.");
+            }
+            options.setThreadCount( std::atoi( args.front().c_str() ));
+            args.pop_front();
+        }
+
+        // unknown flags
+        else if( arg.size() > 1 && arg[0] == '-' ){
+            throw std::runtime_error( std::string("Unknown flag ") + arg );
+        }
+
+        // otherwise it is an input
+        else{
+            options.addInput( arg );
+        }
+    }
+
+    // make sure we have something to read
+    if( options.getInputs().empty() ){
+        throw std::runtime_error("No inputs were specified.");
+    }
+
     // return output
     return options;
 
 }
-
@@ -8,14 +8,23 @@
 
 /// C++ Standard Library
 #include <string>
+#include <vector>
+
+/// Boost C++ Library
+#include <boost/filesystem.hpp>
 
 /**
  * Options container
 */
-class Options { 
+class Options {
 
     public:
-        
+
+        /**
+         * Default Constructor
+        */
+        Options();
+
         /**
          * Set the default values
         */
@@ -31,16 +40,85 @@ class Options {
         */
         std::string getAppName()const;
 
+        /**
+         * Add an input file or directory
+        */
+        void addInput( boost::filesystem::path const& input );
+
+        /**
+         * Get the input files and directories
+        */
+        std::vector<boost::filesystem::path> const& getInputs()const;
+
+        /**
+         * Set if directories are searched recursively
+        */
+        void setRecursive( const bool& recursive );
+
+        /**
+         * Check if directories are searched recursively
+        */
+        bool getRecursive()const;
+
+        /**
+         * Set if band statistics are computed
+        */
+        void setComputeStatistics( const bool& compute_statistics );
+
+        /**
+         * Check if band statistics are computed
+        */
+        bool getComputeStatistics()const;
+
+        /**
+         * Set if statistics visit every pixel
+        */
+        void setExactStatistics( const bool& exact_statistics );
+
+        /**
+         * Check if statistics visit every pixel
+        */
+        bool getExactStatistics()const;
+
+        /**
+         * Set the number of worker threads
+        */
+        void setThreadCount( const int& thread_count );
+
+        /**
+         * Get the number of worker threads
+        */
+        int getThreadCount()const;
+
 
     private:
-        
+
         /// Application Name
         std::string m_appName;
 
+        /// Input files and directories
+        std::vector<boost::filesystem::path> m_inputs;
+
+        /// Search directories recursively
+        bool m_recursive;
+
+        /// Compute band statistics
+        bool m_compute_statistics;
+
+        /// Visit every pixel when computing statistics
+        bool m_exact_statistics;
+
+        /// Number of worker threads
+        int m_thread_count;
 
 }; /// End of Options Class
 
 
+/**
+ * Print usage instructions
+*/
+void usage( const std::string& appName );
+
 /**
  * Parse Command-Line Options
 */
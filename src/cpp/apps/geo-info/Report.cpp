@@ -0,0 +1,76 @@
+/**
+ * @file    Report.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "Report.hpp"
+
+/// C++ Standard Library
+#include <iomanip>
+
+/**
+ * Print the information of one file
+*/
+void print_report( std::ostream& output,
+                   GEO::IO::GDAL::DatasetInfo const& info,
+                   std::vector<GEO::BandStatistics> const& statistics ){
+
+    output << info.path.native() << std::endl;
+    if( info.isValid() == false ){
+        output << "    error: " << info.error << std::endl << std::endl;
+        return;
+    }
+
+    // layout
+    output << "    driver      : " << info.driver << std::endl;
+    output << "    size        : " << info.cols << " x " << info.rows << std::endl;
+    output << "    bands       : " << info.bands.size() << std::endl;
+
+    // georeferencing
+    if( info.has_geotransform ){
+        output << std::setprecision(12);
+        output << "    origin      : " << info.geotransform[0] << ", " << info.geotransform[3] << std::endl;
+        output << "    pixel size  : " << info.geotransform[1] << ", " << info.geotransform[5] << std::endl;
+        output << std::setprecision(6);
+    }
+    if( info.projection.empty() == false ){
+        output << "    projection  : " << info.projection << std::endl;
+    }
+
+    // bands
+    for( size_t b=0; b<info.bands.size(); b++ ){
+        GEO::IO::GDAL::BandInfo const& band = info.bands[b];
+        output << "    band " << (b+1) << "      : " << band.data_type << ", "
+               << band.color_interpretation << ", block " << band.block_cols << " x " << band.block_rows
+               << ", " << band.overview_count << " overviews";
+        if( band.has_nodata ){
+            output << ", nodata " << band.nodata_value;
+        }
+        output << std::endl;
+
+        if( b < statistics.size() ){
+            GEO::BandStatistics const& stats = statistics[b];
+            output << "        min " << stats.min << ", max " << stats.max
+                   << ", mean " << stats.mean << ", stddev " << stats.stddev;
+            if( stats.percentiles.size() >= 3 ){
+                output << ", p2 " << stats.percentiles[0] << ", p50 " << stats.percentiles[1] << ", p98 " << stats.percentiles[2];
+            }
+            output << ", samples " << stats.valid_count << std::endl;
+        }
+    }
+
+    // metadata and NITF tagged records
+    if( info.metadata.empty() == false ){
+        output << "    metadata    :" << std::endl;
+        for( size_t i=0; i<info.metadata.size(); i++ ){
+            output << "        " << info.metadata[i].first << " = " << info.metadata[i].second << std::endl;
+        }
+    }
+    if( info.tres.empty() == false ){
+        output << "    TREs        :" << std::endl;
+        for( size_t i=0; i<info.tres.size(); i++ ){
+            output << "        " << info.tres[i].first << " = " << info.tres[i].second << std::endl;
+        }
+    }
+    output << std::endl;
+}
@@ -0,0 +1,27 @@
+/**
+ * @file    Report.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __GEOEXPLORE_APPS_GEOINFO_REPORT_HPP__
+#define __GEOEXPLORE_APPS_GEOINFO_REPORT_HPP__
+
+/// C++ Standard Library
+#include <ostream>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Print the information of one file
+ *
+ * @param[in] output     Stream to print to.
+ * @param[in] info       Header information.
+ * @param[in] statistics Band statistics.  Empty when they were not computed.
+*/
+void print_report( std::ostream& output,
+                   GEO::IO::GDAL::DatasetInfo const& info,
+                   std::vector<GEO::BandStatistics> const& statistics );
+
+#endif
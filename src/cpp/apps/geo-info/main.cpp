@@ -9,16 +9,113 @@
 
 /// GeoInfo Libraries
 #include "Options.hpp"
+#include "Report.hpp"
+
+/// C++ Libraries
+#include <exception>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
 
 
 using namespace std;
 
+/**
+ * Check if a file is a side-car of another raster
+*/
+bool is_sidecar( boost::filesystem::path const& pathname ){
+    static const set<string> extensions = { ".aux", ".hdr", ".ovr", ".prj", ".rrd", ".tfw", ".xml" };
+    return extensions.count( GEO::string_toLower( pathname.extension().string() )) > 0;
+}
+
+/**
+ * Expand the inputs into a list of files
+*/
+vector<boost::filesystem::path> collect_files( Options const& options ){
+
+    vector<boost::filesystem::path> output;
+    for( size_t i=0; i<options.getInputs().size(); i++ ){
+
+        boost::filesystem::path const& input = options.getInputs()[i];
+        if( boost::filesystem::is_directory( input ) == false ){
+            output.push_back( input );
+            continue;
+        }
+
+        // walk the directory
+        if( options.getRecursive() ){
+            boost::filesystem::recursive_directory_iterator it( input ), end;
+            for( ; it != end; it++ ){
+                if( boost::filesystem::is_regular_file( it->status() ) && is_sidecar( it->path() ) == false ){
+                    output.push_back( it->path() );
+                }
+            }
+        } else {
+            boost::filesystem::directory_iterator it( input ), end;
+            for( ; it != end; it++ ){
+                if( boost::filesystem::is_regular_file( it->status() ) && is_sidecar( it->path() ) == false ){
+                    output.push_back( it->path() );
+                }
+            }
+        }
+    }
+    return output;
+}
+
 int main( int argc, char* argv[] ){
 
     /// Parse Command-Line Options
-    Options options = parse_command_line( argc, argv );
+    Options options;
+    try{
+        options = parse_command_line( argc, argv );
+    } catch( exception& e ){
+        cerr << "error: " << e.what() << endl;
+        usage( argv[0] );
+        return 1;
+    }
 
-    return 0;
-}
+    try{
+
+        /// Read the headers of every file in parallel
+        vector<boost::filesystem::path> files = collect_files( options );
+        vector<vector<string> > siblings;
+        vector<GEO::IO::GDAL::DatasetInfo> info = GEO::IO::GDAL::read_dataset_info( files, options.getThreadCount(), &siblings );
 
+        /// Compute statistics
+        vector<vector<GEO::BandStatistics> > statistics( files.size() );
+        vector<string> statistics_errors( files.size() );
+        if( options.getComputeStatistics() ){
+            GEO::StatisticsOptions stats_options;
+            stats_options.approximate = ( options.getExactStatistics() == false );
 
+            // spread files over the threads, or a single file's strips, not both
+            const bool per_file = ( files.size() > 1 );
+            stats_options.num_threads = per_file ? 1 : options.getThreadCount();
+            GEO::parallel_for( 0, files.size(), [&]( const size_t& idx, const int& /*thread_id*/ ){
+                if( info[idx].isValid() == false ){
+                    return;
+                }
+                try{
+                    statistics[idx] = GEO::IO::GDAL::compute_image_statistics<GEO::ChannelTypeDoubleFree>( files[idx], stats_options, &siblings[idx] );
+                } catch( exception& e ){
+                    statistics_errors[idx] = e.what();
+                }
+            }, per_file ? options.getThreadCount() : 1 );
+        }
+
+        /// Print the report in input order
+        for( size_t i=0; i<info.size(); i++ ){
+            print_report( cout, info[i], statistics[i] );
+            if( statistics_errors[i].empty() == false ){
+                cerr << files[i].native() << ": statistics failed: " << statistics_errors[i] << endl;
+            }
+        }
+
+    } catch( exception& e ){
+        cerr << "error: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
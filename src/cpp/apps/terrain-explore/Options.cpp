@@ -9,6 +9,7 @@
 
 /// C++ Headers
 #include <iostream>
+#include <stdexcept>
 
 /**
  * Print Usage Instructions
@@ -16,16 +17,26 @@
 void usage(const std::string& appName)
 {
     std::cout <<
-        "Usage : " << appName << std::endl <<
-        "\tTODO: Add usage message" << std::endl;
+        "Usage : " << appName << " <dem> [texture]" << std::endl <<
+        "\tdem     : Elevation model readable by GDAL" << std::endl <<
+        "\ttexture : Image covering the same area as the elevation model" << std::endl;
 }
 
 /**
  * Parse Command-Line Options
  */
-Options parse_command_line(int /*argc*/, char* /*argv*/[])
+Options parse_command_line(int argc, char* argv[])
 {
-    // TODO
-    return Options();
+    Options options;
+    options.appName = argv[0];
+
+    if ( argc < 2 || argc > 3 )
+        throw std::runtime_error("Expected an elevation model and an optional texture.");
+
+    options.demPath = argv[1];
+    if ( argc > 2 )
+        options.texturePath = argv[2];
+
+    return options;
 }
 
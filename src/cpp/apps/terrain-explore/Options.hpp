@@ -22,6 +22,13 @@ public:
 
     /// Application name
     std::string appName;
+
+    /// Elevation model to explore
+    std::string demPath;
+
+    /// Optional image draped over the elevation model.  It must cover the
+    /// same area as the elevation model.
+    std::string texturePath;
 }; // class Options
 
 /**
@@ -10,24 +10,63 @@
 /// Include Qt5 Headers
 #include <QApplication>
 
+/// Include GLM Headers
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
 /// Include C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <functional>
 #include <iostream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 #include <cstddef> // offsetof
 
 /**
  * Default constructor
  */
-TerrainViewer::TerrainViewer(QWidget* parent) :
+TerrainViewer::TerrainViewer(const Options& options, QWidget* parent) :
     QGLWidget(parent),
+    m_options(options),
+    m_treeReady(false),
+    m_treeFailed(false),
+    m_textureRows(0),
+    m_textureCols(0),
+    m_frame(0),
+    m_program(0),
     m_windowSize(800, 600)
 {
+    m_textureScale[0] = m_textureScale[1] = 1.0;
     setMouseTracking(true);
+
+    // never read the elevation model on the GL thread
+    m_loader = std::thread(&TerrainViewer::loadTerrain, this);
 }
 
 TerrainViewer::~TerrainViewer()
 {
+    if ( m_loader.joinable() )
+        m_loader.join();
+
+    // join the loaders while the objects they read are still alive,
+    // then release them before the GL objects
+    if ( m_streamer )
+        m_streamer->stop();
+    if ( m_virtualTexture )
+        m_virtualTexture->stop();
+    m_streamer.reset();
+    m_virtualTexture.reset();
+    m_meshCache.reset();
+    m_tileCache.reset();
+
+    makeCurrent();
+    m_atlas = GLTexture();
+    m_pageTable = GLTexture();
+    m_gpuTiles.clear();
     glDeleteProgram(m_program);
-    glDeleteBuffers(1, &m_vboGeometry);
 }
 
 QSize TerrainViewer::minimumSizeHint() const
@@ -40,25 +79,113 @@ QSize TerrainViewer::sizeHint() const
     return m_windowSize;
 }
 
-void TerrainViewer::initializeGL()
+void TerrainViewer::loadTerrain()
 {
-    // TODO Mostly Temporary, this is here as a test
-    
-    // Initialize basic geometry and shaders for this example
-    glewInit();
+    try
+    {
+        GEO::Image<GEO::PixelGray_df> dem;
+        GEO::IO::read_image(m_options.demPath, dem);
+
+        // meshes and imagery pages from earlier runs
+        try
+        {
+            m_tileCache.reset(new GEO::TERRAIN::TileCache(
+                boost::filesystem::temp_directory_path() / "terrain-explore", TILE_CACHE_BYTES));
+        }
+        catch (std::exception& e)
+        {
+            std::cerr << "[W] TILE CACHE DISABLED: " << e.what() << std::endl;
+        }
+
+        if ( !m_options.texturePath.empty() )
+        {
+            GEO::IO::GDAL::ImageDriverGDAL texture(m_options.texturePath);
+            texture.open();
+            if ( !texture.isOpen() )
+                throw std::runtime_error("Unable to open " + m_options.texturePath);
+            m_textureRows = texture.rows();
+            m_textureCols = texture.cols();
+            m_textureScale[0] = double(texture.cols()) / dem.cols();
+            m_textureScale[1] = double(texture.rows()) / dem.rows();
+
+            // imagery is paged from the overviews into a fixed size atlas
+            m_virtualTexture.reset(new GEO::TERRAIN::VirtualTexture(m_textureRows, m_textureCols,
+                                                                    VIRTUAL_PAGE_SIZE, VIRTUAL_ATLAS_SLOTS));
+            if ( m_tileCache != nullptr )
+            {
+                std::stringstream settings;
+                settings << "page=" << VIRTUAL_PAGE_SIZE << ",border=" << m_virtualTexture->border();
+                m_virtualTexture->setPageCache(m_tileCache,
+                                               GEO::TERRAIN::dataset_hash(m_options.texturePath, settings.str()));
+            }
+            m_virtualTexture->setPageLoader(std::bind(&TerrainViewer::loadPage, this,
+                                                      std::placeholders::_1, std::placeholders::_2));
+        }
+
+        // meshes are cached per elevation model version and chunk size
+        if ( m_tileCache != nullptr )
+        {
+            std::stringstream settings;
+            settings << "chunk=" << TERRAIN_CHUNK_QUADS;
+            m_meshCache.reset(new GEO::TERRAIN::TerrainMeshCache(m_tileCache,
+                GEO::TERRAIN::dataset_hash(m_options.demPath, settings.str())));
+        }
 
-    //this defines a triangle, feel free to change it
-    // each row is first the position of the vertex then the color
-    Vertex geometry[] = { {{0.0, 0.9, 0.0}, {1.0, 0.0, 0.0}},
-                          {{-0.9, -0.9, 0.0}, {0.0, 1.0, 0.0}},
-                          {{0.9, -0.9, 0.0}, {0.0, 0.0, 1.0}}};
+        // so are the node errors and height ranges, which take seconds to measure
+        std::vector<float> metrics;
+        if ( m_meshCache != nullptr )
+            m_meshCache->loadMetrics(metrics);
+        m_tree.reset(new GEO::TERRAIN::TerrainQuadtree(GEO::TERRAIN::make_elevation_grid(dem),
+                                                       TERRAIN_CHUNK_QUADS, 0, metrics));
+        if ( m_meshCache != nullptr && m_tree->metrics() != metrics )
+            m_meshCache->storeMetrics(m_tree->metrics());
+        m_treeReady = true;
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << "[F] FAILED TO LOAD TERRAIN: " << e.what() << std::endl;
+        m_treeFailed = true;
+    }
+}
+
+void TerrainViewer::loadPage(const GEO::TERRAIN::VirtualPage& page, GEO::TERRAIN::PageBuffer& buffer) const
+{
+    // the page with its border, clipped to the image at its level
+    const int scale = 1 << page.level;
+    const int levelCols = (m_textureCols + scale - 1) / scale;
+    const int levelRows = (m_textureRows + scale - 1) / scale;
+    const GEO::Rect rect = m_virtualTexture->pageRect(page);
+    const int x0 = std::max(rect.x(), 0);
+    const int y0 = std::max(rect.y(), 0);
+    const int x1 = std::min(rect.x() + rect.width(), levelCols);
+    const int y1 = std::min(rect.y() + rect.height(), levelRows);
 
-    // Create a Vertex Buffer object to store this vertex info on the GPU
-    glGenBuffers(1, &m_vboGeometry);
-    glBindBuffer(GL_ARRAY_BUFFER, m_vboGeometry);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(geometry), geometry, GL_STATIC_DRAW);
+    // read the matching overview
+    const GEO::Rect window(x0 * scale, y0 * scale,
+                           std::min((x1 - x0) * scale, m_textureCols - x0 * scale),
+                           std::min((y1 - y0) * scale, m_textureRows - y0 * scale));
+    GEO::Image<GEO::PixelRGB_u8> image;
+    GEO::IO::read_image(m_options.texturePath, window, image, page.level);
+    if ( image.rows() == 0 || image.cols() == 0 )
+        return;
 
-    //--Geometry done
+    // pixels past the image edge repeat the last row and column
+    const int size = m_virtualTexture->slotSize();
+    for ( int r = 0; r < size; ++r )
+    {
+        const int sr = std::max(0, std::min(rect.y() + r - y0, image.rows() - 1));
+        for ( int c = 0; c < size; ++c )
+        {
+            const int sc = std::max(0, std::min(rect.x() + c - x0, image.cols() - 1));
+            for ( int k = 0; k < 3; ++k )
+                buffer.texels[(size_t(r) * size + c) * 3 + k] = image(sr, sc)[k];
+        }
+    }
+}
+
+void TerrainViewer::initializeGL()
+{
+    glewInit();
 
     GLuint vertex_shader = glCreateShader(GL_VERTEX_SHADER);
     GLuint fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
@@ -66,18 +193,48 @@ void TerrainViewer::initializeGL()
     //Shader Sources
     // Put these into files and write a loader in the future
     const char *vs =
-        "attribute vec3 v_position;"
-        "attribute vec3 v_color;"
-        "varying vec3 color;"
+        "attribute vec3 v_position;"   // 16-bit grid fractions
+        "attribute vec2 v_normal;"     // octahedron encoded
+        "uniform mat4 mvp;"
+        "uniform vec3 offset;"
+        "uniform vec3 scale;"
+        "uniform vec2 imageOffset;"    // node corner in imagery uv
+        "uniform vec2 imageScale;"     // node size in imagery uv
+        "varying vec3 normal;"
+        "varying vec2 uv;"
         "void main(void){"
-        "   gl_Position = vec4(v_position, 1.0);"
-        "   color = v_color;"
+        "   gl_Position = mvp * vec4(offset + v_position * scale, 1.0);"
+        "   normal = vec3(v_normal.x, 1.0 - abs(v_normal.x) - abs(v_normal.y), v_normal.y);"
+        "   if (normal.y < 0.0)"
+        "       normal.xz = (1.0 - abs(normal.zx)) * vec2(normal.x >= 0.0 ? 1.0 : -1.0, normal.z >= 0.0 ? 1.0 : -1.0);"
+        "   uv = imageOffset + v_position.xz / 65535.0 * imageScale;"
         "}";
 
     const char *fs =
-        "varying vec3 color;"
+        "uniform sampler2D atlas;"
+        "uniform sampler2D pageTable;"
+        "uniform int useTexture;"
+        "uniform vec2 imageSize;"      // full resolution pixels
+        "uniform vec2 tableSize;"      // page table texels
+        "uniform vec3 atlasLayout;"    // page size, border, atlas size
+        "uniform vec2 pageLevel;"      // level, its first page table row
+        "varying vec3 normal;"
+        "varying vec2 uv;"
+        "vec3 virtualTexture(){"
+        "   vec2 pixel = min(uv * imageSize, imageSize - 0.5);"
+        "   vec2 page = floor(pixel / (atlasLayout.x * exp2(pageLevel.x)));"
+        "   vec4 entry = floor(texture2D(pageTable, (page + vec2(0.5, pageLevel.y + 0.5)) / tableSize) * 255.0 + 0.5);"
+        "   if (entry.a < 128.0)"
+        "       return vec3(0.55, 0.6, 0.45);"
+        // the entry may point at a coarser ancestor page
+        "   vec2 inPage = fract(pixel / (atlasLayout.x * exp2(entry.b)));"
+        "   vec2 texel = entry.rg * (atlasLayout.x + 2.0 * atlasLayout.y) + atlasLayout.y + inPage * atlasLayout.x;"
+        "   return texture2D(atlas, texel / atlasLayout.z).rgb;"
+        "}"
         "void main(void){"
-        "   gl_FragColor = vec4(color.xyz, 1.0);"
+        "   float light = 0.3 + 0.7 * max(dot(normalize(normal), normalize(vec3(0.4, 1.0, -0.3))), 0.0);"
+        "   vec3 color = (useTexture == 1) ? virtualTexture() : vec3(0.55, 0.6, 0.45);"
+        "   gl_FragColor = vec4(color * light, 1.0);"
         "}";
 
     //compile the shaders
@@ -121,65 +278,306 @@ void TerrainViewer::initializeGL()
 
     //Now we set the locations of the attributes and uniforms
     //this allows us to access them easily while rendering
-    m_locPosition = glGetAttribLocation(m_program,
-                    const_cast<const char*>("v_position"));
-    if(m_locPosition == -1)
+    m_locPosition = glGetAttribLocation(m_program, "v_position");
+    m_locNormal = glGetAttribLocation(m_program, "v_normal");
+    m_locMVP = glGetUniformLocation(m_program, "mvp");
+    m_locOffset = glGetUniformLocation(m_program, "offset");
+    m_locScale = glGetUniformLocation(m_program, "scale");
+    m_locUseTexture = glGetUniformLocation(m_program, "useTexture");
+    m_locAtlas = glGetUniformLocation(m_program, "atlas");
+    m_locPageTable = glGetUniformLocation(m_program, "pageTable");
+    m_locImageOffset = glGetUniformLocation(m_program, "imageOffset");
+    m_locImageScale = glGetUniformLocation(m_program, "imageScale");
+    m_locImageSize = glGetUniformLocation(m_program, "imageSize");
+    m_locTableSize = glGetUniformLocation(m_program, "tableSize");
+    m_locAtlasLayout = glGetUniformLocation(m_program, "atlasLayout");
+    m_locPageLevel = glGetUniformLocation(m_program, "pageLevel");
+    if(m_locPosition == -1 || m_locNormal == -1 || m_locMVP == -1 || m_locOffset == -1 || m_locScale == -1)
     {
-        std::cerr << "[F] POSITION NOT FOUND" << std::endl;
+        std::cerr << "[F] SHADER VARIABLES NOT FOUND" << std::endl;
         qApp->quit();
     }
-    
-    m_locColor = glGetAttribLocation(m_program,
-                    const_cast<const char*>("v_color"));
-    if(m_locColor == -1)
+
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+    m_clock.start();
+}
+
+void TerrainViewer::uploadTiles()
+{
+    std::vector<GEO::TERRAIN::TileStagingBuffer::ptr_t> buffers;
+    try
     {
-        std::cerr << "[F] V_COLOR NOT FOUND" << std::endl;
-        qApp->quit();
+        buffers = m_streamer->poll(UPLOAD_BYTES_PER_FRAME);
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << "[E] TILE STREAMING FAILED: " << e.what() << std::endl;
+        return;
+    }
+
+    for ( size_t i = 0; i < buffers.size(); ++i )
+    {
+        // the node was reset, so the next frame that needs it asks again
+        if ( !buffers[i]->error.empty() )
+        {
+            std::cerr << "[E] FAILED TO LOAD TILE " << buffers[i]->node << ": " << buffers[i]->error << std::endl;
+            continue;
+        }
+
+        const GEO::TERRAIN::QuantizedMesh& mesh = *buffers[i]->mesh;
+        GpuTile& tile = m_gpuTiles[buffers[i]->node];
+        tile.indexCount = mesh.indices.size();
+        tile.lastFrame = m_frame;
+        std::copy(mesh.origin, mesh.origin + 3, tile.origin);
+        std::copy(mesh.offset, mesh.offset + 3, tile.offset);
+        std::copy(mesh.scale, mesh.scale + 3, tile.scale);
+
+        // allocate the buffers, then fill them from the staging copy
+        tile.buffers.generate(2);
+        tile.buffers.bind(GL_ARRAY_BUFFER, 0);
+        tile.buffers.setEmpty(mesh.vertices.size() * sizeof(GEO::TERRAIN::QuantizedVertex), GL_STATIC_DRAW, 0);
+        tile.buffers.setSubData(mesh.vertices.data(), 0, mesh.vertices.size(), 0);
+        tile.buffers.bind(GL_ELEMENT_ARRAY_BUFFER, 1);
+        tile.buffers.setEmpty(mesh.indices.size() * sizeof(uint16_t), GL_STATIC_DRAW, 1);
+        tile.buffers.setSubData(mesh.indices.data(), 0, mesh.indices.size(), 1);
+
+    }
+    GLBuffer::unbindBuffers(GL_ARRAY_BUFFER);
+    GLBuffer::unbindBuffers(GL_ELEMENT_ARRAY_BUFFER);
+}
+
+void TerrainViewer::uploadPages()
+{
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    // copy each placed page into its atlas slot
+    std::vector<GEO::TERRAIN::PageBuffer::ptr_t> pages = m_virtualTexture->poll(PAGES_PER_FRAME);
+    const int size = m_virtualTexture->slotSize();
+    const int slots = m_virtualTexture->atlasSlots();
+    const GLsizei dims[] = {size, size};
+    m_atlas.bind(GL_TEXTURE_2D);
+    for ( size_t i = 0; i < pages.size(); ++i )
+    {
+        // the page was reset, so the next frame that needs it asks again
+        if ( !pages[i]->error.empty() )
+        {
+            std::cerr << "[E] FAILED TO LOAD IMAGERY PAGE " << pages[i]->page.level << "/" << pages[i]->page.x
+                      << "/" << pages[i]->page.y << ": " << pages[i]->error << std::endl;
+            continue;
+        }
+
+        const GLint offsets[] = {(pages[i]->slot % slots) * size, (pages[i]->slot / slots) * size};
+        m_atlas.setSubData(pages[i]->texels.data(), offsets, dims, 0, GL_UNSIGNED_BYTE, GL_RGB);
+    }
+
+    // then the page table rows that changed
+    int first, count;
+    if ( m_virtualTexture->takeDirtyRows(first, count) )
+    {
+        const GLint offsets[] = {0, first};
+        const GLsizei rows[] = {m_virtualTexture->tableCols(), count};
+        m_pageTable.bind(GL_TEXTURE_2D);
+        m_pageTable.setSubData(m_virtualTexture->table().data() + size_t(first) * m_virtualTexture->tableCols(),
+                               offsets, rows, 0, GL_UNSIGNED_BYTE, GL_RGBA);
+    }
+    GLTexture::unbindTextures(GL_TEXTURE_2D);
+}
+
+void TerrainViewer::evictTiles()
+{
+    if ( m_gpuTiles.size() <= MAX_GPU_TILES )
+        return;
+
+    // oldest first, never a tile drawn this frame
+    std::vector<std::pair<int, int> > candidates;
+    for ( std::map<int, GpuTile>::iterator it = m_gpuTiles.begin(); it != m_gpuTiles.end(); ++it )
+        if ( it->second.lastFrame < m_frame )
+            candidates.push_back(std::make_pair(it->second.lastFrame, it->first));
+    std::sort(candidates.begin(), candidates.end());
+
+    for ( size_t i = 0; i < candidates.size() && m_gpuTiles.size() > MAX_GPU_TILES; ++i )
+    {
+        const int node = candidates[i].second;
+        m_gpuTiles.erase(node);
+        m_streamer->release(node);
     }
 }
 
 void TerrainViewer::paintGL()
 {
-    /// TODO Mostly temporary. This is here for a test
     //clear the screen
-    glClearColor(1.0, 1.0, 1.0, 1.0);
+    glClearColor(0.6, 0.75, 0.9, 1.0);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    //enable the shader program
-    glUseProgram(m_program);
+    // nothing will ever show up
+    if ( m_treeFailed )
+    {
+        qApp->quit();
+        return;
+    }
+
+    // keep painting until the terrain shows up
+    if ( !m_treeReady )
+    {
+        this->swapBuffers();
+        update();
+        return;
+    }
+    if ( m_streamer == nullptr )
+    {
+        m_streamer.reset(new GEO::TERRAIN::TileStreamer(m_tree));
+        if ( m_meshCache != nullptr )
+            m_streamer->setMeshCache(m_meshCache);
+
+        // the atlas is allocated once and only ever updated
+        if ( m_virtualTexture != nullptr )
+        {
+            const GLsizei atlasDims[] = {m_virtualTexture->atlasSize(), m_virtualTexture->atlasSize()};
+            m_atlas.generate(1);
+            m_atlas.bind(GL_TEXTURE_2D);
+            m_atlas.setSampling(GL_TEXTURE_2D, GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE);
+            m_atlas.setData(static_cast<const GLubyte*>(nullptr), atlasDims, 0, GL_UNSIGNED_BYTE, GL_RGB, GL_RGB8);
+
+            const GLsizei tableDims[] = {m_virtualTexture->tableCols(), m_virtualTexture->tableRows()};
+            m_pageTable.generate(1);
+            m_pageTable.bind(GL_TEXTURE_2D);
+            m_pageTable.setSampling(GL_TEXTURE_2D, GL_NEAREST, GL_NEAREST, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE);
+            m_pageTable.setData(m_virtualTexture->table().data(), tableDims, 0, GL_UNSIGNED_BYTE, GL_RGBA, GL_RGBA8);
+            GLTexture::unbindTextures(GL_TEXTURE_2D);
+        }
+    }
+    ++m_frame;
+
+    // slow orbit above the terrain
+    const GEO::TERRAIN::ElevationGrid& grid = m_tree->builder().getGrid();
+    const GEO::TERRAIN::QuadtreeNode& root = m_tree->node(0);
+    const double sizeX = (grid.cols - 1) * grid.spacing_x;
+    const double sizeZ = (grid.rows - 1) * grid.spacing_y;
+    const double extent = std::max(sizeX, sizeZ);
+    const double angle = 0.05 * m_clock.elapsed() / 1000.0;
+    GEO::TERRAIN::LodView view;
+    view.eye[0] = sizeX / 2 + 0.35 * sizeX * std::cos(angle);
+    view.eye[1] = root.max_height + 0.05 * extent;
+    view.eye[2] = sizeZ / 2 + 0.35 * sizeZ * std::sin(angle);
+    view.viewport_height = height();
 
-    //set up the Vertex Buffer Object so it can be drawn
+    // rendering is relative to the eye to keep float precision
+    const glm::vec3 target(sizeX / 2 - view.eye[0], root.min_height - view.eye[1], sizeZ / 2 - view.eye[2]);
+    const float znear = 0.0005 * extent;
+    const float top = znear * std::tan(view.fov_y / 2);
+    const float right = top * width() / std::max(height(), 1);
+    const glm::mat4 viewProjection = glm::frustum(-right, right, -top, top, znear, float(3 * extent)) *
+                                     glm::lookAt(glm::vec3(0.0f), target, glm::vec3(0.0f, 1.0f, 0.0f));
+
+    // only what is in view and above the horizon is requested and drawn
+    const double forward[3] = {target.x, target.y, target.z};
+    const double up[3] = {0.0, 1.0, 0.0};
+    const GEO::TERRAIN::Frustum frustum(view.eye, forward, up, view.fov_y,
+                                        double(width()) / std::max(height(), 1), znear, 3 * extent);
+    std::vector<int> selected = GEO::TERRAIN::select_visible(*m_tree, view, frustum);
+
+    // request what the view needs and draw the closest thing already uploaded
+    std::set<int> draw;
+    for ( size_t i = 0; i < selected.size(); ++i )
+    {
+        int node = selected[i];
+        if ( m_gpuTiles.count(node) == 0 )
+            m_streamer->request(node);
+        while ( node >= 0 && m_gpuTiles.count(node) == 0 )
+            node = m_tree->node(node).parent;
+        if ( node >= 0 )
+            draw.insert(node);
+    }
+
+    uploadTiles();
+
+    // report the imagery pages each drawn node needs, at the resolution it is seen
+    std::map<int, int> pageLevels;
+    if ( m_virtualTexture != nullptr )
+    {
+        m_virtualTexture->nextFrame();
+        const double texelMeters = grid.spacing_x / m_textureScale[0];
+        for ( std::set<int>::iterator it = draw.begin(); it != draw.end(); ++it )
+        {
+            const GEO::Rect& window = m_tree->node(*it).window;
+            const int level = GEO::TERRAIN::select_page_level(texelMeters, m_tree->bounds(*it).distance(view.eye),
+                                                              view, m_virtualTexture->levels());
+            const int x = std::floor(window.x() * m_textureScale[0]);
+            const int y = std::floor(window.y() * m_textureScale[1]);
+            const int w = std::ceil((window.x() + window.width() - 1) * m_textureScale[0]) - x + 1;
+            const int h = std::ceil((window.y() + window.height() - 1) * m_textureScale[1]) - y + 1;
+            m_virtualTexture->request(level, GEO::Rect(x, y, w, h));
+            pageLevels[*it] = level;
+        }
+        uploadPages();
+    }
+
+    glUseProgram(m_program);
     glEnableVertexAttribArray(m_locPosition);
-    glEnableVertexAttribArray(m_locColor);
-    glBindBuffer(GL_ARRAY_BUFFER, m_vboGeometry);
-
-    //set pointers into the vbo for each of the attributes(position and color)
-    glVertexAttribPointer( m_locPosition,//location of attribute
-                           3,               //number of elements
-                           GL_FLOAT,        //type
-                           GL_FALSE,        //normalized?
-                           sizeof(Vertex),  //stride
-                           0);              //offset
-
-    glVertexAttribPointer( m_locColor,
-                           3,
-                           GL_FLOAT,
-                           GL_FALSE,
-                           sizeof(Vertex),
-                           (void*)offsetof(Vertex,color));
-     
-    glDrawArrays(GL_TRIANGLES, 0, 3);//mode, starting index, count
+    glEnableVertexAttribArray(m_locNormal);
+
+    glUniform1i(m_locUseTexture, m_virtualTexture != nullptr ? 1 : 0);
+    if ( m_virtualTexture != nullptr )
+    {
+        glActiveTexture(GL_TEXTURE0);
+        m_atlas.bind(GL_TEXTURE_2D);
+        glActiveTexture(GL_TEXTURE1);
+        m_pageTable.bind(GL_TEXTURE_2D);
+        glUniform1i(m_locAtlas, 0);
+        glUniform1i(m_locPageTable, 1);
+        glUniform2f(m_locImageSize, m_textureCols, m_textureRows);
+        glUniform2f(m_locTableSize, m_virtualTexture->tableCols(), m_virtualTexture->tableRows());
+        glUniform3f(m_locAtlasLayout, m_virtualTexture->pageSize(), m_virtualTexture->border(),
+                    m_virtualTexture->atlasSize());
+    }
+
+    for ( std::set<int>::iterator it = draw.begin(); it != draw.end(); ++it )
+    {
+        GpuTile& tile = m_gpuTiles[*it];
+        tile.lastFrame = m_frame;
+
+        const glm::vec3 offset(tile.origin[0] - view.eye[0], tile.origin[1] - view.eye[1], tile.origin[2] - view.eye[2]);
+        const glm::mat4 mvp = glm::translate(viewProjection, offset);
+        glUniformMatrix4fv(m_locMVP, 1, GL_FALSE, glm::value_ptr(mvp));
+        glUniform3fv(m_locOffset, 1, tile.offset);
+        glUniform3fv(m_locScale, 1, tile.scale);
+        if ( m_virtualTexture != nullptr )
+        {
+            const GEO::Rect& window = m_tree->node(*it).window;
+            const int level = pageLevels[*it];
+            glUniform2f(m_locImageOffset, window.x() * m_textureScale[0] / m_textureCols,
+                                          window.y() * m_textureScale[1] / m_textureRows);
+            glUniform2f(m_locImageScale, (window.width() - 1) * m_textureScale[0] / m_textureCols,
+                                         (window.height() - 1) * m_textureScale[1] / m_textureRows);
+            glUniform2f(m_locPageLevel, level, m_virtualTexture->tableRowOffset(level));
+        }
+
+        tile.buffers.bind(GL_ARRAY_BUFFER, 0);
+        glVertexAttribPointer(m_locPosition, 3, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(GEO::TERRAIN::QuantizedVertex),
+                              (void*)offsetof(GEO::TERRAIN::QuantizedVertex, position));
+        glVertexAttribPointer(m_locNormal, 2, GL_BYTE, GL_TRUE, sizeof(GEO::TERRAIN::QuantizedVertex),
+                              (void*)offsetof(GEO::TERRAIN::QuantizedVertex, normal));
+        tile.buffers.bind(GL_ELEMENT_ARRAY_BUFFER, 1);
+        glDrawElements(GL_TRIANGLES, tile.indexCount, GL_UNSIGNED_SHORT, 0);
+    }
 
     //clean up
     glDisableVertexAttribArray(m_locPosition);
-    glDisableVertexAttribArray(m_locColor);
+    glDisableVertexAttribArray(m_locNormal);
+    GLBuffer::unbindBuffers(GL_ARRAY_BUFFER);
+    GLBuffer::unbindBuffers(GL_ELEMENT_ARRAY_BUFFER);
+    GLTexture::unbindTextures(GL_TEXTURE_2D);
+    glActiveTexture(GL_TEXTURE0);
+    GLTexture::unbindTextures(GL_TEXTURE_2D);
+
+    evictTiles();
 
     this->swapBuffers();
+    update();
 }
 
 void TerrainViewer::resizeGL(int width, int height)
 {
     glViewport(0, 0, width, height);
 }
-
-
@@ -6,7 +6,41 @@
 
 /// Qt5 Headers
 #include "glincludes.hpp"
+#include "glwrappers/GLTexture.hpp"
 #include <QGLWidget>
+#include <QElapsedTimer>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/// Terrain-Explore Libraries
+#include "Options.hpp"
+
+/// C++ Headers
+#include <atomic>
+#include <map>
+#include <thread>
+
+/// Quads along the edge of a quadtree node mesh
+const int TERRAIN_CHUNK_QUADS = 64;
+
+/// Bytes uploaded to the GPU per frame at most
+const size_t UPLOAD_BYTES_PER_FRAME = 8 << 20;
+
+/// Quadtree nodes kept on the GPU at most
+const size_t MAX_GPU_TILES = 2048;
+
+/// Disk space for cached meshes and imagery pages
+const size_t TILE_CACHE_BYTES = size_t(2) << 30;
+
+/// Imagery page size in pixels
+const int VIRTUAL_PAGE_SIZE = 128;
+
+/// Imagery atlas slots per side, 32x32 pages of 130x130 RGB is about 50 MB
+const int VIRTUAL_ATLAS_SLOTS = 32;
+
+/// Imagery pages uploaded to the GPU per frame at most
+const int PAGES_PER_FRAME = 32;
 
 class TerrainViewer : public QGLWidget
 {
@@ -14,9 +48,11 @@ class TerrainViewer : public QGLWidget
 public:
     /**
      * Default constructor
+     *
+     * Starts loading the elevation model in the background.
      */
-    TerrainViewer(QWidget* parent = nullptr);
-    
+    TerrainViewer(const Options& options, QWidget* parent = nullptr);
+
     /**
      * Destructor
      */
@@ -52,17 +88,111 @@ protected:
 
 private:
 
-    /// TODO These are temporary to test OpenGL. They will be abstracted away later
-    struct Vertex
+    /**
+     * Node uploaded to the GPU
+     */
+    struct GpuTile
     {
-        GLfloat position[3];
-        GLfloat color[3];
+        GLBuffer buffers;       // vertices, indices
+        GLsizei indexCount;
+        double origin[3];
+        float offset[3];        // quantized vertex decoding
+        float scale[3];
+        int lastFrame;
     };
+
+    /**
+     * Read the elevation model and build the quadtree. Runs on m_loader.
+     *
+     * Sets m_treeReady when done, or m_treeFailed on error.
+     */
+    void loadTerrain();
+
+    /**
+     * Read an imagery page from the matching overview. Runs on the virtual texture threads.
+     */
+    void loadPage(const GEO::TERRAIN::VirtualPage& page, GEO::TERRAIN::PageBuffer& buffer) const;
+
+    /**
+     * Copy the pages the virtual texture placed into the atlas, and the page table changes.
+     * Failed pages are logged.
+     */
+    void uploadPages();
+
+    /**
+     * Upload the buffers the streamer finished, within the frame budget.
+     * Failed buffers are logged and their nodes requested again later.
+     */
+    void uploadTiles();
+
+    /**
+     * Drop the least recently drawn tiles above MAX_GPU_TILES
+     */
+    void evictTiles();
+
+    /// Command-line options
+    Options m_options;
+
+    /// Background thread loading the elevation model
+    std::thread m_loader;
+
+    /// Set once m_tree can be used
+    std::atomic<bool> m_treeReady;
+
+    /// Set if the elevation model could not be loaded
+    std::atomic<bool> m_treeFailed;
+
+    /// Level of detail quadtree
+    GEO::TERRAIN::TerrainQuadtree::ptr_t m_tree;
+
+    /// Texture to elevation model size ratio
+    double m_textureScale[2];
+
+    /// Imagery size in pixels
+    int m_textureRows;
+    int m_textureCols;
+
+    /// Builds node meshes in the background
+    GEO::TERRAIN::TileStreamer::ptr_t m_streamer;
+
+    /// Imagery pages, null without imagery
+    GEO::TERRAIN::VirtualTexture::ptr_t m_virtualTexture;
+
+    /// Resident imagery pages and the page table
+    GLTexture m_atlas;
+    GLTexture m_pageTable;
+
+    /// Meshes and imagery pages from earlier runs, null if the cache is unusable
+    GEO::TERRAIN::TileCache::ptr_t m_tileCache;
+
+    /// Built node meshes from earlier runs, null without the tile cache
+    GEO::TERRAIN::TerrainMeshCache::ptr_t m_meshCache;
+
+    /// Nodes on the GPU
+    std::map<int, GpuTile> m_gpuTiles;
+
+    /// Frame counter
+    int m_frame;
+
+    /// Drives the camera
+    QElapsedTimer m_clock;
+
+    /// Terrain shader
     GLuint m_program;
-    GLuint m_vboGeometry;
     GLint m_locPosition;
-    GLint m_locColor;
-    // END TODO
+    GLint m_locNormal;
+    GLint m_locMVP;
+    GLint m_locOffset;
+    GLint m_locScale;
+    GLint m_locUseTexture;
+    GLint m_locAtlas;
+    GLint m_locPageTable;
+    GLint m_locImageOffset;
+    GLint m_locImageScale;
+    GLint m_locImageSize;
+    GLint m_locTableSize;
+    GLint m_locAtlasLayout;
+    GLint m_locPageLevel;
 
     /// Holds the current window size
     QSize m_windowSize;
@@ -4,6 +4,7 @@
 #include <GL/glew.h>
 #include <glm/glm.hpp>
 #include <boost/shared_array.hpp>
+#include <memory>
 
 class GLTexture
 {
@@ -75,8 +76,13 @@ public:
     template <typename T>
     bool setData(const T* data, const GLsizei* dimVals, GLsizei idx = 0, GLenum type = GL_UNSIGNED_BYTE, GLenum format = GL_RGB, GLint internalFormat = GL_RGBA, GLint lod = 0 );
 
+    // Replace a rectangle of an existing 2D texture level. offsets and dimVals are x, y and
+    //     width, height. Used to update atlases without reallocating them.
+    template <typename T>
+    bool setSubData(const T* data, const GLint* offsets, const GLsizei* dimVals, GLsizei idx = 0, GLenum type = GL_UNSIGNED_BYTE, GLenum format = GL_RGB, GLint lod = 0 );
+
     bool loadImageData(const char* filename, GLsizei idx = 0, GLenum internaFormat = GL_RGBA, GLint lod = 0);
-    void setSampling(GLenum target, GLenum minFilter = GL_NEAREST, GLenum magFilter = GL_NEAREST, GLenum wrapS = GL_WRAP_BORDER, GLenum wrapT = GL_WRAP_BORDER);
+    void setSampling(GLenum target, GLenum minFilter = GL_NEAREST, GLenum magFilter = GL_NEAREST, GLenum wrapS = GL_CLAMP_TO_BORDER, GLenum wrapT = GL_CLAMP_TO_BORDER);
     void generateMipMap(GLenum target);
 
     static void unbindTextures(GLenum target);
@@ -164,5 +170,23 @@ bool GLTexture::setData(const T* data, const GLsizei* dimVals, GLsizei idx, GLen
     return true;
 }
 
+template <typename T>
+bool GLTexture::setSubData(const T* data, const GLint* offsets, const GLsizei* dimVals, GLsizei idx, GLenum type, GLenum format, GLint lod)
+{
+    if ( m_texParameters == nullptr || idx >= *m_texCount || m_texParameters[idx].target != GL_TEXTURE_2D )
+        return false;
+
+    glTexSubImage2D(GL_TEXTURE_2D,
+        lod,
+        offsets[0], // x
+        offsets[1], // y
+        dimVals[0], // width
+        dimVals[1], // height
+        format,
+        type,
+        reinterpret_cast<const void*>(data));
+    return true;
+}
+
 #endif // GLTEXTURE_HPP
 
@@ -34,7 +34,7 @@ int main(int argc, char* argv[])
         QApplication app(argc, argv);
 
         /// Create the viewer
-        TerrainViewer viewer;
+        TerrainViewer viewer(options);
         viewer.show();
         viewer.setWindowTitle(QApplication::translate("terrain-explore", "Terrain-Explore"));
 
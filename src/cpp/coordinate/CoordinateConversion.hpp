@@ -8,18 +8,78 @@
 
 /// GeoExplore Libraries
 #include <GeoExplore/coordinate/CoordinateBase.hpp>
+#include <GeoExplore/coordinate/CoordinateECEF.hpp>
 #include <GeoExplore/coordinate/CoordinateGeodetic.hpp>
+#include <GeoExplore/coordinate/CoordinateLocal.hpp>
+#include <GeoExplore/coordinate/CoordinateMGRS.hpp>
 #include <GeoExplore/coordinate/CoordinateUTM.hpp>
+#include <GeoExplore/coordinate/GeoidModel.hpp>
+#include <GeoExplore/core/Exceptions.hpp>
 #include <GeoExplore/io/OGR_Driver.hpp>
 
 /// C++ Libraries
 #include <iostream>
-#include <stdexcept>
 
 namespace GEO{
 
+/**
+ * Check if a coordinate type is Cartesian, ECEF or a local frame
+*/
+inline bool is_cartesian( CoordinateType const& coordinate_type ){
+    return coordinate_type == CoordinateType::ECEF ||
+           coordinate_type == CoordinateType::ENU  ||
+           coordinate_type == CoordinateType::NED;
+}
+
+/**
+ * Get the geoid model used for EGM96 altitudes
+ *
+ * @throws GeneralException if no default model is set.
+*/
+inline GeoidModel::ptr_t egm96_geoid(){
+    GeoidModel::ptr_t geoid = GeoidModel::getDefault();
+    if( !geoid ){
+        throw GeneralException("EGM96 altitudes need a geoid model, see GeoidModel::setDefault.", __FILE__, __LINE__);
+    }
+    return geoid;
+}
+
+/**
+ * Copy a coordinate given a pointer to it
+ *
+ * clone() is not virtual, so the copy is made through the actual type.
+*/
+template<typename DATATYPE>
+typename CoordinateBase<DATATYPE>::ptr_t clone_coordinate( typename CoordinateBase<DATATYPE>::ptr_t const& coordinate ){
+
+    switch( coordinate->type() ){
+        case CoordinateType::ECEF:
+            return boost::static_pointer_cast<CoordinateECEF<DATATYPE> >(coordinate)->clone();
+        case CoordinateType::ENU:
+            return boost::static_pointer_cast<CoordinateENU<DATATYPE> >(coordinate)->clone();
+        case CoordinateType::Geodetic:
+            return boost::static_pointer_cast<CoordinateGeodetic<DATATYPE> >(coordinate)->clone();
+        case CoordinateType::MGRS:
+            return boost::static_pointer_cast<CoordinateMGRS<DATATYPE> >(coordinate)->clone();
+        case CoordinateType::NED:
+            return boost::static_pointer_cast<CoordinateNED<DATATYPE> >(coordinate)->clone();
+        case CoordinateType::UTM:
+            return boost::static_pointer_cast<CoordinateUTM<DATATYPE> >(coordinate)->clone();
+        default:
+            return coordinate->clone();
+    }
+}
+
 /**
  * Convert between coordinate systems given pointers to coordinates
+ *
+ * ENU and NED outputs need a reference coordinate, see the overload below.
+ *
+ * Converting altitudes to or from the EGM96 datum uses the default
+ * GeoidModel.  ECEF, ENU and NED positions are always on the ellipsoid,
+ * so only their datum label changes, and the geoid is applied whenever an
+ * EGM96 coordinate is converted between a Cartesian and a non-Cartesian
+ * type, even without a datum change.
  */
 template<typename DATATYPE>
 typename CoordinateBase<DATATYPE>::ptr_t  convert_coordinate( typename CoordinateBase<DATATYPE>::ptr_t const& coordinate, 
@@ -28,7 +88,30 @@ typename CoordinateBase<DATATYPE>::ptr_t  convert_coordinate( typename Coordinat
 
     // compare before and after types.  Return a copy of the input if the before and after are the same
     if( coordinate->datum() == output_datum &&  coordinate->type() == output_coordinate_type ){
-        return coordinate->clone();
+        return clone_coordinate<DATATYPE>( coordinate );
+    }
+
+    // EGM96 is WGS84 with altitudes above the geoid
+    if( coordinate->datum() != output_datum && ( coordinate->datum() == Datum::EGM96 || output_datum == Datum::EGM96 )){
+
+        GeoidModel::ptr_t geoid = egm96_geoid();
+
+        // the EGM96 geodetic side always has orthometric altitudes, Cartesian
+        // ends are handled by the same datum conversion to or from it
+        typename CoordinateGeodetic<DATATYPE>::ptr_t geodetic;
+        if( coordinate->datum() == Datum::EGM96 ){
+            geodetic = boost::static_pointer_cast<CoordinateGeodetic<DATATYPE> >(
+                            convert_coordinate<DATATYPE>( coordinate, CoordinateType::Geodetic, Datum::EGM96 ));
+            geodetic->altitude() = geoid->toEllipsoidal( geodetic->latitude(), geodetic->longitude(), geodetic->altitude() );
+            geodetic->datum() = Datum::WGS84;
+        }
+        else{
+            geodetic = boost::static_pointer_cast<CoordinateGeodetic<DATATYPE> >(
+                            convert_coordinate<DATATYPE>( coordinate, CoordinateType::Geodetic, Datum::WGS84 ));
+            geodetic->altitude() = geoid->toOrthometric( geodetic->latitude(), geodetic->longitude(), geodetic->altitude() );
+            geodetic->datum() = Datum::EGM96;
+        }
+        return convert_coordinate<DATATYPE>( typename CoordinateBase<DATATYPE>::ptr_t( geodetic ), output_coordinate_type, output_datum );
     }
     
     // check if we have a Geodetic to UTM
@@ -80,9 +163,114 @@ typename CoordinateBase<DATATYPE>::ptr_t  convert_coordinate( typename Coordinat
 
     }
 
+    // Cartesian coordinates pass through geodetic on the input datum
+    if( is_cartesian( coordinate->type() ) || is_cartesian( output_coordinate_type ) ){
+
+        if( coordinate->datum() != output_datum ){
+            throw GeneralException("Datum changes are not supported for Cartesian coordinates.", __FILE__, __LINE__);
+        }
+        if( output_coordinate_type == CoordinateType::ENU || output_coordinate_type == CoordinateType::NED ){
+            throw GeneralException("Local frame outputs need a reference coordinate.", __FILE__, __LINE__);
+        }
+
+        typename CoordinateGeodetic<DATATYPE>::ptr_t geodetic;
+        if( coordinate->type() == CoordinateType::Geodetic ){
+            geodetic = boost::static_pointer_cast<CoordinateGeodetic<DATATYPE> >(coordinate);
+        }
+        else if( coordinate->type() == CoordinateType::ECEF ){
+            geodetic.reset( new CoordinateGeodetic<DATATYPE>( convert_ECEF2Geodetic( *boost::static_pointer_cast<CoordinateECEF<DATATYPE> >(coordinate))));
+        }
+        else if( coordinate->type() == CoordinateType::ENU ){
+            geodetic.reset( new CoordinateGeodetic<DATATYPE>( convert_ENU2Geodetic( *boost::static_pointer_cast<CoordinateENU<DATATYPE> >(coordinate))));
+        }
+        else if( coordinate->type() == CoordinateType::NED ){
+            geodetic.reset( new CoordinateGeodetic<DATATYPE>( convert_NED2Geodetic( *boost::static_pointer_cast<CoordinateNED<DATATYPE> >(coordinate))));
+        }
+        else{
+            geodetic = boost::static_pointer_cast<CoordinateGeodetic<DATATYPE> >(
+                            convert_coordinate<DATATYPE>( coordinate, CoordinateType::Geodetic, output_datum ));
+        }
+
+        // Cartesian positions are above the ellipsoid, EGM96 altitudes above the geoid
+        if( output_datum == Datum::EGM96 && is_cartesian( coordinate->type() ) != is_cartesian( output_coordinate_type )){
+            GeoidModel::ptr_t geoid = egm96_geoid();
+            geodetic.reset( new CoordinateGeodetic<DATATYPE>( *geodetic ));
+            if( is_cartesian( coordinate->type() )){
+                geodetic->altitude() = geoid->toOrthometric( geodetic->latitude(), geodetic->longitude(), geodetic->altitude() );
+            }
+            else{
+                geodetic->altitude() = geoid->toEllipsoidal( geodetic->latitude(), geodetic->longitude(), geodetic->altitude() );
+            }
+        }
+
+        if( output_coordinate_type == CoordinateType::Geodetic ){
+            return geodetic;
+        }
+        if( output_coordinate_type == CoordinateType::ECEF ){
+            return typename CoordinateECEF<DATATYPE>::ptr_t( new CoordinateECEF<DATATYPE>( convert_Geodetic2ECEF( *geodetic )));
+        }
+        return convert_coordinate<DATATYPE>( typename CoordinateBase<DATATYPE>::ptr_t( geodetic ), output_coordinate_type, output_datum );
+    }
+
+    // MGRS is a grid over the input datum
+    if( coordinate->type() == CoordinateType::MGRS || output_coordinate_type == CoordinateType::MGRS ){
+
+        if( coordinate->datum() != output_datum ){
+            throw GeneralException("Datum changes are not supported for MGRS coordinates.", __FILE__, __LINE__);
+        }
+
+        if( coordinate->type() == CoordinateType::Geodetic && output_coordinate_type == CoordinateType::MGRS ){
+            typename CoordinateGeodetic<DATATYPE>::ptr_t input = boost::static_pointer_cast<CoordinateGeodetic<DATATYPE> >(coordinate);
+            return typename CoordinateMGRS<DATATYPE>::ptr_t( new CoordinateMGRS<DATATYPE>( convert_Geodetic2MGRS( *input, 5 )));
+        }
+        if( coordinate->type() == CoordinateType::UTM && output_coordinate_type == CoordinateType::MGRS ){
+            typename CoordinateUTM<DATATYPE>::ptr_t input = boost::static_pointer_cast<CoordinateUTM<DATATYPE> >(coordinate);
+            return typename CoordinateMGRS<DATATYPE>::ptr_t( new CoordinateMGRS<DATATYPE>( convert_UTM2MGRS( *input, 5 )));
+        }
+        if( coordinate->type() == CoordinateType::MGRS && output_coordinate_type == CoordinateType::Geodetic ){
+            typename CoordinateMGRS<DATATYPE>::ptr_t input = boost::static_pointer_cast<CoordinateMGRS<DATATYPE> >(coordinate);
+            return typename CoordinateGeodetic<DATATYPE>::ptr_t( new CoordinateGeodetic<DATATYPE>( convert_MGRS2Geodetic( *input )));
+        }
+        if( coordinate->type() == CoordinateType::MGRS && output_coordinate_type == CoordinateType::UTM ){
+            typename CoordinateMGRS<DATATYPE>::ptr_t input = boost::static_pointer_cast<CoordinateMGRS<DATATYPE> >(coordinate);
+            return typename CoordinateUTM<DATATYPE>::ptr_t( new CoordinateUTM<DATATYPE>( convert_MGRS2UTM( *input )));
+        }
+    }
+
     // otherwise, throw an error
-    throw std::runtime_error("Conversion type currently not supported.");
+    throw GeneralException("Conversion type currently not supported.", __FILE__, __LINE__);
+
+}
+
+/**
+ * Convert between coordinate systems given pointers to coordinates, with
+ * the reference of ENU and NED outputs
+ *
+ * @param[in] coordinate             Coordinate to convert.
+ * @param[in] output_coordinate_type Output type.
+ * @param[in] reference              Origin of local frame outputs.  Its datum is the output datum.
+*/
+template<typename DATATYPE>
+typename CoordinateBase<DATATYPE>::ptr_t  convert_coordinate( typename CoordinateBase<DATATYPE>::ptr_t const& coordinate,
+                                                              CoordinateType const& output_coordinate_type,
+                                                              CoordinateGeodetic<DATATYPE> const& reference ){
+
+    if( output_coordinate_type != CoordinateType::ENU && output_coordinate_type != CoordinateType::NED ){
+        return convert_coordinate<DATATYPE>( coordinate, output_coordinate_type, reference.datum() );
+    }
+
+    // the frame is built from the reference altitude above the ellipsoid
+    if( reference.datum() == Datum::EGM96 ){
+        throw GeneralException("Local frame references must have ellipsoidal altitudes, not EGM96.", __FILE__, __LINE__);
+    }
+
+    typename CoordinateGeodetic<DATATYPE>::ptr_t geodetic = boost::static_pointer_cast<CoordinateGeodetic<DATATYPE> >(
+                            convert_coordinate<DATATYPE>( coordinate, CoordinateType::Geodetic, reference.datum() ));
 
+    if( output_coordinate_type == CoordinateType::ENU ){
+        return typename CoordinateENU<DATATYPE>::ptr_t( new CoordinateENU<DATATYPE>( convert_Geodetic2ENU( *geodetic, reference )));
+    }
+    return typename CoordinateNED<DATATYPE>::ptr_t( new CoordinateNED<DATATYPE>( convert_Geodetic2NED( *geodetic, reference )));
 }
 
 
@@ -208,6 +396,226 @@ CoordinateGeodetic<DATATYPE> convert_coordinate( CoordinateUTM<DATATYPE> const&
 }
 
 
+/**
+ * Convert from Geodetic to MGRS
+ *
+ * The grid is computed on the WGS84 ellipsoid.  The datum and altitude are
+ * carried over unchanged.
+ *
+ * @param[in] coordinate Lat/Lon coordinate to convert
+ * @param[in] precision  Number of digits per axis, 0 to 5.
+ *
+ * @return MGRS coordinate.
+*/
+template<typename DATATYPE>
+CoordinateMGRS<DATATYPE> convert_Geodetic2MGRS( CoordinateGeodetic<DATATYPE> const& coordinate, const int& precision = 5 ){
+
+    CoordinateMGRS<DATATYPE> output( coordinate.datum() );
+    output.altitude()  = coordinate.altitude();
+    output.precision() = precision;
+
+    double easting, northing;
+    if( geodetic_to_mgrs( coordinate.latitude(), coordinate.longitude(), output.zone(), output.band(),
+                          output.column(), output.row(), easting, northing ) == false ){
+        throw GeneralException("Coordinate cannot be expressed in MGRS.", __FILE__, __LINE__);
+    }
+    output.easting()  = easting;
+    output.northing() = northing;
+    return output;
+}
+
+/**
+ * Convert from MGRS to Geodetic
+ *
+ * @return South-west corner of the MGRS square.
+*/
+template<typename DATATYPE>
+CoordinateGeodetic<DATATYPE> convert_MGRS2Geodetic( CoordinateMGRS<DATATYPE> const& coordinate ){
+
+    double latitude, longitude;
+    if( mgrs_to_geodetic( coordinate.zone(), coordinate.band(), coordinate.column(), coordinate.row(),
+                          coordinate.easting(), coordinate.northing(), latitude, longitude ) == false ){
+        throw GeneralException("Invalid MGRS coordinate " + coordinate.toString(), __FILE__, __LINE__);
+    }
+    return CoordinateGeodetic<DATATYPE>( latitude, longitude, coordinate.altitude(), coordinate.datum() );
+}
+
+/**
+ * Convert from UTM to MGRS
+ *
+ * The coordinate keeps its UTM zone.  Southern hemisphere coordinates are
+ * recognized by their negative northing, as in convert_UTM2Geodetic.
+*/
+template<typename DATATYPE>
+CoordinateMGRS<DATATYPE> convert_UTM2MGRS( CoordinateUTM<DATATYPE> const& coordinate, const int& precision = 5 ){
+
+    CoordinateMGRS<DATATYPE> output( coordinate.datum() );
+    output.altitude()  = coordinate.altitude();
+    output.zone()      = coordinate.zone();
+    output.precision() = precision;
+
+    const bool north = coordinate.northing() >= 0;
+    double easting, northing;
+    if( coordinate.zone() <= 0 ||
+        utm_ups_to_mgrs( coordinate.zone(), north, coordinate.easting(),
+                         north ? coordinate.northing() : coordinate.northing() + 10000000.0,
+                         output.band(), output.column(), output.row(), easting, northing ) == false ){
+        throw GeneralException("Coordinate cannot be expressed in MGRS.", __FILE__, __LINE__);
+    }
+    output.easting()  = easting;
+    output.northing() = northing;
+    return output;
+}
+
+/**
+ * Convert from MGRS to UTM
+ *
+ * Southern hemisphere northings are negative, as expected by
+ * convert_UTM2Geodetic.
+ *
+ * @throws GeneralException for polar coordinates, which have no UTM zone.
+*/
+template<typename DATATYPE>
+CoordinateUTM<DATATYPE> convert_MGRS2UTM( CoordinateMGRS<DATATYPE> const& coordinate ){
+
+    if( coordinate.isPolar() ){
+        throw GeneralException("Polar MGRS coordinates have no UTM zone.", __FILE__, __LINE__);
+    }
+
+    bool north;
+    double easting, northing;
+    if( mgrs_to_utm_ups( coordinate.zone(), coordinate.band(), coordinate.column(), coordinate.row(),
+                         coordinate.easting(), coordinate.northing(), north, easting, northing ) == false ){
+        throw GeneralException("Invalid MGRS coordinate " + coordinate.toString(), __FILE__, __LINE__);
+    }
+    return CoordinateUTM<DATATYPE>( coordinate.zone(), easting, north ? northing : northing - 10000000.0,
+                                    coordinate.altitude(), coordinate.datum() );
+}
+
+/**
+ * Convert from Geodetic to ECEF
+ *
+ * Computed on the WGS84 ellipsoid.  The datum is carried over unchanged.
+*/
+template<typename DATATYPE>
+CoordinateECEF<DATATYPE> convert_Geodetic2ECEF( CoordinateGeodetic<DATATYPE> const& coordinate ){
+
+    double x, y, z;
+    geodetic_to_ecef( coordinate.latitude(), coordinate.longitude(), coordinate.altitude(), x, y, z );
+    return CoordinateECEF<DATATYPE>( x, y, z, coordinate.datum() );
+}
+
+/**
+ * Convert from ECEF to Geodetic
+*/
+template<typename DATATYPE>
+CoordinateGeodetic<DATATYPE> convert_ECEF2Geodetic( CoordinateECEF<DATATYPE> const& coordinate ){
+
+    double latitude, longitude, altitude;
+    ecef_to_geodetic( coordinate.x(), coordinate.y(), coordinate.z(), latitude, longitude, altitude );
+    return CoordinateGeodetic<DATATYPE>( latitude, longitude, altitude, coordinate.datum() );
+}
+
+/**
+ * Convert from ECEF to ENU
+ *
+ * @param[in] coordinate ECEF coordinate to convert.
+ * @param[in] reference  Origin of the frame.
+*/
+template<typename DATATYPE>
+CoordinateENU<DATATYPE> convert_ECEF2ENU( CoordinateECEF<DATATYPE> const& coordinate,
+                                          CoordinateGeodetic<DATATYPE> const& reference ){
+
+    double east, north, up;
+    CoordinateENU<DATATYPE> output( reference );
+    output.frame().fromECEF( coordinate.x(), coordinate.y(), coordinate.z(), east, north, up );
+    output.east()  = east;
+    output.north() = north;
+    output.up()    = up;
+    return output;
+}
+
+/**
+ * Convert from ENU to ECEF
+*/
+template<typename DATATYPE>
+CoordinateECEF<DATATYPE> convert_ENU2ECEF( CoordinateENU<DATATYPE> const& coordinate ){
+
+    double x, y, z;
+    coordinate.frame().toECEF( coordinate.east(), coordinate.north(), coordinate.up(), x, y, z );
+    return CoordinateECEF<DATATYPE>( x, y, z, coordinate.datum() );
+}
+
+/**
+ * Convert from ECEF to NED
+ *
+ * @param[in] coordinate ECEF coordinate to convert.
+ * @param[in] reference  Origin of the frame.
+*/
+template<typename DATATYPE>
+CoordinateNED<DATATYPE> convert_ECEF2NED( CoordinateECEF<DATATYPE> const& coordinate,
+                                          CoordinateGeodetic<DATATYPE> const& reference ){
+
+    double north, east, down;
+    CoordinateNED<DATATYPE> output( reference );
+    output.frame().fromECEF( coordinate.x(), coordinate.y(), coordinate.z(), north, east, down );
+    output.north() = north;
+    output.east()  = east;
+    output.down()  = down;
+    return output;
+}
+
+/**
+ * Convert from NED to ECEF
+*/
+template<typename DATATYPE>
+CoordinateECEF<DATATYPE> convert_NED2ECEF( CoordinateNED<DATATYPE> const& coordinate ){
+
+    double x, y, z;
+    coordinate.frame().toECEF( coordinate.north(), coordinate.east(), coordinate.down(), x, y, z );
+    return CoordinateECEF<DATATYPE>( x, y, z, coordinate.datum() );
+}
+
+/**
+ * Convert from Geodetic to ENU
+ *
+ * @param[in] coordinate Lat/Lon coordinate to convert.
+ * @param[in] reference  Origin of the frame.
+*/
+template<typename DATATYPE>
+CoordinateENU<DATATYPE> convert_Geodetic2ENU( CoordinateGeodetic<DATATYPE> const& coordinate,
+                                              CoordinateGeodetic<DATATYPE> const& reference ){
+    return convert_ECEF2ENU( convert_Geodetic2ECEF( coordinate ), reference );
+}
+
+/**
+ * Convert from ENU to Geodetic
+*/
+template<typename DATATYPE>
+CoordinateGeodetic<DATATYPE> convert_ENU2Geodetic( CoordinateENU<DATATYPE> const& coordinate ){
+    return convert_ECEF2Geodetic( convert_ENU2ECEF( coordinate ));
+}
+
+/**
+ * Convert from Geodetic to NED
+ *
+ * @param[in] coordinate Lat/Lon coordinate to convert.
+ * @param[in] reference  Origin of the frame.
+*/
+template<typename DATATYPE>
+CoordinateNED<DATATYPE> convert_Geodetic2NED( CoordinateGeodetic<DATATYPE> const& coordinate,
+                                              CoordinateGeodetic<DATATYPE> const& reference ){
+    return convert_ECEF2NED( convert_Geodetic2ECEF( coordinate ), reference );
+}
+
+/**
+ * Convert from NED to Geodetic
+*/
+template<typename DATATYPE>
+CoordinateGeodetic<DATATYPE> convert_NED2Geodetic( CoordinateNED<DATATYPE> const& coordinate ){
+    return convert_ECEF2Geodetic( convert_NED2ECEF( coordinate ));
+}
+
 
 } /// End of GEO Namespace
 
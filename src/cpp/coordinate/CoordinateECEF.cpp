@@ -0,0 +1,156 @@
+/**
+ * @file    CoordinateECEF.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "CoordinateECEF.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+
+/// GeoExplore Libraries
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+
+/// WGS84 ellipsoid
+static const double WGS84_A  = 6378137.0;
+static const double WGS84_F  = 1.0 / 298.257223563;
+static const double WGS84_E2 = WGS84_F * ( 2 - WGS84_F );
+static const double WGS84_E4 = WGS84_E2 * WGS84_E2;
+
+/// Degree conversions
+static const double DEG2RAD = M_PI / 180.0;
+static const double RAD2DEG = 180.0 / M_PI;
+
+/// Coordinates are processed in blocks of this many by the batch functions
+static const size_t BATCH_BLOCK = 4096;
+
+/**
+ * Convert a geodetic coordinate to ECEF
+*/
+void geodetic_to_ecef( const double& latitude,
+                       const double& longitude,
+                       const double& altitude,
+                       double&       x,
+                       double&       y,
+                       double&       z ){
+
+    const double sin_lat = std::sin( latitude  * DEG2RAD );
+    const double cos_lat = std::cos( latitude  * DEG2RAD );
+    const double sin_lon = std::sin( longitude * DEG2RAD );
+    const double cos_lon = std::cos( longitude * DEG2RAD );
+
+    // prime vertical radius of curvature
+    const double N = WGS84_A / std::sqrt( 1 - WGS84_E2 * sin_lat * sin_lat );
+
+    x = ( N + altitude ) * cos_lat * cos_lon;
+    y = ( N + altitude ) * cos_lat * sin_lon;
+    z = ( N * ( 1 - WGS84_E2 ) + altitude ) * sin_lat;
+}
+
+/**
+ * Convert an ECEF coordinate to geodetic
+*/
+void ecef_to_geodetic( const double& x,
+                       const double& y,
+                       const double& z,
+                       double&       latitude,
+                       double&       longitude,
+                       double&       altitude ){
+
+    const double rho2 = x*x + y*y;
+    const double p = rho2 / ( WGS84_A * WGS84_A );
+    const double q = ( 1 - WGS84_E2 ) * z * z / ( WGS84_A * WGS84_A );
+    const double r = ( p + q - WGS84_E4 ) / 6;
+    const double evolute = 8 * r*r*r + WGS84_E4 * p * q;
+
+    longitude = std::atan2( y, x ) * RAD2DEG;
+
+    // on the equatorial disc inside the evolute the nearest point of the
+    // ellipsoid is off the equator, at parametric latitude beta
+    if( evolute <= 0 && q == 0 ){
+        const double b = WGS84_A * std::sqrt( 1 - WGS84_E2 );
+        const double cos_beta = std::sqrt( p ) / WGS84_E2;
+        const double sin_beta = std::sqrt( 1 - cos_beta * cos_beta );
+        latitude = std::atan2( WGS84_A * sin_beta, b * cos_beta ) * RAD2DEG;
+        altitude = -b / WGS84_A * std::sqrt( b * b * cos_beta * cos_beta + WGS84_A * WGS84_A * sin_beta * sin_beta );
+        return;
+    }
+
+    double u;
+    if( evolute > 0 ){
+        const double rad1 = std::sqrt( evolute );
+        const double rad2 = std::sqrt( WGS84_E4 * p * q );
+
+        // away from the evolute the second cube root cancels badly, use
+        // (rad1 + rad2)(rad1 - rad2) = 8 r^3 instead
+        if( evolute > 10 * WGS84_E2 ){
+            const double rad3 = std::cbrt( ( rad1 + rad2 ) * ( rad1 + rad2 ));
+            u = r + 0.5 * rad3 + 2 * r * r / rad3;
+        }
+        else{
+            u = r + 0.5 * std::cbrt( ( rad1 + rad2 ) * ( rad1 + rad2 ))
+                  + 0.5 * std::cbrt( ( rad1 - rad2 ) * ( rad1 - rad2 ));
+        }
+    }
+    else{
+        const double rad1 = std::sqrt( -evolute );
+        const double rad2 = std::sqrt( -8 * r*r*r );
+        const double rad3 = std::sqrt( WGS84_E4 * p * q );
+        const double angle = std::atan2( rad3, rad1 + rad2 ) * 2 / 3;
+        u = -4 * r * std::sin( angle ) * std::cos( M_PI / 6 + angle );
+    }
+
+    const double v = std::sqrt( u * u + WGS84_E4 * q );
+    const double w = WGS84_E2 * ( u + v - q ) / ( 2 * v );
+    const double k = ( u + v ) / ( std::sqrt( w * w + u + v ) + w );
+    const double D = k * std::sqrt( rho2 ) / ( k + WGS84_E2 );
+    const double hypot_Dz = std::sqrt( D * D + z * z );
+
+    latitude = 2 * std::atan2( z, hypot_Dz + D ) * RAD2DEG;
+    altitude = ( k + WGS84_E2 - 1 ) / k * hypot_Dz;
+}
+
+/**
+ * Convert geodetic coordinates to ECEF
+*/
+void geodetic_to_ecef( const size_t& count,
+                       const double* latitudes,
+                       const double* longitudes,
+                       const double* altitudes,
+                       double*       x,
+                       double*       y,
+                       double*       z,
+                       int           num_threads ){
+
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        const size_t end = std::min( count, ( block + 1 ) * BATCH_BLOCK );
+        for( size_t i=block*BATCH_BLOCK; i<end; i++ ){
+            geodetic_to_ecef( latitudes[i], longitudes[i], altitudes[i], x[i], y[i], z[i] );
+        }
+    }, num_threads );
+}
+
+/**
+ * Convert ECEF coordinates to geodetic
+*/
+void ecef_to_geodetic( const size_t& count,
+                       const double* x,
+                       const double* y,
+                       const double* z,
+                       double*       latitudes,
+                       double*       longitudes,
+                       double*       altitudes,
+                       int           num_threads ){
+
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        const size_t end = std::min( count, ( block + 1 ) * BATCH_BLOCK );
+        for( size_t i=block*BATCH_BLOCK; i<end; i++ ){
+            ecef_to_geodetic( x[i], y[i], z[i], latitudes[i], longitudes[i], altitudes[i] );
+        }
+    }, num_threads );
+}
+
+} /// End of GEO Namespace
@@ -0,0 +1,204 @@
+/**
+ * @file    CoordinateECEF.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_COORDINATE_COORDINATEECEF_HPP__
+#define __SRC_CPP_COORDINATE_COORDINATEECEF_HPP__
+
+/// C++ Standard Libraries
+#include <cstddef>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Enumerations.hpp>
+#include <GeoExplore/coordinate/CoordinateBase.hpp>
+
+namespace GEO{
+
+/**
+ * Convert a geodetic coordinate to Earth-Centered, Earth-Fixed
+ *
+ * Computed on the WGS84 ellipsoid.
+ *
+ * @param[in]  latitude  Latitude in degrees.
+ * @param[in]  longitude Longitude in degrees.
+ * @param[in]  altitude  Height above the ellipsoid in meters.
+ * @param[out] x         X in meters, towards the prime meridian on the equator.
+ * @param[out] y         Y in meters, towards 90 degrees east on the equator.
+ * @param[out] z         Z in meters, towards the north pole.
+*/
+void geodetic_to_ecef( const double& latitude,
+                       const double& longitude,
+                       const double& altitude,
+                       double&       x,
+                       double&       y,
+                       double&       z );
+
+/**
+ * Convert an Earth-Centered, Earth-Fixed coordinate to geodetic
+ *
+ * Uses the closed form solution of Vermeille, "An analytical method to
+ * transform geocentric into geodetic coordinates", 2011, which needs no
+ * iteration and is exact everywhere, including near the center of the
+ * Earth.  Computed on the WGS84 ellipsoid.
+ *
+ * @param[out] latitude  Latitude in degrees.
+ * @param[out] longitude Longitude in degrees, in [-180,180].
+ * @param[out] altitude  Height above the ellipsoid in meters.
+*/
+void ecef_to_geodetic( const double& x,
+                       const double& y,
+                       const double& z,
+                       double&       latitude,
+                       double&       longitude,
+                       double&       altitude );
+
+/**
+ * Convert geodetic coordinates to Earth-Centered, Earth-Fixed
+ *
+ * Arrays are processed in blocks split across threads.  Outputs may not
+ * alias inputs.
+ *
+ * @param[in]  count       Number of coordinates.
+ * @param[in]  num_threads Number of threads.  Values <= 0 use the default.
+*/
+void geodetic_to_ecef( const size_t& count,
+                       const double* latitudes,
+                       const double* longitudes,
+                       const double* altitudes,
+                       double*       x,
+                       double*       y,
+                       double*       z,
+                       int           num_threads = 0 );
+
+/**
+ * Convert Earth-Centered, Earth-Fixed coordinates to geodetic
+ *
+ * Arrays are processed in blocks split across threads.  Outputs may not
+ * alias inputs.
+ *
+ * @param[in]  count       Number of coordinates.
+ * @param[in]  num_threads Number of threads.  Values <= 0 use the default.
+*/
+void ecef_to_geodetic( const size_t& count,
+                       const double* x,
+                       const double* y,
+                       const double* z,
+                       double*       latitudes,
+                       double*       longitudes,
+                       double*       altitudes,
+                       int           num_threads = 0 );
+
+
+/**
+ * @class CoordinateECEF
+ *
+ * Earth-Centered, Earth-Fixed Cartesian coordinate in meters.  The height
+ * is part of the position, so the altitude of the base class is unused.
+*/
+template <typename DATATYPE>
+class CoordinateECEF : public CoordinateBase<DATATYPE>{
+
+    public:
+
+        /// Typedef the datatype
+        typedef DATATYPE datatype;
+
+        /// Create the pointer type
+        typedef boost::shared_ptr<CoordinateECEF<DATATYPE> > ptr_t;
+
+        /**
+         * Default Constructor.  The center of the Earth.
+        */
+        CoordinateECEF() : CoordinateBase<DATATYPE>(0, Datum::WGS84),
+                           m_x(0),
+                           m_y(0),
+                           m_z(0){}
+
+        /**
+         * Datum Constructor
+         *
+         * @param[in] datum Datum
+        */
+        CoordinateECEF( Datum const& datum ) : CoordinateBase<DATATYPE>(0, datum),
+                                               m_x(0),
+                                               m_y(0),
+                                               m_z(0){}
+
+        /**
+         * Parameterized Constructor
+        */
+        CoordinateECEF( datatype const& x,
+                        datatype const& y,
+                        datatype const& z,
+                        Datum const&    datum = Datum::WGS84 ) :
+                                CoordinateBase<DATATYPE>(0, datum),
+                                m_x(x),
+                                m_y(y),
+                                m_z(z){}
+
+        /**
+         * Get the x value
+        */
+        datatype x()const{ return m_x; }
+
+        /**
+         * Set the x value
+        */
+        datatype& x(){ return m_x; }
+
+        /**
+         * Get the y value
+        */
+        datatype y()const{ return m_y; }
+
+        /**
+         * Set the y value
+        */
+        datatype& y(){ return m_y; }
+
+        /**
+         * Get the z value
+        */
+        datatype z()const{ return m_z; }
+
+        /**
+         * Set the z value
+        */
+        datatype& z(){ return m_z; }
+
+        /**
+         * Clone the coordinate
+        */
+        typename CoordinateECEF<DATATYPE>::ptr_t clone()const{
+            return typename CoordinateECEF<DATATYPE>::ptr_t( new CoordinateECEF<DATATYPE>( m_x, m_y, m_z, this->datum() ));
+        }
+
+        /**
+         * Get the coordinate type
+        */
+        virtual CoordinateType type(){ return CoordinateType::ECEF; }
+
+    protected:
+
+        /// X in meters
+        datatype m_x;
+
+        /// Y in meters
+        datatype m_y;
+
+        /// Z in meters
+        datatype m_z;
+
+}; /// End of CoordinateECEF Class
+
+/// Common Typedefs
+typedef CoordinateECEF<double> CoordinateECEFDouble;
+typedef CoordinateECEF<double> CoordinateECEF_d;
+
+} /// End of GEO Namespace
+
+#endif
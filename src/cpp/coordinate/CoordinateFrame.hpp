@@ -0,0 +1,89 @@
+/**
+ * @file    CoordinateFrame.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#ifndef __SRC_COORDINATE_COORDINATEFRAME_HPP__
+#define __SRC_COORDINATE_COORDINATEFRAME_HPP__
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Enumerations.hpp>
+
+namespace GEO{
+
+/**
+ * @class CoordinateFrame
+ *
+ * Description of the space a set of coordinates lives in.  Geodetic
+ * frames store longitude as x and latitude as y.  UTM frames store
+ * easting as x and northing as y in a single zone.
+ */
+class CoordinateFrame{
+
+    public:
+
+        /**
+         * Default Constructor.  Geodetic WGS84.
+        */
+        CoordinateFrame() : type(CoordinateType::Geodetic),
+                            datum(Datum::WGS84),
+                            zone(0),
+                            north(true){}
+
+        /**
+         * Geodetic Frame Constructor
+         *
+         * @param[in] datum_ Datum
+        */
+        CoordinateFrame( Datum const& datum_ ) : type(CoordinateType::Geodetic),
+                                                 datum(datum_),
+                                                 zone(0),
+                                                 north(true){}
+
+        /**
+         * UTM Frame Constructor
+         *
+         * @param[in] zone_  UTM zone
+         * @param[in] north_ True for the northern hemisphere
+         * @param[in] datum_ Datum
+        */
+        CoordinateFrame( const int& zone_, const bool& north_, Datum const& datum_ = Datum::WGS84 ) :
+                                                 type(CoordinateType::UTM),
+                                                 datum(datum_),
+                                                 zone(zone_),
+                                                 north(north_){}
+
+        /**
+         * Compare frames
+        */
+        bool operator == ( CoordinateFrame const& rhs )const{
+            if( type != rhs.type || datum != rhs.datum ){
+                return false;
+            }
+            return type != CoordinateType::UTM || ( zone == rhs.zone && north == rhs.north );
+        }
+
+        /**
+         * Compare frames
+        */
+        bool operator != ( CoordinateFrame const& rhs )const{
+            return !( *this == rhs );
+        }
+
+        /// Coordinate type, Geodetic or UTM
+        CoordinateType type;
+
+        /// Datum
+        Datum datum;
+
+        /// UTM zone
+        int zone;
+
+        /// UTM hemisphere
+        bool north;
+
+}; /// End of CoordinateFrame Class
+
+} /// End of GEO Namespace
+
+#endif
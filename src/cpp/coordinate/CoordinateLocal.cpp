@@ -0,0 +1,197 @@
+/**
+ * @file    CoordinateLocal.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "CoordinateLocal.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+
+/// Degree conversions
+static const double DEG2RAD = M_PI / 180.0;
+
+/// Coordinates are processed in blocks of this many by the batch functions
+static const size_t BATCH_BLOCK = 4096;
+
+/**
+ * Rotate and translate a block of points
+ *
+ * The matrix and offsets are copied to locals so the compiler can keep
+ * them in registers and vectorize the loop.
+ *
+ * @param[in] inverse True to rotate by the transpose and add the origin,
+ *                    false to subtract the origin and rotate.
+*/
+static void transform_block( const size_t& begin,
+                             const size_t& end,
+                             const double  rotation[9],
+                             const double  origin[3],
+                             const bool&   inverse,
+                             const double* u,
+                             const double* v,
+                             const double* w,
+                             double*       a,
+                             double*       b,
+                             double*       c ){
+
+    const double r0 = rotation[0], r1 = rotation[1], r2 = rotation[2];
+    const double r3 = rotation[3], r4 = rotation[4], r5 = rotation[5];
+    const double r6 = rotation[6], r7 = rotation[7], r8 = rotation[8];
+    const double ox = origin[0], oy = origin[1], oz = origin[2];
+
+    if( inverse ){
+        for( size_t i=begin; i<end; i++ ){
+            const double du = u[i], dv = v[i], dw = w[i];
+            a[i] = ox + r0 * du + r3 * dv + r6 * dw;
+            b[i] = oy + r1 * du + r4 * dv + r7 * dw;
+            c[i] = oz + r2 * du + r5 * dv + r8 * dw;
+        }
+    }
+    else{
+        for( size_t i=begin; i<end; i++ ){
+            const double dx = u[i] - ox, dy = v[i] - oy, dz = w[i] - oz;
+            a[i] = r0 * dx + r1 * dy + r2 * dz;
+            b[i] = r3 * dx + r4 * dy + r5 * dz;
+            c[i] = r6 * dx + r7 * dy + r8 * dz;
+        }
+    }
+}
+
+/**
+ * Constructor
+*/
+LocalTangentFrame::LocalTangentFrame( const double&         latitude,
+                                      const double&         longitude,
+                                      const double&         altitude,
+                                      CoordinateType const& type )
+  : m_type(type),
+    m_latitude(latitude),
+    m_longitude(longitude),
+    m_altitude(altitude)
+{
+    if( type != CoordinateType::ENU && type != CoordinateType::NED ){
+        throw GeneralException("Local tangent frames must be ENU or NED, not " + CoordinateType2String( type ), __FILE__, __LINE__);
+    }
+
+    geodetic_to_ecef( latitude, longitude, altitude, m_origin[0], m_origin[1], m_origin[2] );
+
+    const double sin_lat = std::sin( latitude  * DEG2RAD );
+    const double cos_lat = std::cos( latitude  * DEG2RAD );
+    const double sin_lon = std::sin( longitude * DEG2RAD );
+    const double cos_lon = std::cos( longitude * DEG2RAD );
+
+    const double east[3]  = { -sin_lon, cos_lon, 0 };
+    const double north[3] = { -sin_lat * cos_lon, -sin_lat * sin_lon, cos_lat };
+    const double up[3]    = {  cos_lat * cos_lon,  cos_lat * sin_lon, sin_lat };
+
+    for( int i=0; i<3; i++ ){
+        if( type == CoordinateType::ENU ){
+            m_rotation[i]   = east[i];
+            m_rotation[3+i] = north[i];
+            m_rotation[6+i] = up[i];
+        }
+        else{
+            m_rotation[i]   = north[i];
+            m_rotation[3+i] = east[i];
+            m_rotation[6+i] = -up[i];
+        }
+    }
+}
+
+/**
+ * Convert a geodetic coordinate to the frame
+*/
+void LocalTangentFrame::fromGeodetic( const double& latitude, const double& longitude, const double& altitude,
+                                      double& a, double& b, double& c )const{
+
+    double x, y, z;
+    geodetic_to_ecef( latitude, longitude, altitude, x, y, z );
+    fromECEF( x, y, z, a, b, c );
+}
+
+/**
+ * Convert a coordinate of the frame to geodetic
+*/
+void LocalTangentFrame::toGeodetic( const double& a, const double& b, const double& c,
+                                    double& latitude, double& longitude, double& altitude )const{
+
+    double x, y, z;
+    toECEF( a, b, c, x, y, z );
+    ecef_to_geodetic( x, y, z, latitude, longitude, altitude );
+}
+
+/**
+ * Convert ECEF coordinates to the frame
+*/
+void LocalTangentFrame::fromECEF( const size_t& count,
+                                  const double* x, const double* y, const double* z,
+                                  double* a, double* b, double* c,
+                                  int num_threads )const{
+
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        transform_block( block * BATCH_BLOCK, std::min( count, ( block + 1 ) * BATCH_BLOCK ),
+                         m_rotation, m_origin, false, x, y, z, a, b, c );
+    }, num_threads );
+}
+
+/**
+ * Convert coordinates of the frame to ECEF
+*/
+void LocalTangentFrame::toECEF( const size_t& count,
+                                const double* a, const double* b, const double* c,
+                                double* x, double* y, double* z,
+                                int num_threads )const{
+
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        transform_block( block * BATCH_BLOCK, std::min( count, ( block + 1 ) * BATCH_BLOCK ),
+                         m_rotation, m_origin, true, a, b, c, x, y, z );
+    }, num_threads );
+}
+
+/**
+ * Convert geodetic coordinates to the frame
+*/
+void LocalTangentFrame::fromGeodetic( const size_t& count,
+                                      const double* latitudes, const double* longitudes, const double* altitudes,
+                                      double* a, double* b, double* c,
+                                      int num_threads )const{
+
+    // the ECEF values go to the outputs, then rotate in place while the block is hot
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        const size_t begin = block * BATCH_BLOCK;
+        const size_t end   = std::min( count, ( block + 1 ) * BATCH_BLOCK );
+        for( size_t i=begin; i<end; i++ ){
+            geodetic_to_ecef( latitudes[i], longitudes[i], altitudes[i], a[i], b[i], c[i] );
+        }
+        transform_block( begin, end, m_rotation, m_origin, false, a, b, c, a, b, c );
+    }, num_threads );
+}
+
+/**
+ * Convert coordinates of the frame to geodetic
+*/
+void LocalTangentFrame::toGeodetic( const size_t& count,
+                                    const double* a, const double* b, const double* c,
+                                    double* latitudes, double* longitudes, double* altitudes,
+                                    int num_threads )const{
+
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        const size_t begin = block * BATCH_BLOCK;
+        const size_t end   = std::min( count, ( block + 1 ) * BATCH_BLOCK );
+        transform_block( begin, end, m_rotation, m_origin, true, a, b, c, latitudes, longitudes, altitudes );
+        for( size_t i=begin; i<end; i++ ){
+            const double x = latitudes[i], y = longitudes[i], z = altitudes[i];
+            ecef_to_geodetic( x, y, z, latitudes[i], longitudes[i], altitudes[i] );
+        }
+    }, num_threads );
+}
+
+} /// End of GEO Namespace
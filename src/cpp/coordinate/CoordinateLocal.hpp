@@ -0,0 +1,427 @@
+/**
+ * @file    CoordinateLocal.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_COORDINATE_COORDINATELOCAL_HPP__
+#define __SRC_CPP_COORDINATE_COORDINATELOCAL_HPP__
+
+/// C++ Standard Libraries
+#include <cstddef>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Enumerations.hpp>
+#include <GeoExplore/coordinate/CoordinateBase.hpp>
+#include <GeoExplore/coordinate/CoordinateECEF.hpp>
+#include <GeoExplore/coordinate/CoordinateGeodetic.hpp>
+
+namespace GEO{
+
+/**
+ * @class LocalTangentFrame
+ *
+ * Cartesian frame tangent to the WGS84 ellipsoid at a reference point,
+ * with its axes either East-North-Up or North-East-Down.  The rotation
+ * from ECEF is computed once, so every transform is a translation and a
+ * 3x3 product.
+*/
+class LocalTangentFrame{
+
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param[in] latitude  Reference latitude in degrees.
+         * @param[in] longitude Reference longitude in degrees.
+         * @param[in] altitude  Reference height above the ellipsoid in meters.
+         * @param[in] type      CoordinateType::ENU or CoordinateType::NED.
+         *
+         * @throws GeneralException if the type is not a local frame.
+        */
+        LocalTangentFrame( const double&         latitude,
+                           const double&         longitude,
+                           const double&         altitude,
+                           CoordinateType const& type = CoordinateType::ENU );
+
+        /**
+         * Get the axes, ENU or NED
+        */
+        CoordinateType type()const{ return m_type; }
+
+        /**
+         * Get the reference latitude in degrees
+        */
+        double latitude()const{ return m_latitude; }
+
+        /**
+         * Get the reference longitude in degrees
+        */
+        double longitude()const{ return m_longitude; }
+
+        /**
+         * Get the reference altitude in meters
+        */
+        double altitude()const{ return m_altitude; }
+
+        /**
+         * Convert an ECEF coordinate to the frame
+         *
+         * @param[out] a First axis, east or north.
+         * @param[out] b Second axis, north or east.
+         * @param[out] c Third axis, up or down.
+        */
+        void fromECEF( const double& x, const double& y, const double& z,
+                       double& a, double& b, double& c )const{
+
+            const double dx = x - m_origin[0];
+            const double dy = y - m_origin[1];
+            const double dz = z - m_origin[2];
+            a = m_rotation[0] * dx + m_rotation[1] * dy + m_rotation[2] * dz;
+            b = m_rotation[3] * dx + m_rotation[4] * dy + m_rotation[5] * dz;
+            c = m_rotation[6] * dx + m_rotation[7] * dy + m_rotation[8] * dz;
+        }
+
+        /**
+         * Convert a coordinate of the frame to ECEF
+        */
+        void toECEF( const double& a, const double& b, const double& c,
+                     double& x, double& y, double& z )const{
+
+            x = m_origin[0] + m_rotation[0] * a + m_rotation[3] * b + m_rotation[6] * c;
+            y = m_origin[1] + m_rotation[1] * a + m_rotation[4] * b + m_rotation[7] * c;
+            z = m_origin[2] + m_rotation[2] * a + m_rotation[5] * b + m_rotation[8] * c;
+        }
+
+        /**
+         * Convert a geodetic coordinate to the frame
+        */
+        void fromGeodetic( const double& latitude, const double& longitude, const double& altitude,
+                           double& a, double& b, double& c )const;
+
+        /**
+         * Convert a coordinate of the frame to geodetic
+        */
+        void toGeodetic( const double& a, const double& b, const double& c,
+                         double& latitude, double& longitude, double& altitude )const;
+
+        /**
+         * Convert ECEF coordinates to the frame
+         *
+         * Arrays are processed in blocks split across threads.  Outputs may
+         * not alias inputs.
+         *
+         * @param[in] num_threads Number of threads.  Values <= 0 use the default.
+        */
+        void fromECEF( const size_t& count,
+                       const double* x, const double* y, const double* z,
+                       double* a, double* b, double* c,
+                       int num_threads = 0 )const;
+
+        /**
+         * Convert coordinates of the frame to ECEF
+        */
+        void toECEF( const size_t& count,
+                     const double* a, const double* b, const double* c,
+                     double* x, double* y, double* z,
+                     int num_threads = 0 )const;
+
+        /**
+         * Convert geodetic coordinates to the frame
+        */
+        void fromGeodetic( const size_t& count,
+                           const double* latitudes, const double* longitudes, const double* altitudes,
+                           double* a, double* b, double* c,
+                           int num_threads = 0 )const;
+
+        /**
+         * Convert coordinates of the frame to geodetic
+        */
+        void toGeodetic( const size_t& count,
+                         const double* a, const double* b, const double* c,
+                         double* latitudes, double* longitudes, double* altitudes,
+                         int num_threads = 0 )const;
+
+    private:
+
+        /// Axes
+        CoordinateType m_type;
+
+        /// Reference point
+        double m_latitude;
+        double m_longitude;
+        double m_altitude;
+
+        /// Reference point in ECEF
+        double m_origin[3];
+
+        /// Rows are the frame axes in ECEF
+        double m_rotation[9];
+
+}; /// End of LocalTangentFrame Class
+
+
+/**
+ * @class CoordinateENU
+ *
+ * East-North-Up coordinate in meters, in the tangent frame of a
+ * reference geodetic coordinate.  The altitude of the base class is
+ * unused.
+*/
+template <typename DATATYPE>
+class CoordinateENU : public CoordinateBase<DATATYPE>{
+
+    public:
+
+        /// Typedef the datatype
+        typedef DATATYPE datatype;
+
+        /// Create the pointer type
+        typedef boost::shared_ptr<CoordinateENU<DATATYPE> > ptr_t;
+
+        /**
+         * Default Constructor.  The origin of the frame at 0,0.
+        */
+        CoordinateENU() : CoordinateBase<DATATYPE>(0, Datum::WGS84),
+                          m_reference(),
+                          m_east(0),
+                          m_north(0),
+                          m_up(0){}
+
+        /**
+         * Reference Constructor.  The origin of the frame.
+        */
+        CoordinateENU( CoordinateGeodetic<DATATYPE> const& reference ) :
+                                CoordinateBase<DATATYPE>(0, reference.datum()),
+                                m_reference(reference),
+                                m_east(0),
+                                m_north(0),
+                                m_up(0){}
+
+        /**
+         * Parameterized Constructor
+        */
+        CoordinateENU( datatype const& east,
+                       datatype const& north,
+                       datatype const& up,
+                       CoordinateGeodetic<DATATYPE> const& reference ) :
+                                CoordinateBase<DATATYPE>(0, reference.datum()),
+                                m_reference(reference),
+                                m_east(east),
+                                m_north(north),
+                                m_up(up){}
+
+        /**
+         * Get the reference coordinate
+        */
+        CoordinateGeodetic<DATATYPE> const& reference()const{ return m_reference; }
+
+        /**
+         * Set the reference coordinate
+        */
+        CoordinateGeodetic<DATATYPE>& reference(){ return m_reference; }
+
+        /**
+         * Get the tangent frame of the reference
+        */
+        LocalTangentFrame frame()const{
+            return LocalTangentFrame( m_reference.latitude(), m_reference.longitude(), m_reference.altitude(), CoordinateType::ENU );
+        }
+
+        /**
+         * Get the east value
+        */
+        datatype east()const{ return m_east; }
+
+        /**
+         * Set the east value
+        */
+        datatype& east(){ return m_east; }
+
+        /**
+         * Get the north value
+        */
+        datatype north()const{ return m_north; }
+
+        /**
+         * Set the north value
+        */
+        datatype& north(){ return m_north; }
+
+        /**
+         * Get the up value
+        */
+        datatype up()const{ return m_up; }
+
+        /**
+         * Set the up value
+        */
+        datatype& up(){ return m_up; }
+
+        /**
+         * Clone the coordinate
+        */
+        typename CoordinateENU<DATATYPE>::ptr_t clone()const{
+            return typename CoordinateENU<DATATYPE>::ptr_t( new CoordinateENU<DATATYPE>( m_east, m_north, m_up, m_reference ));
+        }
+
+        /**
+         * Get the coordinate type
+        */
+        virtual CoordinateType type(){ return CoordinateType::ENU; }
+
+    protected:
+
+        /// Origin of the frame
+        CoordinateGeodetic<DATATYPE> m_reference;
+
+        /// East in meters
+        datatype m_east;
+
+        /// North in meters
+        datatype m_north;
+
+        /// Up in meters
+        datatype m_up;
+
+}; /// End of CoordinateENU Class
+
+
+/**
+ * @class CoordinateNED
+ *
+ * North-East-Down coordinate in meters, in the tangent frame of a
+ * reference geodetic coordinate.  The altitude of the base class is
+ * unused.
+*/
+template <typename DATATYPE>
+class CoordinateNED : public CoordinateBase<DATATYPE>{
+
+    public:
+
+        /// Typedef the datatype
+        typedef DATATYPE datatype;
+
+        /// Create the pointer type
+        typedef boost::shared_ptr<CoordinateNED<DATATYPE> > ptr_t;
+
+        /**
+         * Default Constructor.  The origin of the frame at 0,0.
+        */
+        CoordinateNED() : CoordinateBase<DATATYPE>(0, Datum::WGS84),
+                          m_reference(),
+                          m_north(0),
+                          m_east(0),
+                          m_down(0){}
+
+        /**
+         * Reference Constructor.  The origin of the frame.
+        */
+        CoordinateNED( CoordinateGeodetic<DATATYPE> const& reference ) :
+                                CoordinateBase<DATATYPE>(0, reference.datum()),
+                                m_reference(reference),
+                                m_north(0),
+                                m_east(0),
+                                m_down(0){}
+
+        /**
+         * Parameterized Constructor
+        */
+        CoordinateNED( datatype const& north,
+                       datatype const& east,
+                       datatype const& down,
+                       CoordinateGeodetic<DATATYPE> const& reference ) :
+                                CoordinateBase<DATATYPE>(0, reference.datum()),
+                                m_reference(reference),
+                                m_north(north),
+                                m_east(east),
+                                m_down(down){}
+
+        /**
+         * Get the reference coordinate
+        */
+        CoordinateGeodetic<DATATYPE> const& reference()const{ return m_reference; }
+
+        /**
+         * Set the reference coordinate
+        */
+        CoordinateGeodetic<DATATYPE>& reference(){ return m_reference; }
+
+        /**
+         * Get the tangent frame of the reference
+        */
+        LocalTangentFrame frame()const{
+            return LocalTangentFrame( m_reference.latitude(), m_reference.longitude(), m_reference.altitude(), CoordinateType::NED );
+        }
+
+        /**
+         * Get the north value
+        */
+        datatype north()const{ return m_north; }
+
+        /**
+         * Set the north value
+        */
+        datatype& north(){ return m_north; }
+
+        /**
+         * Get the east value
+        */
+        datatype east()const{ return m_east; }
+
+        /**
+         * Set the east value
+        */
+        datatype& east(){ return m_east; }
+
+        /**
+         * Get the down value
+        */
+        datatype down()const{ return m_down; }
+
+        /**
+         * Set the down value
+        */
+        datatype& down(){ return m_down; }
+
+        /**
+         * Clone the coordinate
+        */
+        typename CoordinateNED<DATATYPE>::ptr_t clone()const{
+            return typename CoordinateNED<DATATYPE>::ptr_t( new CoordinateNED<DATATYPE>( m_north, m_east, m_down, m_reference ));
+        }
+
+        /**
+         * Get the coordinate type
+        */
+        virtual CoordinateType type(){ return CoordinateType::NED; }
+
+    protected:
+
+        /// Origin of the frame
+        CoordinateGeodetic<DATATYPE> m_reference;
+
+        /// North in meters
+        datatype m_north;
+
+        /// East in meters
+        datatype m_east;
+
+        /// Down in meters
+        datatype m_down;
+
+}; /// End of CoordinateNED Class
+
+/// Common Typedefs
+typedef CoordinateENU<double> CoordinateENUDouble;
+typedef CoordinateENU<double> CoordinateENU_d;
+
+typedef CoordinateNED<double> CoordinateNEDDouble;
+typedef CoordinateNED<double> CoordinateNED_d;
+
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,759 @@
+/**
+ * @file    CoordinateMGRS.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "CoordinateMGRS.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+/// GeoExplore Libraries
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+
+/// WGS84 ellipsoid
+static const double WGS84_A = 6378137.0;
+static const double WGS84_F = 1.0 / 298.257223563;
+
+/// Projection constants
+static const double UTM_K0 = 0.9996;
+static const double UPS_K0 = 0.994;
+static const double UTM_FALSE_EASTING  = 500000;
+static const double UTM_FALSE_NORTHING = 10000000;
+static const double UPS_FALSE_ORIGIN   = 2000000;
+
+/// MGRS letters
+static const char  UTM_BANDS[]      = "CDEFGHJKLMNPQRSTUVWX";
+static const char* UTM_COLUMNS[3]   = { "ABCDEFGH", "JKLMNPQR", "STUVWXYZ" };
+static const char  UTM_ROWS[]       = "ABCDEFGHJKLMNPQRSTUV";
+static const char  UPS_ROWS[]       = "ABCDEFGHJKLMNPQRSTUVWXYZ";
+static const char  UPS_WEST_COLUMNS[] = "JKLPQRSTUXYZ";
+static const char  UPS_EAST_COLUMNS[] = "ABCFGHJKLPQR";
+
+/// First UPS column and row of each square, in meters
+static const double UPS_WEST_ORIGIN  = 800000;
+static const double UPS_EAST_ORIGIN  = 2000000;
+static const double UPS_NORTH_ORIGIN = 1300000;
+static const double UPS_SOUTH_ORIGIN = 800000;
+
+/// UPS rows in use, A to P in the north and A to Z in the south
+static const int UPS_NORTH_ROWS = 14;
+static const int UPS_SOUTH_ROWS = 24;
+
+/// Size of a square and of the row letter cycle
+static const double SQUARE_SIZE = 100000;
+static const double ROW_CYCLE   = 2000000;
+
+/// Strings are processed in blocks of this many by the batch functions
+static const size_t BATCH_BLOCK = 4096;
+
+/**
+ * Ellipsoid terms and the 6th order Krueger series of the transverse
+ * Mercator projection, from Karney, "Transverse Mercator with an accuracy
+ * of a few nanometers", 2011.
+*/
+class ProjectionTerms{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        ProjectionTerms(){
+
+            const double n = WGS84_F / ( 2 - WGS84_F );
+            const double n2 = n*n, n3 = n2*n, n4 = n3*n, n5 = n4*n, n6 = n5*n;
+
+            e  = std::sqrt( WGS84_F * ( 2 - WGS84_F ));
+            e2 = e * e;
+
+            // rectifying radius
+            A = WGS84_A / ( 1 + n ) * ( 1 + n2/4 + n4/64 + n6/256 );
+
+            alpha[0] = beta[0] = 0;
+            alpha[1] = n/2 - 2*n2/3 + 5*n3/16 + 41*n4/180 - 127*n5/288 + 7891*n6/37800;
+            alpha[2] = 13*n2/48 - 3*n3/5 + 557*n4/1440 + 281*n5/630 - 1983433*n6/1935360;
+            alpha[3] = 61*n3/240 - 103*n4/140 + 15061*n5/26880 + 167603*n6/181440;
+            alpha[4] = 49561*n4/161280 - 179*n5/168 + 6601661*n6/7257600;
+            alpha[5] = 34729*n5/80640 - 3418889*n6/1995840;
+            alpha[6] = 212378941*n6/319334400;
+
+            beta[1] = n/2 - 2*n2/3 + 37*n3/96 - n4/360 - 81*n5/512 + 96199*n6/604800;
+            beta[2] = n2/48 + n3/15 - 437*n4/1440 + 46*n5/105 - 1118711*n6/3870720;
+            beta[3] = 17*n3/480 - 37*n4/840 - 209*n5/4480 + 5569*n6/90720;
+            beta[4] = 4397*n4/161280 - 11*n5/504 - 830251*n6/7257600;
+            beta[5] = 4583*n5/161280 - 108847*n6/3991680;
+            beta[6] = 20648693*n6/638668800;
+
+            // polar stereographic radius per unit of t
+            ups_c = 2 * WGS84_A / std::sqrt( std::pow( 1 + e, 1 + e ) * std::pow( 1 - e, 1 - e ));
+        }
+
+        /// Eccentricity and its square
+        double e, e2;
+
+        /// Rectifying radius
+        double A;
+
+        /// Forward and inverse series
+        double alpha[7], beta[7];
+
+        /// Polar stereographic scale
+        double ups_c;
+
+}; /// End of ProjectionTerms Class
+
+/**
+ * Get the projection terms
+*/
+static ProjectionTerms const& terms(){
+    static const ProjectionTerms output;
+    return output;
+}
+
+/**
+ * Tangent of the conformal latitude from the tangent of the latitude
+*/
+static double conformal_tau( const double& tau ){
+    const double e = terms().e;
+    const double sigma = std::sinh( e * std::atanh( e * tau / std::sqrt( 1 + tau*tau )));
+    return tau * std::sqrt( 1 + sigma*sigma ) - sigma * std::sqrt( 1 + tau*tau );
+}
+
+/**
+ * Tangent of the latitude from the tangent of the conformal latitude, by Newton's method
+*/
+static double geodetic_tau( const double& tau_prime ){
+    const double e2 = terms().e2;
+    double tau = tau_prime;
+    for( int i=0; i<5; i++ ){
+        const double guess = conformal_tau( tau );
+        const double delta = ( tau_prime - guess ) / std::sqrt( 1 + guess*guess ) *
+                             ( 1 + ( 1 - e2 ) * tau*tau ) / ( ( 1 - e2 ) * std::sqrt( 1 + tau*tau ));
+        tau += delta;
+        if( std::fabs( delta ) < 1e-14 * std::max( 1.0, std::fabs( tau ))){
+            break;
+        }
+    }
+    return tau;
+}
+
+/**
+ * Add the Krueger series to xi and eta
+ *
+ * The multiple angles come from the Chebyshev recurrences, so only one
+ * sine, cosine, sinh and cosh are evaluated.
+*/
+static void krueger_sum( const double* coeffs,
+                         const double& sign,
+                         const double& xi,
+                         const double& eta,
+                         double&       out_xi,
+                         double&       out_eta ){
+
+    const double c1 = std::cos( 2 * xi ), ch1 = std::cosh( 2 * eta );
+    double s_prev  = 0, s_cur  = std::sin( 2 * xi );
+    double c_prev  = 1, c_cur  = c1;
+    double sh_prev = 0, sh_cur = std::sinh( 2 * eta );
+    double ch_prev = 1, ch_cur = ch1;
+
+    out_xi  = xi;
+    out_eta = eta;
+    for( int j=1; j<=6; j++ ){
+        out_xi  += sign * coeffs[j] * s_cur * ch_cur;
+        out_eta += sign * coeffs[j] * c_cur * sh_cur;
+
+        const double s_next  = 2 * c1  * s_cur  - s_prev;
+        const double c_next  = 2 * c1  * c_cur  - c_prev;
+        const double sh_next = 2 * ch1 * sh_cur - sh_prev;
+        const double ch_next = 2 * ch1 * ch_cur - ch_prev;
+        s_prev  = s_cur;  s_cur  = s_next;
+        c_prev  = c_cur;  c_cur  = c_next;
+        sh_prev = sh_cur; sh_cur = sh_next;
+        ch_prev = ch_cur; ch_cur = ch_next;
+    }
+}
+
+/**
+ * Transverse Mercator, relative to the central meridian and the equator
+*/
+static void tm_forward( const double& phi, const double& lambda, double& x, double& y ){
+
+    ProjectionTerms const& t = terms();
+    const double tau_prime = conformal_tau( std::tan( phi ));
+    const double xi_prime  = std::atan2( tau_prime, std::cos( lambda ));
+    const double eta_prime = std::asinh( std::sin( lambda ) / std::sqrt( tau_prime*tau_prime + std::pow( std::cos( lambda ), 2 )));
+
+    double xi, eta;
+    krueger_sum( t.alpha, 1, xi_prime, eta_prime, xi, eta );
+    x = UTM_K0 * t.A * eta;
+    y = UTM_K0 * t.A * xi;
+}
+
+/**
+ * Inverse transverse Mercator
+*/
+static void tm_inverse( const double& x, const double& y, double& phi, double& lambda ){
+
+    ProjectionTerms const& t = terms();
+    double xi_prime, eta_prime;
+    krueger_sum( t.beta, -1, y / ( UTM_K0 * t.A ), x / ( UTM_K0 * t.A ), xi_prime, eta_prime );
+
+    const double sinh_eta = std::sinh( eta_prime );
+    const double cos_xi   = std::cos( xi_prime );
+    const double tau_prime = std::sin( xi_prime ) / std::sqrt( sinh_eta*sinh_eta + cos_xi*cos_xi );
+    phi    = std::atan( geodetic_tau( tau_prime ));
+    lambda = std::atan2( sinh_eta, cos_xi );
+}
+
+/**
+ * Polar stereographic, with the hemisphere of the pole
+*/
+static void ups_forward( const double& phi, const double& lambda, const bool& north, double& easting, double& northing ){
+
+    ProjectionTerms const& t = terms();
+    const double lat = north ? phi : -phi;
+    const double es  = t.e * std::sin( lat );
+    const double rho = UPS_K0 * t.ups_c * std::tan( M_PI/4 - lat/2 ) / std::pow( ( 1 - es ) / ( 1 + es ), t.e / 2 );
+    easting  = UPS_FALSE_ORIGIN + rho * std::sin( lambda );
+    northing = north ? UPS_FALSE_ORIGIN - rho * std::cos( lambda )
+                     : UPS_FALSE_ORIGIN + rho * std::cos( lambda );
+}
+
+/**
+ * Inverse polar stereographic
+*/
+static void ups_inverse( const double& easting, const double& northing, const bool& north, double& phi, double& lambda ){
+
+    ProjectionTerms const& t = terms();
+    const double dx = easting - UPS_FALSE_ORIGIN;
+    const double dy = northing - UPS_FALSE_ORIGIN;
+    const double ts = std::sqrt( dx*dx + dy*dy ) / ( UPS_K0 * t.ups_c );
+
+    double lat = M_PI/2 - 2 * std::atan( ts );
+    for( int i=0; i<10; i++ ){
+        const double es = t.e * std::sin( lat );
+        const double next = M_PI/2 - 2 * std::atan( ts * std::pow( ( 1 - es ) / ( 1 + es ), t.e / 2 ));
+        const bool done = std::fabs( next - lat ) < 1e-14;
+        lat = next;
+        if( done ){
+            break;
+        }
+    }
+    phi    = north ? lat : -lat;
+    lambda = north ? std::atan2( dx, -dy ) : std::atan2( dx, dy );
+}
+
+/**
+ * Wrap a longitude to [-180,180)
+*/
+static double wrap_longitude( const double& longitude ){
+    double output = longitude - 360 * std::floor( ( longitude + 180 ) / 360 );
+    return output >= 180 ? output - 360 : output;
+}
+
+/**
+ * Get the MGRS zone of a point in the UTM latitudes
+*/
+static int mgrs_zone( const double& latitude, const double& longitude ){
+
+    int zone = (int)std::floor( ( longitude + 180 ) / 6 ) + 1;
+    zone = std::max( 1, std::min( zone, 60 ));
+
+    // Norway
+    if( latitude >= 56 && latitude < 64 && longitude >= 3 && longitude < 12 ){
+        return 32;
+    }
+
+    // Svalbard
+    if( latitude >= 72 && longitude >= 0 && longitude < 42 ){
+        if( longitude <  9 ){ return 31; }
+        if( longitude < 21 ){ return 33; }
+        if( longitude < 33 ){ return 35; }
+        return 37;
+    }
+    return zone;
+}
+
+/**
+ * Position of a letter in a set, or -1
+*/
+static int letter_index( const char* letters, const char& letter ){
+    const char* found = std::strchr( letters, letter );
+    return ( letter != '\0' && found != nullptr ) ? (int)( found - letters ) : -1;
+}
+
+/**
+ * Convert a geodetic coordinate to UTM or UPS
+*/
+bool geodetic_to_utm_ups( const double& latitude,
+                          const double& longitude,
+                          int&          zone,
+                          bool&         north,
+                          double&       easting,
+                          double&       northing ){
+
+    if( ( latitude >= -90 && latitude <= 90 ) == false || std::isfinite( longitude ) == false ){
+        return false;
+    }
+    const double lon = wrap_longitude( longitude );
+    const double phi = latitude * M_PI / 180;
+    north = latitude >= 0;
+
+    // polar regions
+    if( latitude < -80 || latitude >= 84 ){
+        zone = 0;
+        ups_forward( phi, lon * M_PI / 180, north, easting, northing );
+        return true;
+    }
+
+    zone = mgrs_zone( latitude, lon );
+    const double central = zone * 6 - 183;
+    double x, y;
+    tm_forward( phi, wrap_longitude( lon - central ) * M_PI / 180, x, y );
+    easting  = UTM_FALSE_EASTING + x;
+    northing = north ? y : y + UTM_FALSE_NORTHING;
+    return true;
+}
+
+/**
+ * Convert a UTM or UPS coordinate to geodetic
+*/
+bool utm_ups_to_geodetic( const int&    zone,
+                          const bool&   north,
+                          const double& easting,
+                          const double& northing,
+                          double&       latitude,
+                          double&       longitude ){
+
+    if( zone < 0 || zone > 60 ){
+        return false;
+    }
+
+    double phi, lambda;
+    if( zone == 0 ){
+        ups_inverse( easting, northing, north, phi, lambda );
+        latitude  = phi * 180 / M_PI;
+        longitude = wrap_longitude( lambda * 180 / M_PI );
+        return true;
+    }
+
+    tm_inverse( easting - UTM_FALSE_EASTING, north ? northing : northing - UTM_FALSE_NORTHING, phi, lambda );
+    latitude  = phi * 180 / M_PI;
+    longitude = wrap_longitude( zone * 6 - 183 + lambda * 180 / M_PI );
+    return true;
+}
+
+/**
+ * Split a UTM or UPS coordinate into its MGRS square
+*/
+static bool grid_to_mgrs( const int&    zone,
+                          const bool&   north,
+                          const double& latitude,
+                          const double& grid_easting,
+                          const double& grid_northing,
+                          char&         band,
+                          char&         column,
+                          char&         row,
+                          double&       easting,
+                          double&       northing ){
+
+    const double square_easting  = std::floor( grid_easting  / SQUARE_SIZE );
+    const double square_northing = std::floor( grid_northing / SQUARE_SIZE );
+    easting  = grid_easting  - square_easting  * SQUARE_SIZE;
+    northing = grid_northing - square_northing * SQUARE_SIZE;
+
+    // polar squares start at fixed origins on each side of the pole
+    if( zone == 0 ){
+        const bool west = grid_easting < UPS_FALSE_ORIGIN;
+        band = north ? ( west ? 'Y' : 'Z' ) : ( west ? 'A' : 'B' );
+        const int col_index = (int)( square_easting - ( west ? UPS_WEST_ORIGIN : UPS_EAST_ORIGIN ) / SQUARE_SIZE );
+        const int row_index = (int)( square_northing - ( north ? UPS_NORTH_ORIGIN : UPS_SOUTH_ORIGIN ) / SQUARE_SIZE );
+        if( col_index < 0 || col_index >= 12 || row_index < 0 || row_index >= ( north ? UPS_NORTH_ROWS : UPS_SOUTH_ROWS )){
+            return false;
+        }
+        column = ( west ? UPS_WEST_COLUMNS : UPS_EAST_COLUMNS )[col_index];
+        row    = UPS_ROWS[row_index];
+        return true;
+    }
+
+    // the band comes from the latitude, X stretching to 84 degrees
+    band = UTM_BANDS[std::min( (int)std::floor( ( latitude + 80 ) / 8 ), 19 )];
+
+    // columns cycle every three zones, rows every two
+    const int col_index = (int)square_easting - 1;
+    if( col_index < 0 || col_index >= 8 ){
+        return false;
+    }
+    column = UTM_COLUMNS[( zone - 1 ) % 3][col_index];
+    row    = UTM_ROWS[( (int)square_northing + ( zone % 2 == 0 ? 5 : 0 )) % 20];
+    return true;
+}
+
+/**
+ * Convert a geodetic coordinate to MGRS components
+*/
+bool geodetic_to_mgrs( const double& latitude,
+                       const double& longitude,
+                       int&          zone,
+                       char&         band,
+                       char&         column,
+                       char&         row,
+                       double&       easting,
+                       double&       northing ){
+
+    bool north;
+    double grid_easting, grid_northing;
+    return geodetic_to_utm_ups( latitude, longitude, zone, north, grid_easting, grid_northing ) &&
+           grid_to_mgrs( zone, north, latitude, grid_easting, grid_northing, band, column, row, easting, northing );
+}
+
+/**
+ * Convert a UTM or UPS coordinate to MGRS components
+*/
+bool utm_ups_to_mgrs( const int&    zone,
+                      const bool&   north,
+                      const double& grid_easting,
+                      const double& grid_northing,
+                      char&         band,
+                      char&         column,
+                      char&         row,
+                      double&       easting,
+                      double&       northing ){
+
+    // only the band needs the latitude
+    double latitude, longitude;
+    return utm_ups_to_geodetic( zone, north, grid_easting, grid_northing, latitude, longitude ) &&
+           grid_to_mgrs( zone, north, latitude, grid_easting, grid_northing, band, column, row, easting, northing );
+}
+
+/**
+ * Convert MGRS components to UTM or UPS
+*/
+bool mgrs_to_utm_ups( const int&    zone,
+                      const char&   band,
+                      const char&   column,
+                      const char&   row,
+                      const double& easting,
+                      const double& northing,
+                      bool&         north,
+                      double&       grid_easting,
+                      double&       grid_northing ){
+
+    if( zone == 0 ){
+        const bool west = band == 'A' || band == 'Y';
+        north = band == 'Y' || band == 'Z';
+        if( west == false && band != 'B' && band != 'Z' ){
+            return false;
+        }
+        const int col_index = letter_index( west ? UPS_WEST_COLUMNS : UPS_EAST_COLUMNS, column );
+        const int row_index = letter_index( UPS_ROWS, row );
+        if( col_index < 0 || row_index < 0 || row_index >= ( north ? UPS_NORTH_ROWS : UPS_SOUTH_ROWS )){
+            return false;
+        }
+        grid_easting  = ( west ? UPS_WEST_ORIGIN : UPS_EAST_ORIGIN ) + col_index * SQUARE_SIZE + easting;
+        grid_northing = ( north ? UPS_NORTH_ORIGIN : UPS_SOUTH_ORIGIN ) + row_index * SQUARE_SIZE + northing;
+        return true;
+    }
+
+    const int band_index = letter_index( UTM_BANDS, band );
+    if( zone < 0 || zone > 60 || band_index < 0 ){
+        return false;
+    }
+    const int col_index = letter_index( UTM_COLUMNS[( zone - 1 ) % 3], column );
+    int row_index = letter_index( UTM_ROWS, row );
+    if( col_index < 0 || row_index < 0 ){
+        return false;
+    }
+    row_index = ( row_index - ( zone % 2 == 0 ? 5 : 0 ) + 20 ) % 20;
+    north = band >= 'N';
+
+    // the row letters repeat every 2000 km, pick the cycle holding the
+    // southern edge of the band.  South of the equator parallels bend
+    // south away from the central meridian, so the edge is taken 3
+    // degrees off it.
+    const double bottom = ( -80 + 8 * band_index ) * M_PI / 180;
+    double x, y_center, y_edge;
+    tm_forward( bottom, 0, x, y_center );
+    tm_forward( bottom, 3 * M_PI / 180, x, y_edge );
+    double band_northing = std::min( y_center, y_edge ) + ( north ? 0 : UTM_FALSE_NORTHING );
+    band_northing = std::floor( band_northing / SQUARE_SIZE ) * SQUARE_SIZE;
+
+    grid_northing = row_index * SQUARE_SIZE;
+    while( grid_northing < band_northing ){
+        grid_northing += ROW_CYCLE;
+    }
+    grid_northing += northing;
+    grid_easting = ( col_index + 1 ) * SQUARE_SIZE + easting;
+    return true;
+}
+
+/**
+ * Convert MGRS components to geodetic
+*/
+bool mgrs_to_geodetic( const int&    zone,
+                       const char&   band,
+                       const char&   column,
+                       const char&   row,
+                       const double& easting,
+                       const double& northing,
+                       double&       latitude,
+                       double&       longitude ){
+
+    bool north;
+    double grid_easting, grid_northing;
+    if( mgrs_to_utm_ups( zone, band, column, row, easting, northing, north, grid_easting, grid_northing ) == false ){
+        return false;
+    }
+    return utm_ups_to_geodetic( zone, north, grid_easting, grid_northing, latitude, longitude );
+}
+
+/**
+ * Parse an MGRS string
+*/
+bool parse_mgrs( const char*   text,
+                 const size_t& length,
+                 int&          zone,
+                 char&         band,
+                 char&         column,
+                 char&         row,
+                 double&       easting,
+                 double&       northing,
+                 int&          precision ){
+
+    size_t pos = 0;
+    const auto at_end = [&](){ return pos >= length || text[pos] == '\0'; };
+    const auto skip_spaces = [&](){ while( at_end() == false && text[pos] == ' ' ){ pos++; } };
+    const auto next_letter = [&]( char& letter ){
+        if( at_end() || std::isalpha( (unsigned char)text[pos] ) == 0 ){
+            return false;
+        }
+        letter = std::toupper( (unsigned char)text[pos++] );
+        return true;
+    };
+
+    // zone, absent in the polar regions
+    skip_spaces();
+    zone = 0;
+    int zone_digits = 0;
+    while( at_end() == false && std::isdigit( (unsigned char)text[pos] )){
+        zone = zone * 10 + ( text[pos++] - '0' );
+        if( ++zone_digits > 2 ){
+            return false;
+        }
+    }
+
+    // band and square
+    skip_spaces();
+    if( next_letter( band ) == false ){
+        return false;
+    }
+    skip_spaces();
+    if( next_letter( column ) == false || next_letter( row ) == false ){
+        return false;
+    }
+
+    // digits, optionally split in groups
+    char digits[10];
+    int count = 0;
+    for(;;){
+        skip_spaces();
+        if( at_end() ){
+            break;
+        }
+        if( std::isdigit( (unsigned char)text[pos] ) == 0 || count == 10 ){
+            return false;
+        }
+        digits[count++] = text[pos++];
+    }
+    if( count % 2 != 0 ){
+        return false;
+    }
+    precision = count / 2;
+
+    double scale = SQUARE_SIZE;
+    easting = northing = 0;
+    for( int i=0; i<precision; i++ ){
+        scale /= 10;
+        easting  += ( digits[i] - '0' ) * scale;
+        northing += ( digits[i+precision] - '0' ) * scale;
+    }
+
+    // the letters must exist in the zone
+    bool north;
+    double grid_easting, grid_northing;
+    if( zone == 0 ){
+        return zone_digits == 0 && mgrs_to_utm_ups( zone, band, column, row, easting, northing, north, grid_easting, grid_northing );
+    }
+    return zone <= 60 &&
+           letter_index( UTM_BANDS, band ) >= 0 &&
+           letter_index( UTM_COLUMNS[( zone - 1 ) % 3], column ) >= 0 &&
+           letter_index( UTM_ROWS, row ) >= 0;
+}
+
+/**
+ * Format MGRS components
+*/
+size_t format_mgrs( const int&    zone,
+                    const char&   band,
+                    const char&   column,
+                    const char&   row,
+                    const double& easting,
+                    const double& northing,
+                    const int&    precision,
+                    char*         output ){
+
+    size_t pos = 0;
+    if( zone > 0 ){
+        output[pos++] = '0' + ( zone / 10 ) % 10;
+        output[pos++] = '0' + zone % 10;
+    }
+    output[pos++] = band;
+    output[pos++] = column;
+    output[pos++] = row;
+
+    // truncate to the precision
+    const int digits = std::max( 0, std::min( precision, 5 ));
+    long scale = 1, limit = 1;
+    for( int i=digits; i<5; i++ ){
+        scale *= 10;
+    }
+    for( int i=0; i<digits; i++ ){
+        limit *= 10;
+    }
+    long e = std::max( 0L, std::min( (long)std::floor( easting  / scale ), limit - 1 ));
+    long n = std::max( 0L, std::min( (long)std::floor( northing / scale ), limit - 1 ));
+    for( int i=digits-1; i>=0; i-- ){
+        output[pos+i]        = '0' + e % 10;
+        output[pos+digits+i] = '0' + n % 10;
+        e /= 10;
+        n /= 10;
+    }
+    pos += 2 * digits;
+    output[pos] = '\0';
+    return pos;
+}
+
+/**
+ * Encode a geodetic coordinate as an MGRS string
+*/
+size_t encode_mgrs( const double& latitude,
+                    const double& longitude,
+                    const int&    precision,
+                    char*         output ){
+
+    int zone;
+    char band, column, row;
+    double easting, northing;
+    if( geodetic_to_mgrs( latitude, longitude, zone, band, column, row, easting, northing ) == false ){
+        output[0] = '\0';
+        return 0;
+    }
+    return format_mgrs( zone, band, column, row, easting, northing, precision, output );
+}
+
+/**
+ * Decode an MGRS string
+*/
+bool decode_mgrs( const char*   text,
+                  const size_t& length,
+                  double&       latitude,
+                  double&       longitude ){
+
+    int zone, precision;
+    char band, column, row;
+    double easting, northing;
+    return parse_mgrs( text, length, zone, band, column, row, easting, northing, precision ) &&
+           mgrs_to_geodetic( zone, band, column, row, easting, northing, latitude, longitude );
+}
+
+/**
+ * Encode geodetic coordinates as MGRS strings
+*/
+size_t encode_mgrs( const size_t& count,
+                    const double* latitudes,
+                    const double* longitudes,
+                    const int&    precision,
+                    char*         output,
+                    const size_t& stride,
+                    int           num_threads ){
+
+    if( stride < MGRS_MAX_LENGTH + 1 ){
+        throw GeneralException("MGRS record stride is too small.", __FILE__, __LINE__);
+    }
+
+    std::atomic<size_t> encoded( 0 );
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        const size_t end = std::min( count, ( block + 1 ) * BATCH_BLOCK );
+        size_t block_encoded = 0;
+        for( size_t i=block*BATCH_BLOCK; i<end; i++ ){
+            if( encode_mgrs( latitudes[i], longitudes[i], precision, output + i * stride ) > 0 ){
+                block_encoded++;
+            }
+        }
+        encoded += block_encoded;
+    }, num_threads );
+    return encoded;
+}
+
+/**
+ * Decode MGRS strings stored in fixed size records
+*/
+size_t decode_mgrs( const size_t& count,
+                    const char*   input,
+                    const size_t& stride,
+                    double*       latitudes,
+                    double*       longitudes,
+                    int           num_threads ){
+
+    std::atomic<size_t> decoded( 0 );
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        const size_t end = std::min( count, ( block + 1 ) * BATCH_BLOCK );
+        size_t block_decoded = 0;
+        for( size_t i=block*BATCH_BLOCK; i<end; i++ ){
+            if( decode_mgrs( input + i * stride, stride, latitudes[i], longitudes[i] )){
+                block_decoded++;
+            }
+            else{
+                latitudes[i] = longitudes[i] = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+        decoded += block_decoded;
+    }, num_threads );
+    return decoded;
+}
+
+/**
+ * Decode terminated MGRS strings
+*/
+size_t decode_mgrs( const size_t&      count,
+                    const char* const* strings,
+                    double*            latitudes,
+                    double*            longitudes,
+                    int                num_threads ){
+
+    std::atomic<size_t> decoded( 0 );
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        const size_t end = std::min( count, ( block + 1 ) * BATCH_BLOCK );
+        size_t block_decoded = 0;
+        for( size_t i=block*BATCH_BLOCK; i<end; i++ ){
+            if( strings[i] != nullptr && decode_mgrs( strings[i], std::strlen( strings[i] ), latitudes[i], longitudes[i] )){
+                block_decoded++;
+            }
+            else{
+                latitudes[i] = longitudes[i] = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+        decoded += block_decoded;
+    }, num_threads );
+    return decoded;
+}
+
+} /// End of GEO Namespace
@@ -6,20 +6,282 @@
 #ifndef __SRC_CPP_COORDINATE_COORDINATEMGRS_HPP__
 #define __SRC_CPP_COORDINATE_COORDINATEMGRS_HPP__
 
+/// C++ Standard Libraries
+#include <cstddef>
+#include <string>
+
 /// GeoExplore Libraries
 #include <GeoExplore/core/Enumerations.hpp>
+#include <GeoExplore/core/Exceptions.hpp>
 #include <GeoExplore/coordinate/CoordinateBase.hpp>
 
 namespace GEO{
 
+/// Longest MGRS string, without the terminator
+const size_t MGRS_MAX_LENGTH = 15;
+
+
+/**
+ * Convert a geodetic coordinate to UTM or UPS
+ *
+ * The zone is chosen the way MGRS does, including the Norway and Svalbard
+ * exceptions.  UTM covers latitudes from -80 up to 84 degrees, UPS the
+ * rest.  Northings in the southern hemisphere include the false northing.
+ * The projections are computed on the WGS84 ellipsoid.
+ *
+ * @param[in]  latitude  Latitude in degrees.
+ * @param[in]  longitude Longitude in degrees.
+ * @param[out] zone      UTM zone, or 0 for UPS.
+ * @param[out] north     True for the northern hemisphere.
+ * @param[out] easting   Easting in meters.
+ * @param[out] northing  Northing in meters.
+ *
+ * @return False if the latitude or longitude is invalid.
+*/
+bool geodetic_to_utm_ups( const double& latitude,
+                          const double& longitude,
+                          int&          zone,
+                          bool&         north,
+                          double&       easting,
+                          double&       northing );
+
+/**
+ * Convert a UTM or UPS coordinate to geodetic
+ *
+ * @param[in]  zone      UTM zone, or 0 for UPS.
+ * @param[in]  north     True for the northern hemisphere.
+ * @param[in]  easting   Easting in meters.
+ * @param[in]  northing  Northing in meters, with the false northing in the south.
+ * @param[out] latitude  Latitude in degrees.
+ * @param[out] longitude Longitude in degrees, in [-180,180).
+ *
+ * @return False if the zone is invalid.
+*/
+bool utm_ups_to_geodetic( const int&    zone,
+                          const bool&   north,
+                          const double& easting,
+                          const double& northing,
+                          double&       latitude,
+                          double&       longitude );
+
+/**
+ * Convert a geodetic coordinate to MGRS components
+ *
+ * @param[in]  latitude  Latitude in degrees.
+ * @param[in]  longitude Longitude in degrees.
+ * @param[out] zone      Grid zone, or 0 in the polar regions.
+ * @param[out] band      Latitude band letter, or A, B, Y, Z in the polar regions.
+ * @param[out] column    100 km square column letter.
+ * @param[out] row       100 km square row letter.
+ * @param[out] easting   Easting inside the square in meters.
+ * @param[out] northing  Northing inside the square in meters.
+ *
+ * @return False if the latitude or longitude is invalid.
+*/
+bool geodetic_to_mgrs( const double& latitude,
+                       const double& longitude,
+                       int&          zone,
+                       char&         band,
+                       char&         column,
+                       char&         row,
+                       double&       easting,
+                       double&       northing );
+
+/**
+ * Convert a UTM or UPS coordinate to MGRS components
+ *
+ * The coordinate keeps its zone, even when MGRS would put the point in a
+ * neighbouring one.
+ *
+ * @param[in]  zone          UTM zone, or 0 for UPS.
+ * @param[in]  north         True for the northern hemisphere.
+ * @param[in]  grid_easting  Easting in meters.
+ * @param[in]  grid_northing Northing in meters, with the false northing in the south.
+ *
+ * @return False if the coordinate is outside the MGRS squares of the zone.
+*/
+bool utm_ups_to_mgrs( const int&    zone,
+                      const bool&   north,
+                      const double& grid_easting,
+                      const double& grid_northing,
+                      char&         band,
+                      char&         column,
+                      char&         row,
+                      double&       easting,
+                      double&       northing );
+
+/**
+ * Convert MGRS components to UTM or UPS
+ *
+ * The northing is resolved inside the latitude band, so the band must be
+ * the one of the point.
+ *
+ * @param[out] north         True for the northern hemisphere.
+ * @param[out] grid_easting  UTM or UPS easting in meters.
+ * @param[out] grid_northing UTM or UPS northing in meters.
+ *
+ * @return False if the letters are invalid for the zone.
+*/
+bool mgrs_to_utm_ups( const int&    zone,
+                      const char&   band,
+                      const char&   column,
+                      const char&   row,
+                      const double& easting,
+                      const double& northing,
+                      bool&         north,
+                      double&       grid_easting,
+                      double&       grid_northing );
+
+/**
+ * Convert MGRS components to geodetic
+ *
+ * @return False if the letters are invalid for the zone.
+*/
+bool mgrs_to_geodetic( const int&    zone,
+                       const char&   band,
+                       const char&   column,
+                       const char&   row,
+                       const double& easting,
+                       const double& northing,
+                       double&       latitude,
+                       double&       longitude );
+
+/**
+ * Parse an MGRS string
+ *
+ * Letters may be lower case, and the zone, square and digit groups may be
+ * separated by spaces, as in "18S UJ 23394 07396".  Zones may have one or
+ * two digits.  Parsing stops at the first terminator.
+ *
+ * @param[in]  text      String, not necessarily terminated.
+ * @param[in]  length    Number of characters available.
+ * @param[out] precision Number of digits per axis, 0 to 5.
+ *
+ * @return False if the string is malformed or its letters do not exist in its zone.
+*/
+bool parse_mgrs( const char*   text,
+                 const size_t& length,
+                 int&          zone,
+                 char&         band,
+                 char&         column,
+                 char&         row,
+                 double&       easting,
+                 double&       northing,
+                 int&          precision );
+
+/**
+ * Format MGRS components
+ *
+ * Zones are written with two digits and digits are truncated, never
+ * rounded, so the string names the square holding the point.
+ *
+ * @param[in]  precision Number of digits per axis, 0 to 5.
+ * @param[out] output    At least MGRS_MAX_LENGTH + 1 characters.  Terminated.
+ *
+ * @return Length of the string.
+*/
+size_t format_mgrs( const int&    zone,
+                    const char&   band,
+                    const char&   column,
+                    const char&   row,
+                    const double& easting,
+                    const double& northing,
+                    const int&    precision,
+                    char*         output );
+
+/**
+ * Encode a geodetic coordinate as an MGRS string
+ *
+ * @param[out] output At least MGRS_MAX_LENGTH + 1 characters.  Terminated.
+ *
+ * @return Length of the string, 0 if the coordinate is invalid.
+*/
+size_t encode_mgrs( const double& latitude,
+                    const double& longitude,
+                    const int&    precision,
+                    char*         output );
+
+/**
+ * Decode an MGRS string to the south-west corner of its square
+ *
+ * @return False if the string is invalid.
+*/
+bool decode_mgrs( const char*   text,
+                  const size_t& length,
+                  double&       latitude,
+                  double&       longitude );
+
+/**
+ * Encode geodetic coordinates as MGRS strings
+ *
+ * Strings are written to fixed size records and terminated.  Invalid
+ * coordinates produce empty strings.  Nothing is allocated per coordinate.
+ *
+ * @param[in]  count       Number of coordinates.
+ * @param[in]  latitudes   Latitudes in degrees.
+ * @param[in]  longitudes  Longitudes in degrees.
+ * @param[in]  precision   Number of digits per axis, 0 to 5.
+ * @param[out] output      count * stride characters.
+ * @param[in]  stride      Record size, at least MGRS_MAX_LENGTH + 1.
+ * @param[in]  num_threads Number of threads.  Values <= 0 use the default.
+ *
+ * @return Number of coordinates encoded.
+*/
+size_t encode_mgrs( const size_t& count,
+                    const double* latitudes,
+                    const double* longitudes,
+                    const int&    precision,
+                    char*         output,
+                    const size_t& stride = MGRS_MAX_LENGTH + 1,
+                    int           num_threads = 0 );
+
+/**
+ * Decode MGRS strings stored in fixed size records
+ *
+ * Each string ends at its terminator or at the end of its record.  Invalid
+ * strings produce NaN coordinates.
+ *
+ * @param[in]  count       Number of strings.
+ * @param[in]  input       count * stride characters.
+ * @param[in]  stride      Record size.
+ * @param[out] latitudes   Latitudes in degrees.
+ * @param[out] longitudes  Longitudes in degrees.
+ * @param[in]  num_threads Number of threads.  Values <= 0 use the default.
+ *
+ * @return Number of strings decoded.
+*/
+size_t decode_mgrs( const size_t& count,
+                    const char*   input,
+                    const size_t& stride,
+                    double*       latitudes,
+                    double*       longitudes,
+                    int           num_threads = 0 );
+
+/**
+ * Decode terminated MGRS strings
+ *
+ * @return Number of strings decoded.
+*/
+size_t decode_mgrs( const size_t&      count,
+                    const char* const* strings,
+                    double*            latitudes,
+                    double*            longitudes,
+                    int                num_threads = 0 );
+
+
 /**
  * @class CoordinateMGRS
+ *
+ * Military Grid Reference System coordinate.  The point is stored as its
+ * grid zone, 100 km square and offset inside the square, with the number
+ * of digits it was given with.  Polar coordinates have zone 0 and bands
+ * A, B, Y or Z.
 */
 template <typename DATATYPE>
 class CoordinateMGRS : public CoordinateBase<DATATYPE>{
 
     public:
-        
+
         /// Typedef the datatype
         typedef DATATYPE datatype;
 
@@ -28,18 +290,214 @@ class CoordinateMGRS : public CoordinateBase<DATATYPE>{
 
 
         /**
-         * Default Constructor
+         * Default Constructor.  The origin of zone 31N.
+        */
+        CoordinateMGRS() : CoordinateBase<DATATYPE>(0, Datum::WGS84),
+                           m_zone(31),
+                           m_band('N'),
+                           m_column('A'),
+                           m_row('A'),
+                           m_easting(66021),
+                           m_northing(0),
+                           m_precision(5){}
+
+        /**
+         * Parameterized Constructor
+         *
+         * @param[in] datum Datum
+        */
+        CoordinateMGRS( Datum const& datum ) : CoordinateBase<DATATYPE>(0, datum),
+                                               m_zone(31),
+                                               m_band('N'),
+                                               m_column('A'),
+                                               m_row('A'),
+                                               m_easting(66021),
+                                               m_northing(0),
+                                               m_precision(5){}
+
+        /**
+         * Parameterized Constructor
+        */
+        CoordinateMGRS( const int&      zone,
+                        const char&     band,
+                        const char&     column,
+                        const char&     row,
+                        datatype const& easting,
+                        datatype const& northing,
+                        const int&      precision = 5,
+                        datatype const& altitude = 0,
+                        Datum const&    datum = Datum::WGS84 ) :
+                                CoordinateBase<DATATYPE>(altitude, datum),
+                                m_zone(zone),
+                                m_band(band),
+                                m_column(column),
+                                m_row(row),
+                                m_easting(easting),
+                                m_northing(northing),
+                                m_precision(precision){}
+
+        /**
+         * Parse Constructor
+         *
+         * @param[in] text     MGRS string, see parse_mgrs.
+         * @param[in] altitude Altitude
+         * @param[in] datum    Datum
+         *
+         * @throws GeneralException if the string is invalid.
         */
-        CoordinateMGRS() : CoordinateBase<DATATYPE>(){}
+        explicit CoordinateMGRS( std::string const& text,
+                                 datatype const&    altitude = 0,
+                                 Datum const&       datum = Datum::WGS84 ) :
+                                        CoordinateBase<DATATYPE>(altitude, datum){
 
+            double easting, northing;
+            if( parse_mgrs( text.c_str(), text.size(), m_zone, m_band, m_column, m_row, easting, northing, m_precision ) == false ){
+                throw GeneralException("Invalid MGRS string: " + text, __FILE__, __LINE__);
+            }
+            m_easting  = easting;
+            m_northing = northing;
+        }
+
+        /**
+         * Get the grid zone, 0 in the polar regions
+        */
+        int zone()const{ return m_zone; }
+
+        /**
+         * Set the grid zone
+        */
+        int& zone(){ return m_zone; }
+
+        /**
+         * Get the latitude band
+        */
+        char band()const{ return m_band; }
+
+        /**
+         * Set the latitude band
+        */
+        char& band(){ return m_band; }
+
+        /**
+         * Get the 100 km square column letter
+        */
+        char column()const{ return m_column; }
+
+        /**
+         * Set the 100 km square column letter
+        */
+        char& column(){ return m_column; }
+
+        /**
+         * Get the 100 km square row letter
+        */
+        char row()const{ return m_row; }
+
+        /**
+         * Set the 100 km square row letter
+        */
+        char& row(){ return m_row; }
+
+        /**
+         * Get the easting inside the square
+        */
+        datatype easting()const{ return m_easting; }
+
+        /**
+         * Set the easting inside the square
+        */
+        datatype& easting(){ return m_easting; }
+
+        /**
+         * Get the northing inside the square
+        */
+        datatype northing()const{ return m_northing; }
+
+        /**
+         * Set the northing inside the square
+        */
+        datatype& northing(){ return m_northing; }
+
+        /**
+         * Get the number of digits per axis
+        */
+        int precision()const{ return m_precision; }
+
+        /**
+         * Set the number of digits per axis
+        */
+        int& precision(){ return m_precision; }
+
+        /**
+         * Check if the coordinate is in a polar region
+        */
+        bool isPolar()const{ return m_zone == 0; }
+
+        /**
+         * Format the coordinate with its own precision
+        */
+        std::string toString()const{
+            return toString( m_precision );
+        }
+
+        /**
+         * Format the coordinate
+         *
+         * @param[in] precision Number of digits per axis, 0 to 5.
+        */
+        std::string toString( const int& precision )const{
+            char output[MGRS_MAX_LENGTH+1];
+            const size_t length = format_mgrs( m_zone, m_band, m_column, m_row, m_easting, m_northing, precision, output );
+            return std::string( output, length );
+        }
+
+        /**
+         * Clone the data
+        */
+        CoordinateMGRS<DATATYPE>::ptr_t clone()const{
+            return CoordinateMGRS<DATATYPE>::ptr_t(
+                    new CoordinateMGRS<DATATYPE>( m_zone,
+                                                  m_band,
+                                                  m_column,
+                                                  m_row,
+                                                  m_easting,
+                                                  m_northing,
+                                                  m_precision,
+                                                  this->altitude(),
+                                                  this->datum()));
+        }
+
+        virtual CoordinateType type(){ return CoordinateType::MGRS; }
 
     private:
 
+        /// Grid zone
+        int m_zone;
+
+        /// Latitude band
+        char m_band;
+
+        /// 100 km square column
+        char m_column;
 
+        /// 100 km square row
+        char m_row;
 
+        /// Easting inside the square
+        datatype m_easting;
+
+        /// Northing inside the square
+        datatype m_northing;
+
+        /// Digits per axis
+        int m_precision;
 
 }; /// End of CoordinateMGRS Class
 
+/// Common Typedefs
+typedef CoordinateMGRS<double> CoordinateMGRSDouble;
+typedef CoordinateMGRS<double> CoordinateMGRS_d;
+
 
 } /// End of GEO Namespace
 
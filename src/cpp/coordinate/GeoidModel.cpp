@@ -0,0 +1,208 @@
+/**
+ * @file    GeoidModel.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "GeoidModel.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+
+/// Boost C++ Libraries
+#include <boost/interprocess/file_mapping.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace bf=boost::filesystem;
+namespace bi=boost::interprocess;
+
+namespace GEO{
+
+/// Points are processed in blocks of this many by the batch functions
+static const size_t BATCH_BLOCK = 4096;
+
+/**
+ * Default model and its guard
+*/
+static std::mutex& default_mutex(){
+    static std::mutex mutex;
+    return mutex;
+}
+static GeoidModel::ptr_t& default_model(){
+    static GeoidModel::ptr_t model;
+    return model;
+}
+
+/**
+ * Cubic convolution weights, Keys with a = -0.5, for the posts at -1, 0, 1
+ * and 2 around a fraction t
+*/
+static void cubic_weights( const double& t, double weights[4] ){
+    weights[0] = ( ( -0.5 * t + 1.0 ) * t - 0.5 ) * t;
+    weights[1] = ( 1.5 * t - 2.5 ) * t * t + 1.0;
+    weights[2] = ( ( -1.5 * t + 2.0 ) * t + 0.5 ) * t;
+    weights[3] = ( 0.5 * t - 0.5 ) * t * t;
+}
+
+/**
+ * Constructor
+*/
+GeoidModel::GeoidModel( bf::path const& pathname ){
+
+    if( bf::exists( pathname ) == false ){
+        throw GeneralException("Geoid grid " + pathname.string() + " does not exist.", __FILE__, __LINE__);
+    }
+
+    try{
+        bi::file_mapping mapping( pathname.c_str(), bi::read_only );
+        bi::mapped_region region( mapping, bi::read_only );
+        m_region.swap( region );
+    }
+    catch( bi::interprocess_exception const& e ){
+        throw GeneralException("Unable to map geoid grid " + pathname.string() + ": " + e.what(), __FILE__, __LINE__);
+    }
+    m_data = static_cast<const uint8_t*>( m_region.get_address() );
+
+    // a global grid has rows = 180/spacing + 1 and cols = 360/spacing, so
+    // the post count is 2 rows ( rows - 1 )
+    const size_t posts = m_region.get_size() / 2;
+    m_rows = (int)std::floor( ( 1 + std::sqrt( 1.0 + 2.0 * posts )) / 2 + 0.5 );
+    m_cols = 2 * ( m_rows - 1 );
+    if( m_region.get_size() % 2 != 0 || m_rows < 3 || (size_t)m_rows * m_cols != posts ){
+        throw GeneralException("Geoid grid " + pathname.string() + " is not a global grid.", __FILE__, __LINE__);
+    }
+    m_spacing = 180.0 / ( m_rows - 1 );
+}
+
+/**
+ * Get the default model
+*/
+GeoidModel::ptr_t GeoidModel::getDefault(){
+    std::lock_guard<std::mutex> lock( default_mutex() );
+    return default_model();
+}
+
+/**
+ * Set the default model
+*/
+void GeoidModel::setDefault( ptr_t const& model ){
+    std::lock_guard<std::mutex> lock( default_mutex() );
+    default_model() = model;
+}
+
+/**
+ * Get the geoid undulation
+*/
+double GeoidModel::undulation( const double&             latitude,
+                               const double&             longitude,
+                               GeoidInterpolation const& interpolation )const{
+
+    if( std::isfinite( latitude ) == false || std::isfinite( longitude ) == false ){
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    // grid position, rows clamped at the poles and columns wrapped
+    const double y = std::min( std::max( ( 90.0 - latitude ) / m_spacing, 0.0 ), m_rows - 1.0 );
+    double x = longitude / m_spacing;
+    x -= std::floor( x / m_cols ) * m_cols;
+
+    const int row = std::min( (int)y, m_rows - 2 );
+    const int col = std::min( (int)x, m_cols - 1 );
+    const double fy = y - row;
+    const double fx = x - col;
+
+    if( interpolation == GeoidInterpolation::BILINEAR ){
+        const int next = ( col + 1 ) % m_cols;
+        const double top    = post( row,   col ) * ( 1 - fx ) + post( row,   next ) * fx;
+        const double bottom = post( row+1, col ) * ( 1 - fx ) + post( row+1, next ) * fx;
+        return top * ( 1 - fy ) + bottom * fy;
+    }
+
+    double wx[4], wy[4];
+    cubic_weights( fx, wx );
+    cubic_weights( fy, wy );
+
+    int cols[4];
+    for( int i=0; i<4; i++ ){
+        cols[i] = ( col - 1 + i + m_cols ) % m_cols;
+    }
+
+    double result = 0;
+    for( int j=0; j<4; j++ ){
+        const int r = std::min( std::max( row - 1 + j, 0 ), m_rows - 1 );
+        double sum = 0;
+        for( int i=0; i<4; i++ ){
+            sum += wx[i] * post( r, cols[i] );
+        }
+        result += wy[j] * sum;
+    }
+    return result;
+}
+
+/**
+ * Get the geoid undulation at many points
+*/
+void GeoidModel::undulation( const size_t&             count,
+                             const double*             latitudes,
+                             const double*             longitudes,
+                             double*                   undulations,
+                             GeoidInterpolation const& interpolation,
+                             int                       num_threads )const{
+
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        const size_t end = std::min( count, ( block + 1 ) * BATCH_BLOCK );
+        for( size_t i=block*BATCH_BLOCK; i<end; i++ ){
+            undulations[i] = undulation( latitudes[i], longitudes[i], interpolation );
+        }
+    }, num_threads );
+}
+
+/**
+ * Convert ellipsoidal heights to orthometric heights
+*/
+void GeoidModel::toOrthometric( const size_t&             count,
+                                const double*             latitudes,
+                                const double*             longitudes,
+                                double*                   heights,
+                                GeoidInterpolation const& interpolation,
+                                int                       num_threads )const{
+    applyUndulation( count, latitudes, longitudes, heights, -1, interpolation, num_threads );
+}
+
+/**
+ * Convert orthometric heights to ellipsoidal heights
+*/
+void GeoidModel::toEllipsoidal( const size_t&             count,
+                                const double*             latitudes,
+                                const double*             longitudes,
+                                double*                   heights,
+                                GeoidInterpolation const& interpolation,
+                                int                       num_threads )const{
+    applyUndulation( count, latitudes, longitudes, heights, 1, interpolation, num_threads );
+}
+
+/**
+ * Add the undulation times a sign to heights
+*/
+void GeoidModel::applyUndulation( const size_t&             count,
+                                  const double*             latitudes,
+                                  const double*             longitudes,
+                                  double*                   heights,
+                                  const double&             sign,
+                                  GeoidInterpolation const& interpolation,
+                                  int                       num_threads )const{
+
+    parallel_for( 0, ( count + BATCH_BLOCK - 1 ) / BATCH_BLOCK, [&]( const size_t& block, const int& /*thread_id*/ ){
+        const size_t end = std::min( count, ( block + 1 ) * BATCH_BLOCK );
+        for( size_t i=block*BATCH_BLOCK; i<end; i++ ){
+            heights[i] += sign * undulation( latitudes[i], longitudes[i], interpolation );
+        }
+    }, num_threads );
+}
+
+} /// End of GEO Namespace
@@ -0,0 +1,203 @@
+/**
+ * @file    GeoidModel.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_COORDINATE_GEOIDMODEL_HPP__
+#define __SRC_CPP_COORDINATE_GEOIDMODEL_HPP__
+
+/// C++ Standard Libraries
+#include <cstddef>
+#include <cstdint>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace GEO{
+
+/**
+ * @class GeoidInterpolation
+ *
+ * Method used to sample the geoid between grid posts.
+*/
+enum class GeoidInterpolation{
+    BILINEAR,
+    BICUBIC,
+}; /// End of GeoidInterpolation Enumeration
+
+
+/**
+ * @class GeoidModel
+ *
+ * Geoid undulation grid, the height of the geoid above the WGS84
+ * ellipsoid.  Orthometric heights, as in DEMs, are ellipsoidal heights,
+ * as from GPS, minus the undulation.
+ *
+ * The grid is read through a memory map in the NGA format of the EGM96
+ * WW15MGH.DAC file: big-endian 16 bit centimeters, rows from 90 to -90
+ * degrees, columns eastward from 0 degrees, with the same spacing on both
+ * axes.  The spacing is found from the file size, so finer grids in the
+ * same layout load as well.
+ *
+ * Lookups are const and thread-safe.
+*/
+class GeoidModel{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<GeoidModel> ptr_t;
+
+        /**
+         * Constructor
+         *
+         * @param[in] pathname Grid file.
+         *
+         * @throws GeneralException if the file cannot be mapped or is not a global grid.
+        */
+        explicit GeoidModel( boost::filesystem::path const& pathname );
+
+        /**
+         * Get the model used by convert_coordinate for EGM96 heights
+         *
+         * @return Null until one is set.
+        */
+        static ptr_t getDefault();
+
+        /**
+         * Set the model used by convert_coordinate for EGM96 heights
+        */
+        static void setDefault( ptr_t const& model );
+
+        /**
+         * Get the number of grid rows
+        */
+        int rows()const{ return m_rows; }
+
+        /**
+         * Get the number of grid columns
+        */
+        int cols()const{ return m_cols; }
+
+        /**
+         * Get the grid spacing in degrees
+        */
+        double spacing()const{ return m_spacing; }
+
+        /**
+         * Get the undulation at a grid post
+         *
+         * @param[in] row Row from the north pole, in [0,rows).
+         * @param[in] col Column from the prime meridian, in [0,cols).
+        */
+        double post( const int& row, const int& col )const{
+            const uint8_t* value = m_data + 2 * ( (size_t)row * m_cols + col );
+            return (int16_t)( ( value[0] << 8 ) | value[1] ) * 0.01;
+        }
+
+        /**
+         * Get the geoid undulation
+         *
+         * @param[in] latitude      Latitude in degrees.
+         * @param[in] longitude     Longitude in degrees.
+         * @param[in] interpolation Interpolation method.
+         *
+         * @return Height of the geoid above the ellipsoid in meters.
+        */
+        double undulation( const double&             latitude,
+                           const double&             longitude,
+                           GeoidInterpolation const& interpolation = GeoidInterpolation::BILINEAR )const;
+
+        /**
+         * Get the geoid undulation at many points
+         *
+         * Points are processed in blocks split across threads.
+         *
+         * @param[in]  count       Number of points.
+         * @param[out] undulations Heights of the geoid above the ellipsoid in meters.
+         * @param[in]  num_threads Number of threads.  Values <= 0 use the default.
+        */
+        void undulation( const size_t&             count,
+                         const double*             latitudes,
+                         const double*             longitudes,
+                         double*                   undulations,
+                         GeoidInterpolation const& interpolation = GeoidInterpolation::BILINEAR,
+                         int                       num_threads = 0 )const;
+
+        /**
+         * Convert an ellipsoidal height to an orthometric height
+        */
+        double toOrthometric( const double&             latitude,
+                              const double&             longitude,
+                              const double&             height,
+                              GeoidInterpolation const& interpolation = GeoidInterpolation::BILINEAR )const{
+            return height - undulation( latitude, longitude, interpolation );
+        }
+
+        /**
+         * Convert an orthometric height to an ellipsoidal height
+        */
+        double toEllipsoidal( const double&             latitude,
+                              const double&             longitude,
+                              const double&             height,
+                              GeoidInterpolation const& interpolation = GeoidInterpolation::BILINEAR )const{
+            return height + undulation( latitude, longitude, interpolation );
+        }
+
+        /**
+         * Convert ellipsoidal heights to orthometric heights in place
+        */
+        void toOrthometric( const size_t&             count,
+                            const double*             latitudes,
+                            const double*             longitudes,
+                            double*                   heights,
+                            GeoidInterpolation const& interpolation = GeoidInterpolation::BILINEAR,
+                            int                       num_threads = 0 )const;
+
+        /**
+         * Convert orthometric heights to ellipsoidal heights in place
+        */
+        void toEllipsoidal( const size_t&             count,
+                            const double*             latitudes,
+                            const double*             longitudes,
+                            double*                   heights,
+                            GeoidInterpolation const& interpolation = GeoidInterpolation::BILINEAR,
+                            int                       num_threads = 0 )const;
+
+    private:
+
+        /**
+         * Add the undulation times a sign to heights
+        */
+        void applyUndulation( const size_t&             count,
+                              const double*             latitudes,
+                              const double*             longitudes,
+                              double*                   heights,
+                              const double&             sign,
+                              GeoidInterpolation const& interpolation,
+                              int                       num_threads )const;
+
+        /// Do not allow copies
+        GeoidModel( GeoidModel const& );
+        GeoidModel& operator = ( GeoidModel const& );
+
+        /// Mapping of the grid file
+        boost::interprocess::mapped_region m_region;
+
+        /// Grid posts
+        const uint8_t* m_data;
+
+        /// Grid size
+        int m_rows;
+        int m_cols;
+
+        /// Post spacing in degrees
+        double m_spacing;
+
+}; /// End of GeoidModel Class
+
+} /// End of GEO Namespace
+
+#endif
@@ -18,9 +18,9 @@ std::string Datum2WKT_string( Datum const& datum ){
 
     switch(datum){
         
-        /// If we have EGM96
+        /// If we have EGM96, a vertical datum over WGS84
         case Datum::EGM96:
-            return "EGM96";
+            return "WGS84";
 
         /// If we have WGS84
         case Datum::WGS84:
@@ -44,8 +44,16 @@ std::string CoordinateType2String( CoordinateType const& ctype ){
 
         case CoordinateType::Base:
             return "Base";
+        case CoordinateType::ECEF:
+            return "ECEF";
+        case CoordinateType::ENU:
+            return "ENU";
         case CoordinateType::Geodetic:
             return "Geodetic";
+        case CoordinateType::MGRS:
+            return "MGRS";
+        case CoordinateType::NED:
+            return "NED";
         case CoordinateType::UTM:
             return "UTM";
         default:
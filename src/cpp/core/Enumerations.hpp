@@ -15,6 +15,9 @@ namespace GEO{
  * @class Datum
  *
  * Common Geographic Datums which are supported.
+ *
+ * EGM96 is WGS84 with altitudes above the EGM96 geoid instead of the
+ * ellipsoid, see GeoidModel.
  */
 enum class Datum{
 
@@ -35,7 +38,11 @@ std::string Datum2WKT_string( Datum const& datum );
 enum class CoordinateType{
 
     Base,
+    ECEF,
+    ENU,
     Geodetic,
+    MGRS,
+    NED,
     UTM,
 
 }; /// End of CoordinateType
@@ -36,7 +36,8 @@ GeneralException::GeneralException( std::string const& message,
                                     int const& lineNumber ) : 
                                                m_message(message),
                                                m_filename(filename),
-                                               m_lineNumber(lineNumber){}
+                                               m_lineNumber(lineNumber),
+                                               m_what( message + ", File: " + filename + ", Line: " + num2str(lineNumber)){}
 
 
 } /// End of GEO Namespace
@@ -102,9 +102,7 @@ class GeneralException : public std::exception {
          * Message
         */
         virtual const char* what()const throw(){
-            return std::string( m_message  + std::string(", File: ") + 
-                                m_filename + std::string(", Line: ") + 
-                                num2str(m_lineNumber)).c_str();
+            return m_what.c_str();
         }
 
     private:
@@ -118,6 +116,9 @@ class GeneralException : public std::exception {
         /// Line Number
         int m_lineNumber;
 
+        /// Full message, kept so what() does not point at a temporary
+        std::string m_what;
+
 
 }; /// End of NotImplementedException
 
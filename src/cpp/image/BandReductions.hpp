@@ -0,0 +1,154 @@
+/**
+ * @file    BandReductions.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_BANDREDUCTIONS_HPP__
+#define __SRC_CPP_IMAGE_BANDREDUCTIONS_HPP__
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/image/MultibandImage.hpp>
+#include <GeoExplore/image/PixelCopy.hpp>
+#include <GeoExplore/image/PlanarBuffer.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+
+/**
+ * @class BandSummary
+ *
+ * Minimum, maximum and mean of one band.
+*/
+class BandSummary{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        BandSummary() : min(0), max(0), sum(0), mean(0), count(0){}
+
+        /// Smallest sample
+        double min;
+
+        /// Largest sample
+        double max;
+
+        /// Sum of the samples
+        double sum;
+
+        /// Mean of the samples
+        double mean;
+
+        /// Number of samples
+        size_t count;
+
+}; /// End of BandSummary Class
+
+
+/**
+ * Summarize one band
+ *
+ * The loop keeps four independent accumulators so the compiler can
+ * vectorize it and the sums do not form one long dependency chain.
+*/
+template <typename DataType>
+BandSummary summarize_band( BandSpan<DataType> const& band ){
+
+    BandSummary output;
+    const size_t count = band.size();
+    if( count == 0 ){
+        return output;
+    }
+
+    const DataType* data = band.data();
+    DataType mn[4] = { data[0], data[0], data[0], data[0] };
+    DataType mx[4] = { data[0], data[0], data[0], data[0] };
+    double   sm[4] = { 0, 0, 0, 0 };
+
+    size_t i=0;
+    for( ; i+4<=count; i+=4 ){
+        for( int k=0; k<4; k++ ){
+            mn[k] = std::min( mn[k], data[i+k] );
+            mx[k] = std::max( mx[k], data[i+k] );
+            sm[k] += data[i+k];
+        }
+    }
+    for( ; i<count; i++ ){
+        mn[0] = std::min( mn[0], data[i] );
+        mx[0] = std::max( mx[0], data[i] );
+        sm[0] += data[i];
+    }
+
+    output.min   = std::min( std::min( mn[0], mn[1] ), std::min( mn[2], mn[3] ));
+    output.max   = std::max( std::max( mx[0], mx[1] ), std::max( mx[2], mx[3] ));
+    output.sum   = ( sm[0] + sm[1] ) + ( sm[2] + sm[3] );
+    output.count = count;
+    output.mean  = output.sum / count;
+    return output;
+}
+
+/**
+ * Summarize every band of an image, one band per thread
+*/
+template <typename ChannelType>
+std::vector<BandSummary> summarize_bands( MultibandImage<ChannelType> const& image ){
+
+    std::vector<BandSummary> output( std::max( image.bands(), 0 ));
+    if( image.empty() ){
+        return output;
+    }
+    parallel_for( 0, output.size(), [&]( const size_t& b, const int& /*thread_id*/ ){
+        output[b] = summarize_band( image.band( (int)b ));
+    });
+    return output;
+}
+
+/**
+ * Compute a weighted sum of the bands at every pixel
+ *
+ * Useful for band ratios, spectral indices and projecting a hyperspectral
+ * cube onto a single component.  Bands are accumulated one at a time so
+ * the inner loop streams over contiguous samples.
+ *
+ * @param[in]  image   Input image.
+ * @param[in]  weights One weight per band.
+ * @param[out] output  Row-major result with rows*cols values.
+*/
+template <typename ChannelType>
+void weighted_band_sum( MultibandImage<ChannelType> const& image,
+                        std::vector<double> const&         weights,
+                        std::vector<double>&               output ){
+
+    typedef typename ChannelType::type datatype;
+
+    if( (int)weights.size() != image.bands() ){
+        throw GEO::GeneralException("Weight count must match the band count.", __FILE__, __LINE__);
+    }
+    const size_t count = (size_t)image.rows() * image.cols();
+    output.assign( count, 0 );
+    if( image.empty() ){
+        return;
+    }
+
+    double* dst = output.data();
+    parallel_blocks( count, sizeof(double) + sizeof(datatype) * image.bands(), [&]( const size_t& begin, const size_t& end ){
+        for( int b=0; b<image.bands(); b++ ){
+            const double w = weights[b];
+            const datatype* src = image.band(b).data();
+            for( size_t i=begin; i<end; i++ ){
+                dst[i] += w * src[i];
+            }
+        }
+    });
+}
+
+} /// End of GEO Namespace
+
+#endif
@@ -13,34 +13,26 @@ namespace GEO{
 
 
 /**
- * @class BaseResource
+ * @class ReadOnlyResource
+ *
+ * Resource whose pixels are only read by value, such as band-sequential
+ * storage where no pixel exists in memory to reference.
 */
 template <typename PixelType>
-class BaseResource{
+class ReadOnlyResource{
 
     public:
-        
 
         /**
          * Return the pixel value
         */
         virtual PixelType operator[]( const int& idx )const = 0;
 
-        /**
-         * Return the pixel reference
-        */
-        virtual PixelType& operator[]( const int& idx ) = 0;
-        
         /**
          * Return the pixel value
         */
         virtual PixelType  operator()( const int& x, const int& y ) const = 0;
 
-        /**
-         * Return the pixel reference
-        */
-        virtual PixelType& operator()( const int& x, const int& y ) = 0;
-        
         /**
          * Return the number of image rows
         */
@@ -57,6 +49,30 @@ class BaseResource{
         */
         virtual int channels()const = 0;
 
+}; /// End of ReadOnlyResource Class
+
+
+/**
+ * @class BaseResource
+*/
+template <typename PixelType>
+class BaseResource : public ReadOnlyResource<PixelType> {
+
+    public:
+
+        using ReadOnlyResource<PixelType>::operator[];
+        using ReadOnlyResource<PixelType>::operator();
+
+        /**
+         * Return the pixel reference
+        */
+        virtual PixelType& operator[]( const int& idx ) = 0;
+
+        /**
+         * Return the pixel reference
+        */
+        virtual PixelType& operator()( const int& x, const int& y ) = 0;
+
 }; /// End of BaseResource Class
 
 } /// End of GEO Namespace
@@ -0,0 +1,290 @@
+/**
+ * @file    GeoTransform.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "GeoTransform.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+
+namespace GEO{
+
+/// Points mapped per pass.  Keeps the scratch arrays in cache.
+static const size_t GEOTRANSFORM_CHUNK = 4096;
+
+/**
+ * Frame type, x and y of a geodetic coordinate
+*/
+static CoordinateType frame_type( CoordinateGeodetic_d const* ){ return CoordinateType::Geodetic; }
+static double world_x( CoordinateGeodetic_d const& coordinate ){ return coordinate.longitude(); }
+static double world_y( CoordinateGeodetic_d const& coordinate ){ return coordinate.latitude(); }
+static bool in_frame( CoordinateGeodetic_d const& coordinate, CoordinateFrame const& frame ){
+    return coordinate.datum() == frame.datum;
+}
+static CoordinateGeodetic_d make_coordinate( const double& x, const double& y, const double& z,
+                                             CoordinateFrame const& frame, CoordinateGeodetic_d const* ){
+    return CoordinateGeodetic_d( y, x, z, frame.datum );
+}
+
+/**
+ * Frame type, x and y of a UTM coordinate
+*/
+static CoordinateType frame_type( CoordinateUTM_d const* ){ return CoordinateType::UTM; }
+static double world_x( CoordinateUTM_d const& coordinate ){ return coordinate.easting(); }
+static double world_y( CoordinateUTM_d const& coordinate ){ return coordinate.northing(); }
+static bool in_frame( CoordinateUTM_d const& coordinate, CoordinateFrame const& frame ){
+    return coordinate.datum() == frame.datum && coordinate.zone() == frame.zone;
+}
+static CoordinateUTM_d make_coordinate( const double& x, const double& y, const double& z,
+                                        CoordinateFrame const& frame, CoordinateUTM_d const* ){
+    return CoordinateUTM_d( frame.zone, x, y, z, frame.datum );
+}
+
+
+/**
+ * Map pixels to coordinates, optionally through a transformer
+*/
+template <typename CoordType>
+static void pixels_to_coordinates( GeoTransform const& geotransform,
+                                   std::vector<double> const& cols,
+                                   std::vector<double> const& rows,
+                                   OGR::CoordinateTransformer const* transformer,
+                                   std::vector<CoordType>& output ){
+
+    if( cols.size() != rows.size() ){
+        throw GeneralException("Column and row counts differ.", __FILE__, __LINE__);
+    }
+
+    // the output frame is the transformer target, or the image frame
+    CoordinateFrame const& frame = ( transformer == nullptr ) ? geotransform.getFrame() : transformer->target();
+    if( transformer != nullptr && transformer->source() != geotransform.getFrame() ){
+        throw GeneralException("Transformer source is not the image frame.", __FILE__, __LINE__);
+    }
+    if( frame.type != frame_type( (CoordType const*)nullptr )){
+        throw GeneralException("Output coordinates do not match the frame type.", __FILE__, __LINE__);
+    }
+
+    output.clear();
+    output.reserve( cols.size() );
+    double x[GEOTRANSFORM_CHUNK], y[GEOTRANSFORM_CHUNK], z[GEOTRANSFORM_CHUNK];
+    for( size_t start=0; start<cols.size(); start += GEOTRANSFORM_CHUNK ){
+
+        const size_t count = std::min( GEOTRANSFORM_CHUNK, cols.size() - start );
+        geotransform.pixelToWorld( count, &cols[start], &rows[start], x, y );
+        std::fill( z, z + count, 0.0 );
+        if( transformer != nullptr ){
+            transformer->transform( count, x, y, z );
+        }
+        for( size_t i=0; i<count; i++ ){
+            output.push_back( make_coordinate( x[i], y[i], z[i], frame, (CoordType const*)nullptr ));
+        }
+    }
+}
+
+/**
+ * Map coordinates to pixels, optionally through a transformer
+*/
+template <typename CoordType>
+static void coordinates_to_pixels( GeoTransform const& geotransform,
+                                   std::vector<CoordType> const& coordinates,
+                                   OGR::CoordinateTransformer const* transformer,
+                                   std::vector<double>& cols,
+                                   std::vector<double>& rows ){
+
+    // the input frame is the transformer source, or the image frame
+    CoordinateFrame const& frame = ( transformer == nullptr ) ? geotransform.getFrame() : transformer->source();
+    if( transformer != nullptr && transformer->target() != geotransform.getFrame() ){
+        throw GeneralException("Transformer target is not the image frame.", __FILE__, __LINE__);
+    }
+    if( frame.type != frame_type( (CoordType const*)nullptr )){
+        throw GeneralException("Input coordinates do not match the frame type.", __FILE__, __LINE__);
+    }
+
+    cols.resize( coordinates.size() );
+    rows.resize( coordinates.size() );
+    double x[GEOTRANSFORM_CHUNK], y[GEOTRANSFORM_CHUNK];
+    for( size_t start=0; start<coordinates.size(); start += GEOTRANSFORM_CHUNK ){
+
+        const size_t count = std::min( GEOTRANSFORM_CHUNK, coordinates.size() - start );
+        for( size_t i=0; i<count; i++ ){
+            CoordType const& coordinate = coordinates[start+i];
+            if( in_frame( coordinate, frame ) == false ){
+                throw GeneralException("Coordinate is not in the expected frame.", __FILE__, __LINE__);
+            }
+            x[i] = world_x( coordinate );
+            y[i] = world_y( coordinate );
+        }
+        if( transformer != nullptr ){
+            transformer->transform( count, x, y );
+        }
+        geotransform.worldToPixel( count, x, y, &cols[start], &rows[start] );
+    }
+}
+
+
+/**
+ * Default Constructor
+*/
+GeoTransform::GeoTransform() : m_valid(false){
+
+    const double identity[6] = { 0, 1, 0, 0, 0, 1 };
+    std::copy( identity, identity + 6, m_forward );
+    std::copy( identity, identity + 6, m_inverse );
+}
+
+/**
+ * Parameterized Constructor
+*/
+GeoTransform::GeoTransform( const double coefficients[6], CoordinateFrame const& frame )
+  : m_frame(frame),
+    m_valid(true)
+{
+    std::copy( coefficients, coefficients + 6, m_forward );
+    computeInverse();
+}
+
+/**
+ * Compute the inverse coefficients
+*/
+void GeoTransform::computeInverse(){
+
+    const double det = m_forward[1] * m_forward[5] - m_forward[2] * m_forward[4];
+    if( std::fabs( det ) < 1e-300 ){
+        throw GeneralException("Geotransform is not invertible.", __FILE__, __LINE__);
+    }
+
+    m_inverse[1] =  m_forward[5] / det;
+    m_inverse[2] = -m_forward[2] / det;
+    m_inverse[4] = -m_forward[4] / det;
+    m_inverse[5] =  m_forward[1] / det;
+    m_inverse[0] = -( m_inverse[1] * m_forward[0] + m_inverse[2] * m_forward[3] );
+    m_inverse[3] = -( m_inverse[4] * m_forward[0] + m_inverse[5] * m_forward[3] );
+}
+
+/**
+ * Get the transform of a window
+*/
+GeoTransform GeoTransform::window( Rect const& window, const int& scale )const{
+
+    if( m_valid == false ){
+        return GeoTransform();
+    }
+
+    double coefficients[6];
+    coefficients[0] = m_forward[0] + window.x() * m_forward[1] + window.y() * m_forward[2];
+    coefficients[3] = m_forward[3] + window.x() * m_forward[4] + window.y() * m_forward[5];
+    coefficients[1] = m_forward[1] * scale;
+    coefficients[2] = m_forward[2] * scale;
+    coefficients[4] = m_forward[4] * scale;
+    coefficients[5] = m_forward[5] * scale;
+    return GeoTransform( coefficients, m_frame );
+}
+
+/**
+ * Map pixel coordinates to world coordinates
+*/
+void GeoTransform::pixelToWorld( const size_t& count, const double* cols, const double* rows, double* x, double* y )const{
+
+    const double c0 = m_forward[0], c1 = m_forward[1], c2 = m_forward[2];
+    const double c3 = m_forward[3], c4 = m_forward[4], c5 = m_forward[5];
+    for( size_t i=0; i<count; i++ ){
+        x[i] = c0 + cols[i] * c1 + rows[i] * c2;
+        y[i] = c3 + cols[i] * c4 + rows[i] * c5;
+    }
+}
+
+/**
+ * Map world coordinates to pixel coordinates
+*/
+void GeoTransform::worldToPixel( const size_t& count, const double* x, const double* y, double* cols, double* rows )const{
+
+    const double c0 = m_inverse[0], c1 = m_inverse[1], c2 = m_inverse[2];
+    const double c3 = m_inverse[3], c4 = m_inverse[4], c5 = m_inverse[5];
+    for( size_t i=0; i<count; i++ ){
+        cols[i] = c0 + x[i] * c1 + y[i] * c2;
+        rows[i] = c3 + x[i] * c4 + y[i] * c5;
+    }
+}
+
+/**
+ * Map pixel coordinates to geodetic coordinates
+*/
+void GeoTransform::pixelToWorld( std::vector<double> const& cols,
+                                 std::vector<double> const& rows,
+                                 std::vector<CoordinateGeodetic_d>& output )const{
+    pixels_to_coordinates( *this, cols, rows, nullptr, output );
+}
+
+/**
+ * Map pixel coordinates to UTM coordinates
+*/
+void GeoTransform::pixelToWorld( std::vector<double> const& cols,
+                                 std::vector<double> const& rows,
+                                 std::vector<CoordinateUTM_d>& output )const{
+    pixels_to_coordinates( *this, cols, rows, nullptr, output );
+}
+
+/**
+ * Map pixel coordinates to geodetic coordinates through a transformer
+*/
+void GeoTransform::pixelToWorld( std::vector<double> const& cols,
+                                 std::vector<double> const& rows,
+                                 OGR::CoordinateTransformer const& transformer,
+                                 std::vector<CoordinateGeodetic_d>& output )const{
+    pixels_to_coordinates( *this, cols, rows, &transformer, output );
+}
+
+/**
+ * Map pixel coordinates to UTM coordinates through a transformer
+*/
+void GeoTransform::pixelToWorld( std::vector<double> const& cols,
+                                 std::vector<double> const& rows,
+                                 OGR::CoordinateTransformer const& transformer,
+                                 std::vector<CoordinateUTM_d>& output )const{
+    pixels_to_coordinates( *this, cols, rows, &transformer, output );
+}
+
+/**
+ * Map geodetic coordinates to pixel coordinates
+*/
+void GeoTransform::worldToPixel( std::vector<CoordinateGeodetic_d> const& coordinates,
+                                 std::vector<double>& cols,
+                                 std::vector<double>& rows )const{
+    coordinates_to_pixels( *this, coordinates, nullptr, cols, rows );
+}
+
+/**
+ * Map UTM coordinates to pixel coordinates
+*/
+void GeoTransform::worldToPixel( std::vector<CoordinateUTM_d> const& coordinates,
+                                 std::vector<double>& cols,
+                                 std::vector<double>& rows )const{
+    coordinates_to_pixels( *this, coordinates, nullptr, cols, rows );
+}
+
+/**
+ * Map geodetic coordinates to pixel coordinates through a transformer
+*/
+void GeoTransform::worldToPixel( std::vector<CoordinateGeodetic_d> const& coordinates,
+                                 OGR::CoordinateTransformer const& transformer,
+                                 std::vector<double>& cols,
+                                 std::vector<double>& rows )const{
+    coordinates_to_pixels( *this, coordinates, &transformer, cols, rows );
+}
+
+/**
+ * Map UTM coordinates to pixel coordinates through a transformer
+*/
+void GeoTransform::worldToPixel( std::vector<CoordinateUTM_d> const& coordinates,
+                                 OGR::CoordinateTransformer const& transformer,
+                                 std::vector<double>& cols,
+                                 std::vector<double>& rows )const{
+    coordinates_to_pixels( *this, coordinates, &transformer, cols, rows );
+}
+
+} /// End of GEO Namespace
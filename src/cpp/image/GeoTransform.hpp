@@ -0,0 +1,192 @@
+/**
+ * @file    GeoTransform.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_GEOTRANSFORM_HPP__
+#define __SRC_CPP_IMAGE_GEOTRANSFORM_HPP__
+
+/// C++ Standard Libraries
+#include <cstddef>
+#include <vector>
+
+/// GeoExplore Libraries
+#include <GeoExplore/coordinate/CoordinateFrame.hpp>
+#include <GeoExplore/coordinate/CoordinateGeodetic.hpp>
+#include <GeoExplore/coordinate/CoordinateUTM.hpp>
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/io/OGR_Driver.hpp>
+
+namespace GEO{
+
+/**
+ * @class GeoTransform
+ *
+ * Affine mapping between pixel and world coordinates, using the GDAL
+ * coefficient order
+ *
+ *    x = c[0] + col * c[1] + row * c[2]
+ *    y = c[3] + col * c[4] + row * c[5]
+ *
+ * Pixel coordinates are continuous: pixel (0,0) covers [0,1) x [0,1), so
+ * its center is at (0.5,0.5).  World x and y are in the coordinate frame,
+ * which is longitude/latitude or easting/northing.
+ *
+ * The array methods run straight loops over the coordinates and are meant
+ * for mapping millions of points at a time.
+*/
+class GeoTransform{
+
+    public:
+
+        /**
+         * Default Constructor.  Identity transform with no frame.
+        */
+        GeoTransform();
+
+        /**
+         * Parameterized Constructor
+         *
+         * @param[in] coefficients Affine coefficients in GDAL order.
+         * @param[in] frame        Frame of the world coordinates.
+        */
+        GeoTransform( const double coefficients[6], CoordinateFrame const& frame );
+
+        /**
+         * Check if the image is georeferenced
+        */
+        bool isValid()const{ return m_valid; }
+
+        /**
+         * Get a coefficient
+        */
+        double operator[]( const int& idx )const{ return m_forward[idx]; }
+
+        /**
+         * Get the world frame
+        */
+        CoordinateFrame const& getFrame()const{ return m_frame; }
+
+        /**
+         * Get the datum
+        */
+        Datum getDatum()const{ return m_frame.datum; }
+
+        /**
+         * Get the transform of a window of the image
+         *
+         * @param[in] window Window in pixel coordinates.
+         * @param[in] scale  Source pixels per window pixel, for reduced reads.
+        */
+        GeoTransform window( Rect const& window, const int& scale = 1 )const;
+
+        /**
+         * Map pixel coordinates to world coordinates
+         *
+         * @param[in]  count Number of points.
+         * @param[in]  cols  Column of each point.
+         * @param[in]  rows  Row of each point.
+         * @param[out] x     World x of each point.
+         * @param[out] y     World y of each point.
+        */
+        void pixelToWorld( const size_t& count, const double* cols, const double* rows, double* x, double* y )const;
+
+        /**
+         * Map world coordinates to pixel coordinates
+         *
+         * @param[in]  count Number of points.
+         * @param[in]  x     World x of each point.
+         * @param[in]  y     World y of each point.
+         * @param[out] cols  Column of each point.
+         * @param[out] rows  Row of each point.
+        */
+        void worldToPixel( const size_t& count, const double* x, const double* y, double* cols, double* rows )const;
+
+        /**
+         * Map pixel coordinates to geodetic coordinates.  The frame must be geodetic.
+        */
+        void pixelToWorld( std::vector<double> const& cols,
+                           std::vector<double> const& rows,
+                           std::vector<CoordinateGeodetic_d>& output )const;
+
+        /**
+         * Map pixel coordinates to UTM coordinates.  The frame must be UTM.
+        */
+        void pixelToWorld( std::vector<double> const& cols,
+                           std::vector<double> const& rows,
+                           std::vector<CoordinateUTM_d>& output )const;
+
+        /**
+         * Map pixel coordinates to geodetic coordinates through a transformer
+         * whose source is the image frame.
+        */
+        void pixelToWorld( std::vector<double> const& cols,
+                           std::vector<double> const& rows,
+                           OGR::CoordinateTransformer const& transformer,
+                           std::vector<CoordinateGeodetic_d>& output )const;
+
+        /**
+         * Map pixel coordinates to UTM coordinates through a transformer
+         * whose source is the image frame.
+        */
+        void pixelToWorld( std::vector<double> const& cols,
+                           std::vector<double> const& rows,
+                           OGR::CoordinateTransformer const& transformer,
+                           std::vector<CoordinateUTM_d>& output )const;
+
+        /**
+         * Map geodetic coordinates to pixel coordinates.  The frame must be geodetic.
+        */
+        void worldToPixel( std::vector<CoordinateGeodetic_d> const& coordinates,
+                           std::vector<double>& cols,
+                           std::vector<double>& rows )const;
+
+        /**
+         * Map UTM coordinates to pixel coordinates.  The frame must be UTM.
+        */
+        void worldToPixel( std::vector<CoordinateUTM_d> const& coordinates,
+                           std::vector<double>& cols,
+                           std::vector<double>& rows )const;
+
+        /**
+         * Map geodetic coordinates to pixel coordinates through a transformer
+         * whose target is the image frame.
+        */
+        void worldToPixel( std::vector<CoordinateGeodetic_d> const& coordinates,
+                           OGR::CoordinateTransformer const& transformer,
+                           std::vector<double>& cols,
+                           std::vector<double>& rows )const;
+
+        /**
+         * Map UTM coordinates to pixel coordinates through a transformer
+         * whose target is the image frame.
+        */
+        void worldToPixel( std::vector<CoordinateUTM_d> const& coordinates,
+                           OGR::CoordinateTransformer const& transformer,
+                           std::vector<double>& cols,
+                           std::vector<double>& rows )const;
+
+    private:
+
+        /**
+         * Compute the inverse coefficients
+        */
+        void computeInverse();
+
+        /// Pixel to world coefficients
+        double m_forward[6];
+
+        /// World to pixel coefficients
+        double m_inverse[6];
+
+        /// World Frame
+        CoordinateFrame m_frame;
+
+        /// Georeferenced Flag
+        bool m_valid;
+
+}; /// End of GeoTransform Class
+
+} /// End of GEO Namespace
+
+#endif
@@ -6,11 +6,19 @@
 #ifndef __SRC_CPP_IMAGE_IMAGETYPE_HPP__
 #define __SRC_CPP_IMAGE_IMAGETYPE_HPP__
 
+/// C++ Standard Libraries
+#include <utility>
+
 /// GeoExplore Libraries
 #include <GeoExplore/image/BaseResource.hpp>
 #include <GeoExplore/image/DiskResource.hpp>
+#include <GeoExplore/image/GeoTransform.hpp>
 #include <GeoExplore/image/MemoryResource.hpp>
-#include <GeoExplore/image/MetadataContainerBase.hpp>
+#include <GeoExplore/image/MetadataContainer.hpp>
+#include <GeoExplore/image/PlanarResource.hpp>
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/image/TiledResource.hpp>
+#include <GeoExplore/image/ViewResource.hpp>
 
 
 namespace GEO {
@@ -30,6 +38,9 @@ class Image_{
         /// define the datatype
         typedef typename pixeltype::channeltype datatype;
 
+        /// Pixel reference type, a value for read-only resources
+        typedef decltype( std::declval<ResourceType&>()( 0, 0 )) reference;
+
         /**
          * Default Constructor
         */
@@ -78,14 +89,14 @@ class Image_{
          * Get the pixel value
         */
         PixelType operator()( const int& row, const int& col )const{
-            return m_resource(row,col);
+            return m_resource(col,row);
         }
 
         /**
-         * Get the pixel reference
+         * Get the pixel reference, or the pixel value for read-only resources
         */
-        PixelType& operator()( const int& row, const int& col ){
-            return m_resource(row,col);
+        reference operator()( const int& row, const int& col ){
+            return m_resource(col,row);
         }
 
         /**
@@ -102,19 +113,105 @@ class Image_{
             return m_resource;
         }
 
+        /**
+         * Get a reference to the resource
+        */
+        ResourceType& resource(){
+            return m_resource;
+        }
+
+        /**
+         * Get the metadata.  Copies and views of an image share the same
+         * container, so it may be null for images built in memory.
+        */
+        MetadataContainer::ptr_t getMetadata()const{
+            return m_metadata;
+        }
+
+        /**
+         * Set the metadata
+        */
+        void setMetadata( MetadataContainer::ptr_t metadata ){
+            m_metadata = metadata;
+        }
+
+        /**
+         * Get the geotransform and datum
+        */
+        GeoTransform const& getGeoTransform()const{
+            return m_geotransform;
+        }
+
+        /**
+         * Set the geotransform and datum
+        */
+        void setGeoTransform( GeoTransform const& geotransform ){
+            m_geotransform = geotransform;
+        }
+
+        /**
+         * Map pixel coordinates to world coordinates.  Takes the same
+         * arguments as GeoTransform::pixelToWorld.
+        */
+        template <typename... Args>
+        void pixelToWorld( Args&&... args )const{
+            m_geotransform.pixelToWorld( std::forward<Args>(args)... );
+        }
+
+        /**
+         * Map world coordinates to pixel coordinates.  Takes the same
+         * arguments as GeoTransform::worldToPixel.
+        */
+        template <typename... Args>
+        void worldToPixel( Args&&... args )const{
+            m_geotransform.worldToPixel( std::forward<Args>(args)... );
+        }
+
         private:
 
             /// internal pixel data
             ResourceType  m_resource;    
             
             /// Internal Metadata
-            MetadataContainerBase::ptr_t m_metadata;
+            MetadataContainer::ptr_t m_metadata;
+
+            /// Pixel to world mapping
+            GeoTransform m_geotransform;
 
 };  /// End of BaseImage Class
 
 /// Common Image Aliases
 template <typename PixelType> using Image     = Image_<PixelType,MemoryResource<PixelType> >;
 template <typename PixelType> using DiskImage = Image_<PixelType,DiskResource<PixelType> >;
+template <typename PixelType> using ImageView = Image_<PixelType,ViewResource<PixelType> >;
+template <typename PixelType> using PlanarImage = Image_<PixelType,PlanarResource<PixelType> >;
+template <typename PixelType> using TiledImage  = Image_<PixelType,TiledResource<PixelType> >;
+
+/**
+ * Create a view into a window of an image.  No pixels are copied and
+ * writes through the view modify the parent image, which detaches first
+ * if it shares its pixels.
+*/
+template <typename PixelType>
+ImageView<PixelType> make_view( Image<PixelType>& image, Rect const& window ){
+    ImageView<PixelType> output;
+    output.setResource( ViewResource<PixelType>( image.resource(), window ));
+    output.setMetadata( image.getMetadata() );
+    output.setGeoTransform( image.getGeoTransform().window( window ));
+    return output;
+}
+
+/**
+ * Create a view into a window of another view
+*/
+template <typename PixelType>
+ImageView<PixelType> make_view( ImageView<PixelType> const& image, Rect const& window ){
+    ImageView<PixelType> output;
+    output.setResource( ViewResource<PixelType>( image.getResource(), window ));
+    output.setMetadata( image.getMetadata() );
+    output.setGeoTransform( image.getGeoTransform().window( window ));
+    return output;
+}
 
 } /// End of namespace GEO
 
@@ -0,0 +1,156 @@
+/**
+ * @file    ImageSampling.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "ImageSampling.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+/// GeoExplore Libraries
+#include <GeoExplore/utilities/SpaceFillingCurves.hpp>
+
+namespace GEO{
+
+/// Points whose offsets and weights are computed together
+static const size_t INTERPOLATION_BLOCK = 256;
+
+/**
+ * Group sample points by tile
+*/
+void group_points_by_tile( const int& image_rows,
+                           const int& image_cols,
+                           const int& tile_size,
+                           std::vector<double> const& cols,
+                           std::vector<double> const& rows,
+                           std::vector<size_t>& order,
+                           std::vector<SampleTile>& tiles ){
+
+    order.clear();
+    tiles.clear();
+
+    // key every point inside the image by the morton code of its tile
+    std::vector<std::pair<uint64_t,size_t> > keys;
+    keys.reserve( cols.size() );
+    for( size_t i=0; i<cols.size(); i++ ){
+        if( !( cols[i] >= 0 && cols[i] < image_cols && rows[i] >= 0 && rows[i] < image_rows )){
+            continue;
+        }
+        const uint32_t tx = (uint32_t)( cols[i] / tile_size );
+        const uint32_t ty = (uint32_t)( rows[i] / tile_size );
+        keys.push_back( std::make_pair( morton_encode( tx, ty ), i ));
+    }
+    std::sort( keys.begin(), keys.end() );
+
+    // split into runs of one tile
+    order.resize( keys.size() );
+    for( size_t i=0; i<keys.size(); i++ ){
+        order[i] = keys[i].second;
+        if( i == 0 || keys[i].first != keys[i-1].first ){
+            uint32_t tx, ty;
+            morton_decode( keys[i].first, tx, ty );
+            SampleTile tile;
+            tile.tile_x = tx;
+            tile.tile_y = ty;
+            tile.begin  = i;
+            tile.end    = i;
+            tiles.push_back( tile );
+        }
+        tiles.back().end = i+1;
+    }
+}
+
+/**
+ * Compute the window of a sample tile
+*/
+Rect sample_tile_window( SampleTile const& tile,
+                         const int& tile_size,
+                         const int& image_rows,
+                         const int& image_cols,
+                         Interpolation const& interpolation ){
+
+    const int border = ( interpolation == Interpolation::BILINEAR ) ? 1 : 0;
+    const int x0 = std::max( tile.tile_x * tile_size - border, 0 );
+    const int y0 = std::max( tile.tile_y * tile_size - border, 0 );
+    const int x1 = std::min( ( tile.tile_x + 1 ) * tile_size + border, image_cols );
+    const int y1 = std::min( ( tile.tile_y + 1 ) * tile_size + border, image_rows );
+    return Rect( x0, y0, x1 - x0, y1 - y0 );
+}
+
+/**
+ * Interpolate points from a window
+*/
+void interpolate_points( const double*        window_data,
+                         Rect const&          window,
+                         const int&           channels,
+                         const int&           image_rows,
+                         const int&           image_cols,
+                         const size_t*        indices,
+                         const size_t&        count,
+                         const double*        cols,
+                         const double*        rows,
+                         Interpolation const& interpolation,
+                         double*              output ){
+
+    const int stride = window.width();
+    size_t o00[INTERPOLATION_BLOCK], o01[INTERPOLATION_BLOCK], o10[INTERPOLATION_BLOCK], o11[INTERPOLATION_BLOCK];
+    double fx[INTERPOLATION_BLOCK], fy[INTERPOLATION_BLOCK], values[INTERPOLATION_BLOCK];
+
+    for( size_t start=0; start<count; start += INTERPOLATION_BLOCK ){
+
+        const size_t block = std::min( INTERPOLATION_BLOCK, count - start );
+
+        // nearest pixel
+        if( interpolation == Interpolation::NEAREST ){
+            for( size_t i=0; i<block; i++ ){
+                const size_t idx = indices[start+i];
+                const int x = std::min( (int)cols[idx], image_cols-1 ) - window.x();
+                const int y = std::min( (int)rows[idx], image_rows-1 ) - window.y();
+                o00[i] = (size_t)y * stride + x;
+            }
+            for( int ch=0; ch<channels; ch++ ){
+                for( size_t i=0; i<block; i++ ){
+                    output[ indices[start+i] * channels + ch ] = window_data[ o00[i] * channels + ch ];
+                }
+            }
+            continue;
+        }
+
+        // neighbor offsets and weights, clamped to the image edges
+        for( size_t i=0; i<block; i++ ){
+            const size_t idx = indices[start+i];
+            const double u = cols[idx] - 0.5;
+            const double v = rows[idx] - 0.5;
+            const double fu = std::floor( u );
+            const double fv = std::floor( v );
+            fx[i] = u - fu;
+            fy[i] = v - fv;
+            const int xa = std::min( std::max( (int)fu,     0 ), image_cols-1 ) - window.x();
+            const int xb = std::min( std::max( (int)fu + 1, 0 ), image_cols-1 ) - window.x();
+            const int ya = std::min( std::max( (int)fv,     0 ), image_rows-1 ) - window.y();
+            const int yb = std::min( std::max( (int)fv + 1, 0 ), image_rows-1 ) - window.y();
+            o00[i] = (size_t)ya * stride + xa;
+            o01[i] = (size_t)ya * stride + xb;
+            o10[i] = (size_t)yb * stride + xa;
+            o11[i] = (size_t)yb * stride + xb;
+        }
+
+        // blend each channel
+        for( int ch=0; ch<channels; ch++ ){
+            for( size_t i=0; i<block; i++ ){
+                const double top    = window_data[ o00[i]*channels + ch ] * ( 1 - fx[i] ) + window_data[ o01[i]*channels + ch ] * fx[i];
+                const double bottom = window_data[ o10[i]*channels + ch ] * ( 1 - fx[i] ) + window_data[ o11[i]*channels + ch ] * fx[i];
+                values[i] = top * ( 1 - fy[i] ) + bottom * fy[i];
+            }
+            for( size_t i=0; i<block; i++ ){
+                output[ indices[start+i] * channels + ch ] = values[i];
+            }
+        }
+    }
+}
+
+} /// End of GEO Namespace
@@ -0,0 +1,242 @@
+/**
+ * @file    ImageSampling.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_IMAGESAMPLING_HPP__
+#define __SRC_CPP_IMAGE_IMAGESAMPLING_HPP__
+
+/// C++ Standard Libraries
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/image/Image.hpp>
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+
+/**
+ * @class Interpolation
+ *
+ * Method used to sample between pixel centers.
+*/
+enum class Interpolation{
+    NEAREST,
+    BILINEAR,
+}; /// End of Interpolation Enumeration
+
+/// Tile edge used to group sample points
+const int SAMPLE_TILE_SIZE = 256;
+
+/**
+ * @class SampleTile
+ *
+ * Run of sorted sample points which fall inside one tile.
+*/
+class SampleTile{
+
+    public:
+
+        /// Tile column
+        int tile_x;
+
+        /// Tile row
+        int tile_y;
+
+        /// First entry of the run in the sorted order
+        size_t begin;
+
+        /// One past the last entry of the run
+        size_t end;
+
+}; /// End of SampleTile Class
+
+
+/**
+ * Group sample points by tile
+ *
+ * Points are sorted by the Morton code of their tile, so neighboring tiles
+ * are processed close together.  Points outside the image are left out.
+ *
+ * @param[in]  image_rows Image rows.
+ * @param[in]  image_cols Image columns.
+ * @param[in]  tile_size  Tile edge in pixels.
+ * @param[in]  cols       Column of each point.
+ * @param[in]  rows       Row of each point.
+ * @param[out] order      Point indices sorted by tile.
+ * @param[out] tiles      Runs of order falling in each tile.
+*/
+void group_points_by_tile( const int& image_rows,
+                           const int& image_cols,
+                           const int& tile_size,
+                           std::vector<double> const& cols,
+                           std::vector<double> const& rows,
+                           std::vector<size_t>& order,
+                           std::vector<SampleTile>& tiles );
+
+/**
+ * Compute the pixels needed to sample the points of a tile
+ *
+ * Bilinear sampling needs one extra pixel around the tile.  The window
+ * is clipped to the image.
+*/
+Rect sample_tile_window( SampleTile const& tile,
+                         const int& tile_size,
+                         const int& image_rows,
+                         const int& image_cols,
+                         Interpolation const& interpolation );
+
+/**
+ * Interpolate points from a window of samples
+ *
+ * Neighbor offsets and weights are computed for a block of points first,
+ * then each channel is blended in a single straight loop which the
+ * compiler can vectorize.
+ *
+ * @param[in]  window_data   Interleaved samples of the window, row-major.
+ * @param[in]  window        Window in image pixel coordinates.
+ * @param[in]  channels      Samples per pixel.
+ * @param[in]  image_rows    Image rows.
+ * @param[in]  image_cols    Image columns.
+ * @param[in]  indices       Points to sample.
+ * @param[in]  count         Number of indices.
+ * @param[in]  cols          Column of every point.
+ * @param[in]  rows          Row of every point.
+ * @param[in]  interpolation Interpolation method.
+ * @param[out] output        Interleaved samples of every point.
+*/
+void interpolate_points( const double*        window_data,
+                         Rect const&          window,
+                         const int&           channels,
+                         const int&           image_rows,
+                         const int&           image_cols,
+                         const size_t*        indices,
+                         const size_t&        count,
+                         const double*        cols,
+                         const double*        rows,
+                         Interpolation const& interpolation,
+                         double*              output );
+
+/**
+ * Sample an image at a list of points
+ *
+ * Points are grouped by tile and tiles are spread over threads.  Each tile
+ * window is fetched once with fetch_window( window, thread_id, buffer ),
+ * which must fill buffer with the interleaved samples of the window.
+ *
+ * Pixel coordinates are continuous, so the center of pixel (0,0) is at
+ * (0.5,0.5).  Points outside the image sample as NaN.
+ *
+ * @param[in]  image_rows    Image rows.
+ * @param[in]  image_cols    Image columns.
+ * @param[in]  channels      Samples per pixel.
+ * @param[in]  cols          Column of each point.
+ * @param[in]  rows          Row of each point.
+ * @param[in]  interpolation Interpolation method.
+ * @param[in]  fetch_window  Window reader.
+ * @param[out] output        channels samples per point, in input order.
+ * @param[in]  threads       Number of threads.  Values <= 0 use the default.
+*/
+template <typename FetchType>
+void sample_points( const int&                 image_rows,
+                    const int&                 image_cols,
+                    const int&                 channels,
+                    std::vector<double> const& cols,
+                    std::vector<double> const& rows,
+                    Interpolation const&       interpolation,
+                    FetchType                  fetch_window,
+                    std::vector<double>&       output,
+                    const int&                 threads = 0 ){
+
+    if( cols.size() != rows.size() ){
+        throw GeneralException("Column and row counts differ.", __FILE__, __LINE__);
+    }
+
+    output.assign( cols.size() * channels, std::numeric_limits<double>::quiet_NaN() );
+
+    // sort the points by tile
+    std::vector<size_t> order;
+    std::vector<SampleTile> tiles;
+    group_points_by_tile( image_rows, image_cols, SAMPLE_TILE_SIZE, cols, rows, order, tiles );
+
+    // each thread reads and interpolates whole tiles
+    const int thread_count = ( threads > 0 ) ? threads : default_thread_count();
+    std::vector<std::vector<double> > buffers( thread_count );
+    parallel_for( 0, tiles.size(), [&]( const size_t& t, const int& thread_id ){
+
+        SampleTile const& tile = tiles[t];
+        const Rect window = sample_tile_window( tile, SAMPLE_TILE_SIZE, image_rows, image_cols, interpolation );
+
+        std::vector<double>& buffer = buffers[thread_id];
+        buffer.resize( (size_t)window.width() * window.height() * channels );
+        fetch_window( window, thread_id, buffer );
+
+        interpolate_points( buffer.data(), window, channels, image_rows, image_cols,
+                            &order[tile.begin], tile.end - tile.begin,
+                            cols.data(), rows.data(), interpolation, output.data() );
+
+    }, thread_count );
+}
+
+
+/**
+ * Sample an image at a list of pixel coordinates
+ *
+ * @param[in]  image         Image to sample.
+ * @param[in]  cols          Column of each point.
+ * @param[in]  rows          Row of each point.
+ * @param[in]  interpolation Interpolation method.
+ * @param[out] output        One sample per channel per point, in input order.
+ * @param[in]  threads       Number of threads.  Values <= 0 use the default.
+*/
+template <typename PixelType, typename ResourceType>
+void sample( Image_<PixelType,ResourceType> const& image,
+             std::vector<double> const& cols,
+             std::vector<double> const& rows,
+             Interpolation const& interpolation,
+             std::vector<double>& output,
+             const int& threads = 0 ){
+
+    const int channels = PixelType().dims();
+    auto fetch_window = [&]( Rect const& window, const int& /*thread_id*/, std::vector<double>& buffer ){
+        size_t i = 0;
+        for( int r=window.y(); r<window.y()+window.height(); r++ ){
+            for( int c=window.x(); c<window.x()+window.width(); c++ ){
+                const PixelType pixel = image( r, c );
+                for( int ch=0; ch<channels; ch++ ){
+                    buffer[i++] = pixel[ch];
+                }
+            }
+        }
+    };
+    sample_points( image.rows(), image.cols(), channels, cols, rows, interpolation, fetch_window, output, threads );
+}
+
+/**
+ * Sample an image at a list of world coordinates
+ *
+ * The coordinates are mapped through the image geotransform, so they
+ * must be in the image frame.
+*/
+template <typename PixelType, typename ResourceType, typename CoordType>
+void sample( Image_<PixelType,ResourceType> const& image,
+             std::vector<CoordType> const& coordinates,
+             Interpolation const& interpolation,
+             std::vector<double>& output,
+             const int& threads = 0 ){
+
+    if( image.getGeoTransform().isValid() == false ){
+        throw GeneralException("Image is not georeferenced.", __FILE__, __LINE__);
+    }
+    std::vector<double> cols, rows;
+    image.worldToPixel( coordinates, cols, rows );
+    sample( image, cols, rows, interpolation, output, threads );
+}
+
+} /// End of GEO Namespace
+
+#endif
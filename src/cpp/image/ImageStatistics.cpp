@@ -0,0 +1,208 @@
+/**
+ * @file    ImageStatistics.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "ImageStatistics.hpp"
+
+namespace GEO{
+
+/// Static Constants
+const int StatisticsOptions::MAX_AUTO_BINS;
+
+/**
+ * Statistics Options Constructor
+*/
+StatisticsOptions::StatisticsOptions() : use_nodata(false),
+                                         nodata_value(0),
+                                         histogram_bins(0),
+                                         histogram_min(0),
+                                         histogram_max(0),
+                                         approximate(false),
+                                         approximate_pixels(1 << 20),
+                                         num_threads(0){
+
+    percentiles.push_back(2);
+    percentiles.push_back(50);
+    percentiles.push_back(98);
+}
+
+/**
+ * Get the no-data value of a band
+*/
+bool StatisticsOptions::getNodata( const int& band, double& value )const{
+
+    // per-band values take precedence
+    if( band >= 0 && band < (int)band_nodata_values.size() && std::isnan( band_nodata_values[band] ) == false ){
+        value = band_nodata_values[band];
+        return true;
+    }
+    if( use_nodata ){
+        value = nodata_value;
+        return true;
+    }
+    return false;
+}
+
+
+/**
+ * Band Statistics Constructor
+*/
+BandStatistics::BandStatistics() : min(0),
+                                   max(0),
+                                   mean(0),
+                                   stddev(0),
+                                   valid_count(0),
+                                   nodata_count(0),
+                                   histogram_min(0),
+                                   histogram_max(0){
+
+}
+
+/**
+ * Estimate a percentile
+*/
+double BandStatistics::percentile( const double& pct )const{
+
+    if( valid_count == 0 || histogram.empty() ){
+        return 0;
+    }
+
+    // walk the cumulative histogram to the target rank
+    const double target = std::max( 0.0, std::min( pct, 100.0 )) / 100.0 * valid_count;
+    const double width = ( histogram_max - histogram_min ) / histogram.size();
+    double cumulative = 0;
+    for( size_t i=0; i<histogram.size(); i++ ){
+        if( histogram[i] > 0 && cumulative + histogram[i] >= target ){
+            const double fraction = ( target - cumulative ) / histogram[i];
+            const double value = histogram_min + ( i + fraction ) * width;
+            return std::max( min, std::min( max, value ));
+        }
+        cumulative += histogram[i];
+    }
+    return max;
+}
+
+
+/**
+ * Band Accumulator Constructor
+*/
+BandAccumulator::BandAccumulator( const int& bins,
+                                  const double& histogram_min,
+                                  const double& histogram_max )
+                                    : m_count(0),
+                                      m_nodata_count(0),
+                                      m_mean(0),
+                                      m_m2(0),
+                                      m_min(std::numeric_limits<double>::infinity()),
+                                      m_max(-std::numeric_limits<double>::infinity()),
+                                      m_histogram( std::max( bins, 0 ), 0 ),
+                                      m_histogram_min(histogram_min),
+                                      m_histogram_max(histogram_max){
+
+    m_bin_scale = ( bins > 0 ) ? bins / ( histogram_max - histogram_min ) : 0;
+}
+
+/**
+ * Add a block of moments
+*/
+void BandAccumulator::addMoments( const uint64_t& count,
+                                  const double&   mean,
+                                  const double&   m2,
+                                  const double&   min,
+                                  const double&   max ){
+
+    if( count == 0 ){
+        return;
+    }
+
+    // pairwise update of the mean and squared differences
+    const double total = (double)m_count + count;
+    const double delta = mean - m_mean;
+    m_mean += delta * count / total;
+    m_m2   += m2 + delta * delta * ( (double)m_count * count / total );
+    m_count += count;
+
+    m_min = std::min( m_min, min );
+    m_max = std::max( m_max, max );
+}
+
+/**
+ * Clear the accumulator
+*/
+void BandAccumulator::reset(){
+    m_count = 0;
+    m_nodata_count = 0;
+    m_mean = 0;
+    m_m2 = 0;
+    m_min = std::numeric_limits<double>::infinity();
+    m_max = -std::numeric_limits<double>::infinity();
+    std::fill( m_histogram.begin(), m_histogram.end(), 0 );
+}
+
+/**
+ * Merge two accumulators
+*/
+void BandAccumulator::merge( BandAccumulator const& other ){
+
+    if( other.m_histogram.size() != m_histogram.size() ){
+        throw GEO::GeneralException("Cannot merge accumulators with different histograms.", __FILE__, __LINE__);
+    }
+
+    addMoments( other.m_count, other.m_mean, other.m_m2, other.m_min, other.m_max );
+    m_nodata_count += other.m_nodata_count;
+    for( size_t i=0; i<m_histogram.size(); i++ ){
+        m_histogram[i] += other.m_histogram[i];
+    }
+}
+
+/**
+ * Compute the final statistics
+*/
+BandStatistics BandAccumulator::finalize( StatisticsOptions const& options )const{
+
+    BandStatistics output;
+    output.valid_count   = m_count;
+    output.nodata_count  = m_nodata_count;
+    output.histogram     = m_histogram;
+    output.histogram_min = m_histogram_min;
+    output.histogram_max = m_histogram_max;
+    if( m_count > 0 ){
+        output.min    = m_min;
+        output.max    = m_max;
+        output.mean   = m_mean;
+        output.stddev = std::sqrt( m_m2 / m_count );
+    }
+    for( size_t i=0; i<options.percentiles.size(); i++ ){
+        output.percentiles.push_back( output.percentile( options.percentiles[i] ));
+    }
+    return output;
+}
+
+
+/**
+ * Finalize a set of accumulators
+*/
+std::vector<BandStatistics> finalize_statistics( std::vector<BandAccumulator> const& accumulators,
+                                                 StatisticsOptions const& options ){
+
+    std::vector<BandStatistics> output;
+    for( size_t i=0; i<accumulators.size(); i++ ){
+        output.push_back( accumulators[i].finalize( options ));
+    }
+    return output;
+}
+
+/**
+ * Compute the sampling step
+*/
+int statistics_step( const int& rows, const int& cols, StatisticsOptions const& options ){
+
+    const double pixels = (double)rows * cols;
+    if( options.approximate == false || options.approximate_pixels == 0 || pixels <= options.approximate_pixels ){
+        return 1;
+    }
+    return (int)std::ceil( std::sqrt( pixels / options.approximate_pixels ));
+}
+
+} /// End of GEO Namespace
@@ -0,0 +1,610 @@
+/**
+ * @file    ImageStatistics.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_IMAGESTATISTICS_HPP__
+#define __SRC_CPP_IMAGE_IMAGESTATISTICS_HPP__
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/image/ChannelType.hpp>
+#include <GeoExplore/image/Image.hpp>
+#include <GeoExplore/image/MultibandImage.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+
+/**
+ * @class StatisticsOptions
+ *
+ * Controls what compute_statistics measures.
+*/
+class StatisticsOptions{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        StatisticsOptions();
+
+        /// Skip samples equal to nodata_value
+        bool use_nodata;
+
+        /// No-data sample value
+        double nodata_value;
+
+        /// Per-band no-data values, used instead of nodata_value for the bands
+        /// they cover.  NaN marks a band without one.
+        std::vector<double> band_nodata_values;
+
+        /// Number of histogram bins.  Zero picks one bin per integer value, up to MAX_AUTO_BINS.
+        int histogram_bins;
+
+        /// Histogram lower bound.  Used when less than histogram_max.
+        double histogram_min;
+
+        /// Histogram upper bound
+        double histogram_max;
+
+        /// Percentiles to report, in the range [0,100]
+        std::vector<double> percentiles;
+
+        /// Only visit a subset of the pixels
+        bool approximate;
+
+        /// Number of pixels to visit in approximate mode
+        size_t approximate_pixels;
+
+        /// Number of threads.  Values <= 0 use the default.  Use 1 when the
+        /// caller already runs one computation per thread.
+        int num_threads;
+
+        /// Largest automatic histogram
+        static const int MAX_AUTO_BINS = 4096;
+
+        /**
+         * Get the no-data value of a band
+         *
+         * @param[in]  band  Zero-based band index.
+         * @param[out] value No-data value.
+         *
+         * @return False if the band has no no-data value.
+        */
+        bool getNodata( const int& band, double& value )const;
+
+}; /// End of StatisticsOptions Class
+
+
+/**
+ * @class BandStatistics
+ *
+ * Statistics of one band.
+*/
+class BandStatistics{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        BandStatistics();
+
+        /**
+         * Estimate a percentile from the histogram
+         *
+         * @param[in] pct Percentile in the range [0,100].
+        */
+        double percentile( const double& pct )const;
+
+        /// Smallest valid sample
+        double min;
+
+        /// Largest valid sample
+        double max;
+
+        /// Mean of the valid samples
+        double mean;
+
+        /// Population standard deviation of the valid samples
+        double stddev;
+
+        /// Number of valid samples
+        uint64_t valid_count;
+
+        /// Number of no-data samples
+        uint64_t nodata_count;
+
+        /// Histogram counts
+        std::vector<uint64_t> histogram;
+
+        /// Lower edge of the first bin
+        double histogram_min;
+
+        /// Upper edge of the last bin
+        double histogram_max;
+
+        /// Requested percentiles, in StatisticsOptions order
+        std::vector<double> percentiles;
+
+}; /// End of BandStatistics Class
+
+
+/**
+ * @class BandAccumulator
+ *
+ * Running statistics of one band.  Partial results from tiles and threads
+ * are combined with the pairwise update of Chan et al., so the variance
+ * stays accurate without a second pass over the image.
+*/
+class BandAccumulator{
+
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param[in] bins          Number of histogram bins.  Zero disables the histogram.
+         * @param[in] histogram_min Lower edge of the first bin.
+         * @param[in] histogram_max Upper edge of the last bin.
+        */
+        BandAccumulator( const int& bins = 0,
+                         const double& histogram_min = 0,
+                         const double& histogram_max = 1 );
+
+        /**
+         * Add the moments of a block of valid samples
+         *
+         * @param[in] count Number of samples.
+         * @param[in] mean  Mean of the samples.
+         * @param[in] m2    Sum of squared differences from the mean.
+         * @param[in] min   Smallest sample.
+         * @param[in] max   Largest sample.
+        */
+        void addMoments( const uint64_t& count,
+                         const double&   mean,
+                         const double&   m2,
+                         const double&   min,
+                         const double&   max );
+
+        /**
+         * Count no-data samples
+        */
+        void addNodata( const uint64_t& count ){
+            m_nodata_count += count;
+        }
+
+        /**
+         * Clear the counts, keeping the histogram layout
+        */
+        void reset();
+
+        /**
+         * Merge another accumulator with the same histogram layout
+        */
+        void merge( BandAccumulator const& other );
+
+        /**
+         * Compute the final statistics
+        */
+        BandStatistics finalize( StatisticsOptions const& options )const;
+
+        /**
+         * Get the histogram bin of a value, clamped to the histogram
+        */
+        inline int bin( const double& value )const{
+            const double idx = ( value - m_histogram_min ) * m_bin_scale;
+            if( idx <= 0 ){
+                return 0;
+            }
+            return std::min( (int)idx, (int)m_histogram.size() - 1 );
+        }
+
+        /**
+         * Get the histogram counts
+        */
+        std::vector<uint64_t>& histogram(){
+            return m_histogram;
+        }
+
+        /**
+         * Return the number of valid samples
+        */
+        uint64_t count()const{ return m_count; }
+
+        /**
+         * Return the smallest valid sample
+        */
+        double min()const{ return m_min; }
+
+        /**
+         * Return the largest valid sample
+        */
+        double max()const{ return m_max; }
+
+    private:
+
+        /// Number of valid samples
+        uint64_t m_count;
+
+        /// Number of no-data samples
+        uint64_t m_nodata_count;
+
+        /// Mean
+        double m_mean;
+
+        /// Sum of squared differences from the mean
+        double m_m2;
+
+        /// Smallest sample
+        double m_min;
+
+        /// Largest sample
+        double m_max;
+
+        /// Histogram counts
+        std::vector<uint64_t> m_histogram;
+
+        /// Lower edge of the first bin
+        double m_histogram_min;
+
+        /// Upper edge of the last bin
+        double m_histogram_max;
+
+        /// Bins per unit value
+        double m_bin_scale;
+
+}; /// End of BandAccumulator Class
+
+
+/**
+ * Number of samples summed in the channel accumulator type before it could overflow
+*/
+template <typename ChannelType>
+size_t statistics_chunk_size(){
+
+    typedef typename ChannelType::accumulator_type acctype;
+    if( std::is_integral<acctype>::value == false ){
+        return 4096;
+    }
+    const double limit = (double)std::numeric_limits<acctype>::max() / std::max( (double)ChannelType::maxValue, 1.0 );
+    return (size_t)std::max( 1.0, std::min( 4096.0, std::floor( limit )));
+}
+
+/**
+ * Add a run of valid samples to an accumulator
+ *
+ * Samples are processed in chunks small enough to sum in the channel's
+ * accumulator type, so the hot loops run on narrow integers and vectorize.
+ * Each chunk is still in cache for the squared-difference and histogram
+ * passes.
+*/
+template <typename ChannelType>
+void accumulate_samples( const typename ChannelType::type* data,
+                         const size_t&                     count,
+                         BandAccumulator&                  accumulator ){
+
+    typedef typename ChannelType::type datatype;
+    typedef typename ChannelType::accumulator_type acctype;
+
+    const size_t chunk = statistics_chunk_size<ChannelType>();
+    std::vector<uint64_t>& histogram = accumulator.histogram();
+
+    for( size_t c0=0; c0<count; c0+=chunk ){
+
+        const size_t n = std::min( chunk, count - c0 );
+        const datatype* x = data + c0;
+
+        // sum and range
+        acctype  sum = 0;
+        datatype mn = x[0], mx = x[0];
+        for( size_t i=0; i<n; i++ ){
+            sum += x[i];
+            mn = std::min( mn, x[i] );
+            mx = std::max( mx, x[i] );
+        }
+
+        // spread around the chunk mean
+        const double mean = (double)sum / n;
+        double m2 = 0;
+        for( size_t i=0; i<n; i++ ){
+            const double d = x[i] - mean;
+            m2 += d * d;
+        }
+        accumulator.addMoments( n, mean, m2, mn, mx );
+
+        // histogram
+        if( histogram.empty() == false ){
+            for( size_t i=0; i<n; i++ ){
+                histogram[accumulator.bin( x[i] )]++;
+            }
+        }
+    }
+}
+
+/**
+ * Add a run of samples to an accumulator, skipping no-data and NaN samples
+ *
+ * @param[in]     data        Samples.
+ * @param[in]     count       Number of samples.
+ * @param[in]     options     No-data settings.
+ * @param[in]     band        Band of the samples.
+ * @param[in,out] scratch     Buffer for the valid samples.
+ * @param[in,out] accumulator Accumulator to update.
+*/
+template <typename ChannelType>
+void accumulate_masked_samples( const typename ChannelType::type*         data,
+                                const size_t&                             count,
+                                StatisticsOptions const&                  options,
+                                const int&                                band,
+                                std::vector<typename ChannelType::type>&  scratch,
+                                BandAccumulator&                          accumulator ){
+
+    typedef typename ChannelType::type datatype;
+
+    // nothing can be masked
+    double nodata_value = 0;
+    const bool use_nodata = options.getNodata( band, nodata_value );
+    if( use_nodata == false && std::is_floating_point<datatype>::value == false ){
+        accumulate_samples<ChannelType>( data, count, accumulator );
+        return;
+    }
+
+    // compact the valid samples
+    scratch.resize( count );
+    const datatype nodata = (datatype)nodata_value;
+    size_t n = 0;
+    for( size_t i=0; i<count; i++ ){
+        const datatype v = data[i];
+        const bool valid = ( v == v ) && ( use_nodata == false || v != nodata );
+        scratch[n] = v;
+        n += valid;
+    }
+    accumulator.addNodata( count - n );
+    accumulate_samples<ChannelType>( scratch.data(), n, accumulator );
+}
+
+/**
+ * Create one empty accumulator per band
+ *
+ * Integer channels get one bin per value up to MAX_AUTO_BINS, otherwise the
+ * channel range is split evenly.  Free-range channels need an explicit
+ * histogram range.
+ *
+ * @param[in] bands   Number of bands.
+ * @param[in] options Histogram settings.
+ * @param[in] range_min Histogram lower bound when options has none.
+ * @param[in] range_max Histogram upper bound when options has none.
+*/
+template <typename ChannelType>
+std::vector<BandAccumulator> make_band_accumulators( const int& bands,
+                                                     StatisticsOptions const& options,
+                                                     double range_min = ChannelType::minValue,
+                                                     double range_max = ChannelType::maxValue ){
+
+    typedef typename ChannelType::type datatype;
+
+    // histogram bounds
+    if( options.histogram_min < options.histogram_max ){
+        range_min = options.histogram_min;
+        range_max = options.histogram_max;
+    }
+    else if( std::is_integral<datatype>::value ){
+        range_max += 1;
+    }
+    if( range_max <= range_min ){
+        range_max = range_min + 1;
+    }
+
+    // bin count
+    int bins = options.histogram_bins;
+    if( bins <= 0 ){
+        if( std::is_integral<datatype>::value ){
+            bins = (int)std::min( range_max - range_min, (double)StatisticsOptions::MAX_AUTO_BINS );
+        } else {
+            bins = StatisticsOptions::MAX_AUTO_BINS;
+        }
+    }
+
+    return std::vector<BandAccumulator>( std::max( bands, 0 ), BandAccumulator( bins, range_min, range_max ));
+}
+
+/**
+ * Accumulate statistics over the rows of an image
+ *
+ * Row blocks are spread across threads, each with its own accumulators,
+ * which are merged at the end.
+ *
+ * @param[in]     rows         Number of rows.
+ * @param[in]     cols         Number of columns.
+ * @param[in]     step         Visit every step-th row and column.
+ * @param[in]     options      No-data settings.
+ * @param[in]     fetch_row    Callable as fetch_row(row, band, step, scratch), returning a
+ *                             pointer to the band samples of a row, taking every step-th column.
+ *                             The scratch vector may be used to gather the samples.
+ * @param[in,out] accumulators One accumulator per band.
+*/
+template <typename ChannelType, typename RowFunction>
+void accumulate_statistics( const int&                    rows,
+                            const int&                    cols,
+                            const int&                    step,
+                            StatisticsOptions const&      options,
+                            RowFunction                   fetch_row,
+                            std::vector<BandAccumulator>& accumulators ){
+
+    typedef typename ChannelType::type datatype;
+
+    const int bands = (int)accumulators.size();
+    const int sample_cols = ( cols + step - 1 ) / step;
+    const int sample_rows = ( rows + step - 1 ) / step;
+    if( bands == 0 || sample_cols <= 0 || sample_rows <= 0 ){
+        return;
+    }
+
+    // blocks of about 64K samples per band
+    const int block_rows = std::max( 1, 65536 / sample_cols );
+    const int blocks = ( sample_rows + block_rows - 1 ) / block_rows;
+    const int threads = std::min( ( options.num_threads > 0 ) ? options.num_threads : default_thread_count(), blocks );
+
+    // empty accumulators with the same histogram layout for each thread
+    std::vector<std::vector<BandAccumulator> > partial( threads, accumulators );
+    for( int t=0; t<threads; t++ ){
+        for( int b=0; b<bands; b++ ){
+            partial[t][b].reset();
+        }
+    }
+    std::vector<std::vector<datatype> > gather( threads ), masked( threads );
+
+    parallel_for( 0, blocks, [&]( const size_t& block, const int& thread_id ){
+
+        std::vector<BandAccumulator>& local = partial[thread_id];
+        const int r0 = (int)block * block_rows;
+        const int r1 = std::min( sample_rows, r0 + block_rows );
+        for( int r=r0; r<r1; r++ ){
+            for( int b=0; b<bands; b++ ){
+                const datatype* samples = fetch_row( r * step, b, step, gather[thread_id] );
+                accumulate_masked_samples<ChannelType>( samples, sample_cols, options, b, masked[thread_id], local[b] );
+            }
+        }
+    }, threads );
+
+    // merge the thread results
+    for( int t=0; t<threads; t++ ){
+        for( int b=0; b<bands; b++ ){
+            accumulators[b].merge( partial[t][b] );
+        }
+    }
+}
+
+/**
+ * Finalize a set of band accumulators
+*/
+std::vector<BandStatistics> finalize_statistics( std::vector<BandAccumulator> const& accumulators,
+                                                 StatisticsOptions const& options );
+
+/**
+ * Compute the step which visits about options.approximate_pixels pixels
+*/
+int statistics_step( const int& rows, const int& cols, StatisticsOptions const& options );
+
+/**
+ * Compute statistics from a row source, finding the histogram range first
+ * for free-range channels.
+*/
+template <typename ChannelType, typename RowFunction>
+std::vector<BandStatistics> compute_statistics( const int& rows,
+                                                const int& cols,
+                                                const int& bands,
+                                                StatisticsOptions const& options,
+                                                RowFunction fetch_row ){
+
+    const int step = statistics_step( rows, cols, options );
+    std::vector<BandAccumulator> accumulators = make_band_accumulators<ChannelType>( bands, options );
+
+    // free-range samples need a range pass before they can be binned
+    if( std::is_same<ChannelType,ChannelTypeDoubleFree>::value &&
+        options.histogram_min >= options.histogram_max ){
+        StatisticsOptions range_options = options;
+        range_options.histogram_bins = 1;
+        std::vector<BandAccumulator> ranges = make_band_accumulators<ChannelType>( bands, range_options );
+        accumulate_statistics<ChannelType>( rows, cols, step, options, fetch_row, ranges );
+        for( int b=0; b<bands; b++ ){
+            StatisticsOptions band_options = options;
+            band_options.histogram_min = ranges[b].min();
+            band_options.histogram_max = std::nextafter( ranges[b].max(), std::numeric_limits<double>::infinity() );
+            accumulators[b] = make_band_accumulators<ChannelType>( 1, band_options )[0];
+        }
+    }
+
+    accumulate_statistics<ChannelType>( rows, cols, step, options, fetch_row, accumulators );
+    return finalize_statistics( accumulators, options );
+}
+
+/**
+ * Compute per-band statistics of an image
+ *
+ * @param[in] image   Image to measure.
+ * @param[in] options Statistics settings.
+*/
+template <typename PixelType, typename ResourceType>
+std::vector<BandStatistics> compute_statistics( Image_<PixelType,ResourceType> const& image,
+                                                StatisticsOptions const& options = StatisticsOptions() ){
+
+    typedef typename PixelType::channeltype channeltype;
+    typedef typename channeltype::type datatype;
+
+    // gather one band of a row from the pixels
+    const int cols = image.cols();
+    auto fetch_row = [&]( const int& row, const int& band, const int& step, std::vector<datatype>& scratch ) -> const datatype* {
+        scratch.resize( ( cols + step - 1 ) / step );
+        for( int c=0, i=0; c<cols; c+=step, i++ ){
+            scratch[i] = image( row, c )[band];
+        }
+        return scratch.data();
+    };
+    return compute_statistics<channeltype>( image.rows(), cols, PixelType().dims(), options, fetch_row );
+}
+
+/**
+ * Compute per-band statistics of a planar image, reading the bands in place
+*/
+template <typename PixelType>
+std::vector<BandStatistics> compute_statistics( PlanarImage<PixelType> const& image,
+                                                StatisticsOptions const& options = StatisticsOptions() ){
+
+    typedef typename PixelType::channeltype channeltype;
+    typedef typename channeltype::type datatype;
+
+    PlanarResource<PixelType> resource = image.getResource();
+    const int cols = image.cols();
+    auto fetch_row = [&]( const int& row, const int& band, const int& step, std::vector<datatype>& scratch ) -> const datatype* {
+        const datatype* samples = resource.band( band ).row( row );
+        if( step == 1 ){
+            return samples;
+        }
+        scratch.resize( ( cols + step - 1 ) / step );
+        for( int c=0, i=0; c<cols; c+=step, i++ ){
+            scratch[i] = samples[c];
+        }
+        return scratch.data();
+    };
+    return compute_statistics<channeltype>( image.rows(), cols, image.channels(), options, fetch_row );
+}
+
+/**
+ * Compute per-band statistics of a multiband image, reading the bands in place
+*/
+template <typename ChannelType>
+std::vector<BandStatistics> compute_statistics( MultibandImage<ChannelType> const& image,
+                                                StatisticsOptions const& options = StatisticsOptions() ){
+
+    typedef typename ChannelType::type datatype;
+
+    const int cols = image.cols();
+    auto fetch_row = [&]( const int& row, const int& band, const int& step, std::vector<datatype>& scratch ) -> const datatype* {
+        const datatype* samples = image.band( band ).row( row );
+        if( step == 1 ){
+            return samples;
+        }
+        scratch.resize( ( cols + step - 1 ) / step );
+        for( int c=0, i=0; c<cols; c+=step, i++ ){
+            scratch[i] = samples[c];
+        }
+        return scratch.data();
+    };
+    return compute_statistics<ChannelType>( image.rows(), cols, image.bands(), options, fetch_row );
+}
+
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,308 @@
+/**
+ * @file    MemoryAllocator.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "MemoryAllocator.hpp"
+
+/// C++ Standard Libraries
+#include <cstdint>
+#include <cstdlib>
+
+/// POSIX Libraries
+#include <sys/mman.h>
+
+namespace GEO{
+
+/// Static Constants
+const int    TilePoolAllocator::SIZE_CLASS_COUNT;
+const size_t HugePageAllocator::HUGE_PAGE_SIZE;
+
+/**
+ * Allocate an aligned block from the heap
+*/
+static void* aligned_heap_allocate( const size_t& bytes ){
+    void* ptr = nullptr;
+    if( posix_memalign( &ptr, PIXEL_BUFFER_ALIGNMENT, ( bytes > 0 ) ? bytes : 1 ) != 0 ){
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+/**
+ * Compute the size class of a block
+*/
+static int size_class( const size_t& bytes ){
+    int sclass = 6;
+    while( ((size_t)1 << sclass) < bytes ){
+        sclass++;
+    }
+    return sclass;
+}
+
+/**
+ * Round a size up to whole huge pages
+*/
+static size_t huge_page_round( const size_t& bytes ){
+    const size_t page = HugePageAllocator::HUGE_PAGE_SIZE;
+    return ( bytes + page - 1 ) / page * page;
+}
+
+
+/**
+ * Heap Allocate
+*/
+void* HeapAllocator::allocate( const size_t& bytes ){
+    return aligned_heap_allocate( bytes );
+}
+
+/**
+ * Heap Deallocate
+*/
+void HeapAllocator::deallocate( void* ptr, const size_t& /*bytes*/ ){
+    free( ptr );
+}
+
+
+/**
+ * Tile Pool Constructor
+*/
+TilePoolAllocator::TilePoolAllocator( const size_t& max_cached_bytes ) :
+                                            m_free_lists(SIZE_CLASS_COUNT),
+                                            m_cached_bytes(0),
+                                            m_max_cached_bytes(max_cached_bytes){
+
+}
+
+/**
+ * Tile Pool Destructor
+*/
+TilePoolAllocator::~TilePoolAllocator(){
+    release();
+}
+
+/**
+ * Tile Pool Allocate
+*/
+void* TilePoolAllocator::allocate( const size_t& bytes ){
+
+    const int sclass = size_class( bytes );
+    if( sclass >= SIZE_CLASS_COUNT ){
+        return aligned_heap_allocate( bytes );
+    }
+
+    // reuse a released block
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        std::vector<void*>& free_list = m_free_lists[sclass];
+        if( free_list.empty() == false ){
+            void* ptr = free_list.back();
+            free_list.pop_back();
+            m_cached_bytes -= (size_t)1 << sclass;
+            return ptr;
+        }
+    }
+
+    return aligned_heap_allocate( (size_t)1 << sclass );
+}
+
+/**
+ * Tile Pool Deallocate
+*/
+void TilePoolAllocator::deallocate( void* ptr, const size_t& bytes ){
+
+    const int sclass = size_class( bytes );
+    if( sclass < SIZE_CLASS_COUNT ){
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if( m_cached_bytes + ((size_t)1 << sclass) <= m_max_cached_bytes ){
+            m_free_lists[sclass].push_back( ptr );
+            m_cached_bytes += (size_t)1 << sclass;
+            return;
+        }
+    }
+    free( ptr );
+}
+
+/**
+ * Free the cached blocks
+*/
+void TilePoolAllocator::release(){
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    for( size_t i=0; i<m_free_lists.size(); i++ ){
+        for( size_t j=0; j<m_free_lists[i].size(); j++ ){
+            free( m_free_lists[i][j] );
+        }
+        m_free_lists[i].clear();
+    }
+    m_cached_bytes = 0;
+}
+
+/**
+ * Get the cached size
+*/
+size_t TilePoolAllocator::cachedBytes()const{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_cached_bytes;
+}
+
+
+/**
+ * Huge Page Constructor
+*/
+HugePageAllocator::HugePageAllocator( const size_t& max_cached_bytes,
+                                      const bool& prefault ) :
+                                            m_cached_bytes(0),
+                                            m_max_cached_bytes(max_cached_bytes),
+                                            m_prefault(prefault){
+
+}
+
+/**
+ * Huge Page Destructor
+*/
+HugePageAllocator::~HugePageAllocator(){
+    release();
+}
+
+/**
+ * Huge Page Allocate
+*/
+void* HugePageAllocator::allocate( const size_t& bytes ){
+
+    if( bytes < HUGE_PAGE_SIZE ){
+        return aligned_heap_allocate( bytes );
+    }
+    const size_t size = huge_page_round( bytes );
+
+    // reuse a released mapping
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        std::map<size_t,std::vector<void*> >::iterator it = m_free_maps.find( size );
+        if( it != m_free_maps.end() && it->second.empty() == false ){
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            m_cached_bytes -= size;
+            return ptr;
+        }
+    }
+
+    // create a new mapping with room to align it to a huge page, since
+    // the kernel only backs aligned 2 MB ranges with huge pages
+    const size_t page = HUGE_PAGE_SIZE;
+    void* map = mmap( nullptr, size + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if( map == MAP_FAILED ){
+        throw std::bad_alloc();
+    }
+
+    // trim the unaligned head and the tail
+    char* base = static_cast<char*>( map );
+    char* ptr  = reinterpret_cast<char*>( ( reinterpret_cast<uintptr_t>( base ) + page - 1 ) / page * page );
+    if( ptr > base ){
+        munmap( base, ptr - base );
+    }
+    if( base + size + page > ptr + size ){
+        munmap( ptr + size, ( base + size + page ) - ( ptr + size ));
+    }
+
+    // advise before the first touch, so the faults map huge pages
+#ifdef MADV_HUGEPAGE
+    madvise( ptr, size, MADV_HUGEPAGE );
+#endif
+    if( m_prefault ){
+#ifdef MADV_POPULATE_WRITE
+        if( madvise( ptr, size, MADV_POPULATE_WRITE ) != 0 )
+#endif
+        {
+            for( size_t offset=0; offset<size; offset += 4096 ){
+                static_cast<volatile char*>( ptr )[offset] = 0;
+            }
+        }
+    }
+    return ptr;
+}
+
+/**
+ * Huge Page Deallocate
+*/
+void HugePageAllocator::deallocate( void* ptr, const size_t& bytes ){
+
+    if( bytes < HUGE_PAGE_SIZE ){
+        free( ptr );
+        return;
+    }
+    const size_t size = huge_page_round( bytes );
+
+    // keep the mapping if there is room
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if( m_cached_bytes + size <= m_max_cached_bytes ){
+            m_free_maps[size].push_back( ptr );
+            m_cached_bytes += size;
+            return;
+        }
+    }
+    munmap( ptr, size );
+}
+
+/**
+ * Unmap the cached mappings
+*/
+void HugePageAllocator::release(){
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    std::map<size_t,std::vector<void*> >::iterator it = m_free_maps.begin();
+    for( ; it != m_free_maps.end(); it++ ){
+        for( size_t i=0; i<it->second.size(); i++ ){
+            munmap( it->second[i], it->first );
+        }
+    }
+    m_free_maps.clear();
+    m_cached_bytes = 0;
+}
+
+/**
+ * Get the cached size
+*/
+size_t HugePageAllocator::cachedBytes()const{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_cached_bytes;
+}
+
+
+/**
+ * Storage for the default allocator
+*/
+static MemoryAllocator::ptr_t& default_allocator_storage(){
+    static MemoryAllocator::ptr_t allocator( new HeapAllocator() );
+    return allocator;
+}
+
+/**
+ * Lock for the default allocator
+*/
+static std::mutex& default_allocator_mutex(){
+    static std::mutex mtx;
+    return mtx;
+}
+
+/**
+ * Get the default allocator
+*/
+MemoryAllocator::ptr_t default_allocator(){
+    std::lock_guard<std::mutex> lock( default_allocator_mutex() );
+    return default_allocator_storage();
+}
+
+/**
+ * Set the default allocator
+*/
+void set_default_allocator( MemoryAllocator::ptr_t allocator ){
+    std::lock_guard<std::mutex> lock( default_allocator_mutex() );
+    if( allocator == nullptr ){
+        allocator = MemoryAllocator::ptr_t( new HeapAllocator() );
+    }
+    default_allocator_storage() = allocator;
+}
+
+} /// End of GEO Namespace
@@ -0,0 +1,311 @@
+/**
+ * @file    MemoryAllocator.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_MEMORYALLOCATOR_HPP__
+#define __SRC_CPP_IMAGE_MEMORYALLOCATOR_HPP__
+
+/// C++ Standard Libraries
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+/// Boost C++ Library
+#include <boost/shared_ptr.hpp>
+
+namespace GEO{
+
+/// Alignment of every pixel buffer in bytes
+const size_t PIXEL_BUFFER_ALIGNMENT = 64;
+
+/**
+ * @class MemoryAllocator
+ *
+ * Source of raw memory for pixel buffers.
+*/
+class MemoryAllocator{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<MemoryAllocator> ptr_t;
+
+        /**
+         * Destructor
+        */
+        virtual ~MemoryAllocator(){}
+
+        /**
+         * Allocate a block of memory aligned to PIXEL_BUFFER_ALIGNMENT
+         *
+         * @param[in] bytes Size of the block.
+        */
+        virtual void* allocate( const size_t& bytes ) = 0;
+
+        /**
+         * Release a block of memory
+         *
+         * @param[in] ptr   Block returned by allocate.
+         * @param[in] bytes Size passed to allocate.
+        */
+        virtual void deallocate( void* ptr, const size_t& bytes ) = 0;
+
+}; /// End of MemoryAllocator Class
+
+
+/**
+ * @class HeapAllocator
+ *
+ * Allocates every block from the heap.
+*/
+class HeapAllocator : public MemoryAllocator{
+
+    public:
+
+        /**
+         * Allocate a block
+        */
+        virtual void* allocate( const size_t& bytes );
+
+        /**
+         * Release a block
+        */
+        virtual void deallocate( void* ptr, const size_t& bytes );
+
+}; /// End of HeapAllocator Class
+
+
+/**
+ * @class TilePoolAllocator
+ *
+ * Keeps released blocks in power-of-two size classes and hands them out
+ * again, so allocating and freeing many same-sized tiles does not touch the
+ * heap after the first few tiles.  At most max_cached_bytes are kept.
+*/
+class TilePoolAllocator : public MemoryAllocator{
+
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param[in] max_cached_bytes Maximum size of released blocks to keep.
+        */
+        TilePoolAllocator( const size_t& max_cached_bytes = (size_t)256 << 20 );
+
+        /**
+         * Destructor
+        */
+        virtual ~TilePoolAllocator();
+
+        /**
+         * Allocate a block
+        */
+        virtual void* allocate( const size_t& bytes );
+
+        /**
+         * Release a block
+        */
+        virtual void deallocate( void* ptr, const size_t& bytes );
+
+        /**
+         * Free every cached block
+        */
+        void release();
+
+        /**
+         * Return the size of the cached blocks
+        */
+        size_t cachedBytes()const;
+
+    private:
+
+        /// Number of size classes
+        static const int SIZE_CLASS_COUNT = 48;
+
+        /// Lock for the free lists
+        mutable std::mutex m_mutex;
+
+        /// Free blocks by size class
+        std::vector<std::vector<void*> > m_free_lists;
+
+        /// Size of the cached blocks
+        size_t m_cached_bytes;
+
+        /// Limit on the cached blocks
+        size_t m_max_cached_bytes;
+
+}; /// End of TilePoolAllocator Class
+
+
+/**
+ * @class HugePageAllocator
+ *
+ * Maps large blocks directly and asks the kernel to back them with
+ * transparent huge pages, which removes most page faults and TLB misses
+ * when walking a large image.  Released mappings are kept for reuse up to
+ * max_cached_bytes, so a reused buffer is already faulted in.  Blocks
+ * smaller than a huge page come from the heap.
+*/
+class HugePageAllocator : public MemoryAllocator{
+
+    public:
+
+        /// Huge page size in bytes
+        static const size_t HUGE_PAGE_SIZE = (size_t)2 << 20;
+
+        /**
+         * Constructor
+         *
+         * @param[in] max_cached_bytes Maximum size of released mappings to keep.
+         * @param[in] prefault         Fault in new mappings when they are created.
+        */
+        HugePageAllocator( const size_t& max_cached_bytes = (size_t)1 << 30,
+                           const bool& prefault = false );
+
+        /**
+         * Destructor
+        */
+        virtual ~HugePageAllocator();
+
+        /**
+         * Allocate a block
+        */
+        virtual void* allocate( const size_t& bytes );
+
+        /**
+         * Release a block
+        */
+        virtual void deallocate( void* ptr, const size_t& bytes );
+
+        /**
+         * Unmap every cached mapping
+        */
+        void release();
+
+        /**
+         * Return the size of the cached mappings
+        */
+        size_t cachedBytes()const;
+
+    private:
+
+        /// Lock for the cache
+        mutable std::mutex m_mutex;
+
+        /// Released mappings by size
+        std::map<size_t, std::vector<void*> > m_free_maps;
+
+        /// Size of the cached mappings
+        size_t m_cached_bytes;
+
+        /// Limit on the cached mappings
+        size_t m_max_cached_bytes;
+
+        /// Fault in new mappings
+        bool m_prefault;
+
+}; /// End of HugePageAllocator Class
+
+
+/**
+ * Get the allocator used when none is given
+*/
+MemoryAllocator::ptr_t default_allocator();
+
+/**
+ * Set the allocator used when none is given
+ *
+ * @param[in] allocator New default.  A null pointer restores the heap allocator.
+*/
+void set_default_allocator( MemoryAllocator::ptr_t allocator );
+
+
+/**
+ * @class PixelArrayDeleter
+ *
+ * Destroys the pixels of an array and returns the memory to its allocator.
+ * The deleter holds the allocator, so it lives as long as its buffers.
+*/
+template <typename PixelType>
+class PixelArrayDeleter{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        PixelArrayDeleter( MemoryAllocator::ptr_t allocator, const size_t& count ) :
+                                m_allocator(allocator), m_count(count){}
+
+        /**
+         * Release the array
+        */
+        void operator()( PixelType* pixels ){
+            if( std::is_trivially_destructible<PixelType>::value == false ){
+                for( size_t i=0; i<m_count; i++ ){
+                    pixels[i].~PixelType();
+                }
+            }
+            m_allocator->deallocate( pixels, m_count * sizeof(PixelType) );
+        }
+
+    private:
+
+        /// Allocator which owns the memory
+        MemoryAllocator::ptr_t m_allocator;
+
+        /// Number of pixels
+        size_t m_count;
+
+}; /// End of PixelArrayDeleter Class
+
+
+/**
+ * Allocate an array of pixels
+ *
+ * Trivial pixel types are left uninitialized.  Other pixel types are
+ * default constructed.
+ *
+ * @param[in] count     Number of pixels.
+ * @param[in] allocator Allocator to use.  Null uses the default allocator.
+*/
+template <typename PixelType>
+boost::shared_ptr<PixelType[]> allocate_pixels( const size_t& count,
+                                                MemoryAllocator::ptr_t allocator = MemoryAllocator::ptr_t() ){
+
+    if( count == 0 ){
+        return boost::shared_ptr<PixelType[]>();
+    }
+    if( allocator == nullptr ){
+        allocator = default_allocator();
+    }
+
+    PixelType* pixels = static_cast<PixelType*>( allocator->allocate( count * sizeof(PixelType) ));
+
+    // construct the pixels
+    if( std::is_trivial<PixelType>::value == false ){
+        size_t i=0;
+        try{
+            for( ; i<count; i++ ){
+                new (pixels + i) PixelType();
+            }
+        } catch( ... ){
+            while( i > 0 ){
+                pixels[--i].~PixelType();
+            }
+            allocator->deallocate( pixels, count * sizeof(PixelType) );
+            throw;
+        }
+    }
+
+    return boost::shared_ptr<PixelType[]>( pixels, PixelArrayDeleter<PixelType>( allocator, count ));
+}
+
+} /// End of GEO Namespace
+
+#endif
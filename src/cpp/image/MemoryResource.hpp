@@ -9,6 +9,9 @@
 /// GeoExplore Libraries
 #include <GeoExplore/core/Exceptions.hpp>
 #include <GeoExplore/image/BaseResource.hpp>
+#include <GeoExplore/image/MemoryAllocator.hpp>
+#include <GeoExplore/image/PixelCopy.hpp>
+#include <GeoExplore/image/Rect.hpp>
 #include <cstddef>
 
 /// Boost C++ Library
@@ -21,6 +24,12 @@ namespace GEO{
 
 /**
  * @class MemoryResource
+ *
+ * Pixel buffer held in memory.  Copies share the buffer until one of
+ * them is written through a non-const accessor, at which point the writer
+ * detaches onto its own copy.  Views write to the buffer directly, so a
+ * resource detaches before handing one out, and while any of its views
+ * are alive copies take their own pixels.
 */
 template <typename PixelType>
 class MemoryResource : public BaseResource<PixelType> {
@@ -36,9 +45,25 @@ class MemoryResource : public BaseResource<PixelType> {
         
         /**
          * Parameterized Constructor
+         *
+         * @param[in] rows      Number of rows.
+         * @param[in] cols      Number of columns.
+         * @param[in] allocator Allocator for the pixel buffer.  Null uses the default allocator.
         */
-        MemoryResource( const int& rows, const int& cols ) : m_data(new PixelType[rows*cols]),
-                                                             m_rows(rows), m_cols(cols){}
+        MemoryResource( const int& rows, 
+                        const int& cols, 
+                        MemoryAllocator::ptr_t allocator = MemoryAllocator::ptr_t() ) 
+                          : m_data(allocate_pixels<PixelType>( (size_t)rows*cols, allocator )),
+                            m_rows(rows), 
+                            m_cols(cols),
+                            m_allocator(allocator){}
+
+        /**
+         * Copy Constructor.  Shares the buffer unless it is viewed.
+        */
+        MemoryResource( MemoryResource<PixelType> const& rhs ) : m_data(nullptr), m_rows(0), m_cols(0){
+            *this = rhs;
+        }
 
         /**
          * Get the pixel value
@@ -61,6 +86,7 @@ class MemoryResource : public BaseResource<PixelType> {
             if( m_data == nullptr ){
                 throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
             }
+            detach();
             return m_data[idx];
         }
         
@@ -85,6 +111,7 @@ class MemoryResource : public BaseResource<PixelType> {
             if( m_data == nullptr ){
                 throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
             }
+            detach();
             return m_data[m_cols*y + x];
         }
 
@@ -124,12 +151,13 @@ class MemoryResource : public BaseResource<PixelType> {
             // copy row and columns
             output.m_rows = rows();
             output.m_cols = cols();
+            output.m_allocator = m_allocator;
 
             // copy the data
-            output.m_data = boost::shared_ptr<PixelType[]>(new PixelType[output.m_rows*output.m_cols]);
-
-            for( size_t i=0; i<(rows()*cols()); i++ ){
-                output.m_data[i] = m_data[i];
+            if( m_data != nullptr ){
+                const size_t count = (size_t)m_rows * m_cols;
+                output.m_data = allocate_pixels<PixelType>( count, m_allocator );
+                copy_pixels( m_data.get(), output.m_data.get(), count );
             }
 
             // return the data
@@ -137,7 +165,134 @@ class MemoryResource : public BaseResource<PixelType> {
         }
 
         /**
-         * Shallow Copy
+         * Set every pixel to a value
+        */
+        void fill( PixelType const& value ){
+            
+            // make sure the image has memory initialized
+            if( m_data == nullptr ){
+                throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
+            }
+            detach( false );
+            fill_pixels( m_data.get(), (size_t)m_rows * m_cols, value );
+        }
+
+        /**
+         * Deep copy a window into another resource
+         *
+         * The output is reallocated unless it already has the window size
+         * and does not share its buffer.
+         *
+         * @param[out] output Destination resource.
+         * @param[in]  window Window in pixel coordinates.
+        */
+        void copyTo( MemoryResource<PixelType>& output, Rect const& window )const{
+            
+            // make sure the image has memory initialized
+            if( m_data == nullptr ){
+                throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
+            }
+            if( window.inside( m_rows, m_cols ) == false ){
+                throw GEO::GeneralException("Copy window lies outside of the image.", __FILE__, __LINE__);
+            }
+
+            // size the output
+            if( output.m_data == nullptr || 
+                output.m_rows != window.height() || 
+                output.m_cols != window.width() ||
+                output.m_data.use_count() > 1 ){
+                output = MemoryResource<PixelType>( window.height(), window.width(), m_allocator );
+            }
+
+            // copy each row
+            const PixelType* src = m_data.get() + (size_t)window.y() * m_cols + window.x();
+            PixelType* dst = output.m_data.get();
+            const int width = window.width();
+            const int stride = m_cols;
+            parallel_blocks( window.height(), width * sizeof(PixelType), [&]( const size_t& begin, const size_t& end ){
+                for( size_t r=begin; r<end; r++ ){
+                    copy_pixels_serial( src + r*stride, dst + r*width, width );
+                }
+            });
+        }
+
+        /**
+         * Deep copy into another resource
+        */
+        void copyTo( MemoryResource<PixelType>& output )const{
+            copyTo( output, Rect( 0, 0, m_cols, m_rows ));
+        }
+
+        /**
+         * Convert to another pixel type using pixel_cast
+        */
+        template <typename OutputPixelType>
+        MemoryResource<OutputPixelType> convertTo()const{
+            
+            MemoryResource<OutputPixelType> output;
+            if( m_data == nullptr ){
+                return output;
+            }
+
+            const size_t count = (size_t)m_rows * m_cols;
+            boost::shared_ptr<OutputPixelType[]> pixels = allocate_pixels<OutputPixelType>( count, m_allocator );
+            convert_pixels( m_data.get(), pixels.get(), count );
+            output.setPixelData( pixels, m_rows, m_cols );
+            output.setAllocator( m_allocator );
+            return output;
+        }
+
+        /**
+         * Check if the buffer is shared with another resource
+        */
+        bool isShared()const{
+            return ( m_data != nullptr && m_data.use_count() > 1 );
+        }
+
+        /**
+         * Check if a view of the buffer is alive
+        */
+        bool isViewed()const{
+            return ( m_view_pin != nullptr && m_view_pin.use_count() > 1 );
+        }
+
+        /**
+         * Prepare the buffer to be written through a view
+         *
+         * Detaches first, so writes through the view reach only this
+         * resource.  While the returned pin is held, copies of this
+         * resource take their own pixels.
+         *
+         * @return Pin to hold for the life of the view.
+        */
+        boost::shared_ptr<int> pinForView(){
+            detach();
+            if( m_view_pin == nullptr ){
+                m_view_pin.reset( new int(0) );
+            }
+            return m_view_pin;
+        }
+
+        /**
+         * Give this resource its own copy of the buffer if it is shared
+         *
+         * @param[in] copy Copy the current pixels into the new buffer.
+        */
+        void detach( const bool& copy = true ){
+            
+            if( isShared() == false ){
+                return;
+            }
+            const size_t count = (size_t)m_rows * m_cols;
+            boost::shared_ptr<PixelType[]> pixels = allocate_pixels<PixelType>( count, m_allocator );
+            if( copy ){
+                copy_pixels( m_data.get(), pixels.get(), count );
+            }
+            m_data = pixels;
+        }
+
+        /**
+         * Shallow Copy, or a deep copy while the buffer is viewed
         */
         MemoryResource<PixelType>& operator= ( const MemoryResource<PixelType>& rhs ){
             
@@ -147,10 +302,18 @@ class MemoryResource : public BaseResource<PixelType> {
                 // set the rows and column counts
                 this->m_rows = rhs.rows();
                 this->m_cols = rhs.cols();
+                this->m_allocator = rhs.m_allocator;
+                this->m_view_pin.reset();
 
-                // copy the memory pointer
-                this->m_data = rhs.m_data;
-
+                // copy the memory pointer, or the pixels if views write to them
+                if( rhs.isViewed() ){
+                    const size_t count = (size_t)m_rows * m_cols;
+                    this->m_data = allocate_pixels<PixelType>( count, m_allocator );
+                    copy_pixels( rhs.m_data.get(), this->m_data.get(), count );
+                }
+                else{
+                    this->m_data = rhs.m_data;
+                }
             }
 
             // return yourself
@@ -164,6 +327,7 @@ class MemoryResource : public BaseResource<PixelType> {
             m_rows = rows;
             m_cols = cols;
             m_data = data;
+            m_view_pin.reset();
         }
         
         /**
@@ -173,6 +337,20 @@ class MemoryResource : public BaseResource<PixelType> {
             return m_data;
         }
 
+        /**
+         * Get the allocator used for new buffers
+        */
+        MemoryAllocator::ptr_t getAllocator()const{
+            return m_allocator;
+        }
+
+        /**
+         * Set the allocator used for new buffers
+        */
+        void setAllocator( MemoryAllocator::ptr_t allocator ){
+            m_allocator = allocator;
+        }
+
     private:
 
         /// List of pixels
@@ -184,6 +362,12 @@ class MemoryResource : public BaseResource<PixelType> {
         /// number of columns
         int m_cols;
 
+        /// allocator for new buffers
+        MemoryAllocator::ptr_t m_allocator;
+
+        /// held by each view of the buffer
+        boost::shared_ptr<int> m_view_pin;
+
 }; /// End of MemoryResource Class
 
 } /// End of GEO Namespace
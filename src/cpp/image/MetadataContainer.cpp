@@ -5,8 +5,54 @@
 */
 #include "MetadataContainer.hpp"
 
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
 namespace GEO{
 
+/**
+ * Compare an entry with a key id
+*/
+struct EntryKeyLess{
+    template <typename EntryType>
+    bool operator()( EntryType const& entry, const uint32_t& key )const{
+        return entry.key.id() < key;
+    }
+};
+
+/**
+ * Parse a list of numbers
+*/
+static std::vector<double> parse_numbers( std::string const& value ){
+
+    std::vector<double> output;
+    const char* ptr = value.c_str();
+    for(;;){
+
+        // skip separators
+        while( *ptr == ' ' || *ptr == ',' || *ptr == ';' || *ptr == '\t' || *ptr == '\n' || *ptr == '(' || *ptr == ')' ){
+            ptr++;
+        }
+        if( *ptr == '\0' ){
+            break;
+        }
+
+        // stop at the first token which is not a number
+        char* end = nullptr;
+        const double number = std::strtod( ptr, &end );
+        if( end == ptr ){
+            break;
+        }
+        output.push_back( number );
+        ptr = end;
+    }
+    return output;
+}
+
+
 /**
  * Default Constructor
 */
@@ -15,5 +61,134 @@ MetadataContainer::MetadataContainer(){
 
 }
 
+/**
+ * Set a value
+*/
+void MetadataContainer::setValue( MetadataKey const& key, std::string const& value ){
+
+    std::vector<Entry>::iterator it = std::lower_bound( m_entries.begin(), m_entries.end(), key.id(), EntryKeyLess() );
+    if( it != m_entries.end() && it->key == key ){
+        it->value = value;
+        it->numbers.reset();
+        return;
+    }
+
+    m_entries.insert( it, Entry( key, value ));
+}
+
+/**
+ * Find an entry
+*/
+const MetadataContainer::Entry* MetadataContainer::find( MetadataKey const& key )const{
+
+    std::vector<Entry>::const_iterator it = std::lower_bound( m_entries.begin(), m_entries.end(), key.id(), EntryKeyLess() );
+    if( it != m_entries.end() && it->key == key ){
+        return &(*it);
+    }
+    return nullptr;
+}
+
+/**
+ * Check if a key is present
+*/
+bool MetadataContainer::contains( MetadataKey const& key )const{
+    return find( key ) != nullptr;
+}
+
+/**
+ * Get a raw value
+*/
+std::string MetadataContainer::getValue( MetadataKey const& key )const{
+    const Entry* entry = find( key );
+    return ( entry != nullptr ) ? entry->value : std::string();
+}
+
+/**
+ * Get a value as numbers
+*/
+MetadataContainer::numbers_t MetadataContainer::getNumbers( MetadataKey const& key )const{
+
+    const Entry* entry = find( key );
+    if( entry == nullptr ){
+        return numbers_t( new std::vector<double>() );
+    }
+
+    // parse on first access
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if( entry->numbers == nullptr ){
+        entry->numbers = numbers_t( new std::vector<double>( parse_numbers( entry->value )));
+    }
+    return entry->numbers;
+}
+
+/**
+ * Get one number
+*/
+double MetadataContainer::getNumber( MetadataKey const& key,
+                                     const size_t& index,
+                                     const double& default_value )const{
+
+    numbers_t numbers = getNumbers( key );
+    if( index >= numbers->size() ){
+        return default_value;
+    }
+    return (*numbers)[index];
+}
+
+/**
+ * Get the geotransform
+*/
+bool MetadataContainer::getGeoTransform( double transform[6] )const{
+
+    numbers_t numbers = getNumbers( MetadataKey( METADATA_GEOTRANSFORM ));
+    if( numbers->size() != 6 ){
+        return false;
+    }
+    std::copy( numbers->begin(), numbers->end(), transform );
+    return true;
+}
+
+/**
+ * Get the no-data value of a band
+*/
+bool MetadataContainer::getNoDataValue( double& value, const int& band )const{
+
+    const double number = getNumber( MetadataKey( METADATA_NODATA ), band, std::numeric_limits<double>::quiet_NaN() );
+    if( std::isnan( number )){
+        return false;
+    }
+    value = number;
+    return true;
+}
+
+/**
+ * Get the items of a domain
+*/
+std::vector<std::pair<std::string,std::string> > MetadataContainer::getDomain( std::string const& domain )const{
+
+    std::vector<std::pair<std::string,std::string> > output;
+    const std::string prefix = domain.empty() ? std::string() : domain + ":";
+    for( size_t i=0; i<m_entries.size(); i++ ){
+
+        std::string const& key = m_entries[i].key.str();
+        if( prefix.empty() ){
+            if( key.find(':') == std::string::npos ){
+                output.push_back( std::make_pair( key, m_entries[i].value ));
+            }
+        }
+        else if( key.compare( 0, prefix.size(), prefix ) == 0 ){
+            output.push_back( std::make_pair( key.substr( prefix.size() ), m_entries[i].value ));
+        }
+    }
+    return output;
+}
+
+/**
+ * Return the number of items
+*/
+size_t MetadataContainer::size()const{
+    return m_entries.size();
+}
+
 } /// End of GEO Namespace
 
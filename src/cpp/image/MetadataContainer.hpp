@@ -6,25 +6,162 @@
 #ifndef __SRC_CPP_IMAGE_METADATACONTAINER_HPP__
 #define __SRC_CPP_IMAGE_METADATACONTAINER_HPP__
 
+/// C++ Standard Libraries
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Boost C++ Library
+#include <boost/shared_ptr.hpp>
+
 /// GeoExplore Libraries
 #include <GeoExplore/image/MetadataContainerBase.hpp>
 
 
 namespace GEO{
 
+/// Key of the affine geotransform, stored as six numbers in GDAL order
+const std::string METADATA_GEOTRANSFORM = "GEOTRANSFORM";
+
+/// Key of the spatial reference WKT
+const std::string METADATA_SRS = "SRS";
+
+/// Key of the band no-data values, one number per band, nan for bands without one
+const std::string METADATA_NODATA = "NODATA";
+
+/// Domain of the NITF tagged record extensions
+const std::string METADATA_DOMAIN_TRE = "TRE";
+
+/// Domain of the rational polynomial coefficients
+const std::string METADATA_DOMAIN_RPC = "RPC";
+
 /**
  * @class MetadataContainer
+ *
+ * Flat map of interned keys to raw string values.  Values are kept as the
+ * strings the file provided and are only parsed into numbers when first
+ * asked for, after which the parsed values are cached.  Images share the
+ * container by pointer, so copies and views never duplicate it.
 */
 class MetadataContainer : public MetadataContainerBase{
 
     public:
-        
-        /** 
+
+        /// Pointer Type
+        typedef boost::shared_ptr<MetadataContainer> ptr_t;
+
+        /// Parsed numbers
+        typedef boost::shared_ptr<const std::vector<double> > numbers_t;
+
+        /**
          * Default Constructor
         */
         MetadataContainer();
-    
 
+        /**
+         * Set a value, replacing any existing value
+        */
+        void setValue( MetadataKey const& key, std::string const& value );
+
+        /**
+         * Check if a key is present
+        */
+        virtual bool contains( MetadataKey const& key )const;
+
+        /**
+         * Get the raw value of a key.  Missing keys return an empty string.
+        */
+        virtual std::string getValue( MetadataKey const& key )const;
+
+        /**
+         * Get the value of a key parsed as a list of numbers
+         *
+         * Numbers may be separated by spaces, commas or semicolons.  The
+         * list is parsed on first access.  Missing keys return an empty list.
+        */
+        numbers_t getNumbers( MetadataKey const& key )const;
+
+        /**
+         * Get one number of a value
+         *
+         * @param[in] key           Key to look up.
+         * @param[in] index         Position in the number list.
+         * @param[in] default_value Returned if the key or number is missing.
+        */
+        double getNumber( MetadataKey const& key,
+                          const size_t& index = 0,
+                          const double& default_value = 0 )const;
+
+        /**
+         * Get the affine geotransform
+         *
+         * @param[out] transform Six coefficients in GDAL order.
+         *
+         * @return False if the container has no geotransform.
+        */
+        bool getGeoTransform( double transform[6] )const;
+
+        /**
+         * Get the no-data value of a band
+         *
+         * @param[out] value No-data value.
+         * @param[in]  band  Zero-based band index.
+         *
+         * @return False if the band has no no-data value.
+        */
+        bool getNoDataValue( double& value, const int& band = 0 )const;
+
+        /**
+         * Get the items of a domain
+         *
+         * @param[in] domain Domain name.  Empty returns the default domain.
+         *
+         * @return Item names without the domain prefix, and their values.
+        */
+        std::vector<std::pair<std::string,std::string> > getDomain( std::string const& domain )const;
+
+        /**
+         * Return the number of items
+        */
+        virtual size_t size()const;
+
+    private:
+
+        /**
+         * @class Entry
+        */
+        class Entry{
+
+            public:
+
+                /**
+                 * Constructor
+                */
+                Entry( MetadataKey const& key_, std::string const& value_ )
+                  : key(key_), value(value_){}
+
+                /// Interned key
+                MetadataKey key;
+
+                /// Raw value
+                std::string value;
+
+                /// Parsed value, filled on first access
+                mutable numbers_t numbers;
+
+        }; /// End of Entry Class
+
+        /**
+         * Find an entry
+        */
+        const Entry* find( MetadataKey const& key )const;
+
+        /// Entries sorted by key id
+        std::vector<Entry> m_entries;
+
+        /// Lock for the parsed values
+        mutable std::mutex m_mutex;
 
 }; /// End of MetadataContainer Class
 
@@ -5,8 +5,92 @@
 */
 #include "MetadataContainerBase.hpp"
 
+/// C++ Standard Libraries
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
 namespace GEO{
 
+/**
+ * @class MetadataKeyTable
+ *
+ * Process-wide table of interned key strings.  Names live in a deque so
+ * references handed out by MetadataKey::str() stay valid as it grows.
+*/
+class MetadataKeyTable{
+
+    public:
+
+        /**
+         * Intern a key string
+        */
+        uint32_t intern( std::string const& key ){
+            std::lock_guard<std::mutex> lock( m_mutex );
+            std::unordered_map<std::string,uint32_t>::const_iterator it = m_ids.find( key );
+            if( it != m_ids.end() ){
+                return it->second;
+            }
+            const uint32_t id = (uint32_t)m_names.size();
+            m_names.push_back( key );
+            m_ids[key] = id;
+            return id;
+        }
+
+        /**
+         * Get the string of an id
+        */
+        std::string const& name( const uint32_t& id ){
+            std::lock_guard<std::mutex> lock( m_mutex );
+            return m_names[id];
+        }
+
+    private:
+
+        /// Lock for the table
+        std::mutex m_mutex;
+
+        /// Id of each string
+        std::unordered_map<std::string,uint32_t> m_ids;
+
+        /// String of each id
+        std::deque<std::string> m_names;
+
+}; /// End of MetadataKeyTable Class
+
+/**
+ * Get the key table
+*/
+static MetadataKeyTable& metadata_key_table(){
+    static MetadataKeyTable table;
+    return table;
+}
+
+
+/**
+ * Key Constructor
+*/
+MetadataKey::MetadataKey( std::string const& name ) :
+                m_id( metadata_key_table().intern( name )){
+
+}
+
+/**
+ * Domain Key Constructor
+*/
+MetadataKey::MetadataKey( std::string const& domain, std::string const& name ) :
+                m_id( metadata_key_table().intern( domain.empty() ? name : domain + ":" + name )){
+
+}
+
+/**
+ * Get the key string
+*/
+std::string const& MetadataKey::str()const{
+    return metadata_key_table().name( m_id );
+}
+
+
 /**
  * Default Constructor
 */
@@ -14,5 +98,12 @@ MetadataContainerBase::MetadataContainerBase(){
 
 }
 
+/**
+ * Destructor
+*/
+MetadataContainerBase::~MetadataContainerBase(){
+
+}
+
 }/// End of GEO Namespace
 
@@ -6,18 +6,77 @@
 #ifndef __SRC_CPP_IMAGE_METADATACONTAINERBASE_HPP__
 #define __SRC_CPP_IMAGE_METADATACONTAINERBASE_HPP__
 
+/// C++ Standard Libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 /// Boost C++ Library
 #include <boost/shared_ptr.hpp>
 
 namespace GEO{
 
+/**
+ * @class MetadataKey
+ *
+ * Interned metadata key.  Each distinct key string is stored once for the
+ * life of the process, so keys compare and hash as integers and thousands
+ * of images carrying the same NITF fields share one copy of each name.
+*/
+class MetadataKey{
+
+    public:
+
+        /**
+         * Constructor for a key in the default domain
+        */
+        MetadataKey( std::string const& name );
+
+        /**
+         * Constructor for a key in a metadata domain
+         *
+         * @param[in] domain Domain, such as TRE or RPC.
+         * @param[in] name   Item name within the domain.
+        */
+        MetadataKey( std::string const& domain, std::string const& name );
+
+        /**
+         * Get the interned id
+        */
+        uint32_t id()const{ return m_id; }
+
+        /**
+         * Get the key string.  Domain keys are written as DOMAIN:NAME.
+        */
+        std::string const& str()const;
+
+        /**
+         * Compare keys
+        */
+        bool operator == ( MetadataKey const& rhs )const{ return m_id == rhs.m_id; }
+
+        /**
+         * Order keys by id
+        */
+        bool operator < ( MetadataKey const& rhs )const{ return m_id < rhs.m_id; }
+
+    private:
+
+        /// Interned id
+        uint32_t m_id;
+
+}; /// End of MetadataKey Class
+
+
 /**
  * @class MetadataContainerBase
+ *
+ * Interface to the metadata attached to an image.
 */
 class MetadataContainerBase{
 
     public:
-        
+
         /// Pointer Type
         typedef boost::shared_ptr<MetadataContainerBase> ptr_t;
 
@@ -26,6 +85,26 @@ class MetadataContainerBase{
         */
         MetadataContainerBase();
 
+        /**
+         * Destructor
+        */
+        virtual ~MetadataContainerBase();
+
+        /**
+         * Check if a key is present
+        */
+        virtual bool contains( MetadataKey const& key )const = 0;
+
+        /**
+         * Get the raw value of a key.  Missing keys return an empty string.
+        */
+        virtual std::string getValue( MetadataKey const& key )const = 0;
+
+        /**
+         * Return the number of items
+        */
+        virtual size_t size()const = 0;
+
 
 }; /// End MetadataContainerBase Class
 
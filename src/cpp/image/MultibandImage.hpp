@@ -0,0 +1,161 @@
+/**
+ * @file    MultibandImage.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_MULTIBANDIMAGE_HPP__
+#define __SRC_CPP_IMAGE_MULTIBANDIMAGE_HPP__
+
+/// GeoExplore Libraries
+#include <GeoExplore/image/ChannelType.hpp>
+#include <GeoExplore/image/MemoryAllocator.hpp>
+#include <GeoExplore/image/PlanarBuffer.hpp>
+
+namespace GEO{
+
+/**
+ * @class MultibandImage
+ *
+ * Band-sequential image whose band count is only known at runtime, such as
+ * hyperspectral cubes with hundreds of bands.  Use PixelN with an Image when
+ * the band count is fixed and small.
+*/
+template <typename ChannelType>
+class MultibandImage{
+
+    public:
+
+        /// Channel type
+        typedef ChannelType channeltype;
+
+        /// Sample type
+        typedef typename ChannelType::type datatype;
+
+        /**
+         * Default Constructor
+        */
+        MultibandImage(){
+
+        }
+
+        /**
+         * Parameterized Constructor
+         *
+         * @param[in] rows      Number of rows.
+         * @param[in] cols      Number of columns.
+         * @param[in] bands     Number of bands.
+         * @param[in] allocator Allocator for the samples.  Null uses the default allocator.
+        */
+        MultibandImage( const int& rows,
+                        const int& cols,
+                        const int& bands,
+                        MemoryAllocator::ptr_t allocator = MemoryAllocator::ptr_t() )
+                          : m_buffer( rows, cols, bands, allocator ){
+
+        }
+
+        /**
+         * Get a sample
+        */
+        datatype operator()( const int& x, const int& y, const int& band )const{
+            return m_buffer.sample( x, y, band );
+        }
+
+        /**
+         * Get a sample reference
+        */
+        datatype& operator()( const int& x, const int& y, const int& band ){
+            return m_buffer.sample( x, y, band );
+        }
+
+        /**
+         * Copy every band of a pixel into a buffer
+         *
+         * @param[in]  x      Column.
+         * @param[in]  y      Row.
+         * @param[out] output Buffer with bands() samples.
+        */
+        void getPixel( const int& x, const int& y, datatype* output )const{
+            for( int b=0; b<m_buffer.bands(); b++ ){
+                output[b] = m_buffer.sample( x, y, b );
+            }
+        }
+
+        /**
+         * Get a band
+         *
+         * @param[in] band Zero-based band index.
+        */
+        BandSpan<datatype> band( const int& band )const{
+            return m_buffer.band( band );
+        }
+
+        /**
+         * Return the number of rows
+        */
+        int rows()const{
+            return m_buffer.rows();
+        }
+
+        /**
+         * Return the number of columns
+        */
+        int cols()const{
+            return m_buffer.cols();
+        }
+
+        /**
+         * Return the number of bands
+        */
+        int bands()const{
+            return m_buffer.bands();
+        }
+
+        /**
+         * Check if the image holds samples
+        */
+        bool empty()const{
+            return m_buffer.getSampleData() == nullptr;
+        }
+
+        /**
+         * Get the planar buffer
+        */
+        PlanarBuffer<datatype> const& getBuffer()const{
+            return m_buffer;
+        }
+
+        /**
+         * Get the planar buffer
+        */
+        PlanarBuffer<datatype>& getBuffer(){
+            return m_buffer;
+        }
+
+        /**
+         * Clone (Deep Copy)
+        */
+        MultibandImage<ChannelType> clone()const{
+            MultibandImage<ChannelType> output;
+            output.m_buffer = m_buffer.clone();
+            return output;
+        }
+
+    private:
+
+        /// Band samples
+        PlanarBuffer<datatype> m_buffer;
+
+}; /// End of MultibandImage Class
+
+/// Common MultibandImage Aliases
+typedef MultibandImage<ChannelTypeUInt8>       MultibandImage_u8;
+typedef MultibandImage<ChannelTypeUInt12>      MultibandImage_u12;
+typedef MultibandImage<ChannelTypeUInt14>      MultibandImage_u14;
+typedef MultibandImage<ChannelTypeUInt16>      MultibandImage_u16;
+typedef MultibandImage<ChannelTypeDouble>      MultibandImage_d;
+typedef MultibandImage<ChannelTypeDoubleFree>  MultibandImage_df;
+
+} /// End of GEO Namespace
+
+#endif
@@ -10,6 +10,7 @@
 #include <GeoExplore/image/ChannelType.hpp>
 #include <GeoExplore/image/PixelBase.hpp>
 #include <GeoExplore/image/PixelGray.hpp>
+#include <GeoExplore/image/PixelN.hpp>
 #include <GeoExplore/image/PixelRGB.hpp>
 
 /// C++ Standard Library
@@ -75,6 +76,20 @@ typename std::enable_if<std::is_same<OutputPixelType, PixelGray<typename OutputP
     return PixelGray<typename OutputPixelType::channeltype>( avg );
 }   
 
+/**
+ * Convert PixelN to PixelN with the same band count
+*/
+template <typename OutputPixelType, typename InputChannelType, int N>
+typename std::enable_if<std::is_same<OutputPixelType, PixelN<typename OutputPixelType::channeltype,N> >::value,PixelN<typename OutputPixelType::channeltype,N> >::type
+    pixel_cast( PixelN<InputChannelType,N> const& pixel ){
+
+    PixelN<typename OutputPixelType::channeltype,N> output;
+    for( int i=0; i<N; i++ ){
+        output[i] = range_cast<InputChannelType,typename OutputPixelType::channeltype>( pixel[i] );
+    }
+    return output;
+}
+
 } /// End of GEO Namespace
 
 
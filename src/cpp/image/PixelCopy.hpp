@@ -0,0 +1,108 @@
+/**
+ * @file    PixelCopy.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_PIXELCOPY_HPP__
+#define __SRC_CPP_IMAGE_PIXELCOPY_HPP__
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+/// GeoExplore Libraries
+#include <GeoExplore/image/PixelCast.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+
+/// Buffers smaller than this many bytes are copied on the calling thread
+const size_t PARALLEL_COPY_BYTES = (size_t)8 << 20;
+
+/**
+ * Run func(begin, end) over [0, count), split across threads when the
+ * range covers more than PARALLEL_COPY_BYTES.
+ *
+ * @param[in] count      Number of elements.
+ * @param[in] elem_bytes Size of one element in bytes.
+ * @param[in] func       Callable as func(begin, end).
+*/
+template <typename FunctionType>
+void parallel_blocks( const size_t& count, const size_t& elem_bytes, FunctionType func ){
+
+    const size_t bytes = count * elem_bytes;
+    const int threads = default_thread_count();
+    if( bytes < PARALLEL_COPY_BYTES || threads <= 1 ){
+        func( (size_t)0, count );
+        return;
+    }
+
+    // a few blocks per thread balances uneven memory bandwidth
+    const size_t blocks = std::min( count, (size_t)threads * 4 );
+    const size_t block_size = ( count + blocks - 1 ) / blocks;
+    parallel_for( 0, blocks, [&]( const size_t& idx, const int& /*thread_id*/ ){
+        const size_t begin = idx * block_size;
+        const size_t end   = std::min( count, begin + block_size );
+        if( begin < end ){
+            func( begin, end );
+        }
+    }, threads );
+}
+
+/**
+ * Copy pixels on the calling thread
+*/
+template <typename PixelType>
+void copy_pixels_serial( const PixelType* src, PixelType* dst, const size_t& count ){
+    if( std::is_trivially_copyable<PixelType>::value ){
+        std::memcpy( (void*)dst, (const void*)src, count * sizeof(PixelType) );
+    } else {
+        std::copy( src, src + count, dst );
+    }
+}
+
+/**
+ * Copy pixels, using all cores for large buffers
+ *
+ * @param[in]  src   Source pixels.
+ * @param[out] dst   Destination pixels.  Must not overlap the source.
+ * @param[in]  count Number of pixels.
+*/
+template <typename PixelType>
+void copy_pixels( const PixelType* src, PixelType* dst, const size_t& count ){
+    parallel_blocks( count, sizeof(PixelType), [&]( const size_t& begin, const size_t& end ){
+        copy_pixels_serial( src + begin, dst + begin, end - begin );
+    });
+}
+
+/**
+ * Fill pixels with a value, using all cores for large buffers
+*/
+template <typename PixelType>
+void fill_pixels( PixelType* dst, const size_t& count, PixelType const& value ){
+    parallel_blocks( count, sizeof(PixelType), [&]( const size_t& begin, const size_t& end ){
+        if( std::is_trivially_copyable<PixelType>::value && sizeof(PixelType) == 1 ){
+            std::memset( (void*)(dst + begin), *reinterpret_cast<const unsigned char*>(&value), end - begin );
+        } else {
+            std::fill( dst + begin, dst + end, value );
+        }
+    });
+}
+
+/**
+ * Convert pixels to another pixel type, using all cores for large buffers
+*/
+template <typename OutputPixelType, typename InputPixelType>
+void convert_pixels( const InputPixelType* src, OutputPixelType* dst, const size_t& count ){
+    parallel_blocks( count, sizeof(InputPixelType) + sizeof(OutputPixelType), [&]( const size_t& begin, const size_t& end ){
+        for( size_t i=begin; i<end; i++ ){
+            dst[i] = pixel_cast<OutputPixelType>( src[i] );
+        }
+    });
+}
+
+} /// End of GEO Namespace
+
+#endif
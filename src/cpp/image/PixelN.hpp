@@ -0,0 +1,116 @@
+/**
+ * @file    PixelN.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_PIXELN_HPP__
+#define __SRC_CPP_IMAGE_PIXELN_HPP__
+
+/// GeoExplore Libraries
+#include <GeoExplore/image/ChannelType.hpp>
+#include <GeoExplore/image/PixelBase.hpp>
+
+namespace GEO{
+
+/**
+ * @class PixelN
+ *
+ * Pixel with a compile-time number of bands, for multispectral imagery.
+*/
+template <typename ChannelType, int N>
+class PixelN : public PixelBase<PixelN<ChannelType,N>,ChannelType>{
+
+    public:
+
+        /// Define a channeltype
+        typedef ChannelType channeltype;
+        
+        /// Define datatype
+        typedef typename ChannelType::type datatype;
+
+        /// Number of bands
+        static const int BANDS = N;
+
+        /**
+         * Default Constructor
+        */
+        PixelN() : PixelBase<PixelN<ChannelType,N>,ChannelType>(){
+            for( int i=0; i<N; i++ ){
+                m_data[i] = channeltype::minValue;
+            }
+        }
+
+        /**
+         * Parameterized Constructor
+        */
+        PixelN( datatype const& b ) : PixelBase<PixelN<ChannelType,N>,ChannelType>(){
+            for( int i=0; i<N; i++ ){
+                m_data[i] = b;
+            }
+        }
+
+        /// return the dimensionality
+        virtual int dims()const{ return N; }
+
+        /**
+         * Accessor operator
+        */
+        virtual datatype& operator[]( const int& idx){
+            return m_data[idx];
+        }
+        
+        /**
+         * Accessor Operator
+        */
+        virtual datatype operator[](const int& idx)const{
+            return m_data[idx];
+        }
+
+        /**
+         * Get a pointer to the band values
+        */
+        datatype* data(){
+            return m_data;
+        }
+
+        /**
+         * Get a pointer to the band values
+        */
+        const datatype* data()const{
+            return m_data;
+        }
+        
+        /**
+         * Compare Pixels
+        */
+        virtual bool operator == (const PixelN<ChannelType,N>& rhs )const{
+            for( int i=0; i<N; i++ ){
+                if( m_data[i] != rhs.m_data[i] ){
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+
+        /// Data
+        datatype m_data[N];
+
+}; /// End of class PixelN
+
+/// Static Constants
+template <typename ChannelType, int N> const int PixelN<ChannelType,N>::BANDS;
+
+/// Common PixelN Aliases
+template <int N> using PixelN_d   = PixelN<ChannelTypeDouble,N>;
+template <int N> using PixelN_df  = PixelN<ChannelTypeDoubleFree,N>;
+template <int N> using PixelN_u8  = PixelN<ChannelTypeUInt8,N>;
+template <int N> using PixelN_u12 = PixelN<ChannelTypeUInt12,N>;
+template <int N> using PixelN_u14 = PixelN<ChannelTypeUInt14,N>;
+template <int N> using PixelN_u16 = PixelN<ChannelTypeUInt16,N>;
+template <int N> using PixelN_u32 = PixelN<ChannelTypeUInt32,N>;
+
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,244 @@
+/**
+ * @file    PlanarBuffer.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_PLANARBUFFER_HPP__
+#define __SRC_CPP_IMAGE_PLANARBUFFER_HPP__
+
+/// C++ Standard Libraries
+#include <cstddef>
+
+/// Boost C++ Library
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/image/MemoryAllocator.hpp>
+#include <GeoExplore/image/PixelCopy.hpp>
+
+namespace GEO{
+
+/**
+ * @class BandSpan
+ *
+ * Contiguous view of a single band.  Rows are packed, so the band can be
+ * walked as one flat array of rows*cols samples.
+*/
+template <typename DataType>
+class BandSpan{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        BandSpan( DataType* data, const int& rows, const int& cols ) :
+                        m_data(data), m_rows(rows), m_cols(cols){}
+
+        /**
+         * Get a sample reference
+        */
+        DataType& operator[]( const size_t& idx )const{
+            return m_data[idx];
+        }
+
+        /**
+         * Get a sample reference
+        */
+        DataType& operator()( const int& x, const int& y )const{
+            return m_data[(size_t)m_cols*y + x];
+        }
+
+        /**
+         * Get a pointer to the first sample of a row
+        */
+        DataType* row( const int& y )const{
+            return m_data + (size_t)m_cols*y;
+        }
+
+        /**
+         * Get the sample pointer
+        */
+        DataType* data()const{ return m_data; }
+
+        /**
+         * Get the first sample
+        */
+        DataType* begin()const{ return m_data; }
+
+        /**
+         * Get one past the last sample
+        */
+        DataType* end()const{ return m_data + size(); }
+
+        /**
+         * Get the number of samples
+        */
+        size_t size()const{ return (size_t)m_rows * m_cols; }
+
+        /**
+         * Get the number of rows
+        */
+        int rows()const{ return m_rows; }
+
+        /**
+         * Get the number of columns
+        */
+        int cols()const{ return m_cols; }
+
+    private:
+
+        /// First sample
+        DataType* m_data;
+
+        /// Number of rows
+        int m_rows;
+
+        /// Number of columns
+        int m_cols;
+
+}; /// End of BandSpan Class
+
+
+/**
+ * @class PlanarBuffer
+ *
+ * Band-sequential sample buffer.  All bands live in one allocation and
+ * each band starts on a PIXEL_BUFFER_ALIGNMENT boundary.  Copies share the
+ * samples; use clone() for a deep copy.
+*/
+template <typename DataType>
+class PlanarBuffer{
+
+    public:
+
+        /**
+         * Default Constructor
+        */
+        PlanarBuffer() : m_rows(0), m_cols(0), m_bands(0), m_band_stride(0){
+
+        }
+
+        /**
+         * Parameterized Constructor
+         *
+         * @param[in] rows      Number of rows.
+         * @param[in] cols      Number of columns.
+         * @param[in] bands     Number of bands.
+         * @param[in] allocator Allocator for the samples.  Null uses the default allocator.
+        */
+        PlanarBuffer( const int& rows,
+                      const int& cols,
+                      const int& bands,
+                      MemoryAllocator::ptr_t allocator = MemoryAllocator::ptr_t() )
+                        : m_rows(rows),
+                          m_cols(cols),
+                          m_bands(bands),
+                          m_allocator(allocator){
+
+            // pad each band to the buffer alignment
+            const size_t align = PIXEL_BUFFER_ALIGNMENT / sizeof(DataType);
+            m_band_stride = ( (size_t)rows*cols + align - 1 ) / align * align;
+            m_data = allocate_pixels<DataType>( m_band_stride * m_bands, m_allocator );
+        }
+
+        /**
+         * Get a band
+         *
+         * @param[in] band Zero-based band index.
+        */
+        BandSpan<DataType> band( const int& band )const{
+            if( band < 0 || band >= m_bands ){
+                throw GEO::GeneralException("Band index out of range.", __FILE__, __LINE__);
+            }
+            return BandSpan<DataType>( m_data.get() + band*m_band_stride, m_rows, m_cols );
+        }
+
+        /**
+         * Get a sample
+        */
+        DataType sample( const int& x, const int& y, const int& band )const{
+            return m_data[band*m_band_stride + (size_t)m_cols*y + x];
+        }
+
+        /**
+         * Get a sample reference
+        */
+        DataType& sample( const int& x, const int& y, const int& band ){
+            return m_data[band*m_band_stride + (size_t)m_cols*y + x];
+        }
+
+        /**
+         * Return the number of rows
+        */
+        int rows()const{ return m_rows; }
+
+        /**
+         * Return the number of columns
+        */
+        int cols()const{ return m_cols; }
+
+        /**
+         * Return the number of bands
+        */
+        int bands()const{ return m_bands; }
+
+        /**
+         * Return the number of samples between the start of two bands
+        */
+        size_t bandStride()const{ return m_band_stride; }
+
+        /**
+         * Get the sample buffer
+        */
+        boost::shared_ptr<DataType[]> getSampleData()const{ return m_data; }
+
+        /**
+         * Get the allocator
+        */
+        MemoryAllocator::ptr_t getAllocator()const{ return m_allocator; }
+
+        /**
+         * Clone (Deep Copy)
+        */
+        PlanarBuffer<DataType> clone()const{
+
+            PlanarBuffer<DataType> output;
+            output.m_rows = m_rows;
+            output.m_cols = m_cols;
+            output.m_bands = m_bands;
+            output.m_band_stride = m_band_stride;
+            output.m_allocator = m_allocator;
+            if( m_data != nullptr ){
+                output.m_data = allocate_pixels<DataType>( m_band_stride * m_bands, m_allocator );
+                copy_pixels( m_data.get(), output.m_data.get(), m_band_stride * m_bands );
+            }
+            return output;
+        }
+
+    private:
+
+        /// Sample buffer holding every band
+        boost::shared_ptr<DataType[]> m_data;
+
+        /// number of rows
+        int m_rows;
+
+        /// number of columns
+        int m_cols;
+
+        /// number of bands
+        int m_bands;
+
+        /// samples between bands
+        size_t m_band_stride;
+
+        /// allocator for new buffers
+        MemoryAllocator::ptr_t m_allocator;
+
+}; /// End of PlanarBuffer Class
+
+} /// End of GEO Namespace
+
+#endif
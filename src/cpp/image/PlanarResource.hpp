@@ -0,0 +1,240 @@
+/**
+ * @file    PlanarResource.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_PLANARRESOURCE_HPP__
+#define __SRC_CPP_IMAGE_PLANARRESOURCE_HPP__
+
+/// C++ Standard Libraries
+#include <cstddef>
+
+/// Boost C++ Library
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/image/BaseResource.hpp>
+#include <GeoExplore/image/MemoryResource.hpp>
+#include <GeoExplore/image/PixelCopy.hpp>
+#include <GeoExplore/image/PlanarBuffer.hpp>
+
+namespace GEO{
+
+/**
+ * @class PlanarResource
+ *
+ * Band-sequential pixel storage.  Every band is a contiguous array of
+ * channel samples starting on a PIXEL_BUFFER_ALIGNMENT boundary, so per-band
+ * loops vectorize and GDAL can read a band straight into place.
+ *
+ * Pixels do not exist in memory, so there are no pixel references.
+ * Pixels are read by value, and written with setPixel() or band().
+*/
+template <typename PixelType>
+class PlanarResource : public ReadOnlyResource<PixelType> {
+
+    public:
+
+        /// Channel sample type
+        typedef typename PixelType::channeltype::type datatype;
+
+        /**
+         * Default Constructor
+        */
+        PlanarResource(){
+
+        }
+
+        /**
+         * Parameterized Constructor
+         *
+         * @param[in] rows      Number of rows.
+         * @param[in] cols      Number of columns.
+         * @param[in] allocator Allocator for the sample buffer.  Null uses the default allocator.
+        */
+        PlanarResource( const int& rows,
+                        const int& cols,
+                        MemoryAllocator::ptr_t allocator = MemoryAllocator::ptr_t() )
+                          : m_buffer( rows, cols, PixelType().dims(), allocator ){
+
+        }
+
+        /**
+         * Get the pixel value
+        */
+        virtual PixelType operator[]( const int& idx )const{
+            return (*this)( idx % m_buffer.cols(), idx / m_buffer.cols() );
+        }
+
+        /**
+         * Get the pixel value
+        */
+        virtual PixelType operator()( const int& x, const int& y )const{
+
+            // make sure the image has memory initialized
+            if( m_buffer.getSampleData() == nullptr ){
+                throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
+            }
+            PixelType output;
+            for( int b=0; b<m_buffer.bands(); b++ ){
+                output[b] = m_buffer.sample( x, y, b );
+            }
+            return output;
+        }
+
+        /**
+         * Set a pixel value
+        */
+        void setPixel( const int& x, const int& y, PixelType const& pixel ){
+
+            // make sure the image has memory initialized
+            if( m_buffer.getSampleData() == nullptr ){
+                throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
+            }
+            for( int b=0; b<m_buffer.bands(); b++ ){
+                m_buffer.sample( x, y, b ) = pixel[b];
+            }
+        }
+
+        /**
+         * Return the number of rows
+        */
+        virtual int rows()const{
+            return m_buffer.rows();
+        }
+
+        /**
+         * Return the number of columns
+        */
+        virtual int cols()const{
+            return m_buffer.cols();
+        }
+
+        /**
+         * Return the number of channels
+        */
+        virtual int channels()const{
+            return PixelType().dims();
+        }
+
+        /**
+         * Get a band
+         *
+         * @param[in] band Zero-based band index.
+        */
+        BandSpan<datatype> band( const int& band )const{
+            return m_buffer.band( band );
+        }
+
+        /**
+         * Return the number of samples between the start of two bands
+        */
+        size_t bandStride()const{
+            return m_buffer.bandStride();
+        }
+
+        /**
+         * Get the sample buffer
+        */
+        boost::shared_ptr<datatype[]> getSampleData()const{
+            return m_buffer.getSampleData();
+        }
+
+        /**
+         * Get the planar buffer
+        */
+        PlanarBuffer<datatype> const& getBuffer()const{
+            return m_buffer;
+        }
+
+        /**
+         * Get the planar buffer
+        */
+        PlanarBuffer<datatype>& getBuffer(){
+            return m_buffer;
+        }
+
+        /**
+         * Get the allocator used for new buffers
+        */
+        MemoryAllocator::ptr_t getAllocator()const{
+            return m_buffer.getAllocator();
+        }
+
+        /**
+         * Clone (Deep Copy)
+        */
+        PlanarResource<PixelType> clone()const{
+            PlanarResource<PixelType> output;
+            output.m_buffer = m_buffer.clone();
+            return output;
+        }
+
+    private:
+
+        /// Band samples
+        PlanarBuffer<datatype> m_buffer;
+
+}; /// End of PlanarResource Class
+
+
+/**
+ * Convert interleaved pixels into planar bands
+*/
+template <typename PixelType>
+PlanarResource<PixelType> deinterleave( MemoryResource<PixelType> const& input ){
+
+    PlanarResource<PixelType> output( input.rows(), input.cols(), input.getAllocator() );
+    if( input.getPixelData() == nullptr ){
+        return output;
+    }
+
+    typedef typename PixelType::channeltype::type datatype;
+    const PixelType* src = input.getPixelData().get();
+    const int bands = output.channels();
+    const size_t stride = output.bandStride();
+    datatype* dst = output.getSampleData().get();
+
+    parallel_blocks( (size_t)input.rows()*input.cols(), sizeof(PixelType), [&]( const size_t& begin, const size_t& end ){
+        for( int b=0; b<bands; b++ ){
+            datatype* band = dst + b*stride;
+            for( size_t i=begin; i<end; i++ ){
+                band[i] = src[i][b];
+            }
+        }
+    });
+    return output;
+}
+
+/**
+ * Convert planar bands into interleaved pixels
+*/
+template <typename PixelType>
+MemoryResource<PixelType> interleave( PlanarResource<PixelType> const& input ){
+
+    MemoryResource<PixelType> output( input.rows(), input.cols(), input.getAllocator() );
+    if( input.getSampleData() == nullptr ){
+        return output;
+    }
+
+    typedef typename PixelType::channeltype::type datatype;
+    const datatype* src = input.getSampleData().get();
+    const int bands = input.channels();
+    const size_t stride = input.bandStride();
+    PixelType* dst = output.getPixelData().get();
+
+    parallel_blocks( (size_t)input.rows()*input.cols(), sizeof(PixelType), [&]( const size_t& begin, const size_t& end ){
+        for( int b=0; b<bands; b++ ){
+            const datatype* band = src + b*stride;
+            for( size_t i=begin; i<end; i++ ){
+                dst[i][b] = band[i];
+            }
+        }
+    });
+    return output;
+}
+
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file    Rect.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_RECT_HPP__
+#define __SRC_CPP_IMAGE_RECT_HPP__
+
+/// C++ Standard Libraries
+#include <algorithm>
+
+namespace GEO{
+
+/**
+ * @class Rect
+ *
+ * Rectangular window in pixel coordinates.  x and y are the column
+ * and row of the upper-left corner.
+*/
+class Rect{
+
+    public:
+
+        /**
+         * Default Constructor
+        */
+        Rect() : m_x(0), m_y(0), m_width(0), m_height(0){}
+
+        /**
+         * Parameterized Constructor
+        */
+        Rect( const int& x, const int& y, const int& width, const int& height ) :
+                m_x(x), m_y(y), m_width(width), m_height(height){}
+
+        /**
+         * Get the x (column) value
+        */
+        int x()const{ return m_x; }
+
+        /**
+         * Set the x (column) value
+        */
+        int& x(){ return m_x; }
+
+        /**
+         * Get the y (row) value
+        */
+        int y()const{ return m_y; }
+
+        /**
+         * Set the y (row) value
+        */
+        int& y(){ return m_y; }
+
+        /**
+         * Get the width
+        */
+        int width()const{ return m_width; }
+
+        /**
+         * Set the width
+        */
+        int& width(){ return m_width; }
+
+        /**
+         * Get the height
+        */
+        int height()const{ return m_height; }
+
+        /**
+         * Set the height
+        */
+        int& height(){ return m_height; }
+
+        /**
+         * Get the number of pixels in the window
+        */
+        int area()const{ return m_width * m_height; }
+
+        /**
+         * Check if the window has no pixels
+        */
+        bool empty()const{ return ( m_width <= 0 || m_height <= 0 ); }
+
+        /**
+         * Check if the window lies within an image of the given size
+        */
+        bool inside( const int& rows, const int& cols )const{
+            return ( m_x >= 0 && m_y >= 0 &&
+                     m_x + m_width  <= cols &&
+                     m_y + m_height <= rows );
+        }
+
+        /**
+         * Intersect two windows
+        */
+        Rect operator & ( Rect const& rhs )const{
+            int x0 = std::max( m_x, rhs.m_x );
+            int y0 = std::max( m_y, rhs.m_y );
+            int x1 = std::min( m_x + m_width,  rhs.m_x + rhs.m_width );
+            int y1 = std::min( m_y + m_height, rhs.m_y + rhs.m_height );
+            if( x1 <= x0 || y1 <= y0 ){
+                return Rect();
+            }
+            return Rect( x0, y0, x1 - x0, y1 - y0 );
+        }
+
+        /**
+         * Compare windows
+        */
+        bool operator == ( Rect const& rhs )const{
+            return ( m_x == rhs.m_x && m_y == rhs.m_y &&
+                     m_width == rhs.m_width && m_height == rhs.m_height );
+        }
+
+    private:
+
+        /// Column of the upper-left corner
+        int m_x;
+
+        /// Row of the upper-left corner
+        int m_y;
+
+        /// Number of columns
+        int m_width;
+
+        /// Number of rows
+        int m_height;
+
+}; /// End of Rect Class
+
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,41 @@
+/**
+ * @file    TiledResource.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "TiledResource.hpp"
+
+namespace GEO{
+
+/**
+ * Compute the storage order of a grid of tiles
+*/
+void compute_tile_layout( const int& tiles_x,
+                          const int& tiles_y,
+                          TileLayout const& layout,
+                          std::vector<uint32_t>& slots,
+                          std::vector<uint32_t>& order ){
+
+    // key every tile by its position along the curve
+    const int curve = curve_order( tiles_x, tiles_y );
+    std::vector<std::pair<uint64_t,uint32_t> > keys;
+    keys.reserve( (size_t)tiles_x * tiles_y );
+    for( int ty=0; ty<tiles_y; ty++ ){
+        for( int tx=0; tx<tiles_x; tx++ ){
+            const uint64_t key = ( layout == TileLayout::HILBERT ) ? hilbert_encode( curve, tx, ty )
+                                                                   : morton_encode( tx, ty );
+            keys.push_back( std::make_pair( key, (uint32_t)( ty * tiles_x + tx )));
+        }
+    }
+
+    // grids which are not a power of two skip the unused curve positions
+    std::sort( keys.begin(), keys.end() );
+    slots.resize( keys.size() );
+    order.resize( keys.size() );
+    for( size_t s=0; s<keys.size(); s++ ){
+        order[s] = keys[s].second;
+        slots[keys[s].second] = (uint32_t)s;
+    }
+}
+
+} /// End of GEO Namespace
@@ -0,0 +1,435 @@
+/**
+ * @file    TiledResource.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_TILEDRESOURCE_HPP__
+#define __SRC_CPP_IMAGE_TILEDRESOURCE_HPP__
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/// Boost C++ Library
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/image/BaseResource.hpp>
+#include <GeoExplore/image/MemoryAllocator.hpp>
+#include <GeoExplore/image/MemoryResource.hpp>
+#include <GeoExplore/image/PixelCopy.hpp>
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/utilities/SpaceFillingCurves.hpp>
+
+namespace GEO{
+
+/**
+ * @class TileLayout
+ *
+ * Order in which the tiles of a TiledResource are stored.
+*/
+enum class TileLayout{
+    MORTON,
+    HILBERT,
+}; /// End of TileLayout Enumeration
+
+
+/**
+ * Compute the storage order of a grid of tiles
+ *
+ * @param[in]  tiles_x Tile columns.
+ * @param[in]  tiles_y Tile rows.
+ * @param[in]  layout  Curve to order the tiles by.
+ * @param[out] slots   Storage slot of each tile, indexed by ty*tiles_x+tx.
+ * @param[out] order   Tile index stored in each slot.
+*/
+void compute_tile_layout( const int& tiles_x,
+                          const int& tiles_y,
+                          TileLayout const& layout,
+                          std::vector<uint32_t>& slots,
+                          std::vector<uint32_t>& order );
+
+
+/**
+ * Log2 of a power of two tile size
+*/
+constexpr int tile_size_log2( const int tile_size ){
+    return ( tile_size <= 1 ) ? 0 : 1 + tile_size_log2( tile_size / 2 );
+}
+
+
+/**
+ * @class PixelTile
+ *
+ * One tile of a TiledResource.  Pixels are stored row-major with a
+ * stride of the full tile edge, including on clipped edge tiles.
+*/
+template <typename PixelType>
+class PixelTile{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        PixelTile( Rect const& window, PixelType* data, const int& stride ) :
+                m_window(window), m_data(data), m_stride(stride){}
+
+        /**
+         * Get the tile window in image coordinates
+        */
+        Rect window()const{ return m_window; }
+
+        /**
+         * Get the pixels of the tile
+        */
+        PixelType* data()const{ return m_data; }
+
+        /**
+         * Get the distance between tile rows in pixels
+        */
+        int stride()const{ return m_stride; }
+
+        /**
+         * Get a pixel by its position inside the tile
+        */
+        PixelType& operator()( const int& x, const int& y )const{
+            return m_data[ y * m_stride + x ];
+        }
+
+    private:
+
+        /// Window in image coordinates
+        Rect m_window;
+
+        /// Pixel data
+        PixelType* m_data;
+
+        /// Row stride
+        int m_stride;
+
+}; /// End of PixelTile Class
+
+
+/**
+ * @class TiledResource
+ *
+ * Pixel buffer stored as square tiles of TileSize x TileSize pixels.  Each
+ * tile is contiguous and the tiles follow a Morton or Hilbert curve, so
+ * pixels which are close in 2D are close in memory.  Neighborhood access,
+ * column walks and warps touch far fewer cache lines and pages than with
+ * row-major storage.
+ *
+ * Copies share the pixel buffer.  Use clone() for a deep copy.
+*/
+template <typename PixelType, int TileSize = 64>
+class TiledResource : public BaseResource<PixelType> {
+
+    static_assert( TileSize > 0 && ( TileSize & ( TileSize - 1 )) == 0, "TileSize must be a power of two." );
+
+    public:
+
+        /**
+         * @class tile_iterator
+         *
+         * Walks the tiles in storage order.
+        */
+        class tile_iterator{
+
+            public:
+
+                /// Iterator Traits
+                typedef std::forward_iterator_tag iterator_category;
+                typedef PixelTile<PixelType>      value_type;
+                typedef std::ptrdiff_t            difference_type;
+                typedef PixelTile<PixelType>*     pointer;
+                typedef PixelTile<PixelType>      reference;
+
+                /**
+                 * Constructor
+                */
+                tile_iterator( TiledResource const* resource, const size_t& slot ) :
+                        m_resource(resource), m_slot(slot){}
+
+                /**
+                 * Get the tile
+                */
+                PixelTile<PixelType> operator*()const{ return m_resource->tile( m_slot ); }
+
+                /**
+                 * Advance to the next tile
+                */
+                tile_iterator& operator++(){ m_slot++; return *this; }
+
+                /**
+                 * Compare iterators
+                */
+                bool operator == ( tile_iterator const& rhs )const{ return m_slot == rhs.m_slot; }
+
+                /**
+                 * Compare iterators
+                */
+                bool operator != ( tile_iterator const& rhs )const{ return m_slot != rhs.m_slot; }
+
+            private:
+
+                /// Resource
+                TiledResource const* m_resource;
+
+                /// Storage slot
+                size_t m_slot;
+
+        }; /// End of tile_iterator Class
+
+        /**
+         * Default Constructor
+        */
+        TiledResource() : m_rows(0), m_cols(0), m_tiles_x(0), m_tiles_y(0), m_layout(TileLayout::MORTON),
+                          m_slots(new std::vector<uint32_t>()),
+                          m_order(new std::vector<uint32_t>()){
+
+        }
+
+        /**
+         * Parameterized Constructor
+         *
+         * @param[in] rows      Number of rows.
+         * @param[in] cols      Number of columns.
+         * @param[in] layout    Tile order.
+         * @param[in] allocator Allocator for the pixel buffer.  Null uses the default allocator.
+        */
+        TiledResource( const int& rows,
+                       const int& cols,
+                       TileLayout const& layout = TileLayout::MORTON,
+                       MemoryAllocator::ptr_t allocator = MemoryAllocator::ptr_t() )
+                         : m_rows(rows),
+                           m_cols(cols),
+                           m_tiles_x( ( cols + TileSize - 1 ) / TileSize ),
+                           m_tiles_y( ( rows + TileSize - 1 ) / TileSize ),
+                           m_layout(layout),
+                           m_allocator(allocator){
+
+            boost::shared_ptr<std::vector<uint32_t> > slots( new std::vector<uint32_t>() );
+            boost::shared_ptr<std::vector<uint32_t> > order( new std::vector<uint32_t>() );
+            compute_tile_layout( m_tiles_x, m_tiles_y, m_layout, *slots, *order );
+            m_slots = slots;
+            m_order = order;
+            m_data = allocate_pixels<PixelType>( (size_t)m_tiles_x * m_tiles_y * TileSize * TileSize, allocator );
+        }
+
+        /**
+         * Constructor from a row-major resource
+         *
+         * @param[in] resource Pixels to copy.
+         * @param[in] layout   Tile order.
+        */
+        explicit TiledResource( MemoryResource<PixelType> const& resource,
+                                TileLayout const& layout = TileLayout::MORTON )
+                         : TiledResource( resource.rows(), resource.cols(), layout, resource.getAllocator() ){
+
+            const PixelType* source = resource.getPixelData().get();
+            for( size_t s=0; source != nullptr && s<m_order->size(); s++ ){
+                PixelTile<PixelType> output = tile( s );
+                Rect const window = output.window();
+                for( int r=0; r<window.height(); r++ ){
+                    copy_pixels( source + (size_t)( window.y() + r ) * m_cols + window.x(),
+                                 &output( 0, r ),
+                                 window.width() );
+                }
+            }
+        }
+
+        /**
+         * Get the pixel value
+        */
+        virtual PixelType operator[]( const int& idx )const{
+            return (*this)( idx % m_cols, idx / m_cols );
+        }
+
+        /**
+         * Get the pixel reference
+        */
+        virtual PixelType& operator[]( const int& idx ){
+            return (*this)( idx % m_cols, idx / m_cols );
+        }
+
+        /**
+         * Get the pixel value
+        */
+        virtual PixelType operator()( const int& x, const int& y )const{
+            if( m_data == nullptr ){
+                throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
+            }
+            return m_data[ offset( x, y ) ];
+        }
+
+        /**
+         * Get the pixel reference
+        */
+        virtual PixelType& operator()( const int& x, const int& y ){
+            if( m_data == nullptr ){
+                throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
+            }
+            return m_data[ offset( x, y ) ];
+        }
+
+        /**
+         * Return the number of rows
+        */
+        virtual int rows()const{
+            return m_rows;
+        }
+
+        /**
+         * Return the number of columns
+        */
+        virtual int cols()const{
+            return m_cols;
+        }
+
+        /**
+         * Return the number of channels
+        */
+        virtual int channels()const{
+            return PixelType().dims();
+        }
+
+        /**
+         * Return the tile edge in pixels
+        */
+        static int tileSize(){
+            return TileSize;
+        }
+
+        /**
+         * Return the tile order
+        */
+        TileLayout layout()const{
+            return m_layout;
+        }
+
+        /**
+         * Return the number of tiles
+        */
+        size_t tileCount()const{
+            return m_order->size();
+        }
+
+        /**
+         * Get a tile by its storage slot
+        */
+        PixelTile<PixelType> tile( const size_t& slot )const{
+            const int tx = (*m_order)[slot] % m_tiles_x;
+            const int ty = (*m_order)[slot] / m_tiles_x;
+            const Rect window( tx * TileSize,
+                               ty * TileSize,
+                               std::min( TileSize, m_cols - tx * TileSize ),
+                               std::min( TileSize, m_rows - ty * TileSize ));
+            return PixelTile<PixelType>( window, m_data.get() + slot * TileSize * TileSize, TileSize );
+        }
+
+        /**
+         * Iterate over the tiles in storage order
+        */
+        tile_iterator begin()const{ return tile_iterator( this, 0 ); }
+
+        /**
+         * End of the tiles
+        */
+        tile_iterator end()const{ return tile_iterator( this, m_order->size() ); }
+
+        /**
+         * Visit every pixel in storage order
+         *
+         * @param[in] func Callable as func( x, y, pixel ).
+        */
+        template <typename FunctionType>
+        void forEachPixel( FunctionType func )const{
+            for( size_t s=0; s<m_order->size(); s++ ){
+                PixelTile<PixelType> current = tile( s );
+                Rect const window = current.window();
+                for( int r=0; r<window.height(); r++ ){
+                    for( int c=0; c<window.width(); c++ ){
+                        func( window.x() + c, window.y() + r, current( c, r ));
+                    }
+                }
+            }
+        }
+
+        /**
+         * Copy the pixels into a row-major resource
+        */
+        MemoryResource<PixelType> toMemoryResource()const{
+            MemoryResource<PixelType> output( m_rows, m_cols, m_allocator );
+            PixelType* destination = output.getPixelData().get();
+            for( size_t s=0; s<m_order->size(); s++ ){
+                PixelTile<PixelType> current = tile( s );
+                Rect const window = current.window();
+                for( int r=0; r<window.height(); r++ ){
+                    copy_pixels( &current( 0, r ),
+                                 destination + (size_t)( window.y() + r ) * m_cols + window.x(),
+                                 window.width() );
+                }
+            }
+            return output;
+        }
+
+        /**
+         * Clone (Deep Copy)
+        */
+        TiledResource<PixelType,TileSize> clone()const{
+            TiledResource<PixelType,TileSize> output( *this );
+            if( m_data != nullptr ){
+                const size_t count = m_order->size() * TileSize * TileSize;
+                output.m_data = allocate_pixels<PixelType>( count, m_allocator );
+                copy_pixels( m_data.get(), output.m_data.get(), count );
+            }
+            return output;
+        }
+
+    private:
+
+        /// Log2 of the tile size
+        static const int TILE_SHIFT = tile_size_log2( TileSize );
+
+        /**
+         * Compute the buffer offset of a pixel
+        */
+        size_t offset( const int& x, const int& y )const{
+            const size_t slot = (*m_slots)[ ( y >> TILE_SHIFT ) * m_tiles_x + ( x >> TILE_SHIFT ) ];
+            return ( slot << ( 2 * TILE_SHIFT )) + ( ( y & ( TileSize - 1 )) << TILE_SHIFT ) + ( x & ( TileSize - 1 ));
+        }
+
+        /// Pixel data
+        boost::shared_ptr<PixelType[]> m_data;
+
+        /// Image size
+        int m_rows;
+        int m_cols;
+
+        /// Tile grid size
+        int m_tiles_x;
+        int m_tiles_y;
+
+        /// Tile order
+        TileLayout m_layout;
+
+        /// Storage slot of each tile, shared by copies
+        boost::shared_ptr<const std::vector<uint32_t> > m_slots;
+
+        /// Tile stored in each slot, shared by copies
+        boost::shared_ptr<const std::vector<uint32_t> > m_order;
+
+        /// Allocator for new buffers
+        MemoryAllocator::ptr_t m_allocator;
+
+}; /// End of TiledResource Class
+
+} /// End of GEO Namespace
+
+#endif
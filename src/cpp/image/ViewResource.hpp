@@ -0,0 +1,206 @@
+/**
+ * @file    ViewResource.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IMAGE_VIEWRESOURCE_HPP__
+#define __SRC_CPP_IMAGE_VIEWRESOURCE_HPP__
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/image/BaseResource.hpp>
+#include <GeoExplore/image/MemoryResource.hpp>
+#include <GeoExplore/image/Rect.hpp>
+
+/// Boost C++ Library
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+
+namespace GEO{
+
+/**
+ * @class ViewResource
+ *
+ * Non-owning window into the pixel buffer of a MemoryResource.  The
+ * view refers to the parent buffer through an offset and row stride,
+ * so creating one copies no pixels.  The parent detaches before handing
+ * out the view and copies of it take their own pixels while the view is
+ * alive, so writes through the view reach only the parent.  The view
+ * does not keep the buffer alive; use isValid() to check that the parent
+ * buffer still exists.
+*/
+template <typename PixelType>
+class ViewResource : public BaseResource<PixelType> {
+
+    public:
+
+        /**
+         * Default Constructor
+        */
+        ViewResource() : m_data(nullptr), m_rows(0), m_cols(0), m_stride(0){
+
+        }
+
+        /**
+         * Create a view into a memory resource
+         *
+         * @param[in] parent Resource which owns the pixels.
+         * @param[in] window Window in parent pixel coordinates.
+        */
+        ViewResource( MemoryResource<PixelType>& parent, Rect const& window ){
+
+            // make sure the window is valid
+            if( window.inside( parent.rows(), parent.cols() ) == false ){
+                throw GEO::GeneralException("View window lies outside of the parent image.", __FILE__, __LINE__);
+            }
+
+            m_pin = parent.pinForView();
+            boost::shared_ptr<PixelType[]> data = parent.getPixelData();
+            m_owner  = data;
+            m_stride = parent.cols();
+            m_rows   = window.height();
+            m_cols   = window.width();
+            m_data   = ( data == nullptr ) ? nullptr : ( data.get() + (size_t)window.y() * m_stride + window.x() );
+        }
+
+        /**
+         * Create a view into another view
+         *
+         * @param[in] parent View to take the window from.
+         * @param[in] window Window in parent view coordinates.
+        */
+        ViewResource( ViewResource<PixelType> const& parent, Rect const& window ){
+
+            // make sure the window is valid
+            if( window.inside( parent.rows(), parent.cols() ) == false ){
+                throw GEO::GeneralException("View window lies outside of the parent image.", __FILE__, __LINE__);
+            }
+
+            m_pin    = parent.m_pin;
+            m_owner  = parent.m_owner;
+            m_stride = parent.m_stride;
+            m_rows   = window.height();
+            m_cols   = window.width();
+            m_data   = ( parent.m_data == nullptr ) ? nullptr : ( parent.m_data + (size_t)window.y() * m_stride + window.x() );
+        }
+
+        /**
+         * Get the pixel value
+        */
+        virtual PixelType operator[]( const int& idx )const{
+            return (*this)( idx % m_cols, idx / m_cols );
+        }
+
+        /**
+         * Get the pixel reference
+        */
+        virtual PixelType& operator[]( const int& idx ){
+            return (*this)( idx % m_cols, idx / m_cols );
+        }
+
+        /**
+         * Get the pixel value
+        */
+        virtual PixelType operator()( const int& x, const int& y )const{
+
+            /// make sure the view points at memory
+            if( m_data == nullptr ){
+                throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
+            }
+            return m_data[(size_t)m_stride*y + x];
+        }
+
+        /**
+         * Get the pixel reference
+        */
+        virtual PixelType& operator()( const int& x, const int& y ){
+
+            /// make sure the view points at memory
+            if( m_data == nullptr ){
+                throw MemoryResourceNotInitializedException(__FILE__,__LINE__);
+            }
+            return m_data[(size_t)m_stride*y + x];
+        }
+
+        /**
+         * Return the number of rows
+        */
+        virtual int rows()const{
+            return m_rows;
+        }
+
+        /**
+         * Return the number of columns
+        */
+        virtual int cols()const{
+            return m_cols;
+        }
+
+        /**
+         * Return the number of channels
+        */
+        virtual int channels()const{
+            return PixelType().dims();
+        }
+
+        /**
+         * Return the number of pixels between the start of two rows
+        */
+        int stride()const{
+            return m_stride;
+        }
+
+        /**
+         * Return a pointer to the first pixel of a row
+        */
+        PixelType* row( const int& y )const{
+            return m_data + (size_t)m_stride*y;
+        }
+
+        /**
+         * Check if the parent buffer still exists
+        */
+        bool isValid()const{
+            return ( m_data != nullptr && m_owner.expired() == false );
+        }
+
+        /**
+         * Deep copy the view into a contiguous memory resource
+        */
+        MemoryResource<PixelType> clone()const{
+
+            MemoryResource<PixelType> output( m_rows, m_cols );
+            for( int y=0; y<m_rows; y++ ){
+                const PixelType* src = row(y);
+                for( int x=0; x<m_cols; x++ ){
+                    output[y*m_cols + x] = src[x];
+                }
+            }
+            return output;
+        }
+
+    private:
+
+        /// Parent buffer, used only for validity checks
+        boost::weak_ptr<PixelType[]> m_owner;
+
+        /// Keeps copies of the parent from sharing the buffer
+        boost::shared_ptr<int> m_pin;
+
+        /// First pixel of the view
+        PixelType* m_data;
+
+        /// number of rows
+        int m_rows;
+
+        /// number of columns
+        int m_cols;
+
+        /// number of pixels between rows in the parent buffer
+        int m_stride;
+
+}; /// End of ViewResource Class
+
+} /// End of GEO Namespace
+
+#endif
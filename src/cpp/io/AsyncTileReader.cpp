@@ -0,0 +1,68 @@
+/**
+ * @file    AsyncTileReader.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "AsyncTileReader.hpp"
+
+/// GeoExplore Libraries
+#include <GeoExplore/utilities/SpaceFillingCurves.hpp>
+
+namespace GEO{
+namespace IO{
+namespace GDAL{
+
+/**
+ * Compute the tile windows
+*/
+std::vector<Rect> compute_tile_windows( const int& rows,
+                                        const int& cols,
+                                        const int& tile_rows,
+                                        const int& tile_cols,
+                                        TileAccessPattern const& pattern ){
+
+    std::vector<Rect> windows;
+    if( rows <= 0 || cols <= 0 || tile_rows <= 0 || tile_cols <= 0 ){
+        return windows;
+    }
+
+    const int grid_rows = ( rows + tile_rows - 1 ) / tile_rows;
+    const int grid_cols = ( cols + tile_cols - 1 ) / tile_cols;
+    windows.reserve( (size_t)grid_rows * grid_cols );
+
+    // raster order
+    if( pattern == TileAccessPattern::RASTER_ORDER ){
+        for( int ty=0; ty<grid_rows; ty++ ){
+        for( int tx=0; tx<grid_cols; tx++ ){
+            windows.push_back( Rect( tx*tile_cols, ty*tile_rows,
+                                     std::min( tile_cols, cols - tx*tile_cols ),
+                                     std::min( tile_rows, rows - ty*tile_rows )));
+        }}
+    }
+
+    // hilbert order, skipping curve cells outside of the grid
+    else if( pattern == TileAccessPattern::HILBERT_ORDER ){
+        const int order = curve_order( grid_cols, grid_rows );
+        const uint64_t cells = 1ULL << ( 2*order );
+        uint32_t tx, ty;
+        for( uint64_t d=0; d<cells; d++ ){
+            hilbert_decode( order, d, tx, ty );
+            if( (int)tx >= grid_cols || (int)ty >= grid_rows ){
+                continue;
+            }
+            windows.push_back( Rect( tx*tile_cols, ty*tile_rows,
+                                     std::min( tile_cols, cols - (int)tx*tile_cols ),
+                                     std::min( tile_rows, rows - (int)ty*tile_rows )));
+        }
+    }
+
+    else{
+        throw GEO::GeneralException("Explicit access patterns require a window list.", __FILE__, __LINE__);
+    }
+
+    return windows;
+}
+
+} /// End of GDAL Namespace
+} /// End of IO Namespace
+} /// End of GEO Namespace
@@ -0,0 +1,428 @@
+/**
+ * @file    AsyncTileReader.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IO_ASYNCTILEREADER_HPP__
+#define __SRC_CPP_IO_ASYNCTILEREADER_HPP__
+
+/// C++ Standard Libraries
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/image/MemoryAllocator.hpp>
+#include <GeoExplore/image/MemoryResource.hpp>
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/io/GDAL_Driver.hpp>
+#include <GeoExplore/utilities/BoundedQueue.hpp>
+
+namespace GEO{
+namespace IO{
+namespace GDAL{
+
+/**
+ * @class TileAccessPattern
+ *
+ * Order in which the tiles of an image are read.
+*/
+enum class TileAccessPattern{
+    RASTER_ORDER,
+    HILBERT_ORDER,
+    EXPLICIT,
+}; /// End of TileAccessPattern Enumeration
+
+/**
+ * Split an image into tiles and order them by an access pattern
+ *
+ * @param[in] rows      Image rows.
+ * @param[in] cols      Image columns.
+ * @param[in] tile_rows Tile rows.  Edge tiles are clipped to the image.
+ * @param[in] tile_cols Tile columns.
+ * @param[in] pattern   RASTER_ORDER or HILBERT_ORDER.
+*/
+std::vector<Rect> compute_tile_windows( const int& rows,
+                                        const int& cols,
+                                        const int& tile_rows,
+                                        const int& tile_cols,
+                                        TileAccessPattern const& pattern );
+
+/**
+ * @class ImageTile
+ *
+ * Tile produced by the AsyncTileReader.
+*/
+template <typename PixelType>
+class ImageTile{
+
+    public:
+
+        /**
+         * Default Constructor
+        */
+        ImageTile() : m_index(-1){}
+
+        /**
+         * Get the position of the tile in the access order
+        */
+        int index()const{ return m_index; }
+
+        /**
+         * Set the position of the tile in the access order
+        */
+        int& index(){ return m_index; }
+
+        /**
+         * Get the tile window in image coordinates
+        */
+        Rect window()const{ return m_window; }
+
+        /**
+         * Set the tile window in image coordinates
+        */
+        Rect& window(){ return m_window; }
+
+        /**
+         * Get the tile pixels
+        */
+        MemoryResource<PixelType> resource()const{ return m_resource; }
+
+        /**
+         * Set the tile pixels
+        */
+        MemoryResource<PixelType>& resource(){ return m_resource; }
+
+    private:
+
+        /// Position in the access order
+        int m_index;
+
+        /// Window in image coordinates
+        Rect m_window;
+
+        /// Pixel data
+        MemoryResource<PixelType> m_resource;
+
+}; /// End of ImageTile Class
+
+
+/**
+ * @class AsyncTileReader
+ *
+ * Reads the tiles of an image on background I/O threads ahead of the
+ * consumer.  The access pattern is declared up front, so the I/O threads
+ * always know which tile is needed next.  Finished tiles are handed to the
+ * consumer through a lock-free bounded queue, whose capacity limits how many
+ * tiles are held in memory.
+ *
+ * Each I/O thread opens its own dataset since GDAL datasets cannot be
+ * shared between threads.  With more than one I/O thread, tiles may arrive
+ * slightly out of order; use ImageTile::index() to place them.
+*/
+template <typename PixelType>
+class AsyncTileReader{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<AsyncTileReader<PixelType> > ptr_t;
+
+        /**
+         * Constructor for a generated access pattern
+         *
+         * @param[in] pathname   Image to read.
+         * @param[in] tile_rows  Tile rows.
+         * @param[in] tile_cols  Tile columns.
+         * @param[in] pattern    RASTER_ORDER or HILBERT_ORDER.
+         * @param[in] prefetch   Number of tiles to keep ready.
+         * @param[in] io_threads Number of I/O threads.
+        */
+        AsyncTileReader( boost::filesystem::path const& pathname,
+                         const int& tile_rows,
+                         const int& tile_cols,
+                         TileAccessPattern const& pattern = TileAccessPattern::RASTER_ORDER,
+                         const int& prefetch = 8,
+                         const int& io_threads = 2 )
+                            : m_path(pathname),
+                              m_io_threads(std::max(io_threads,1)),
+                              m_queue(std::max(prefetch,1)),
+                              m_allocator(new TilePoolAllocator()),
+                              m_next(0),
+                              m_queued(0),
+                              m_returned(0),
+                              m_stop(false){
+
+            if( pattern == TileAccessPattern::EXPLICIT ){
+                throw GEO::GeneralException("Explicit access patterns require a window list.", __FILE__, __LINE__);
+            }
+            if( tile_rows <= 0 || tile_cols <= 0 ){
+                throw GEO::GeneralException("Tile size must be positive.", __FILE__, __LINE__);
+            }
+
+            // compute the tiles from the image size
+            ImageDriverGDAL driver( m_path );
+            driver.open();
+            if( driver.isOpen() == false ){
+                throw GEO::GeneralException( std::string("Unable to open ") + m_path.native(), __FILE__, __LINE__);
+            }
+            m_windows = compute_tile_windows( driver.rows(), driver.cols(), tile_rows, tile_cols, pattern );
+        }
+
+        /**
+         * Constructor for an explicit list of windows
+         *
+         * @param[in] pathname   Image to read.
+         * @param[in] windows    Windows to read, in order.
+         * @param[in] prefetch   Number of tiles to keep ready.
+         * @param[in] io_threads Number of I/O threads.
+        */
+        AsyncTileReader( boost::filesystem::path const& pathname,
+                         std::vector<Rect> const& windows,
+                         const int& prefetch = 8,
+                         const int& io_threads = 2 )
+                            : m_path(pathname),
+                              m_windows(windows),
+                              m_io_threads(std::max(io_threads,1)),
+                              m_queue(std::max(prefetch,1)),
+                              m_allocator(new TilePoolAllocator()),
+                              m_next(0),
+                              m_queued(0),
+                              m_returned(0),
+                              m_stop(false){
+
+        }
+
+        /**
+         * Destructor
+        */
+        ~AsyncTileReader(){
+            stop();
+        }
+
+        /**
+         * Start the I/O threads
+        */
+        void start(){
+
+            if( m_threads.empty() == false ){
+                return;
+            }
+            for( int i=0; i<m_io_threads; i++ ){
+                m_threads.push_back( std::thread( &AsyncTileReader<PixelType>::io_loop, this ));
+            }
+        }
+
+        /**
+         * Stop the I/O threads.  Unread tiles are discarded.
+        */
+        void stop(){
+
+            m_stop = true;
+            {
+                std::lock_guard<std::mutex> lock( m_mutex );
+            }
+            m_not_full.notify_all();
+            m_not_empty.notify_all();
+            for( size_t i=0; i<m_threads.size(); i++ ){
+                m_threads[i].join();
+            }
+            m_threads.clear();
+        }
+
+        /**
+         * Get the next tile, waiting for it if required
+         *
+         * @param[out] tile Next tile.
+         *
+         * @return False once every tile has been returned.
+        */
+        bool next( ImageTile<PixelType>& tile ){
+
+            // start reading on the first call
+            if( m_threads.empty() && m_stop == false ){
+                start();
+            }
+
+            for(;;){
+
+                // the fast path never takes a lock
+                if( m_queue.try_pop( tile ) ){
+                    m_returned++;
+                    wake( m_not_full );
+                    return true;
+                }
+
+                // report errors from the I/O threads
+                std::unique_lock<std::mutex> lock( m_mutex );
+                if( m_error != nullptr ){
+                    std::rethrow_exception( m_error );
+                }
+
+                // stop once all tiles were returned or the reader was stopped
+                if( m_returned >= m_windows.size() || m_stop ){
+                    return false;
+                }
+
+                // wait for the I/O threads to queue a tile
+                m_not_empty.wait( lock, [this](){
+                    return m_queued > m_returned || m_error != nullptr || m_stop;
+                });
+            }
+        }
+
+        /**
+         * Set the allocator for tile buffers.  Must be called before start().
+         *
+         * Tiles come from a TilePoolAllocator by default, so once the first
+         * tiles are released, new tiles reuse their buffers.
+        */
+        void setAllocator( MemoryAllocator::ptr_t allocator ){
+            m_allocator = allocator;
+        }
+
+        /**
+         * Return the number of tiles
+        */
+        size_t size()const{
+            return m_windows.size();
+        }
+
+        /**
+         * Return the tile windows in access order
+        */
+        std::vector<Rect> const& windows()const{
+            return m_windows;
+        }
+
+    private:
+
+        /**
+         * I/O thread loop
+        */
+        void io_loop(){
+
+            try{
+                ImageDriverGDAL driver( m_path );
+                driver.open();
+                if( driver.isOpen() == false ){
+                    throw GEO::GeneralException( std::string("Unable to open ") + m_path.native(), __FILE__, __LINE__);
+                }
+
+                for(;;){
+
+                    // claim the next tile
+                    size_t idx = m_next.fetch_add(1);
+                    if( idx >= m_windows.size() || m_stop ){
+                        break;
+                    }
+
+                    // read it
+                    ImageTile<PixelType> tile;
+                    tile.index()  = (int)idx;
+                    tile.window() = m_windows[idx];
+                    boost::shared_ptr<PixelType[]> pixels = allocate_pixels<PixelType>( tile.window().area(), m_allocator );
+                    driver.getPixels( pixels, tile.window(), tile.window().height(), tile.window().width() );
+                    tile.resource().setPixelData( pixels, tile.window().height(), tile.window().width() );
+                    tile.resource().setAllocator( m_allocator );
+
+                    // hand it to the consumer, waiting while the queue is full
+                    while( m_queue.try_push( std::move(tile) ) == false ){
+                        std::unique_lock<std::mutex> lock( m_mutex );
+                        m_not_full.wait( lock, [this](){
+                            // a tile may be returned before its producer counts it
+                            const size_t queued   = m_queued;
+                            const size_t returned = m_returned;
+                            return queued < returned || queued - returned < m_queue.capacity() || m_stop;
+                        });
+                        if( m_stop ){
+                            return;
+                        }
+                    }
+                    m_queued++;
+                    wake( m_not_empty );
+                }
+            }
+            catch( ... ){
+                std::lock_guard<std::mutex> lock( m_mutex );
+                if( m_error == nullptr ){
+                    m_error = std::current_exception();
+                }
+                m_not_empty.notify_all();
+            }
+        }
+
+        /**
+         * Notify a condition after a count it waits on has changed
+         *
+         * Taking the mutex first means a waiter is either still checking its
+         * predicate, and sees the change, or already asleep and is woken.
+        */
+        void wake( std::condition_variable& condition ){
+            {
+                std::lock_guard<std::mutex> lock( m_mutex );
+            }
+            condition.notify_one();
+        }
+
+        /// Do not allow copies
+        AsyncTileReader( AsyncTileReader const& );
+        AsyncTileReader& operator = ( AsyncTileReader const& );
+
+        /// Image pathname
+        boost::filesystem::path m_path;
+
+        /// Tile windows in access order
+        std::vector<Rect> m_windows;
+
+        /// Number of I/O threads
+        int m_io_threads;
+
+        /// I/O threads
+        std::vector<std::thread> m_threads;
+
+        /// Finished tiles
+        BoundedQueue<ImageTile<PixelType> > m_queue;
+
+        /// Allocator for tile buffers
+        MemoryAllocator::ptr_t m_allocator;
+
+        /// Next tile to read
+        std::atomic<size_t> m_next;
+
+        /// Number of tiles pushed to the queue
+        std::atomic<size_t> m_queued;
+
+        /// Number of tiles returned to the consumer
+        std::atomic<size_t> m_returned;
+
+        /// Stop flag
+        std::atomic<bool> m_stop;
+
+        /// Mutex used only for waiting and error reporting
+        std::mutex m_mutex;
+
+        /// Signalled when a tile is queued
+        std::condition_variable m_not_empty;
+
+        /// Signalled when a tile is removed
+        std::condition_variable m_not_full;
+
+        /// First error raised by an I/O thread
+        std::exception_ptr m_error;
+
+}; /// End of AsyncTileReader Class
+
+} /// End of GDAL Namespace
+} /// End of IO Namespace
+} /// End of GEO Namespace
+
+#endif
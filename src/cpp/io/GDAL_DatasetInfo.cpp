@@ -0,0 +1,165 @@
+/**
+ * @file    GDAL_DatasetInfo.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "GDAL_DatasetInfo.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <map>
+
+/// GDAL Libraries
+#include <cpl_conv.h>
+#include <cpl_string.h>
+#include <gdal.h>
+#include <gdal_priv.h>
+
+/// GeoExplore Libraries
+#include <GeoExplore/io/GDAL_DatasetPool.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+namespace IO{
+namespace GDAL{
+
+/**
+ * Band Info Constructor
+*/
+BandInfo::BandInfo() : block_cols(0),
+                       block_rows(0),
+                       overview_count(0),
+                       has_nodata(false),
+                       nodata_value(0){
+
+}
+
+/**
+ * Dataset Info Constructor
+*/
+DatasetInfo::DatasetInfo() : rows(0),
+                             cols(0),
+                             has_geotransform(false){
+
+    std::fill( geotransform, geotransform + 6, 0 );
+}
+
+/**
+ * Parse a GDAL metadata list
+*/
+static std::vector<DatasetInfo::item_t> parse_metadata( char** items ){
+
+    std::vector<DatasetInfo::item_t> output;
+    for( int i=0; items != nullptr && items[i] != nullptr; i++ ){
+        char* key = nullptr;
+        const char* value = CPLParseNameValue( items[i], &key );
+        if( key != nullptr ){
+            output.push_back( DatasetInfo::item_t( key, ( value != nullptr ) ? value : "" ));
+            CPLFree( key );
+        }
+    }
+    return output;
+}
+
+/**
+ * Read the header information of a raster file
+*/
+DatasetInfo read_dataset_info( boost::filesystem::path const& pathname,
+                               std::vector<std::string> const* sibling_files ){
+
+    DatasetInfo output;
+    output.path = pathname;
+
+    // opening only parses the header.  The dataset goes back to the pool, so
+    // reading the pixels next does not open the file again.
+    DatasetPool::handle_t handle = DatasetPool::instance().acquire( pathname, sibling_files );
+    GDALDataset* dataset = handle.get();
+    if( dataset == nullptr ){
+        output.error = "unable to open as a raster";
+        return output;
+    }
+
+    output.rows = dataset->GetRasterYSize();
+    output.cols = dataset->GetRasterXSize();
+    if( dataset->GetDriver() != nullptr ){
+        output.driver = dataset->GetDriver()->GetDescription();
+    }
+
+    // bands
+    for( int b=0; b<dataset->GetRasterCount(); b++ ){
+        GDALRasterBand* band = dataset->GetRasterBand( b+1 );
+        BandInfo info;
+        info.data_type = GDALGetDataTypeName( band->GetRasterDataType() );
+        info.color_interpretation = GDALGetColorInterpretationName( band->GetColorInterpretation() );
+        band->GetBlockSize( &info.block_cols, &info.block_rows );
+        info.overview_count = band->GetOverviewCount();
+        int has_nodata = FALSE;
+        info.nodata_value = band->GetNoDataValue( &has_nodata );
+        info.has_nodata = ( has_nodata != FALSE );
+        output.bands.push_back( info );
+    }
+
+    // georeferencing
+    output.has_geotransform = ( dataset->GetGeoTransform( output.geotransform ) == CE_None );
+    if( dataset->GetProjectionRef() != nullptr ){
+        output.projection = dataset->GetProjectionRef();
+    }
+
+    // metadata
+    output.metadata = parse_metadata( dataset->GetMetadata() );
+    output.tres     = parse_metadata( dataset->GetMetadata( "TRE" ));
+
+    return output;
+}
+
+/**
+ * Read the header information of many raster files
+*/
+std::vector<DatasetInfo> read_dataset_info( std::vector<boost::filesystem::path> const& pathnames,
+                                            const int& num_threads,
+                                            std::vector<std::vector<std::string> >* sibling_files ){
+
+    // list each directory once
+    std::map<boost::filesystem::path, std::vector<std::string> > listings;
+    for( size_t i=0; i<pathnames.size(); i++ ){
+        boost::filesystem::path directory = pathnames[i].parent_path();
+        if( listings.find( directory ) != listings.end() ){
+            continue;
+        }
+        std::vector<std::string>& names = listings[directory];
+        boost::system::error_code ec;
+        boost::filesystem::directory_iterator it( directory.empty() ? "." : directory, ec ), end;
+        for( ; !ec && it != end; it.increment( ec )){
+            names.push_back( it->path().filename().string() );
+        }
+        std::sort( names.begin(), names.end() );
+    }
+
+    // register the drivers before the threads start
+    register_drivers();
+
+    std::vector<std::vector<std::string> > local_siblings;
+    std::vector<std::vector<std::string> >& all_siblings = ( sibling_files != nullptr ) ? *sibling_files : local_siblings;
+    all_siblings.assign( pathnames.size(), std::vector<std::string>() );
+
+    std::vector<DatasetInfo> output( pathnames.size() );
+    parallel_for( 0, pathnames.size(), [&]( const size_t& idx, const int& /*thread_id*/ ){
+
+        // side-car files share the stem of the file
+        std::vector<std::string> const& names = listings.find( pathnames[idx].parent_path() )->second;
+        const std::string stem = pathnames[idx].stem().string();
+        std::vector<std::string>& siblings = all_siblings[idx];
+        std::vector<std::string>::const_iterator it = std::lower_bound( names.begin(), names.end(), stem );
+        for( ; it != names.end() && it->compare( 0, stem.size(), stem ) == 0; it++ ){
+            siblings.push_back( *it );
+        }
+
+        output[idx] = read_dataset_info( pathnames[idx], &siblings );
+    }, num_threads );
+
+    return output;
+}
+
+} /// End of GDAL Namespace
+} /// End of IO Namespace
+} /// End of GEO Namespace
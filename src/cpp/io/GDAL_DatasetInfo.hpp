@@ -0,0 +1,156 @@
+/**
+ * @file    GDAL_DatasetInfo.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IO_GDALDATASETINFO_HPP__
+#define __SRC_CPP_IO_GDALDATASETINFO_HPP__
+
+/// C++ Standard Libraries
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+
+namespace GEO{
+namespace IO{
+namespace GDAL{
+
+/**
+ * @class BandInfo
+ *
+ * Header information of one raster band.
+*/
+class BandInfo{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        BandInfo();
+
+        /// GDAL data type name
+        std::string data_type;
+
+        /// Color interpretation name
+        std::string color_interpretation;
+
+        /// Natural block width
+        int block_cols;
+
+        /// Natural block height
+        int block_rows;
+
+        /// Number of overviews
+        int overview_count;
+
+        /// Band has a no-data value
+        bool has_nodata;
+
+        /// No-data value
+        double nodata_value;
+
+}; /// End of BandInfo Class
+
+
+/**
+ * @class DatasetInfo
+ *
+ * Header information of a raster file.  Nothing here requires reading
+ * pixels.
+*/
+class DatasetInfo{
+
+    public:
+
+        /// Metadata key and value
+        typedef std::pair<std::string,std::string> item_t;
+
+        /**
+         * Constructor
+        */
+        DatasetInfo();
+
+        /**
+         * Check if the file could be read
+        */
+        bool isValid()const{
+            return error.empty();
+        }
+
+        /// Pathname
+        boost::filesystem::path path;
+
+        /// Reason the file could not be read
+        std::string error;
+
+        /// GDAL driver short name
+        std::string driver;
+
+        /// Number of rows
+        int rows;
+
+        /// Number of columns
+        int cols;
+
+        /// Band information
+        std::vector<BandInfo> bands;
+
+        /// Geotransform is present
+        bool has_geotransform;
+
+        /// Affine geotransform in GDAL order
+        double geotransform[6];
+
+        /// Spatial reference WKT
+        std::string projection;
+
+        /// Default domain metadata, including NITF header fields
+        std::vector<item_t> metadata;
+
+        /// NITF tagged record extensions
+        std::vector<item_t> tres;
+
+}; /// End of DatasetInfo Class
+
+
+/**
+ * Read the header information of a raster file
+ *
+ * The dataset is borrowed from DatasetPool::instance() and returned open,
+ * so a following pixel read of the file reuses it.
+ *
+ * @param[in] pathname      File to read.
+ * @param[in] sibling_files Names of the files next to it which share its stem.  When
+ *                          given, GDAL looks for side-car files in this list instead
+ *                          of listing the directory.
+*/
+DatasetInfo read_dataset_info( boost::filesystem::path const& pathname,
+                               std::vector<std::string> const* sibling_files = nullptr );
+
+/**
+ * Read the header information of many raster files in parallel
+ *
+ * Each directory is listed once and every file is handed the side-car
+ * candidates from that listing, so opening a file never scans a large
+ * directory again.  Failed files are reported through DatasetInfo::error.
+ *
+ * @param[in]  pathnames     Files to read.
+ * @param[in]  num_threads   Number of threads.  Values <= 0 use the default.
+ * @param[out] sibling_files If not null, receives the side-car candidates of each
+ *                           file, to hand to later opens of the same files.
+ *
+ * @return Information in the order of pathnames.
+*/
+std::vector<DatasetInfo> read_dataset_info( std::vector<boost::filesystem::path> const& pathnames,
+                                            const int& num_threads = 0,
+                                            std::vector<std::vector<std::string> >* sibling_files = nullptr );
+
+} /// End of GDAL Namespace
+} /// End of IO Namespace
+} /// End of GEO Namespace
+
+#endif
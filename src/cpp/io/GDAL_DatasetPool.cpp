@@ -0,0 +1,219 @@
+/**
+ * @file    GDAL_DatasetPool.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "GDAL_DatasetPool.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <chrono>
+
+/// GDAL Libraries
+#include <gdal.h>
+#include <gdal_priv.h>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+
+namespace GEO{
+namespace IO{
+namespace GDAL{
+
+/**
+ * Register the GDAL drivers
+*/
+void register_drivers(){
+    static std::once_flag registered;
+    std::call_once( registered, [](){ GDALAllRegister(); });
+}
+
+/**
+ * Get the process-wide pool
+*/
+DatasetPool& DatasetPool::instance(){
+
+    // never destroyed, so datasets lent during static destruction stay valid
+    static DatasetPool* pool = new DatasetPool();
+    return *pool;
+}
+
+/**
+ * Constructor
+*/
+DatasetPool::DatasetPool( const size_t& max_open ) : m_open(0),
+                                                     m_max_open(std::max<size_t>( max_open, 1 )),
+                                                     m_waiting(0),
+                                                     m_wait_timeout(DATASET_POOL_WAIT_TIMEOUT){
+}
+
+/**
+ * Destructor
+*/
+DatasetPool::~DatasetPool(){
+    clear();
+}
+
+/**
+ * Borrow a dataset
+*/
+DatasetPool::handle_t DatasetPool::acquire( boost::filesystem::path const& pathname,
+                                            std::vector<std::string> const* sibling_files ){
+
+    const std::string key = boost::filesystem::absolute( pathname ).native();
+    const std::thread::id holder = std::this_thread::get_id();
+    GDALDataset* dataset = nullptr;
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>( std::chrono::duration<double>( m_wait_timeout ));
+        for(;;){
+
+            // reuse an idle dataset of the same file
+            for( std::list<std::pair<std::string,GDALDataset*> >::iterator it = m_idle.begin(); it != m_idle.end(); it++ ){
+                if( it->first == key ){
+                    dataset = it->second;
+                    m_idle.erase( it );
+                    break;
+                }
+            }
+            if( dataset != nullptr ){
+                break;
+            }
+
+            // make room for a new one.  A thread already holding a dataset
+            // may be the one everybody waits on, so it goes over the cap.
+            trim( m_max_open - 1 );
+            if( m_open < m_max_open || m_holders.count( holder ) > 0 ){
+                m_open++;
+                break;
+            }
+
+            // everything is lent out
+            m_waiting++;
+            const std::cv_status status = m_released.wait_until( lock, deadline );
+            m_waiting--;
+            if( status == std::cv_status::timeout && m_open >= m_max_open && m_idle.empty() ){
+                throw GEO::GeneralException("Timed out waiting for a dataset of " + key + ", every dataset is lent out.", __FILE__, __LINE__);
+            }
+        }
+        m_holders[holder]++;
+    }
+
+    // open outside of the lock, the slot is already reserved
+    if( dataset == nullptr ){
+        std::vector<const char*> siblings;
+        if( sibling_files != nullptr ){
+            for( size_t i=0; i<sibling_files->size(); i++ ){
+                siblings.push_back( (*sibling_files)[i].c_str() );
+            }
+            siblings.push_back( nullptr );
+        }
+        register_drivers();
+        dataset = (GDALDataset*) GDALOpenEx( key.c_str(), GDAL_OF_RASTER | GDAL_OF_READONLY,
+                                             nullptr, nullptr,
+                                             siblings.empty() ? nullptr : &siblings[0] );
+        if( dataset == nullptr ){
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_open--;
+            if( --m_holders[holder] == 0 ){
+                m_holders.erase( holder );
+            }
+            m_released.notify_one();
+            return handle_t();
+        }
+    }
+
+    return handle_t( dataset, [this,key,holder]( GDALDataset* lent ){ release( key, lent, holder ); });
+}
+
+/**
+ * Set the maximum number of open datasets
+*/
+void DatasetPool::setMaxOpen( const size_t& max_open ){
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_max_open = std::max<size_t>( max_open, 1 );
+    trim( m_max_open );
+}
+
+/**
+ * Get the maximum number of open datasets
+*/
+size_t DatasetPool::getMaxOpen()const{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_max_open;
+}
+
+/**
+ * Set the wait timeout
+*/
+void DatasetPool::setWaitTimeout( const double& seconds ){
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_wait_timeout = std::max( seconds, 0.0 );
+}
+
+/**
+ * Get the number of waiting threads
+*/
+size_t DatasetPool::waitingCount()const{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_waiting;
+}
+
+/**
+ * Get the number of open datasets
+*/
+size_t DatasetPool::openCount()const{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_open;
+}
+
+/**
+ * Get the number of idle datasets
+*/
+size_t DatasetPool::idleCount()const{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_idle.size();
+}
+
+/**
+ * Close every idle dataset
+*/
+void DatasetPool::clear(){
+    std::lock_guard<std::mutex> lock( m_mutex );
+    trim( 0 );
+}
+
+/**
+ * Take back a lent dataset
+*/
+void DatasetPool::release( std::string const& key, GDALDataset* dataset, std::thread::id const& holder ){
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if( --m_holders[holder] == 0 ){
+        m_holders.erase( holder );
+    }
+
+    // keep it for the next reader unless the cap was lowered
+    if( m_open > m_max_open ){
+        GDALClose( (GDALDatasetH)dataset );
+        m_open--;
+    } else {
+        m_idle.push_front( std::make_pair( key, dataset ));
+    }
+    m_released.notify_one();
+}
+
+/**
+ * Close the least recently used idle datasets
+*/
+void DatasetPool::trim( const size_t& max_open ){
+    while( m_open > max_open && m_idle.empty() == false ){
+        GDALClose( (GDALDatasetH)m_idle.back().second );
+        m_idle.pop_back();
+        m_open--;
+    }
+}
+
+} /// End of GDAL Namespace
+} /// End of IO Namespace
+} /// End of GEO Namespace
@@ -0,0 +1,193 @@
+/**
+ * @file    GDAL_DatasetPool.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_IO_GDALDATASETPOOL_HPP__
+#define __SRC_CPP_IO_GDALDATASETPOOL_HPP__
+
+/// C++ Standard Libraries
+#include <condition_variable>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+/// GDAL Libraries
+class GDALDataset;
+
+namespace GEO{
+namespace IO{
+namespace GDAL{
+
+/// Default cap on the datasets held open by a pool
+const size_t DATASET_POOL_MAX_OPEN = 256;
+
+/// Default time in seconds a borrower waits for a dataset before failing
+const double DATASET_POOL_WAIT_TIMEOUT = 60;
+
+
+/**
+ * Register the GDAL drivers
+ *
+ * Drivers are registered on the first call only.  Safe to call from any
+ * thread.
+*/
+void register_drivers();
+
+
+/**
+ * @class DatasetPool
+ *
+ * Pool of read-only GDAL datasets.
+ *
+ * A GDAL dataset must not be used by two threads at once, so the pool lends
+ * every caller a dataset of its own.  Returned datasets stay open and are
+ * handed to the next caller asking for the same file, which skips the open
+ * and keeps the file's block cache warm.
+ *
+ * The number of open datasets is capped.  When the cap is reached, idle
+ * datasets of other files are closed, and callers wait while every dataset
+ * is lent out.  A thread which already holds a dataset is never made to
+ * wait, so nested reads open over the cap instead of waiting on
+ * themselves.  Other threads give up with an error after the wait timeout
+ * rather than waiting forever.
+*/
+class DatasetPool{
+
+    public:
+
+        /// Lent dataset.  It returns to the pool when the last copy is released.
+        typedef boost::shared_ptr<GDALDataset> handle_t;
+
+        /**
+         * Get the process-wide pool
+        */
+        static DatasetPool& instance();
+
+        /**
+         * Constructor
+         *
+         * @param[in] max_open Maximum number of open datasets.
+        */
+        explicit DatasetPool( const size_t& max_open = DATASET_POOL_MAX_OPEN );
+
+        /**
+         * Destructor
+         *
+         * Closes the idle datasets.  Every lent dataset must be returned first.
+        */
+        ~DatasetPool();
+
+        /**
+         * Borrow a dataset
+         *
+         * @param[in] pathname      Image to open.
+         * @param[in] sibling_files Names of the files next to it which share its stem.  When
+         *                          given and the file is not already open, GDAL looks for
+         *                          side-car files in this list instead of listing the directory.
+         *
+         * @return Dataset, or a null handle if GDAL cannot open the file as a raster.
+         *
+         * @throws GeneralException if no dataset was returned within the wait timeout.
+        */
+        handle_t acquire( boost::filesystem::path const& pathname,
+                          std::vector<std::string> const* sibling_files = nullptr );
+
+        /**
+         * Set the maximum number of open datasets
+         *
+         * Idle datasets over the new cap are closed right away, lent ones
+         * when they are returned.
+        */
+        void setMaxOpen( const size_t& max_open );
+
+        /**
+         * Get the maximum number of open datasets
+        */
+        size_t getMaxOpen()const;
+
+        /**
+         * Set how long a borrower waits for a dataset before acquire() throws
+         *
+         * @param[in] seconds Timeout in seconds.
+        */
+        void setWaitTimeout( const double& seconds );
+
+        /**
+         * Get the number of threads waiting for a dataset
+        */
+        size_t waitingCount()const;
+
+        /**
+         * Get the number of open datasets, lent or idle
+        */
+        size_t openCount()const;
+
+        /**
+         * Get the number of idle datasets
+        */
+        size_t idleCount()const;
+
+        /**
+         * Close every idle dataset
+        */
+        void clear();
+
+    private:
+
+        /// Not copyable
+        DatasetPool( DatasetPool const& ) = delete;
+        DatasetPool& operator = ( DatasetPool const& ) = delete;
+
+        /**
+         * Take back a lent dataset
+        */
+        void release( std::string const& key, GDALDataset* dataset, std::thread::id const& holder );
+
+        /**
+         * Close idle datasets until the pool is under the cap
+         *
+         * Must be called with the mutex held.
+        */
+        void trim( const size_t& max_open );
+
+        /// Guards every member below
+        mutable std::mutex m_mutex;
+
+        /// Signaled when a dataset is returned or a slot frees up
+        std::condition_variable m_released;
+
+        /// Idle datasets by absolute path, most recently returned first
+        std::list<std::pair<std::string,GDALDataset*> > m_idle;
+
+        /// Number of open datasets
+        size_t m_open;
+
+        /// Cap on open datasets
+        size_t m_max_open;
+
+        /// Number of datasets lent to each thread
+        std::map<std::thread::id,size_t> m_holders;
+
+        /// Number of threads waiting for a dataset
+        size_t m_waiting;
+
+        /// Wait timeout in seconds
+        double m_wait_timeout;
+
+}; /// End of DatasetPool Class
+
+} /// End of GDAL Namespace
+} /// End of IO Namespace
+} /// End of GEO Namespace
+
+#endif
@@ -6,10 +6,12 @@
 #include "GDAL_Driver.hpp"
 
 /// GeoExplore Libraries
+#include <GeoExplore/io/OGR_Driver.hpp>
 #include <GeoExplore/utilities/StringUtilities.hpp>
 
 /// C++ Libraries
 #include <iostream>
+#include <sstream>
 
 namespace GEO {
 namespace IO{
@@ -122,11 +124,9 @@ void ImageDriverGDAL::open(){
         throw std::runtime_error( std::string(m_path.native() + " does not exist.").c_str());
     }
 
-    /// Register the driver
-    GDALAllRegister();
-
-	// load the dataset 
-    m_dataset = (GDALDataset*) GDALOpen( m_path.c_str(), GA_ReadOnly);
+    // borrow a dataset from the pool
+    m_handle = DatasetPool::instance().acquire( m_path, m_sibling_files.empty() ? nullptr : &m_sibling_files );
+    m_dataset = m_handle.get();
 	
     // if dataset is null, then there was a problem
 	if( m_dataset == NULL ){
@@ -150,14 +150,204 @@ void ImageDriverGDAL::open(){
 */
 void ImageDriverGDAL::close(){
 
-    if( isOpen() == false ){
-        GDALClose((GDALDatasetH)m_dataset);
+    if( isOpen() == true ){
+        m_handle.reset();
         m_dataset = NULL;
         m_driver = NULL;
     }
 }
 
 
+/**
+ * Get the sample range of a band
+*/
+SampleRange ImageDriverGDAL::getSampleRange( const int& band_index ){
+
+    // get raster datatype
+    GDALDataType gdalDataType = m_dataset->GetRasterBand(band_index+1)->GetRasterDataType();
+    if( gdalDataType == GDT_Byte ){
+        return SampleRange::UINT8;
+    }
+    // signed samples, like DEM postings and their negative nodata, are values
+    if( gdalDataType != GDT_UInt16 ){
+        return SampleRange::NATIVE;
+    }
+
+    // NITF stores the actual bits per pixel in the metadata
+    if( m_driver != nullptr && m_driver->GetDescription() != NULL && 
+        std::string(m_driver->GetDescription()) == "NITF" &&
+        m_dataset->GetMetadataItem("NITF_ABPP") != NULL ){
+        std::string abpp = m_dataset->GetMetadataItem("NITF_ABPP");
+        if( abpp == "12" ){
+            return SampleRange::UINT12;
+        }
+        if( abpp == "14" ){
+            return SampleRange::UINT14;
+        }
+    }
+    return SampleRange::UINT16;
+}
+
+/**
+ * Get the no-data value of a band
+*/
+bool ImageDriverGDAL::getNoDataValue( const int& band_index, double& value ){
+    if( isOpen() == false ){
+        return false;
+    }
+    int success = FALSE;
+    value = m_dataset->GetRasterBand(band_index+1)->GetNoDataValue( &success );
+    return ( success != FALSE );
+}
+
+/**
+ * Get the number of overviews
+*/
+int ImageDriverGDAL::getOverviewCount(){
+    if( isOpen() == false ){
+        return 0;
+    }
+    return m_dataset->GetRasterBand(1)->GetOverviewCount();
+}
+
+/**
+ * Get the block size of the first band
+*/
+void ImageDriverGDAL::getBlockSize( int& block_rows, int& block_cols ){
+    block_rows = 0;
+    block_cols = 0;
+    if( isOpen() == false ){
+        return;
+    }
+    m_dataset->GetRasterBand(1)->GetBlockSize( &block_cols, &block_rows );
+}
+
+/**
+ * Get the number of raster bands
+*/
+int ImageDriverGDAL::getBandCount(){
+    if( isOpen() == false ){
+        return 0;
+    }
+    return m_dataset->GetRasterCount();
+}
+
+/**
+ * Read the dataset metadata
+*/
+MetadataContainer::ptr_t ImageDriverGDAL::getMetadata(){
+
+    MetadataContainer::ptr_t output( new MetadataContainer() );
+    if( isOpen() == false ){
+        return output;
+    }
+
+    // copy the name=value lists of each domain
+    const char* domains[] = { "", "TRE", "RPC", "IMAGE_STRUCTURE" };
+    for( size_t d=0; d<sizeof(domains)/sizeof(domains[0]); d++ ){
+        char** items = m_dataset->GetMetadata( domains[d] );
+        for( int i=0; items != nullptr && items[i] != nullptr; i++ ){
+            char* name = nullptr;
+            const char* value = CPLParseNameValue( items[i], &name );
+            if( name != nullptr && value != nullptr ){
+                output->setValue( MetadataKey( domains[d], name ), value );
+            }
+            CPLFree( name );
+        }
+    }
+
+    // geotransform
+    double transform[6];
+    if( m_dataset->GetGeoTransform( transform ) == CE_None ){
+        std::ostringstream sout;
+        sout.precision(17);
+        for( int i=0; i<6; i++ ){
+            sout << ( i > 0 ? " " : "" ) << transform[i];
+        }
+        output->setValue( MetadataKey( METADATA_GEOTRANSFORM ), sout.str() );
+    }
+
+    // spatial reference
+    const char* projection = m_dataset->GetProjectionRef();
+    if( projection != nullptr && projection[0] != '\0' ){
+        output->setValue( MetadataKey( METADATA_SRS ), projection );
+    }
+
+    // no-data values
+    bool has_nodata = false;
+    std::ostringstream nodata;
+    nodata.precision(17);
+    for( int b=0; b<m_dataset->GetRasterCount(); b++ ){
+        int success = FALSE;
+        const double value = m_dataset->GetRasterBand(b+1)->GetNoDataValue( &success );
+        nodata << ( b > 0 ? " " : "" );
+        if( success != FALSE ){
+            nodata << value;
+            has_nodata = true;
+        } else {
+            nodata << "nan";
+        }
+    }
+    if( has_nodata ){
+        output->setValue( MetadataKey( METADATA_NODATA ), nodata.str() );
+    }
+
+    return output;
+}
+
+/**
+ * Split a window into ranges of whole blocks
+*/
+std::vector<Rect> split_block_ranges( Rect const& window,
+                                      const int& block_rows,
+                                      const int& block_cols,
+                                      const int& count ){
+
+    std::vector<Rect> output;
+    if( window.empty() ){
+        return output;
+    }
+    const int brows = std::max( block_rows, 1 );
+    const int bcols = std::max( block_cols, 1 );
+
+    // blocks touched by the window
+    const int row_first = window.y() / brows;
+    const int col_first = window.x() / bcols;
+    const int block_row_count = ( window.y() + window.height() - 1 ) / brows - row_first + 1;
+    const int block_col_count = ( window.x() + window.width()  - 1 ) / bcols - col_first + 1;
+
+    // group block rows, splitting columns only when rows run short
+    const int target = std::max( count, 1 );
+    const int row_groups = std::min( block_row_count, target );
+    const int col_groups = std::min( block_col_count, std::max( 1, target / row_groups ));
+
+    for( int gy=0; gy<row_groups; gy++ ){
+        const int y0 = std::max( window.y(), ( row_first + gy * block_row_count / row_groups ) * brows );
+        const int y1 = std::min( window.y() + window.height(), ( row_first + ( gy + 1 ) * block_row_count / row_groups ) * brows );
+        for( int gx=0; gx<col_groups; gx++ ){
+            const int x0 = std::max( window.x(), ( col_first + gx * block_col_count / col_groups ) * bcols );
+            const int x1 = std::min( window.x() + window.width(), ( col_first + ( gx + 1 ) * block_col_count / col_groups ) * bcols );
+            output.push_back( Rect( x0, y0, x1 - x0, y1 - y0 ));
+        }
+    }
+    return output;
+}
+
+/**
+ * Build the geotransform of an image
+*/
+GeoTransform make_geotransform( MetadataContainer const& metadata ){
+
+    double transform[6];
+    CoordinateFrame frame;
+    if( metadata.getGeoTransform( transform ) == false ||
+        OGR::parse_coordinate_frame( metadata.getValue( MetadataKey( METADATA_SRS )), frame ) == false ){
+        return GeoTransform();
+    }
+    return GeoTransform( transform, frame );
+}
+
+
 std::string getShortDriverFromFilename( const boost::filesystem::path& filename ){
 
     // pull the extension
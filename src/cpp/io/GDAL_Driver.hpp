@@ -7,7 +7,9 @@
 #define __SRC_CPP_IO_GDALDRIVER_HPP__
 
 /// C++ Standard Libraries
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <type_traits>
 #include <vector>
 
@@ -24,9 +26,18 @@
 /// GeoExplore Libraries
 #include <GeoExplore/core/Exceptions.hpp>
 #include <GeoExplore/image/ChannelType.hpp>
+#include <GeoExplore/image/GeoTransform.hpp>
 #include <GeoExplore/image/Image.hpp>
+#include <GeoExplore/image/ImageSampling.hpp>
+#include <GeoExplore/image/ImageStatistics.hpp>
+#include <GeoExplore/image/MetadataContainer.hpp>
 #include <GeoExplore/image/MemoryResource.hpp>
+#include <GeoExplore/image/MultibandImage.hpp>
+#include <GeoExplore/image/PlanarResource.hpp>
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/io/GDAL_DatasetPool.hpp>
 #include <GeoExplore/io/ImageDriverBase.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
 
 namespace GEO{
 namespace IO{
@@ -56,16 +67,95 @@ GDALDataType ctype2gdaltype(){
     if( std::is_same<CType,ChannelTypeDouble>::value ){
         return GDT_Float64;
     }
+    if( std::is_same<CType,ChannelTypeDoubleFree>::value ){
+        return GDT_Float64;
+    }
 
     return GDT_Unknown;
 }
 
 
+/**
+ * @class SampleRange
+ *
+ * Range of the samples stored in a raster band.
+*/
+enum class SampleRange{
+    UINT8,
+    UINT12,
+    UINT14,
+    UINT16,
+    NATIVE,
+}; /// End of SampleRange Enumeration
+
+/// Number of pixels read per call when reading at full resolution
+const int GDAL_STRIP_PIXELS = 1 << 20;
+
+/// Images with at least this many pixels are decoded on several threads
+const size_t GDAL_PARALLEL_PIXELS = 1 << 22;
+
+/**
+ * Convert a band sample into the range of a channel type
+*/
+template<typename CType>
+double convert_sample( const float& value, SampleRange const& range ){
+    switch( range ){
+        case SampleRange::UINT8:
+            return range_cast<ChannelTypeUInt8,CType>( value );
+        case SampleRange::UINT12:
+            return range_cast<ChannelTypeUInt12,CType>( value );
+        case SampleRange::UINT14:
+            return range_cast<ChannelTypeUInt14,CType>( value );
+        case SampleRange::UINT16:
+            return range_cast<ChannelTypeUInt16,CType>( value );
+        default:
+            return value;
+    }
+}
+
+/**
+ * Check if samples of a range can be stored in a channel type without scaling
+*/
+template<typename CType>
+bool sample_range_matches( SampleRange const& range ){
+    switch( range ){
+        case SampleRange::UINT8:
+            return std::is_same<CType,ChannelTypeUInt8>::value;
+        case SampleRange::UINT12:
+            return std::is_same<CType,ChannelTypeUInt12>::value;
+        case SampleRange::UINT14:
+            return std::is_same<CType,ChannelTypeUInt14>::value;
+        case SampleRange::UINT16:
+            return std::is_same<CType,ChannelTypeUInt16>::value;
+        default:
+            return ctype2gdaltype<CType>() != GDT_Unknown;
+    }
+}
+
 /**
  * Get Short Driver Name from Filename
 */
 std::string getShortDriverFromFilename( const boost::filesystem::path& filename );
 
+/**
+ * Split a window into ranges of whole blocks
+ *
+ * Ranges are rows of blocks spanning the window.  When there are fewer
+ * block rows than requested ranges, the rows are also split on block
+ * columns.  Ranges never share a block, so each can be decoded on its own.
+ *
+ * @param[in] window     Window in pixel coordinates.
+ * @param[in] block_rows Rows of a dataset block.
+ * @param[in] block_cols Columns of a dataset block.
+ * @param[in] count      Desired number of ranges.
+ *
+ * @return Ranges covering the window, in row-major order.
+*/
+std::vector<Rect> split_block_ranges( Rect const& window,
+                                      const int& block_rows,
+                                      const int& block_cols,
+                                      const int& count );
+
 /**
  * @class ImageDriverGDAL
 */
@@ -98,6 +188,9 @@ class ImageDriverGDAL : public GEO::IO::ImageDriverBase{
         
         /**
          * Open the driver
+         *
+         * The dataset is borrowed from DatasetPool::instance(), so every
+         * driver holds a dataset of its own while open.
         */
         virtual void open();
         
@@ -106,8 +199,21 @@ class ImageDriverGDAL : public GEO::IO::ImageDriverBase{
         */
         virtual void open( boost::filesystem::path const& pathname );
 
+        /**
+         * Set the side-car candidates handed to GDAL when the file is opened
+         *
+         * @param[in] sibling_files Names of the files next to the image which
+         *                          share its stem, as listed by read_dataset_info.
+        */
+        void setSiblingFiles( std::vector<std::string> const& sibling_files ){
+            m_sibling_files = sibling_files;
+        }
+
         /**
          * Close the driver
+         *
+         * The dataset goes back to the DatasetPool once no copy of this
+         * driver holds it.
         */
         void close();
         
@@ -144,89 +250,281 @@ class ImageDriverGDAL : public GEO::IO::ImageDriverBase{
                 throw GEO::GeneralException("Error: image data must be pre-allocated to the required size.", __FILE__, __LINE__);
             }
         
-        
-            // get image dimensions
-            int xsize = cols();
-            int ysize = rows();
+            getPixels( image_data, Rect( 0, 0, cols(), rows()), rows(), cols() );
+        }
 
-            // start iterating through each band
-            float* pafScanline;
-            double value;
-    
-            // get driver type
-            std::string driverType;
-            if( m_driver->GetDescription() != NULL ){
-                driverType = m_driver->GetDescription();
+        /**
+         * Get the image data inside a window.
+         *
+         * If the buffer is smaller than the window, GDAL resamples the window
+         * and reads from the closest overview when the dataset has them.
+         *
+         * @param[out] image_data  Buffer with buffer_rows*buffer_cols pixels.
+         * @param[in]  window      Window in full resolution pixel coordinates.
+         * @param[in]  buffer_rows Number of rows in the buffer.
+         * @param[in]  buffer_cols Number of columns in the buffer.
+        */
+        template<typename PixelType>
+        void getPixels( boost::shared_ptr<PixelType[]>& image_data, 
+                        Rect const& window,
+                        const int& buffer_rows,
+                        const int& buffer_cols ){
+
+            // if the dataset is not open, then do nothing
+            if( isOpen() == false ){
+                std::cout << "warning: dataset is not open." << std::endl;
+                return;
             }
 
-            // set the bit depth if we are nitf
-            int NITF_ABPP=16;
-            if( driverType == "NITF" ){
-                if( m_dataset->GetMetadataItem("NITF_ABPP") != NULL ){
-                    std::string abpp = m_dataset->GetMetadataItem("NITF_ABPP");
-                    if( abpp == "12" ){
-                        NITF_ABPP=12;
-                    }
-                    else if( abpp == "14" ){
-                        NITF_ABPP=14;
-                    }
+            // make sure the window is inside the raster
+            if( window.empty() || window.inside( rows(), cols() ) == false ){
+                throw GEO::GeneralException("Error: window lies outside of the image.", __FILE__, __LINE__);
+            }
+
+            typedef typename PixelType::channeltype channeltype;
+            typedef typename channeltype::type datatype;
+            const int band_count = m_dataset->GetRasterCount();
+            const int pixel_dims = PixelType().dims();
+
+            // read every band in one call when GDAL can write the samples in place
+            if( pixel_dims > 1 && band_count >= pixel_dims && bandsMatch<channeltype>( pixel_dims ) ){
+                std::vector<int> band_map( pixel_dims );
+                for( int i=0; i<pixel_dims; i++ ){
+                    band_map[i] = i+1;
                 }
+                m_dataset->RasterIO( GF_Read, window.x(), window.y(), window.width(), window.height(),
+                                     &image_data[0][0], buffer_cols, buffer_rows,
+                                     ctype2gdaltype<channeltype>(), pixel_dims, &band_map[0],
+                                     sizeof(PixelType), (size_t)sizeof(PixelType) * buffer_cols,
+                                     sizeof(datatype) );
+                return;
             }
 
+            // at full resolution, read in strips to bound the scratch buffer
+            int strip_rows = buffer_rows;
+            if( buffer_rows == window.height() && buffer_cols == window.width() ){
+                strip_rows = std::max( 1, std::min( buffer_rows, GDAL_STRIP_PIXELS / buffer_cols ));
+            }
+            std::vector<float> scanlines( (size_t)strip_rows * buffer_cols );
+
+            for( int i=0; i<band_count; i++ ){
+
+                // skip bands the pixel type cannot hold
+                if( band_count > 1 && i >= pixel_dims ){
+                    break;
+                }
 
-            for( int i=0; i<m_dataset->GetRasterCount(); i++ ){
-                
                 // create raster band
                 GDALRasterBand* band = m_dataset->GetRasterBand(i+1);
-                
-                // get raster datatype
-                int gdalDataType = band->GetRasterDataType();
-                
-                // iterate over every row
-                for( int r=0; r<ysize; r++ ){
-
-                    // initialize data
-                    pafScanline = (float*) CPLMalloc(sizeof(float) * xsize);
-                    
-                    // read data
-                    band->RasterIO( GF_Read, 0, r, xsize, 1, pafScanline, xsize, 1, GDT_Float32, 0, 0);
-
-                    
-
-                    //add data to vector
-                    for( size_t c=0; c<xsize; c++ ){
-                        
-                        /// Convert datatypes
-                        if( gdalDataType == GDT_Byte ){
-                            value = range_cast<ChannelTypeUInt8, typename PixelType::channeltype>( pafScanline[c] );
-                        } else if( (gdalDataType == GDT_Int16 || gdalDataType == GDT_UInt16 ) || (NITF_ABPP == 12 )){
-                            value = range_cast<ChannelTypeUInt12,typename PixelType::channeltype>( pafScanline[c] );
-                        } else if( gdalDataType == GDT_Int16 || gdalDataType == GDT_UInt16 ){
-                            value = range_cast<ChannelTypeUInt16,typename PixelType::channeltype>( pafScanline[c] );                        
-                        } else {
-                            value = pafScanline[c];
-                        }
+                SampleRange range = getSampleRange( i );
 
+                for( int r0=0; r0<buffer_rows; r0+=strip_rows ){
 
-                        if( m_dataset->GetRasterCount() == 1 && image_data[0].dims() == 3 ){
-                            image_data[r*xsize + c] = value;
-                        }
-                        else {
-                            image_data[r*xsize + c][i] = value;
-                        }
-                        
+                    // read the strip
+                    const int nrows = std::min( strip_rows, buffer_rows - r0 );
+                    if( strip_rows == buffer_rows ){
+                        band->RasterIO( GF_Read, window.x(), window.y(), window.width(), window.height(),
+                                        &scanlines[0], buffer_cols, buffer_rows, GDT_Float32, 0, 0);
+                    } else {
+                        band->RasterIO( GF_Read, window.x(), window.y() + r0, window.width(), nrows,
+                                        &scanlines[0], buffer_cols, nrows, GDT_Float32, 0, 0);
+                    }
 
+                    // add data to the buffer
+                    for( int r=0; r<nrows; r++ ){
+                        PixelType* dst = image_data.get() + (size_t)(r0 + r)*buffer_cols;
+                        const float* src = &scanlines[(size_t)r*buffer_cols];
+                        for( int c=0; c<buffer_cols; c++ ){
+                            double value = convert_sample<channeltype>( src[c], range );
+                            if( band_count == 1 ){
+                                dst[c] = value;
+                            } else {
+                                dst[c][i] = value;
+                            }
+                        }
                     }
+                }
+            }
+        }
+
+        /**
+         * Read a window into planar bands.
+         *
+         * @param[out] output Planar resource sized to the window.
+         * @param[in]  window Window in pixel coordinates.
+        */
+        template<typename PixelType>
+        void getBands( PlanarResource<PixelType>& output, Rect const& window ){
+            getBands<typename PixelType::channeltype>( output.getBuffer(), window );
+        }
 
-                    // clear data
-                    CPLFree( pafScanline );
+        /**
+         * Read a window into a planar buffer.
+         *
+         * When every band needs no scaling, all bands are read with a single
+         * dataset request straight into the buffer, letting GDAL walk each
+         * block once for the whole band stack.  Otherwise bands are read one
+         * at a time and converted in strips.  Single band images fill every
+         * band of the buffer, and buffer bands past the last image band are
+         * zeroed.
+         *
+         * A buffer smaller than the window is filled from the closest
+         * overview, as with getPixels.
+         *
+         * @param[out] output Planar buffer no larger than the window.
+         * @param[in]  window Window in pixel coordinates.
+        */
+        template<typename ChannelType>
+        void getBands( PlanarBuffer<typename ChannelType::type>& output, Rect const& window ){
 
+            typedef typename ChannelType::type datatype;
 
+            // if the dataset is not open, then do nothing
+            if( isOpen() == false ){
+                std::cout << "warning: dataset is not open." << std::endl;
+                return;
+            }
+
+            // make sure the window and output are valid
+            if( window.empty() || window.inside( rows(), cols() ) == false ){
+                throw GEO::GeneralException("Error: window lies outside of the image.", __FILE__, __LINE__);
+            }
+            if( output.rows() <= 0 || output.cols() <= 0 ||
+                output.rows() > window.height() || output.cols() > window.width() ){
+                throw GEO::GeneralException("Error: planar buffer must be pre-allocated to at most the window size.", __FILE__, __LINE__);
+            }
+
+            const int band_count = m_dataset->GetRasterCount();
+            const int read_count = std::min( band_count, output.bands() );
+            const int buffer_rows = output.rows();
+            const int buffer_cols = output.cols();
+            const bool full_resolution = ( buffer_rows == window.height() && buffer_cols == window.width() );
+
+            // zero the bands the image does not have
+            if( band_count > 1 ){
+                for( int b=band_count; b<output.bands(); b++ ){
+                    BandSpan<datatype> span = output.band(b);
+                    std::fill( span.begin(), span.end(), datatype() );
+                }
+            }
+
+            // read the whole band stack at once
+            if( band_count > 1 && bandsMatch<ChannelType>( read_count ) ){
+                std::vector<int> band_map( read_count );
+                for( int b=0; b<read_count; b++ ){
+                    band_map[b] = b+1;
+                }
+                m_dataset->RasterIO( GF_Read, window.x(), window.y(), window.width(), window.height(),
+                                     output.band(0).data(), buffer_cols, buffer_rows,
+                                     ctype2gdaltype<ChannelType>(), read_count, &band_map[0],
+                                     sizeof(datatype), (size_t)sizeof(datatype) * buffer_cols,
+                                     output.bandStride() * sizeof(datatype) );
+                return;
+            }
+
+            std::vector<float> scanlines;
+            for( int b=0; b<output.bands(); b++ ){
+
+                // single band images fill every channel
+                const int source_band = ( band_count == 1 ) ? 0 : b;
+                if( source_band >= band_count ){
+                    break;
+                }
+                GDALRasterBand* band = m_dataset->GetRasterBand( source_band+1 );
+                SampleRange range = getSampleRange( source_band );
+                BandSpan<datatype> span = output.band(b);
+
+                // read directly into the band
+                if( sample_range_matches<ChannelType>( range ) ){
+                    band->RasterIO( GF_Read, window.x(), window.y(), window.width(), window.height(),
+                                    span.data(), buffer_cols, buffer_rows,
+                                    ctype2gdaltype<ChannelType>(), 0, 0 );
+                    continue;
+                }
+
+                // read and convert in strips at full resolution
+                int strip_rows = buffer_rows;
+                if( full_resolution ){
+                    strip_rows = std::max( 1, std::min( buffer_rows, GDAL_STRIP_PIXELS / buffer_cols ));
+                }
+                scanlines.resize( (size_t)strip_rows * buffer_cols );
+                for( int r0=0; r0<buffer_rows; r0+=strip_rows ){
+                    const int nrows = std::min( strip_rows, buffer_rows - r0 );
+                    if( full_resolution ){
+                        band->RasterIO( GF_Read, window.x(), window.y() + r0, window.width(), nrows,
+                                        &scanlines[0], buffer_cols, nrows, GDT_Float32, 0, 0 );
+                    } else {
+                        band->RasterIO( GF_Read, window.x(), window.y(), window.width(), window.height(),
+                                        &scanlines[0], buffer_cols, buffer_rows, GDT_Float32, 0, 0 );
+                    }
+                    datatype* dst = span.row( r0 );
+                    const size_t count = (size_t)nrows * buffer_cols;
+                    for( size_t i=0; i<count; i++ ){
+                        dst[i] = convert_sample<ChannelType>( scanlines[i], range );
+                    }
                 }
             }
-        
         }
 
+        /**
+         * Check if the first bands can be read into a channel type without scaling
+         *
+         * @param[in] count Number of bands to check.
+        */
+        template<typename ChannelType>
+        bool bandsMatch( const int& count ){
+            for( int b=0; b<count; b++ ){
+                if( sample_range_matches<ChannelType>( getSampleRange( b )) == false ){
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Return the number of raster bands
+        */
+        int getBandCount();
+
+        /**
+         * Read the metadata of the open dataset
+         *
+         * Collects the default, TRE, RPC and IMAGE_STRUCTURE domains along
+         * with the geotransform and spatial reference.  Values are stored
+         * unparsed; numbers are parsed when first asked for.
+        */
+        MetadataContainer::ptr_t getMetadata();
+
+        /**
+         * Return the sample range of a band
+         *
+         * @param[in] band_index Zero-based band index.
+        */
+        SampleRange getSampleRange( const int& band_index );
+
+        /**
+         * Get the no-data value of a band
+         *
+         * @param[in]  band_index Zero-based band index.
+         * @param[out] value      No-data value in the file's sample units.
+         *
+         * @return False if the band has no no-data value.
+        */
+        bool getNoDataValue( const int& band_index, double& value );
+
+        /**
+         * Return the number of overviews of the first band
+        */
+        int getOverviewCount();
+
+        /**
+         * Return the natural block size of the first band
+         *
+         * This is the unit the format decodes at once, such as a JPEG2000
+         * tile, NITF block or GeoTIFF strip.
+        */
+        void getBlockSize( int& block_rows, int& block_cols );
+
         /**
          * Get the pixel value
         */
@@ -241,40 +539,28 @@ class ImageDriverGDAL : public GEO::IO::ImageDriverBase{
             // create output
             PixelType output;
 
-            // iterate over each channel
+            // iterate over the channels both the image and pixel type have
             float data;
             double value;
-            for( int i=0; i<m_dataset->GetRasterCount(); i++ ){
+            const int band_count = std::min( m_dataset->GetRasterCount(), output.dims() );
+            for( int i=0; i<band_count; i++ ){
             
                 // create raster band
                 GDALRasterBand* band = m_dataset->GetRasterBand(i+1);
                 
-                // get raster datatype
-                int gdalDataType = band->GetRasterDataType();
-                
-
                 // read data
                 band->RasterIO( GF_Read, x, y, 1, 1, &data, 1, 1, GDT_Float32, 0, 0);
 
                 /// Convert datatypes
-                if( gdalDataType == GDT_Byte ){
-                    value = range_cast<ChannelTypeUInt8, typename PixelType::channeltype>( data );
-                //} else if( (gdalDataType == GDT_Int16 || gdalDataType == GDT_UInt16 ) || (NITF_ABPP == 12 )){
-                //    value = range_cast<ChannelTypeUInt12,typename PixelType::channeltype>( data );
-                } else if( gdalDataType == GDT_Int16 || gdalDataType == GDT_UInt16 ){
-                    value = range_cast<ChannelTypeUInt16,typename PixelType::channeltype>( data );                        
-                } else {
-                    value = data;
-                }
+                value = convert_sample<typename PixelType::channeltype>( data, getSampleRange(i) );
 
-                    
-                // if the current channel is less than the total channels for the pixeltype
-                if( i <= output.dims() && output.dims() > 1 ){
-                    output[i] = value;
+
+                // single channel pixels hold the first band only
+                if( output.dims() == 1 ){
+                    output = value;
                 }
-                // otherwise, just set it equal
                 else{
-                    output = value;
+                    output[i] = value;
                 }
             }
 
@@ -292,14 +578,109 @@ class ImageDriverGDAL : public GEO::IO::ImageDriverBase{
         /// Dataset
         GDALDataset* m_dataset;
 
+        /// Dataset lent by the pool
+        DatasetPool::handle_t m_handle;
+
+        /// Side-car candidates, empty to let GDAL list the directory
+        std::vector<std::string> m_sibling_files;
+
 }; /// End of ImageDriverBase Class
 
 
+/**
+ * Build the geotransform described by image metadata
+ *
+ * @param[in] metadata Metadata read by ImageDriverGDAL::getMetadata.
+ *
+ * @return Invalid transform if the image has no geotransform, or its
+ *         spatial reference is neither geographic nor UTM.
+*/
+GeoTransform make_geotransform( MetadataContainer const& metadata );
+
+
+/**
+ * Read a window at full resolution on several threads
+ *
+ * The window is split into ranges of whole blocks, so no two threads decode
+ * the same JPEG2000 tile or NITF block.  GDAL datasets are not thread-safe,
+ * so every worker besides the caller opens its own dataset.  Ranges spanning
+ * the window width are read straight into the destination buffer.
+ *
+ * Files stored as a single block are read on the calling thread.
+ *
+ * @param[in]  image_pathname Image to read.
+ * @param[in]  driver         Open driver of the image, used by the calling thread.
+ * @param[in]  window         Window in pixel coordinates.
+ * @param[out] image_data     Buffer of window.height() rows by window.width() pixels.
+ * @param[in]  threads        Number of threads.  Values <= 0 use the default.
+*/
+template <typename PixelType>
+void read_pixels_parallel( const boost::filesystem::path& image_pathname,
+                           ImageDriverGDAL&               driver,
+                           Rect const&                    window,
+                           boost::shared_ptr<PixelType[]>& image_data,
+                           const int&                     threads = 0 ){
+
+    // split the window on block boundaries
+    const int thread_count = ( threads > 0 ) ? threads : default_thread_count();
+    int block_rows, block_cols;
+    driver.getBlockSize( block_rows, block_cols );
+    const std::vector<Rect> ranges = split_block_ranges( window, block_rows, block_cols, thread_count * 4 );
+    if( thread_count <= 1 || ranges.size() <= 1 ){
+        driver.getPixels( image_data, window, window.height(), window.width() );
+        return;
+    }
+
+    std::vector<ImageDriverGDAL::ptr_t> drivers( thread_count );
+    parallel_for( 0, ranges.size(), [&]( const size_t& idx, const int& thread_id ){
+
+        // the calling thread is worker 0
+        ImageDriverGDAL* handle = &driver;
+        if( thread_id > 0 ){
+            if( drivers[thread_id] == nullptr ){
+                drivers[thread_id].reset( new ImageDriverGDAL( image_pathname ));
+                drivers[thread_id]->open();
+                if( drivers[thread_id]->isOpen() == false ){
+                    throw GEO::GeneralException( std::string("Unable to open ") + image_pathname.native(), __FILE__, __LINE__);
+                }
+            }
+            handle = drivers[thread_id].get();
+        }
+
+        Rect const& range = ranges[idx];
+        const size_t offset = (size_t)( range.y() - window.y() ) * window.width() + ( range.x() - window.x() );
+
+        // full-width ranges land in place
+        if( range.width() == window.width() ){
+            boost::shared_ptr<PixelType[]> destination( image_data, image_data.get() + offset );
+            handle->getPixels( destination, range, range.height(), range.width() );
+            return;
+        }
+
+        // otherwise decode then copy the rows
+        const size_t count = (size_t)range.width() * range.height();
+        boost::shared_ptr<PixelType[]> buffer = allocate_pixels<PixelType>( count );
+        handle->getPixels( buffer, range, range.height(), range.width() );
+        for( int r=0; r<range.height(); r++ ){
+            copy_pixels_serial( buffer.get() + (size_t)r * range.width(),
+                                image_data.get() + offset + (size_t)r * window.width(),
+                                range.width() );
+        }
+    }, thread_count );
+}
+
+
 /**
  * Read an image and return the image data
+ *
+ * @param[out] metadata If not null, receives the metadata of the image,
+ *                      read from the same open dataset.
 */
 template <typename PixelType>
-boost::shared_ptr<PixelType[]> load_image_data( const boost::filesystem::path& image_pathname, int& rowCount, int& colCount ){
+boost::shared_ptr<PixelType[]> load_image_data( const boost::filesystem::path& image_pathname,
+                                                int& rowCount,
+                                                int& colCount,
+                                                MetadataContainer::ptr_t* metadata = nullptr ){
    
     // create the GDAL Driver
     ImageDriverGDAL::ptr_t gdal_driver( new ImageDriverGDAL(image_pathname));
@@ -320,10 +701,18 @@ boost::shared_ptr<PixelType[]> load_image_data( const boost::filesystem::path& i
     
 
     // create the pixeldata
-    boost::shared_ptr<PixelType[]> pixeldata( new PixelType[rowCount * colCount]);
+    boost::shared_ptr<PixelType[]> pixeldata = allocate_pixels<PixelType>( (size_t)rowCount * colCount );
+
+    // pass the container to the driver, decoding large images in parallel
+    if( (size_t)rowCount * colCount >= GDAL_PARALLEL_PIXELS ){
+        read_pixels_parallel( image_pathname, *gdal_driver, Rect( 0, 0, colCount, rowCount ), pixeldata );
+    } else {
+        gdal_driver->getPixels( pixeldata, rowCount * colCount );
+    }
 
-    // pass the container to the driver
-    gdal_driver->getPixels( pixeldata, rowCount * colCount );
+    if( metadata != nullptr ){
+        *metadata = gdal_driver->getMetadata();
+    }
 
     return pixeldata;
 }
@@ -332,14 +721,15 @@ boost::shared_ptr<PixelType[]> load_image_data( const boost::filesystem::path& i
  * Load an image and return a resource
 */
 template<typename PixelType>
-MemoryResource<PixelType> load_image( const boost::filesystem::path& image_pathname ){
+MemoryResource<PixelType> load_image( const boost::filesystem::path& image_pathname,
+                                      MetadataContainer::ptr_t* metadata = nullptr ){
 
     /// create the output
     MemoryResource<PixelType> output;
 
     // get the pixel data
     int rowSize, colSize;
-    boost::shared_ptr<PixelType[]> pixels = load_image_data<PixelType>( image_pathname, rowSize, colSize );
+    boost::shared_ptr<PixelType[]> pixels = load_image_data<PixelType>( image_pathname, rowSize, colSize, metadata );
 
     output.setPixelData( pixels, rowSize, colSize );
 
@@ -347,6 +737,277 @@ MemoryResource<PixelType> load_image( const boost::filesystem::path& image_pathn
     return output;
 }
 
+/**
+ * Load a window of an image and return a resource
+ *
+ * Only the requested window is read from disk.  Overview level n returns
+ * the window downsampled by 2^n, read from the dataset overviews when the
+ * file has them.
+ *
+ * @param[in] image_pathname Image to read.
+ * @param[in] window         Window in full resolution pixel coordinates.
+ * @param[in] overview_level Overview level. 0 is full resolution.
+ * @param[out] metadata      If not null, receives the image metadata.
+*/
+template<typename PixelType>
+MemoryResource<PixelType> load_image( const boost::filesystem::path& image_pathname,
+                                      Rect const& window,
+                                      const int& overview_level = 0,
+                                      MetadataContainer::ptr_t* metadata = nullptr ){
+
+    // create the GDAL Driver
+    ImageDriverGDAL driver( image_pathname );
+    driver.open();
+    if( driver.isOpen() == false ){
+        return MemoryResource<PixelType>();
+    }
+
+    // compute the output size
+    const int scale = 1 << overview_level;
+    const int rowCount = ( window.height() + scale - 1 ) / scale;
+    const int colCount = ( window.width()  + scale - 1 ) / scale;
+
+    // read the window
+    boost::shared_ptr<PixelType[]> pixels = allocate_pixels<PixelType>( (size_t)rowCount * colCount );
+    if( overview_level == 0 && (size_t)rowCount * colCount >= GDAL_PARALLEL_PIXELS ){
+        read_pixels_parallel( image_pathname, driver, window, pixels );
+    } else {
+        driver.getPixels( pixels, window, rowCount, colCount );
+    }
+
+    if( metadata != nullptr ){
+        *metadata = driver.getMetadata();
+    }
+
+    MemoryResource<PixelType> output;
+    output.setPixelData( pixels, rowCount, colCount );
+    return output;
+}
+
+/**
+ * Load an image into planar bands
+ *
+ * @param[in] image_pathname Image to read.
+ * @param[out] metadata      If not null, receives the image metadata.
+*/
+template<typename PixelType>
+PlanarResource<PixelType> load_planar_image( const boost::filesystem::path& image_pathname,
+                                             MetadataContainer::ptr_t* metadata = nullptr ){
+
+    // create the GDAL Driver
+    ImageDriverGDAL driver( image_pathname );
+    driver.open();
+    if( driver.isOpen() == false ){
+        return PlanarResource<PixelType>();
+    }
+
+    PlanarResource<PixelType> output( driver.rows(), driver.cols() );
+    driver.getBands( output, Rect( 0, 0, driver.cols(), driver.rows() ));
+
+    if( metadata != nullptr ){
+        *metadata = driver.getMetadata();
+    }
+    return output;
+}
+
+/**
+ * Load every band of an image
+ *
+ * @param[in] image_pathname Image to read.
+*/
+template<typename ChannelType>
+MultibandImage<ChannelType> load_multiband_image( const boost::filesystem::path& image_pathname ){
+
+    // create the GDAL Driver
+    ImageDriverGDAL driver( image_pathname );
+    driver.open();
+    if( driver.isOpen() == false ){
+        return MultibandImage<ChannelType>();
+    }
+
+    MultibandImage<ChannelType> output( driver.rows(), driver.cols(), driver.getBandCount() );
+    driver.getBands<ChannelType>( output.getBuffer(), Rect( 0, 0, driver.cols(), driver.rows() ));
+    return output;
+}
+
+/**
+ * Compute per-band statistics of an image file
+ *
+ * Full statistics stream the image in strips of rows, so the image never
+ * has to fit in memory.  Approximate statistics read a reduced image of
+ * about options.approximate_pixels pixels, which GDAL takes from the
+ * closest overview when the file has them.
+ *
+ * @param[in] image_pathname Image to measure.
+ * @param[in] options        Statistics settings.
+ * @param[in] sibling_files  If not null, the side-car candidates of the image, as
+ *                           listed by read_dataset_info.
+*/
+template<typename ChannelType>
+std::vector<BandStatistics> compute_image_statistics( const boost::filesystem::path& image_pathname,
+                                                      StatisticsOptions const& options = StatisticsOptions(),
+                                                      std::vector<std::string> const* sibling_files = nullptr ){
+
+    // create the GDAL Driver
+    ImageDriverGDAL driver( image_pathname );
+    if( sibling_files != nullptr ){
+        driver.setSiblingFiles( *sibling_files );
+    }
+    driver.open();
+    if( driver.isOpen() == false ){
+        throw GEO::GeneralException( std::string("Unable to open ") + image_pathname.native(), __FILE__, __LINE__);
+    }
+    const int rows  = driver.rows();
+    const int cols  = driver.cols();
+    const int bands = driver.getBandCount();
+    const Rect full( 0, 0, cols, rows );
+
+    // mask the no-data values of the bands unless the caller chose its own,
+    // converted like the samples into the channel range
+    StatisticsOptions stats_options = options;
+    if( stats_options.use_nodata == false && stats_options.band_nodata_values.empty() ){
+        stats_options.band_nodata_values.assign( bands, std::numeric_limits<double>::quiet_NaN() );
+        for( int b=0; b<bands; b++ ){
+            double nodata;
+            if( driver.getNoDataValue( b, nodata ) ){
+                stats_options.band_nodata_values[b] = convert_sample<ChannelType>( nodata, driver.getSampleRange( b ));
+            }
+        }
+    }
+
+    // read the image at a reduced resolution
+    auto read_reduced = [&]( const int& step ){
+        MultibandImage<ChannelType> reduced( (rows + step - 1) / step, (cols + step - 1) / step, bands );
+        driver.getBands<ChannelType>( reduced.getBuffer(), full );
+        StatisticsOptions reduced_options = stats_options;
+        reduced_options.approximate = false;
+        return compute_statistics( reduced, reduced_options );
+    };
+
+    // approximate statistics come from one reduced read
+    const int step = statistics_step( rows, cols, stats_options );
+    if( step > 1 ){
+        return read_reduced( step );
+    }
+
+    // free-range samples are binned over the range of each band in a reduced
+    // read.  Samples outside of it land in the edge bins; min and max stay exact.
+    std::vector<BandAccumulator> accumulators = make_band_accumulators<ChannelType>( bands, stats_options );
+    if( std::is_same<ChannelType,ChannelTypeDoubleFree>::value &&
+        options.histogram_min >= options.histogram_max ){
+        StatisticsOptions range_options = stats_options;
+        range_options.approximate = true;
+        std::vector<BandStatistics> ranges = read_reduced( statistics_step( rows, cols, range_options ));
+        for( int b=0; b<bands; b++ ){
+            StatisticsOptions band_options = stats_options;
+            band_options.histogram_min = ranges[b].min;
+            band_options.histogram_max = std::nextafter( ranges[b].max, std::numeric_limits<double>::infinity() );
+            accumulators[b] = make_band_accumulators<ChannelType>( 1, band_options )[0];
+        }
+    }
+
+    // stream the image in strips
+    const int strip_rows = std::max( 1, std::min( rows, GDAL_STRIP_PIXELS / std::max( cols * bands, 1 )));
+    MultibandImage<ChannelType> strip;
+    for( int r0=0; r0<rows; r0+=strip_rows ){
+        const int nrows = std::min( strip_rows, rows - r0 );
+        if( strip.rows() != nrows ){
+            strip = MultibandImage<ChannelType>( nrows, cols, bands );
+        }
+        driver.getBands<ChannelType>( strip.getBuffer(), Rect( 0, r0, cols, nrows ));
+
+        const MultibandImage<ChannelType>& cstrip = strip;
+        auto fetch_row = [&]( const int& row, const int& band, const int& /*step*/, std::vector<typename ChannelType::type>& /*scratch*/ ){
+            return (const typename ChannelType::type*)cstrip.band( band ).row( row );
+        };
+        accumulate_statistics<ChannelType>( nrows, cols, 1, stats_options, fetch_row, accumulators );
+    }
+    return finalize_statistics( accumulators, stats_options );
+}
+
+/**
+ * Sample an image file at a list of pixel coordinates
+ *
+ * Points are grouped by tile and each tile window is read once, instead
+ * of one read per point.  Tiles are spread over threads, and each thread
+ * reads through its own dataset since GDAL datasets cannot be shared
+ * between threads.
+ *
+ * @param[in]  image_pathname Image to sample.
+ * @param[in]  cols           Column of each point.
+ * @param[in]  rows           Row of each point.
+ * @param[in]  interpolation  Interpolation method.
+ * @param[out] output         One sample per channel per point, in input order.
+ *                            Points outside the image are NaN.
+ * @param[in]  threads        Number of threads.  Values <= 0 use the default.
+*/
+template<typename PixelType>
+void sample_image( const boost::filesystem::path& image_pathname,
+                   std::vector<double> const& cols,
+                   std::vector<double> const& rows,
+                   Interpolation const& interpolation,
+                   std::vector<double>& output,
+                   const int& threads = 0 ){
+
+    // open the first dataset on this thread to check the file
+    const int thread_count = ( threads > 0 ) ? threads : default_thread_count();
+    std::vector<ImageDriverGDAL::ptr_t> drivers( thread_count );
+    drivers[0].reset( new ImageDriverGDAL( image_pathname ));
+    drivers[0]->open();
+    if( drivers[0]->isOpen() == false ){
+        throw GEO::GeneralException( std::string("Unable to open ") + image_pathname.native(), __FILE__, __LINE__);
+    }
+
+    const int channels = PixelType().dims();
+    auto fetch_window = [&]( Rect const& window, const int& thread_id, std::vector<double>& buffer ){
+
+        if( drivers[thread_id] == nullptr ){
+            drivers[thread_id].reset( new ImageDriverGDAL( image_pathname ));
+            drivers[thread_id]->open();
+            if( drivers[thread_id]->isOpen() == false ){
+                throw GEO::GeneralException( std::string("Unable to open ") + image_pathname.native(), __FILE__, __LINE__);
+            }
+        }
+
+        const size_t count = (size_t)window.width() * window.height();
+        boost::shared_ptr<PixelType[]> pixels = allocate_pixels<PixelType>( count );
+        drivers[thread_id]->getPixels( pixels, window, window.height(), window.width() );
+        for( size_t i=0; i<count; i++ ){
+            for( int ch=0; ch<channels; ch++ ){
+                buffer[i*channels + ch] = pixels[i][ch];
+            }
+        }
+    };
+    sample_points( drivers[0]->rows(), drivers[0]->cols(), channels, cols, rows, interpolation, fetch_window, output, thread_count );
+}
+
+/**
+ * Sample an image file at a list of world coordinates
+ *
+ * The coordinates are mapped through the image geotransform, so they must
+ * be in the image frame.  Pass them through an OGR::CoordinateTransformer
+ * first if they are not.
+*/
+template<typename PixelType, typename CoordType>
+void sample_image( const boost::filesystem::path& image_pathname,
+                   std::vector<CoordType> const& coordinates,
+                   Interpolation const& interpolation,
+                   std::vector<double>& output,
+                   const int& threads = 0 ){
+
+    ImageDriverGDAL driver( image_pathname );
+    driver.open();
+    MetadataContainer::ptr_t metadata = driver.getMetadata();
+    GeoTransform geotransform = make_geotransform( *metadata );
+    if( geotransform.isValid() == false ){
+        throw GEO::GeneralException( image_pathname.native() + " is not georeferenced.", __FILE__, __LINE__);
+    }
+
+    std::vector<double> cols, rows;
+    geotransform.worldToPixel( coordinates, cols, rows );
+    sample_image<PixelType>( image_pathname, cols, rows, interpolation, output, threads );
+}
+
 /**
  * Write an image to a GDAL format
 */
@@ -360,6 +1021,7 @@ void write_image( Image_<PixelType,ResourceType>const&  output_image, boost::fil
     }
 
     // create the driver
+    register_drivers();
     GDALDriver* gdal_driver = GetGDALDriverManager()->GetDriverByName(driverShortName.c_str());
     
     // make sure the driver can create images
@@ -9,6 +9,7 @@
 /// GeoExplore Libraries
 #include <GeoExplore/core/Enumerations.hpp>
 #include <GeoExplore/image/Image.hpp>
+#include <GeoExplore/image/MultibandImage.hpp>
 #include <GeoExplore/io/GDAL_Driver.hpp>
 #include <GeoExplore/io/NETPBM_Driver.hpp>
 #include <GeoExplore/io/OpenCV_Driver.hpp>
@@ -18,6 +19,7 @@
 
 /// C++ Standard Libraries
 #include <iostream>
+#include <vector>
 
 
 namespace GEO{
@@ -37,6 +39,38 @@ enum class DriverOptions{
 GEO::ImageDriverType compute_driver( const boost::filesystem::path& pathname, const DriverOptions& options = DriverOptions::NONE );    
 
 
+/**
+ * Read an Image at a reduced scale
+ *
+ * JPEG and PNG files are decoded directly at the reduced size, which is
+ * much faster than decoding the full image and resizing it.  If the output
+ * image already has the decoded size, its buffer is reused.
+*/
+template<typename PixelType>
+void read_image( boost::filesystem::path const& pathname, 
+                 Image<PixelType>& output_image, 
+                 GEO::IO::OPENCV::DecodeScale const& scale ){
+
+    /// make sure the file exists
+    if( boost::filesystem::exists( pathname ) == false ){
+        throw std::runtime_error(std::string(std::string("error: File \"") + pathname.native() + std::string("\" does not exist.")).c_str());
+    }
+
+    /// only the OpenCV driver supports reduced decoding
+    if( compute_driver(pathname) != GEO::ImageDriverType::OPENCV ){
+        throw GEO::GeneralException("Reduced decoding is only supported for OpenCV images.", __FILE__, __LINE__);
+    }
+
+    // decode into the existing resource
+    MemoryResource<PixelType> resource = output_image.getResource();
+    output_image.setResource( MemoryResource<PixelType>() );
+    
+    std::vector<uchar> buffer;
+    cv::Mat image;
+    GEO::IO::OPENCV::load_image( pathname, resource, scale, buffer, image );
+    output_image.setResource( resource );
+}
+
 /**
  * Read an Image
 */
@@ -56,8 +90,17 @@ void read_image( boost::filesystem::path const& pathname, Image<PixelType>& outp
      * Since we are just loading pixel data, call the appropriate load_image_data function
      */
     if( driver == GEO::ImageDriverType::GDAL ){
-        int rowSize;
-        output_image.setResource( GEO::IO::GDAL::load_image<PixelType>(pathname));
+        MetadataContainer::ptr_t metadata;
+        MemoryResource<PixelType> resource = GEO::IO::GDAL::load_image<PixelType>( pathname, &metadata );
+        if( metadata == nullptr ){
+            throw GEO::GeneralException( std::string("Unable to open ") + pathname.native(), __FILE__, __LINE__);
+        }
+        output_image.setResource( resource );
+        output_image.setMetadata( metadata );
+        output_image.setGeoTransform( GEO::IO::GDAL::make_geotransform( *metadata ));
+    }
+    else if( driver == GEO::ImageDriverType::OPENCV ){
+        read_image( pathname, output_image, GEO::IO::OPENCV::DecodeScale::FULL );
     }
     else{
         throw std::runtime_error("Unknown driver.");
@@ -65,6 +108,143 @@ void read_image( boost::filesystem::path const& pathname, Image<PixelType>& outp
     
 }
 
+/**
+ * Read a window of an Image
+ *
+ * Only the window is read for GDAL images.  Overview level n downsamples the
+ * window by 2^n, using the file overviews when they exist.
+ *
+ * @param[in]  pathname       Image to read.
+ * @param[in]  window         Window in full resolution pixel coordinates.
+ * @param[out] output_image   Output image.
+ * @param[in]  overview_level Overview level. 0 is full resolution.
+*/
+template<typename PixelType>
+void read_image( boost::filesystem::path const& pathname, 
+                 Rect const& window,
+                 Image<PixelType>& output_image,
+                 const int& overview_level = 0 ){
+
+    /// make sure the file exists
+    if( boost::filesystem::exists( pathname ) == false ){
+        throw std::runtime_error(std::string(std::string("error: File \"") + pathname.native() + std::string("\" does not exist.")).c_str());
+    }
+
+    /// make sure the overview level is valid
+    if( overview_level < 0 || overview_level > 30 ){
+        throw GEO::GeneralException("Invalid overview level.", __FILE__, __LINE__);
+    }
+
+    /// decide which driver to use depending on the filename
+    GEO::ImageDriverType driver = compute_driver(pathname);
+
+    if( driver == GEO::ImageDriverType::GDAL ){
+        MetadataContainer::ptr_t metadata;
+        MemoryResource<PixelType> resource = GEO::IO::GDAL::load_image<PixelType>( pathname, window, overview_level, &metadata );
+        if( metadata == nullptr ){
+            throw GEO::GeneralException( std::string("Unable to open ") + pathname.native(), __FILE__, __LINE__);
+        }
+        output_image.setResource( resource );
+        output_image.setMetadata( metadata );
+        output_image.setGeoTransform( GEO::IO::GDAL::make_geotransform( *metadata ).window( window, 1 << overview_level ));
+    }
+    else if( driver == GEO::ImageDriverType::OPENCV ){
+        output_image.setResource( GEO::IO::OPENCV::load_image<PixelType>( pathname, window, overview_level ));
+    }
+    else{
+        throw std::runtime_error("Unknown driver.");
+    }
+}
+
+/**
+ * Read a list of images in parallel
+ *
+ * @param[in]  pathnames     Images to read.
+ * @param[out] output_images Output images, one per pathname.
+ * @param[in]  scale         Decode scale for OpenCV images.
+ * @param[in]  num_threads   Number of threads. Values <= 0 use the hardware concurrency.
+*/
+template<typename PixelType>
+void read_images( std::vector<boost::filesystem::path> const& pathnames,
+                  std::vector<Image<PixelType> >&             output_images,
+                  GEO::IO::OPENCV::DecodeScale const& scale = GEO::IO::OPENCV::DecodeScale::FULL,
+                  const int& num_threads = 0 ){
+
+    // make sure every file exists before starting any threads
+    for( size_t i=0; i<pathnames.size(); i++ ){
+        if( boost::filesystem::exists( pathnames[i] ) == false ){
+            throw std::runtime_error(std::string(std::string("error: File \"") + pathnames[i].native() + std::string("\" does not exist.")).c_str());
+        }
+        if( compute_driver( pathnames[i] ) != GEO::ImageDriverType::OPENCV ){
+            throw GEO::GeneralException( pathnames[i].native() + " is not an OpenCV image.", __FILE__, __LINE__);
+        }
+    }
+
+    // decode
+    std::vector<MemoryResource<PixelType> > resources;
+    GEO::IO::OPENCV::load_images( pathnames, resources, scale, num_threads );
+
+    // assign the resources
+    output_images.resize( pathnames.size() );
+    for( size_t i=0; i<pathnames.size(); i++ ){
+        output_images[i].setResource( resources[i] );
+    }
+}
+
+/**
+ * Read an image into planar bands
+*/
+template <typename PixelType>
+void read_image( boost::filesystem::path const& pathname, PlanarImage<PixelType>& output_image ){
+
+    // make sure the file exists
+    if( boost::filesystem::exists( pathname ) == false ){
+        throw std::runtime_error(std::string(std::string("error: File \"") + pathname.native() + std::string("\" does not exist.")).c_str());
+    }
+
+    // GDAL reads band by band, other drivers are deinterleaved
+    GEO::ImageDriverType driver = compute_driver( pathname );
+    if( driver == GEO::ImageDriverType::GDAL ){
+        MetadataContainer::ptr_t metadata;
+        PlanarResource<PixelType> resource = GEO::IO::GDAL::load_planar_image<PixelType>( pathname, &metadata );
+        if( metadata == nullptr ){
+            throw GEO::GeneralException( std::string("Unable to open ") + pathname.native(), __FILE__, __LINE__);
+        }
+        output_image.setResource( resource );
+        output_image.setMetadata( metadata );
+        output_image.setGeoTransform( GEO::IO::GDAL::make_geotransform( *metadata ));
+    }
+    else{
+        Image<PixelType> image;
+        read_image( pathname, image );
+        output_image.setResource( deinterleave( image.getResource() ));
+    }
+}
+
+/**
+ * Read every band of an image
+*/
+template <typename ChannelType>
+void read_image( boost::filesystem::path const& pathname, MultibandImage<ChannelType>& output_image ){
+
+    // make sure the file exists
+    if( boost::filesystem::exists( pathname ) == false ){
+        throw std::runtime_error(std::string(std::string("error: File \"") + pathname.native() + std::string("\" does not exist.")).c_str());
+    }
+
+    // GDAL reads the whole band stack, other drivers only return color images
+    GEO::ImageDriverType driver = compute_driver( pathname );
+    if( driver == GEO::ImageDriverType::GDAL ){
+        output_image = GEO::IO::GDAL::load_multiband_image<ChannelType>( pathname );
+    }
+    else{
+        PlanarImage<PixelRGB<ChannelType> > image;
+        read_image( pathname, image );
+        output_image = MultibandImage<ChannelType>();
+        output_image.getBuffer() = image.getResource().getBuffer();
+    }
+}
+
 /**
  * Read a Disk Image
 */
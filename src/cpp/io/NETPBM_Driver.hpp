@@ -30,7 +30,7 @@ namespace NETPBM{
  * Write PGM Image
  */
 template <typename PixelType>
-void write_pgm_image( BaseResource<PixelType> const& data, 
+void write_pgm_image( ReadOnlyResource<PixelType> const& data, 
                       boost::filesystem::path const& filename ){
 
     // create some variables
@@ -64,7 +64,7 @@ void write_pgm_image( BaseResource<PixelType> const& data,
  * Write PPM Image
  */
 template <typename PixelType>
-void write_ppm_image( BaseResource<PixelType> const& data, 
+void write_ppm_image( ReadOnlyResource<PixelType> const& data, 
                       boost::filesystem::path const& filename ){
     
     // create some variables
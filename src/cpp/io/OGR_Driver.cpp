@@ -6,9 +6,11 @@
 #include "OGR_Driver.hpp"
 
 /// OGR Bindings
+#include <gdal_version.h>
 #include <ogr_spatialref.h>
 
 /// C++ Standard Libraries
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
@@ -23,6 +25,117 @@ OGR_Driver::OGR_Driver(){
 
 
 
+}
+
+/**
+ * Set a spatial reference to a coordinate frame
+*/
+static void set_frame( OGRSpatialReference& srs, CoordinateFrame const& frame ){
+
+    srs.SetWellKnownGeogCS( Datum2WKT_string( frame.datum ).c_str() );
+    if( frame.type == CoordinateType::UTM ){
+        srs.SetUTM( frame.zone, frame.north );
+    }
+
+    // keep longitude/easting as x regardless of the authority axis order
+#if GDAL_VERSION_MAJOR >= 3
+    srs.SetAxisMappingStrategy( OAMS_TRADITIONAL_GIS_ORDER );
+#endif
+}
+
+/**
+ * CoordinateTransformer Constructor
+*/
+CoordinateTransformer::CoordinateTransformer( CoordinateFrame const& source, CoordinateFrame const& target )
+  : m_source(source),
+    m_target(target),
+    m_transform(nullptr)
+{
+    // identical frames need no transformation
+    if( m_source == m_target ){
+        return;
+    }
+
+    OGRSpatialReference sourceSRS, targetSRS;
+    set_frame( sourceSRS, m_source );
+    set_frame( targetSRS, m_target );
+
+    m_transform = OGRCreateCoordinateTransformation( &sourceSRS, &targetSRS );
+    if( m_transform == NULL ){
+        throw std::runtime_error("error: Unable to create coordinate transformation.");
+    }
+}
+
+/**
+ * CoordinateTransformer Destructor
+*/
+CoordinateTransformer::~CoordinateTransformer(){
+    if( m_transform != NULL ){
+        OCTDestroyCoordinateTransformation( m_transform );
+    }
+}
+
+/**
+ * Transform points
+*/
+void CoordinateTransformer::transform( const size_t& count, double* x, double* y, double* z )const{
+
+    if( m_transform == NULL || count == 0 ){
+        return;
+    }
+
+    // OGR takes an int count, so very large arrays go in pieces
+    const size_t max_batch = 1 << 24;
+    for( size_t start=0; start<count; start += max_batch ){
+        const int batch = (int)std::min( max_batch, count - start );
+        if( !m_transform->Transform( batch, x + start, y + start, ( z == nullptr ) ? nullptr : z + start )){
+            throw std::runtime_error("error: Transform failed.");
+        }
+    }
+}
+
+/**
+ * Parse the frame of a spatial reference
+*/
+bool parse_coordinate_frame( std::string const& wkt, CoordinateFrame& frame ){
+
+    OGRSpatialReference srs;
+    std::string buffer = wkt;
+    char* ptr = &buffer[0];
+    if( wkt.empty() || srs.importFromWkt( &ptr ) != OGRERR_NONE ){
+        return false;
+    }
+
+    // datum
+    const char* datum_name = srs.GetAttrValue( "DATUM" );
+    const std::string datum = ( datum_name == NULL ) ? "" : datum_name;
+    if( datum == "WGS_1984" ){
+        frame.datum = Datum::WGS84;
+    } else if( datum == "North_American_Datum_1983" ){
+        frame.datum = Datum::NAD83;
+    } else {
+        return false;
+    }
+
+    // projection
+    if( srs.IsProjected() ){
+        int north = 1;
+        const int zone = srs.GetUTMZone( &north );
+        if( zone == 0 ){
+            return false;
+        }
+        frame.type  = CoordinateType::UTM;
+        frame.zone  = zone;
+        frame.north = ( north != 0 );
+        return true;
+    }
+    if( srs.IsGeographic() ){
+        frame.type = CoordinateType::Geodetic;
+        frame.zone = 0;
+        frame.north = true;
+        return true;
+    }
+    return false;
 }
 
 /**
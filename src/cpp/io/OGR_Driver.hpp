@@ -8,9 +8,19 @@
 
 /// GeoExplore Libraries
 #include <GeoExplore/core/Enumerations.hpp>
+#include <GeoExplore/coordinate/CoordinateFrame.hpp>
 #include <GeoExplore/coordinate/CoordinateUTM.hpp>
 #include <GeoExplore/coordinate/CoordinateGeodetic.hpp>
 
+/// C++ Standard Libraries
+#include <cstddef>
+#include <string>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// OGR Forward Declarations
+class OGRCoordinateTransformation;
 
 namespace GEO{
 namespace OGR{
@@ -32,6 +42,85 @@ class OGR_Driver {
 };  /// End of OGR_Driver Class
 
 
+/**
+ * @class CoordinateTransformer
+ *
+ * Transformation between two coordinate frames which is built once and
+ * applied to whole arrays of points.  Building the OGR transformation is
+ * far more expensive than applying it, so batches should reuse one
+ * transformer rather than converting coordinates one at a time.
+ *
+ * A transformer is not safe to use from several threads at once.
+*/
+class CoordinateTransformer {
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<CoordinateTransformer> ptr_t;
+
+        /**
+         * Constructor
+         *
+         * @param[in] source Frame of the input points.
+         * @param[in] target Frame of the output points.
+        */
+        CoordinateTransformer( CoordinateFrame const& source, CoordinateFrame const& target );
+
+        /**
+         * Destructor
+        */
+        ~CoordinateTransformer();
+
+        /**
+         * Get the source frame
+        */
+        CoordinateFrame const& source()const{ return m_source; }
+
+        /**
+         * Get the target frame
+        */
+        CoordinateFrame const& target()const{ return m_target; }
+
+        /**
+         * Transform points in place
+         *
+         * @param[in]     count Number of points.
+         * @param[in,out] x     Longitude or easting of each point.
+         * @param[in,out] y     Latitude or northing of each point.
+         * @param[in,out] z     Altitude of each point.  May be null.
+        */
+        void transform( const size_t& count, double* x, double* y, double* z = nullptr )const;
+
+    private:
+
+        /// Not copyable
+        CoordinateTransformer( CoordinateTransformer const& );
+        CoordinateTransformer& operator = ( CoordinateTransformer const& );
+
+        /// Source Frame
+        CoordinateFrame m_source;
+
+        /// Target Frame
+        CoordinateFrame m_target;
+
+        /// OGR Transformation.  Null when the frames are the same.
+        OGRCoordinateTransformation* m_transform;
+
+}; /// End of CoordinateTransformer Class
+
+
+/**
+ * Parse the frame of a spatial reference
+ *
+ * @param[in]  wkt   Well-known text of the spatial reference.
+ * @param[out] frame Frame of the spatial reference.
+ *
+ * @return False if the reference is neither geographic nor UTM.
+*/
+bool parse_coordinate_frame( std::string const& wkt, CoordinateFrame& frame );
+
+
 /**
  * Compute the UTM Zone Given the Longitude
  *
@@ -5,23 +5,120 @@
 */
 #include "OpenCV_Driver.hpp"
 
+/// C++ Standard Libraries
+#include <fstream>
+
 namespace GEO{
 namespace IO{
 namespace OPENCV{
 
 
+/**
+ * Compute the imread flags
+*/
+int compute_imread_flags( const int& channels, const int& depth, DecodeScale const& scale ){
+
+    // grayscale pixels let the decoder skip the chroma planes
+    int flags = cv::IMREAD_COLOR;
+    if( channels == 1 ){
+        flags = cv::IMREAD_GRAYSCALE;
+    }
+
+    // reduced decoding
+    switch( scale ){
+        case DecodeScale::FULL:
+            break;
+        case DecodeScale::HALF:
+            flags = ( channels == 1 ) ? cv::IMREAD_REDUCED_GRAYSCALE_2 : cv::IMREAD_REDUCED_COLOR_2;
+            break;
+        case DecodeScale::QUARTER:
+            flags = ( channels == 1 ) ? cv::IMREAD_REDUCED_GRAYSCALE_4 : cv::IMREAD_REDUCED_COLOR_4;
+            break;
+        case DecodeScale::EIGHTH:
+            flags = ( channels == 1 ) ? cv::IMREAD_REDUCED_GRAYSCALE_8 : cv::IMREAD_REDUCED_COLOR_8;
+            break;
+        default:
+            throw GEO::GeneralException("Unknown decode scale.", __FILE__, __LINE__);
+    }
+
+    // keep 16 bit samples if the pixel type can hold them
+    if( depth == CV_16U ){
+        flags |= cv::IMREAD_ANYDEPTH;
+    }
+
+    return flags;
+}
+
+/**
+ * Decode an image file
+*/
+void decode_image( boost::filesystem::path const& pathname,
+                   const int& flags,
+                   std::vector<uchar>& buffer,
+                   cv::Mat& image ){
+
+    // read the encoded file into the scratch buffer
+    std::ifstream fin( pathname.c_str(), std::ios::in | std::ios::binary );
+    if( fin.good() == false ){
+        throw GEO::GeneralException( std::string("Unable to open ") + pathname.native(), __FILE__, __LINE__);
+    }
+    fin.seekg( 0, std::ios::end );
+    std::streamoff length = fin.tellg();
+    fin.seekg( 0, std::ios::beg );
+    buffer.resize( (size_t)length );
+    if( length > 0 ){
+        fin.read( reinterpret_cast<char*>(&buffer[0]), length );
+    }
+    fin.close();
+
+    // decode into the existing matrix
+    cv::imdecode( buffer, flags, &image );
+    if( image.empty() ){
+        throw GEO::GeneralException( std::string("OpenCV could not decode ") + pathname.native(), __FILE__, __LINE__);
+    }
+}
+
+/**
+ * Default Constructor
+*/
+ImageDriverOpenCV::ImageDriverOpenCV() : m_flags(cv::IMREAD_COLOR){
+
+}
+
+/**
+ * Constructor given an image filename
+*/
+ImageDriverOpenCV::ImageDriverOpenCV( const boost::filesystem::path& pathname,
+                                      DecodeScale const& scale ) :
+                                            m_path(pathname),
+                                            m_flags(compute_imread_flags( 3, CV_8U, scale )){
+
+}
+
 /**
  * Get the rows
 */
-int ImageDriverOpenCV::rows()const{
-    return 0;
+int ImageDriverOpenCV::rows(){
+    if( isOpen() == false ){
+        if( boost::filesystem::exists( m_path ) == false ){
+            return 0;
+        }
+        open();
+    }
+    return m_image.rows;
 }
 
 /**
  * Get the columns
 */
-int ImageDriverOpenCV::cols()const{
-    return 0;
+int ImageDriverOpenCV::cols(){
+    if( isOpen() == false ){
+        if( boost::filesystem::exists( m_path ) == false ){
+            return 0;
+        }
+        open();
+    }
+    return m_image.cols;
 }
 
 /**
@@ -31,11 +128,24 @@ ImageDriverType ImageDriverOpenCV::type()const{
     return ImageDriverType::OPENCV;
 }
 
+/**
+ * Check if the driver is open
+*/
+bool ImageDriverOpenCV::isOpen()const{
+    return ( m_image.empty() == false );
+}
+
 /**
  * Open the driver
 */
 void ImageDriverOpenCV::open(){
 
+    // make sure the file exists
+    if( boost::filesystem::exists( m_path ) == false ){
+        throw std::runtime_error( std::string(m_path.native() + " does not exist.").c_str());
+    }
+
+    decode_image( m_path, m_flags, m_buffer, m_image );
 }
 
 /**
@@ -43,10 +153,25 @@ void ImageDriverOpenCV::open(){
 */
 void ImageDriverOpenCV::open( const boost::filesystem::path& pathname ){
 
+    m_path = pathname;
+    close();
+    open();
+}
+
+/**
+ * Close the driver
+*/
+void ImageDriverOpenCV::close(){
+    m_image.release();
+}
+
+/**
+ * Set the imread flags
+*/
+void ImageDriverOpenCV::setReadFlags( const int& flags ){
+    m_flags = flags;
 }
 
 } /// End of OpenCV Namespace
 } /// End of IO Namespace
 } /// End of GEO Namespace
-
-
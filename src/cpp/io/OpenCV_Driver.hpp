@@ -6,22 +6,51 @@
 #ifndef __SRC_CPP_IO_OPENCVDRIVER_HPP__
 #define __SRC_CPP_IO_OPENCVDRIVER_HPP__
 
+/// C++ Standard Libraries
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
 /// GeoExplore Libraries
 #include <GeoExplore/core/Enumerations.hpp>
+#include <GeoExplore/core/Exceptions.hpp>
 #include <GeoExplore/image/ChannelType.hpp>
 #include <GeoExplore/image/Image.hpp>
+#include <GeoExplore/image/MemoryResource.hpp>
 #include <GeoExplore/image/PixelCast.hpp>
 #include <GeoExplore/image/PixelGray.hpp>
 #include <GeoExplore/image/PixelRGB.hpp>
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/io/ImageDriverBase.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
 
 /// OpenCV Libraries
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
 
 namespace GEO{
 namespace IO{
 namespace OPENCV{
 
+/**
+ * @class DecodeScale
+ *
+ * Resolution to decode an image at.  The JPEG decoder skips the
+ * unneeded DCT coefficients for reduced scales, which makes thumbnail
+ * reads several times faster than decoding and resizing.
+*/
+enum class DecodeScale{
+    FULL    = 1,
+    HALF    = 2,
+    QUARTER = 4,
+    EIGHTH  = 8,
+}; /// End of DecodeScale Enumeration
+
 /**
  * Generic Conversion Definition between 3d points and opencv points
 */
@@ -40,7 +69,7 @@ struct Pixel2OpenCVType<PixelGray_d>{
     static void Pix2CV( PixelGray_d const& input, cvtype& output ){
         output = input[0];
     }
-}; 
+};
 
 /**
  * Convert from RGB Double to Vec3d
@@ -54,7 +83,7 @@ struct Pixel2OpenCVType<PixelRGB_d>{
         output[1] = input[1];
         output[2] = input[0];
     }
-}; 
+};
 
 /**
  * Convert from RGB UInt8 to Vec3b
@@ -68,48 +97,206 @@ struct Pixel2OpenCVType<PixelRGB_u8>{
         output[1] = input[1];
         output[2] = input[0];
     }
-}; 
+};
+
+/**
+ * Return the OpenCV matrix type the driver decodes into for a pixel type.
+ *
+ * JPEG and PNG store 8 or 16 bit samples, so 12 to 16 bit channel types
+ * request 16 bit decoding and everything else uses 8 bit samples.
+*/
+template <typename PixelType>
+int PixelType2OpenCVType(){
+
+    typedef typename PixelType::channeltype::type datatype;
+    const int depth = ( std::is_integral<datatype>::value && sizeof(datatype) == 2 ) ? CV_16U : CV_8U;
+    return CV_MAKETYPE( depth, PixelType().dims() );
+}
+
+/**
+ * Compute the imread flags for the requested channel count, depth and scale
+*/
+int compute_imread_flags( const int& channels, const int& depth, DecodeScale const& scale );
+
+/**
+ * Decode an image file into an OpenCV matrix.
+ *
+ * The file buffer and matrix are reused when they are already large enough,
+ * so decoding many files on one thread does not reallocate.
+ *
+ * @param[in]     pathname Image to decode.
+ * @param[in]     flags    imread flags.
+ * @param[in,out] buffer   Scratch buffer for the encoded file.
+ * @param[in,out] image    Decoded image.
+*/
+void decode_image( boost::filesystem::path const& pathname,
+                   const int& flags,
+                   std::vector<uchar>& buffer,
+                   cv::Mat& image );
+
+/**
+ * Copy one decoded channel row into the pixel buffer
+*/
+template <typename PixelType, typename CVDataType, typename SourceChannelType>
+void copy_mat_row( const CVDataType* src,
+                   PixelType* dst,
+                   const int& cols,
+                   const int& mat_channels,
+                   const typename PixelType::channeltype::type* lut ){
 
+    typedef typename PixelType::channeltype OutputChannelType;
+    const int pixel_channels = PixelType().dims();
+
+    for( int c=0; c<cols; c++ ){
+        const CVDataType* spx = src + c*mat_channels;
+        PixelType& dpx = dst[c];
+        for( int ch=0; ch<pixel_channels; ch++ ){
+
+            // OpenCV stores color as BGR
+            const int sch = ( mat_channels >= 3 && ch < 3 ) ? (2-ch) : std::min( ch, mat_channels-1 );
+
+            if( lut != nullptr ){
+                dpx[ch] = lut[spx[sch]];
+            } else {
+                dpx[ch] = range_cast<SourceChannelType,OutputChannelType>( spx[sch] );
+            }
+        }
+    }
+}
 
 /**
- * @class ImageDriverOpenCV 
+ * Copy a decoded OpenCV matrix into a pre-allocated pixel buffer
+ *
+ * @param[in]  image  Decoded image (CV_8U or CV_16U).
+ * @param[out] pixels Destination buffer with image.rows*image.cols pixels.
+*/
+template <typename PixelType>
+void copy_mat_to_pixels( cv::Mat const& image, PixelType* pixels ){
+
+    typedef typename PixelType::channeltype OutputChannelType;
+    typedef typename OutputChannelType::type datatype;
+
+    // single channel pixels take the luminance of color images
+    if( PixelType().dims() == 1 && image.channels() >= 3 ){
+        cv::Mat gray;
+        cv::cvtColor( image, gray, ( image.channels() == 4 ) ? cv::COLOR_BGRA2GRAY : cv::COLOR_BGR2GRAY );
+        copy_mat_to_pixels( gray, pixels );
+        return;
+    }
+
+    const int rows = image.rows;
+    const int cols = image.cols;
+    const int mat_channels = image.channels();
+
+    if( image.depth() == CV_8U ){
+
+        // build a lookup table so each sample costs a single load
+        datatype lut[256];
+        for( int i=0; i<256; i++ ){
+            if( std::is_same<OutputChannelType,ChannelTypeUInt8>::value ){
+                lut[i] = i;
+            } else {
+                lut[i] = range_cast<ChannelTypeUInt8,OutputChannelType>( i );
+            }
+        }
+        for( int r=0; r<rows; r++ ){
+            copy_mat_row<PixelType,uchar,ChannelTypeUInt8>( image.ptr<uchar>(r), pixels + (size_t)r*cols, cols, mat_channels, lut );
+        }
+    }
+    else if( image.depth() == CV_16U ){
+        for( int r=0; r<rows; r++ ){
+            copy_mat_row<PixelType,ushort,ChannelTypeUInt16>( image.ptr<ushort>(r), pixels + (size_t)r*cols, cols, mat_channels, nullptr );
+        }
+    }
+    else{
+        throw GEO::GeneralException("Unsupported OpenCV image depth.", __FILE__, __LINE__);
+    }
+}
+
+
+/**
+ * @class ImageDriverOpenCV
 */
 class ImageDriverOpenCV : public ImageDriverBase {
 
     public:
-        
+
+        /// Pointer Type
+        typedef boost::shared_ptr<ImageDriverOpenCV> ptr_t;
+
+        /**
+         * Default Constructor
+        */
+        ImageDriverOpenCV();
+
+        /**
+         * Constructor given an image filename
+        */
+        ImageDriverOpenCV( const boost::filesystem::path& pathname,
+                           DecodeScale const& scale = DecodeScale::FULL );
+
         /**
          * Get the pixel value
         */
         template <typename PixelType>
-        PixelType getPixel( const int& x, const int& y )const{
-            return PixelType();
+        PixelType getPixel( const int& x, const int& y ){
+
+            // make sure the driver is open
+            if( isOpen() == false ){
+                open();
+            }
+
+            PixelType output;
+            copy_mat_row_pixel( m_image, x, y, output );
+            return output;
+        }
+
+        /**
+         * Decode the image into a pre-allocated pixel buffer
+         *
+         * @param[out] image_data      Pixel buffer.
+         * @param[in]  image_data_size Number of pixels in the buffer. Must equal rows()*cols().
+        */
+        template <typename PixelType>
+        void getPixels( boost::shared_ptr<PixelType[]>& image_data, const int& image_data_size ){
+
+            // make sure the driver is open
+            if( isOpen() == false ){
+                open();
+            }
+
+            // make sure the buffer is properly sized
+            if( image_data_size != (rows()*cols())){
+                throw GEO::GeneralException("Error: image data must be pre-allocated to the required size.", __FILE__, __LINE__);
+            }
+
+            copy_mat_to_pixels( m_image, image_data.get() );
         }
-    
+
         /**
          * Get the number of rows
         */
-        virtual int rows()const;
+        virtual int rows();
 
         /**
          * Get the number of columns
         */
-        virtual int cols()const;
+        virtual int cols();
 
         /**
          * Get the image driver type
         */
         virtual ImageDriverType type()const;
-        
+
         /**
          * Write an image to file
         */
         template <typename PixelType, typename ResourceType>
         static void write_image( Image_<PixelType,ResourceType>const& output_image, boost::filesystem::path const& pathname ){
-            
+
             // convert the output image to an opencv structure
             cv::Mat_<cv::Vec3b> image( output_image.rows(), output_image.cols());
-    
+
             // start loading the output image
             for( size_t y=0; y<output_image.rows(); y++ ){
             for( size_t x=0; x<output_image.cols(); x++ ){
@@ -119,9 +306,16 @@ class ImageDriverOpenCV : public ImageDriverBase {
             // run imwrite
             cv::imwrite( pathname.c_str(), image );
         }
-        
+
+        /**
+         * Check if the driver is open
+        */
+        bool isOpen()const;
+
         /**
          * Open the driver
+         *
+         * This decodes the image using the flags set by setReadFlags.
         */
         void open();
 
@@ -129,14 +323,204 @@ class ImageDriverOpenCV : public ImageDriverBase {
          * Open the driver given an image filename
         */
         void open( const boost::filesystem::path& pathname );
+
+        /**
+         * Release the decoded image
+        */
+        void close();
+
+        /**
+         * Set the imread flags used by open
+        */
+        void setReadFlags( const int& flags );
+
     private:
-        
-        /// open the file
 
+        /**
+         * Copy a single decoded pixel
+        */
+        template <typename PixelType>
+        static void copy_mat_row_pixel( cv::Mat const& image, const int& x, const int& y, PixelType& output ){
+
+            // single channel pixels take the luminance of color images
+            if( PixelType().dims() == 1 && image.channels() >= 3 ){
+                copy_mat_to_pixels( image( cv::Rect( x, y, 1, 1 )), &output );
+                return;
+            }
+
+            if( image.depth() == CV_8U ){
+                copy_mat_row<PixelType,uchar,ChannelTypeUInt8>( image.ptr<uchar>(y) + x*image.channels(), &output, 1, image.channels(), nullptr );
+            } else {
+                copy_mat_row<PixelType,ushort,ChannelTypeUInt16>( image.ptr<ushort>(y) + x*image.channels(), &output, 1, image.channels(), nullptr );
+            }
+        }
+
+        /// Image filename
+        boost::filesystem::path m_path;
+
+        /// imread flags
+        int m_flags;
+
+        /// Decoded image
+        cv::Mat m_image;
+
+        /// Encoded file buffer
+        std::vector<uchar> m_buffer;
 
 }; /// End of ImageDriverOpenCV Class
 
 
+/**
+ * Decode an image directly into a memory resource.
+ *
+ * If the resource already has the decoded size and does not share its
+ * buffer, the pixels are written in place and no allocation occurs.
+ *
+ * @param[in]     pathname Image to decode.
+ * @param[in,out] resource Destination resource.
+ * @param[in]     scale    Decode scale.
+ * @param[in,out] buffer   Scratch buffer for the encoded file.
+ * @param[in,out] image    Scratch decoded image.
+*/
+template <typename PixelType>
+void load_image( boost::filesystem::path const& pathname,
+                 MemoryResource<PixelType>&     resource,
+                 DecodeScale const&             scale,
+                 std::vector<uchar>&            buffer,
+                 cv::Mat&                       image ){
+
+    // decode using the native channel layout for the pixel type
+    const int cvtype = PixelType2OpenCVType<PixelType>();
+    decode_image( pathname,
+                  compute_imread_flags( CV_MAT_CN(cvtype), CV_MAT_DEPTH(cvtype), scale ),
+                  buffer,
+                  image );
+
+    // reuse the destination buffer when possible
+    boost::shared_ptr<PixelType[]> pixels = resource.getPixelData();
+    if( pixels == nullptr ||
+        resource.rows() != image.rows ||
+        resource.cols() != image.cols ||
+        pixels.use_count() > 2 ){
+        pixels = allocate_pixels<PixelType>( (size_t)image.rows * image.cols, resource.getAllocator() );
+    }
+
+    // convert into the destination
+    copy_mat_to_pixels( image, pixels.get() );
+    resource.setPixelData( pixels, image.rows, image.cols );
+}
+
+/**
+ * Load an image and return a resource
+*/
+template <typename PixelType>
+MemoryResource<PixelType> load_image( boost::filesystem::path const& pathname,
+                                      DecodeScale const& scale = DecodeScale::FULL ){
+
+    MemoryResource<PixelType> output;
+    std::vector<uchar> buffer;
+    cv::Mat image;
+    load_image( pathname, output, scale, buffer, image );
+    return output;
+}
+
+/**
+ * Load a window of an image and return a resource
+ *
+ * JPEG and PNG files cannot be decoded partially, so the image is decoded
+ * and then cropped.  Overview levels 1 to 3 use reduced decoding, and
+ * higher levels are area-averaged from the eighth scale decode.
+ *
+ * @param[in] pathname       Image to read.
+ * @param[in] window         Window in full resolution pixel coordinates.
+ * @param[in] overview_level Overview level. 0 is full resolution.
+*/
+template <typename PixelType>
+MemoryResource<PixelType> load_image( boost::filesystem::path const& pathname,
+                                      Rect const& window,
+                                      const int& overview_level = 0 ){
+
+    // decode at the closest reduced scale
+    const int decode_level = std::min( overview_level, 3 );
+    const int cvtype = PixelType2OpenCVType<PixelType>();
+    std::vector<uchar> buffer;
+    cv::Mat image;
+    decode_image( pathname,
+                  compute_imread_flags( CV_MAT_CN(cvtype), CV_MAT_DEPTH(cvtype), (DecodeScale)(1 << decode_level) ),
+                  buffer,
+                  image );
+
+    // make sure the window is inside the full resolution image
+    const int full_rows = image.rows << decode_level;
+    const int full_cols = image.cols << decode_level;
+    if( window.empty() || window.inside( full_rows, full_cols ) == false ){
+        throw GEO::GeneralException("Error: window lies outside of the image.", __FILE__, __LINE__);
+    }
+
+    // crop the decoded image
+    const int dscale = 1 << decode_level;
+    cv::Rect roi( window.x() / dscale, 
+                  window.y() / dscale,
+                  ( window.width()  + dscale - 1 ) / dscale,
+                  ( window.height() + dscale - 1 ) / dscale );
+    roi &= cv::Rect( 0, 0, image.cols, image.rows );
+    cv::Mat cropped = image( roi );
+
+    // reduce the remaining levels
+    if( overview_level > decode_level ){
+        const int scale = 1 << overview_level;
+        cv::Mat reduced;
+        cv::resize( cropped, reduced,
+                    cv::Size( ( window.width()  + scale - 1 ) / scale,
+                              ( window.height() + scale - 1 ) / scale ),
+                    0, 0, cv::INTER_AREA );
+        cropped = reduced;
+    }
+
+    // convert
+    boost::shared_ptr<PixelType[]> pixels = allocate_pixels<PixelType>( (size_t)cropped.rows * cropped.cols );
+    copy_mat_to_pixels( cropped, pixels.get() );
+
+    MemoryResource<PixelType> output;
+    output.setPixelData( pixels, cropped.rows, cropped.cols );
+    return output;
+}
+
+/**
+ * Decode a list of images in parallel.
+ *
+ * Each worker keeps its own file buffer and decoded matrix, so after the
+ * first file per thread no intermediate allocations occur.
+ *
+ * @param[in]  pathnames   Images to decode.
+ * @param[out] resources   Decoded resources, one per pathname.
+ * @param[in]  scale       Decode scale.
+ * @param[in]  num_threads Number of threads. Values <= 0 use the hardware concurrency.
+*/
+template <typename PixelType>
+void load_images( std::vector<boost::filesystem::path> const& pathnames,
+                  std::vector<MemoryResource<PixelType> >&    resources,
+                  DecodeScale const& scale = DecodeScale::FULL,
+                  const int& num_threads = 0 ){
+
+    // size the output
+    resources.resize( pathnames.size() );
+
+    // create per-thread scratch space
+    int thread_count = num_threads;
+    if( thread_count <= 0 ){
+        thread_count = default_thread_count();
+    }
+    std::vector<std::vector<uchar> > buffers( thread_count );
+    std::vector<cv::Mat> images( thread_count );
+
+    // decode
+    parallel_for( 0, pathnames.size(), [&]( const size_t& idx, const int& thread_id ){
+        load_image( pathnames[idx], resources[idx], scale, buffers[thread_id], images[thread_id] );
+    }, thread_count );
+}
+
+
 } /// End of OpenCV Namespace
 } /// End of IO Namespace
 } /// End of GEO Namespace
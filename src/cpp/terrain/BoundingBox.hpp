@@ -0,0 +1,56 @@
+/**
+ * @file    BoundingBox.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_BOUNDINGBOX_HPP__
+#define __SRC_CPP_TERRAIN_BOUNDINGBOX_HPP__
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * @class BoundingBox
+ *
+ * Axis aligned box in grid meters, x east, y up and z south.
+*/
+class BoundingBox{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        BoundingBox(){
+            lower[0] = lower[1] = lower[2] = 0;
+            upper[0] = upper[1] = upper[2] = 0;
+        }
+
+        /**
+         * Compute the distance from a point to the box, 0 inside
+        */
+        double distance( const double point[3] )const{
+            double sum = 0;
+            for( int k=0; k<3; k++ ){
+                const double d = std::max( std::max( lower[k] - point[k], point[k] - upper[k] ), 0.0 );
+                sum += d * d;
+            }
+            return std::sqrt( sum );
+        }
+
+        /// Smallest corner
+        double lower[3];
+
+        /// Largest corner
+        double upper[3];
+
+}; /// End of BoundingBox Class
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,210 @@
+/**
+ * @file    ElevationGrid.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_ELEVATIONGRID_HPP__
+#define __SRC_CPP_TERRAIN_ELEVATIONGRID_HPP__
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/image/Image.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/// Meters per degree of arc on the WGS84 equator
+const double METERS_PER_DEGREE = 111319.49079327357;
+
+/**
+ * @class ElevationGrid
+ *
+ * Regular grid of elevation postings in meters.  Posts are stored
+ * row-major, row 0 being the northern edge.
+*/
+class ElevationGrid{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<ElevationGrid> ptr_t;
+
+        /**
+         * Default Constructor
+        */
+        ElevationGrid() : rows(0), cols(0), spacing_x(1), spacing_y(1){}
+
+        /**
+         * Parameterized Constructor
+         *
+         * @param[in] rows_      Number of posting rows.
+         * @param[in] cols_      Number of posting columns.
+         * @param[in] spacing_x_ Distance between columns in meters.
+         * @param[in] spacing_y_ Distance between rows in meters.
+        */
+        ElevationGrid( const int& rows_, const int& cols_, const double& spacing_x_ = 1, const double& spacing_y_ = 1 )
+                        : rows(rows_),
+                          cols(cols_),
+                          spacing_x(spacing_x_),
+                          spacing_y(spacing_y_),
+                          heights( (size_t)rows_ * cols_, 0 ){}
+
+        /**
+         * Get a posting
+        */
+        float operator()( const int& x, const int& y )const{
+            return heights[ (size_t)y * cols + x ];
+        }
+
+        /**
+         * Get a posting reference
+        */
+        float& operator()( const int& x, const int& y ){
+            return heights[ (size_t)y * cols + x ];
+        }
+
+        /**
+         * Get a posting, clamping the position to the grid
+        */
+        float clamped( const int& x, const int& y )const{
+            return (*this)( std::min( std::max( x, 0 ), cols - 1 ),
+                            std::min( std::max( y, 0 ), rows - 1 ));
+        }
+
+        /// Number of posting rows
+        int rows;
+
+        /// Number of posting columns
+        int cols;
+
+        /// Distance between columns in meters
+        double spacing_x;
+
+        /// Distance between rows in meters
+        double spacing_y;
+
+        /// Postings
+        std::vector<float> heights;
+
+}; /// End of ElevationGrid Class
+
+
+/**
+ * Fill the NaN postings of a line of the grid
+ *
+ * Each run of NaN postings is interpolated between the valid postings on
+ * either side, or takes the value of the one valid neighbor at the ends
+ * of the line.  Lines without a valid posting are left alone.
+ *
+ * @param[in,out] values First posting of the line.
+ * @param[in]     count  Number of postings.
+ * @param[in]     stride Distance between postings.
+*/
+inline void fill_void_line( float* values, const int& count, const size_t& stride ){
+
+    int previous = -1;
+    for( int i=0; i<=count; i++ ){
+        if( i < count && std::isnan( values[i*stride] )){
+            continue;
+        }
+
+        // fill the run between the previous valid posting and this one
+        if( i - previous > 1 && ( previous >= 0 || i < count )){
+            const float first = ( previous >= 0 ) ? values[previous*stride] : values[i*stride];
+            const float last  = ( i < count ) ? values[i*stride] : first;
+            for( int j=previous+1; j<i; j++ ){
+                const float t = (float)( j - previous ) / ( i - previous );
+                values[j*stride] = ( previous >= 0 && i < count ) ? first + t * ( last - first ) : first;
+            }
+        }
+        previous = i;
+    }
+}
+
+
+/**
+ * Build an elevation grid from a DEM image
+ *
+ * Post spacing comes from the image geotransform.  Geographic spacing is
+ * converted to meters at the center latitude, which is accurate enough for
+ * the extent of a single DEM.  Images without a geotransform get a spacing
+ * of one meter.
+ *
+ * Voids, postings which are not finite or equal the no-data value in the
+ * image metadata, are filled along their row, or along their column for
+ * rows without data, so they leave no cliffs in the mesh or the quadtree
+ * bounds.  A grid without any data is 0.
+ *
+ * @param[in] dem     Single band elevation image.
+ * @param[in] threads Number of threads.  Values <= 0 use the default.
+*/
+template <typename PixelType, typename ResourceType>
+ElevationGrid::ptr_t make_elevation_grid( Image_<PixelType,ResourceType> const& dem,
+                                          const int& threads = 0 ){
+
+    ElevationGrid::ptr_t output( new ElevationGrid( dem.rows(), dem.cols() ));
+
+    // spacing from the geotransform
+    GeoTransform const& geotransform = dem.getGeoTransform();
+    if( geotransform.isValid() ){
+        output->spacing_x = std::sqrt( geotransform[1] * geotransform[1] + geotransform[4] * geotransform[4] );
+        output->spacing_y = std::sqrt( geotransform[2] * geotransform[2] + geotransform[5] * geotransform[5] );
+        if( geotransform.getFrame().type == CoordinateType::Geodetic ){
+            const double latitude = geotransform[3] + 0.5 * ( dem.cols() * geotransform[4] + dem.rows() * geotransform[5] );
+            output->spacing_x *= METERS_PER_DEGREE * std::cos( latitude * M_PI / 180.0 );
+            output->spacing_y *= METERS_PER_DEGREE;
+        }
+    }
+
+    // no-data value from the file
+    double nodata = std::numeric_limits<double>::quiet_NaN();
+    const bool has_nodata = ( dem.getMetadata() != nullptr && dem.getMetadata()->getNoDataValue( nodata ));
+
+    // copy the postings, marking voids with NaN
+    ElevationGrid& grid = *output;
+    std::atomic<bool> voids( false );
+    parallel_for( 0, dem.rows(), [&]( const size_t& row, const int& /*thread_id*/ ){
+        bool row_voids = false;
+        for( int col=0; col<grid.cols; col++ ){
+            const double value = dem( row, col )[0];
+            const bool is_void = ( std::isfinite( value ) == false || ( has_nodata && value == nodata ));
+            grid( col, row ) = is_void ? std::numeric_limits<float>::quiet_NaN() : (float)value;
+            row_voids = row_voids || is_void;
+        }
+        if( row_voids ){
+            voids = true;
+        }
+    }, threads, 16 );
+
+    // fill the voids along rows, then columns, then give up
+    if( voids ){
+        parallel_for( 0, grid.rows, [&]( const size_t& row, const int& /*thread_id*/ ){
+            fill_void_line( &grid( 0, row ), grid.cols, 1 );
+        }, threads, 16 );
+        parallel_for( 0, grid.cols, [&]( const size_t& col, const int& /*thread_id*/ ){
+            fill_void_line( &grid( col, 0 ), grid.rows, grid.cols );
+        }, threads, 16 );
+        for( size_t i=0; i<grid.heights.size(); i++ ){
+            if( std::isnan( grid.heights[i] )){
+                grid.heights[i] = 0;
+            }
+        }
+    }
+
+    return output;
+}
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
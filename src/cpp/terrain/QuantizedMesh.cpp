@@ -0,0 +1,329 @@
+/**
+ * @file    QuantizedMesh.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "QuantizedMesh.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+/// zlib
+#include <zlib.h>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/// Compressed mesh signature and version
+static const char     MESH_MAGIC[4] = { 'G', 'X', 'Q', 'M' };
+static const uint32_t MESH_VERSION  = 1;
+
+/**
+ * Sign which treats zero as positive
+*/
+static float sign_of( const float& value ){
+    return ( value < 0 ) ? -1.f : 1.f;
+}
+
+/**
+ * Encode a unit normal on an octahedron
+*/
+void oct_encode( const float normal[3], int8_t output[2] ){
+
+    // y is the pole, since terrain normals mostly point up
+    const float l1 = std::fabs( normal[0] ) + std::fabs( normal[1] ) + std::fabs( normal[2] );
+    float u = normal[0] / l1;
+    float v = normal[2] / l1;
+    if( normal[1] < 0 ){
+        const float fu = ( 1 - std::fabs( v )) * sign_of( u );
+        const float fv = ( 1 - std::fabs( u )) * sign_of( v );
+        u = fu;
+        v = fv;
+    }
+    output[0] = (int8_t)std::lround( std::max( -1.f, std::min( u, 1.f )) * 127 );
+    output[1] = (int8_t)std::lround( std::max( -1.f, std::min( v, 1.f )) * 127 );
+}
+
+/**
+ * Decode an octahedron encoded normal
+*/
+void oct_decode( const int8_t encoded[2], float output[3] ){
+
+    float u = encoded[0] / 127.f;
+    float v = encoded[1] / 127.f;
+    const float y = 1 - std::fabs( u ) - std::fabs( v );
+    if( y < 0 ){
+        const float fu = ( 1 - std::fabs( v )) * sign_of( u );
+        const float fv = ( 1 - std::fabs( u )) * sign_of( v );
+        u = fu;
+        v = fv;
+    }
+    const float length = std::sqrt( u * u + y * y + v * v );
+    output[0] = u / length;
+    output[1] = y / length;
+    output[2] = v / length;
+}
+
+/**
+ * Quantize a mesh
+*/
+QuantizedMesh quantize_mesh( TerrainMesh const& mesh ){
+
+    if( mesh.vertices.size() > (size_t)QUANTIZED_MAX + 1 ){
+        throw GeneralException("Mesh has too many vertices for 16-bit indices.", __FILE__, __LINE__);
+    }
+
+    QuantizedMesh output;
+    output.window     = mesh.window;
+    output.step       = mesh.step;
+    output.min_height = mesh.min_height;
+    output.max_height = mesh.max_height;
+    std::copy( mesh.origin, mesh.origin + 3, output.origin );
+
+    // per-mesh bounds
+    float lower[3] = {  std::numeric_limits<float>::max(),  std::numeric_limits<float>::max(),  std::numeric_limits<float>::max() };
+    float upper[3] = { -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max() };
+    for( size_t i=0; i<mesh.vertices.size(); i++ ){
+        for( int k=0; k<3; k++ ){
+            lower[k] = std::min( lower[k], mesh.vertices[i].position[k] );
+            upper[k] = std::max( upper[k], mesh.vertices[i].position[k] );
+        }
+    }
+    for( int k=0; k<3 && mesh.vertices.empty() == false; k++ ){
+        output.offset[k] = lower[k];
+        output.scale[k]  = ( upper[k] > lower[k] ) ? ( upper[k] - lower[k] ) / QUANTIZED_MAX : 1.f;
+    }
+
+    output.vertices.resize( mesh.vertices.size() );
+    for( size_t i=0; i<mesh.vertices.size(); i++ ){
+        for( int k=0; k<3; k++ ){
+            const long q = std::lround( ( mesh.vertices[i].position[k] - output.offset[k] ) / output.scale[k] );
+            output.vertices[i].position[k] = (uint16_t)std::max( 0L, std::min( q, (long)QUANTIZED_MAX ));
+        }
+        oct_encode( mesh.vertices[i].normal, output.vertices[i].normal );
+    }
+    output.indices.assign( mesh.indices.begin(), mesh.indices.end() );
+    return output;
+}
+
+/**
+ * Expand a quantized mesh back to floats
+*/
+TerrainMesh dequantize_mesh( QuantizedMesh const& mesh ){
+
+    TerrainMesh output;
+    output.window     = mesh.window;
+    output.step       = mesh.step;
+    output.min_height = mesh.min_height;
+    output.max_height = mesh.max_height;
+    std::copy( mesh.origin, mesh.origin + 3, output.origin );
+
+    output.vertices.resize( mesh.vertices.size() );
+    for( size_t i=0; i<mesh.vertices.size(); i++ ){
+        TerrainVertex& vertex = output.vertices[i];
+        for( int k=0; k<3; k++ ){
+            vertex.position[k] = mesh.offset[k] + mesh.vertices[i].position[k] * mesh.scale[k];
+        }
+        oct_decode( mesh.vertices[i].normal, vertex.normal );
+        vertex.uv[0] = mesh.vertices[i].position[0] / (float)QUANTIZED_MAX;
+        vertex.uv[1] = mesh.vertices[i].position[2] / (float)QUANTIZED_MAX;
+    }
+    output.indices.assign( mesh.indices.begin(), mesh.indices.end() );
+    return output;
+}
+
+/**
+ * Append a plain value
+*/
+template <typename ValueType>
+static void put( std::vector<uint8_t>& output, ValueType const& value ){
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>( &value );
+    output.insert( output.end(), bytes, bytes + sizeof(ValueType) );
+}
+
+/**
+ * Read a plain value
+*/
+template <typename ValueType>
+static ValueType get( const uint8_t* input, const size_t& size, size_t& pos ){
+    if( pos + sizeof(ValueType) > size ){
+        throw GeneralException("Compressed mesh is truncated.", __FILE__, __LINE__);
+    }
+    ValueType value;
+    std::memcpy( &value, &input[pos], sizeof(ValueType) );
+    pos += sizeof(ValueType);
+    return value;
+}
+
+/**
+ * Append a zigzag varint
+*/
+static void put_delta( std::vector<uint8_t>& output, const int32_t& delta ){
+    uint32_t value = ( (uint32_t)delta << 1 ) ^ (uint32_t)( delta >> 31 );
+    while( value >= 0x80 ){
+        output.push_back( (uint8_t)( value | 0x80 ));
+        value >>= 7;
+    }
+    output.push_back( (uint8_t)value );
+}
+
+/**
+ * Read a zigzag varint
+*/
+static int32_t get_delta( const uint8_t* input, const size_t& size, size_t& pos ){
+    uint32_t value = 0;
+    for( int shift=0; shift<35; shift+=7 ){
+        if( pos >= size ){
+            throw GeneralException("Compressed mesh is truncated.", __FILE__, __LINE__);
+        }
+        const uint8_t byte = input[pos++];
+        value |= (uint32_t)( byte & 0x7f ) << shift;
+        if( ( byte & 0x80 ) == 0 ){
+            return (int32_t)( value >> 1 ) ^ -(int32_t)( value & 1 );
+        }
+    }
+    throw GeneralException("Compressed mesh is corrupt.", __FILE__, __LINE__);
+}
+
+/**
+ * Compress a quantized mesh
+*/
+std::vector<uint8_t> compress_mesh( QuantizedMesh const& mesh ){
+
+    // delta coded streams
+    std::vector<uint8_t> streams;
+    for( int k=0; k<3; k++ ){
+        int32_t previous = 0;
+        for( size_t i=0; i<mesh.vertices.size(); i++ ){
+            put_delta( streams, (int32_t)mesh.vertices[i].position[k] - previous );
+            previous = mesh.vertices[i].position[k];
+        }
+    }
+    for( int k=0; k<2; k++ ){
+        for( size_t i=0; i<mesh.vertices.size(); i++ ){
+            streams.push_back( (uint8_t)mesh.vertices[i].normal[k] );
+        }
+    }
+    int32_t previous = 0;
+    for( size_t i=0; i<mesh.indices.size(); i++ ){
+        put_delta( streams, (int32_t)mesh.indices[i] - previous );
+        previous = mesh.indices[i];
+    }
+
+    // header
+    std::vector<uint8_t> output( MESH_MAGIC, MESH_MAGIC + 4 );
+    put( output, MESH_VERSION );
+    put( output, (int32_t)mesh.window.x() );
+    put( output, (int32_t)mesh.window.y() );
+    put( output, (int32_t)mesh.window.width() );
+    put( output, (int32_t)mesh.window.height() );
+    put( output, (int32_t)mesh.step );
+    for( int k=0; k<3; k++ ){ put( output, mesh.origin[k] ); }
+    for( int k=0; k<3; k++ ){ put( output, mesh.offset[k] ); }
+    for( int k=0; k<3; k++ ){ put( output, mesh.scale[k] ); }
+    put( output, mesh.min_height );
+    put( output, mesh.max_height );
+    put( output, (uint32_t)mesh.vertices.size() );
+    put( output, (uint32_t)mesh.indices.size() );
+    put( output, (uint32_t)streams.size() );
+
+    // deflate the streams after the header
+    const size_t header = output.size();
+    uLongf packed = compressBound( streams.size() );
+    output.resize( header + packed );
+    if( compress2( &output[header], &packed, streams.data(), streams.size(), Z_BEST_SPEED ) != Z_OK ){
+        throw GeneralException("Unable to compress mesh.", __FILE__, __LINE__);
+    }
+    output.resize( header + packed );
+    return output;
+}
+
+/**
+ * Decompress a quantized mesh
+*/
+QuantizedMesh decompress_mesh( std::vector<uint8_t> const& bytes ){
+    return decompress_mesh( bytes.data(), bytes.size() );
+}
+
+/**
+ * Decompress a quantized mesh in place
+*/
+QuantizedMesh decompress_mesh( const uint8_t* bytes, const size_t& size ){
+
+    if( size < 4 || std::memcmp( bytes, MESH_MAGIC, 4 ) != 0 ){
+        throw GeneralException("Not a compressed mesh.", __FILE__, __LINE__);
+    }
+    size_t pos = 4;
+    if( get<uint32_t>( bytes, size, pos ) != MESH_VERSION ){
+        throw GeneralException("Unsupported compressed mesh version.", __FILE__, __LINE__);
+    }
+
+    QuantizedMesh output;
+    const int x = get<int32_t>( bytes, size, pos );
+    const int y = get<int32_t>( bytes, size, pos );
+    const int w = get<int32_t>( bytes, size, pos );
+    const int h = get<int32_t>( bytes, size, pos );
+    output.window = Rect( x, y, w, h );
+    output.step   = get<int32_t>( bytes, size, pos );
+    for( int k=0; k<3; k++ ){ output.origin[k] = get<double>( bytes, size, pos ); }
+    for( int k=0; k<3; k++ ){ output.offset[k] = get<float>( bytes, size, pos ); }
+    for( int k=0; k<3; k++ ){ output.scale[k]  = get<float>( bytes, size, pos ); }
+    output.min_height = get<float>( bytes, size, pos );
+    output.max_height = get<float>( bytes, size, pos );
+    const uint32_t vertex_count = get<uint32_t>( bytes, size, pos );
+    const uint32_t index_count  = get<uint32_t>( bytes, size, pos );
+    const uint32_t stream_size  = get<uint32_t>( bytes, size, pos );
+    if( vertex_count > (uint32_t)QUANTIZED_MAX + 1 ){
+        throw GeneralException("Compressed mesh is corrupt.", __FILE__, __LINE__);
+    }
+
+    // bound the inflated size before allocating it.  Deltas take 1 to 3
+    // bytes, normals 1 byte, and deflate expands at most 1032 to 1.
+    const uint64_t min_stream = (uint64_t)vertex_count * 5 + index_count;
+    const uint64_t max_stream = (uint64_t)vertex_count * 11 + (uint64_t)index_count * 3;
+    if( stream_size < min_stream || stream_size > max_stream || stream_size > (uint64_t)( size - pos ) * 1032 ){
+        throw GeneralException("Compressed mesh is corrupt.", __FILE__, __LINE__);
+    }
+
+    // inflate
+    std::vector<uint8_t> streams( stream_size );
+    uLongf unpacked = stream_size;
+    if( uncompress( streams.data(), &unpacked, bytes + pos, size - pos ) != Z_OK || unpacked != stream_size ){
+        throw GeneralException("Compressed mesh is corrupt.", __FILE__, __LINE__);
+    }
+
+    // undo the deltas
+    pos = 0;
+    output.vertices.resize( vertex_count );
+    for( int k=0; k<3; k++ ){
+        int32_t value = 0;
+        for( size_t i=0; i<vertex_count; i++ ){
+            value += get_delta( streams.data(), streams.size(), pos );
+            output.vertices[i].position[k] = (uint16_t)value;
+        }
+    }
+    for( int k=0; k<2; k++ ){
+        for( size_t i=0; i<vertex_count; i++ ){
+            output.vertices[i].normal[k] = (int8_t)get<uint8_t>( streams.data(), streams.size(), pos );
+        }
+    }
+    output.indices.resize( index_count );
+    int32_t value = 0;
+    for( size_t i=0; i<index_count; i++ ){
+        value += get_delta( streams.data(), streams.size(), pos );
+        if( value < 0 || value >= (int32_t)vertex_count ){
+            throw GeneralException("Compressed mesh is corrupt.", __FILE__, __LINE__);
+        }
+        output.indices[i] = (uint16_t)value;
+    }
+    return output;
+}
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
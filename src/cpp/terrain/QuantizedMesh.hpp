@@ -0,0 +1,161 @@
+/**
+ * @file    QuantizedMesh.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_QUANTIZEDMESH_HPP__
+#define __SRC_CPP_TERRAIN_QUANTIZEDMESH_HPP__
+
+/// C++ Standard Libraries
+#include <cstdint>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/terrain/TerrainMesh.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/// Largest quantized coordinate
+const int QUANTIZED_MAX = 65535;
+
+/**
+ * @class QuantizedVertex
+ *
+ * Eight byte terrain vertex.  Positions are 16-bit fractions of the mesh
+ * bounds and normals are octahedron encoded in two signed bytes.  Texture
+ * coordinates are not stored, they are position[0] and position[2] over
+ * QUANTIZED_MAX.
+*/
+class QuantizedVertex{
+
+    public:
+
+        /// Position, decoded by QuantizedMesh::offset and QuantizedMesh::scale
+        uint16_t position[3];
+
+        /// Octahedron encoded unit normal
+        int8_t normal[2];
+
+}; /// End of QuantizedVertex Class
+
+
+/**
+ * @class QuantizedMesh
+ *
+ * Terrain mesh with quantized vertices and 16-bit indices.  A vertex
+ * decodes to offset + position * scale, relative to the mesh origin.
+*/
+class QuantizedMesh{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<QuantizedMesh> ptr_t;
+
+        /**
+         * Constructor
+        */
+        QuantizedMesh() : step(1), min_height(0), max_height(0){
+            for( int k=0; k<3; k++ ){
+                origin[k] = offset[k] = 0;
+                scale[k] = 1;
+            }
+        }
+
+        /**
+         * Check if the mesh has triangles
+        */
+        bool empty()const{
+            return indices.empty();
+        }
+
+        /**
+         * Get the number of bytes of vertex and index data
+        */
+        size_t bytes()const{
+            return vertices.size() * sizeof(QuantizedVertex) + indices.size() * sizeof(uint16_t);
+        }
+
+        /// Posts of the grid covered by the mesh
+        Rect window;
+
+        /// Distance between vertices in posts
+        int step;
+
+        /// Position of the first post in grid meters
+        double origin[3];
+
+        /// Position of quantized coordinate 0, relative to the origin
+        float offset[3];
+
+        /// Meters per quantized step
+        float scale[3];
+
+        /// Lowest vertex height
+        float min_height;
+
+        /// Highest vertex height
+        float max_height;
+
+        /// Vertices
+        std::vector<QuantizedVertex> vertices;
+
+        /// Triangle indices, counter-clockwise seen from above
+        std::vector<uint16_t> indices;
+
+}; /// End of QuantizedMesh Class
+
+
+/**
+ * Encode a unit normal on an octahedron
+*/
+void oct_encode( const float normal[3], int8_t output[2] );
+
+/**
+ * Decode an octahedron encoded normal
+*/
+void oct_decode( const int8_t encoded[2], float output[3] );
+
+/**
+ * Quantize a mesh
+ *
+ * @param[in] mesh Mesh with at most 65536 vertices.
+*/
+QuantizedMesh quantize_mesh( TerrainMesh const& mesh );
+
+/**
+ * Expand a quantized mesh back to floats
+*/
+TerrainMesh dequantize_mesh( QuantizedMesh const& mesh );
+
+/**
+ * Compress a quantized mesh
+ *
+ * Vertex components and indices are delta coded as separate streams, which
+ * leaves mostly small values on a regular grid, then deflated with zlib.
+ *
+ * @return Self-contained bytes for decompress_mesh.
+*/
+std::vector<uint8_t> compress_mesh( QuantizedMesh const& mesh );
+
+/**
+ * Decompress a quantized mesh
+ *
+ * @throws GeneralException if the bytes are not a compressed mesh.
+*/
+QuantizedMesh decompress_mesh( std::vector<uint8_t> const& bytes );
+
+/**
+ * Decompress a quantized mesh in place, for example from a memory map
+*/
+QuantizedMesh decompress_mesh( const uint8_t* bytes, const size_t& size );
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,165 @@
+/**
+ * @file    TerrainCulling.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "TerrainCulling.hpp"
+
+/// C++ Standard Libraries
+#include <cmath>
+#include <utility>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * Normalize a vector in place
+*/
+static void normalize( double v[3] ){
+    const double length = std::sqrt( v[0] * v[0] + v[1] * v[1] + v[2] * v[2] );
+    v[0] /= length;
+    v[1] /= length;
+    v[2] /= length;
+}
+
+/**
+ * Constructor
+*/
+Frustum::Frustum( const double eye[3],
+                  const double forward[3],
+                  const double up[3],
+                  const double& fov_y,
+                  const double& aspect,
+                  const double& z_near,
+                  const double& z_far ){
+
+    // camera basis
+    double f[3] = { forward[0], forward[1], forward[2] };
+    normalize( f );
+    double r[3] = { f[1] * up[2] - f[2] * up[1],
+                    f[2] * up[0] - f[0] * up[2],
+                    f[0] * up[1] - f[1] * up[0] };
+    normalize( r );
+    const double u[3] = { r[1] * f[2] - r[2] * f[1],
+                          r[2] * f[0] - r[0] * f[2],
+                          r[0] * f[1] - r[1] * f[0] };
+
+    // side planes pass through the eye, their normals lean toward the view axis
+    const double half_v = std::tan( fov_y / 2 );
+    const double half_h = half_v * aspect;
+    for( int k=0; k<3; k++ ){
+        planes[0][k] = half_h * f[k] + r[k];
+        planes[1][k] = half_h * f[k] - r[k];
+        planes[2][k] = half_v * f[k] + u[k];
+        planes[3][k] = half_v * f[k] - u[k];
+        planes[4][k] =  f[k];
+        planes[5][k] = -f[k];
+    }
+    for( int p=0; p<4; p++ ){
+        normalize( planes[p] );
+        planes[p][3] = -( planes[p][0] * eye[0] + planes[p][1] * eye[1] + planes[p][2] * eye[2] );
+    }
+    const double along = f[0] * eye[0] + f[1] * eye[1] + f[2] * eye[2];
+    planes[4][3] = -( along + z_near );
+    planes[5][3] =  ( along + z_far );
+}
+
+/**
+ * Classify a box against the frustum
+*/
+Containment Frustum::classify( BoundingBox const& box )const{
+
+    Containment output = Containment::INSIDE;
+    for( int p=0; p<6; p++ ){
+
+        // corners farthest along and against the plane normal
+        double inner = planes[p][3], outer = planes[p][3];
+        for( int k=0; k<3; k++ ){
+            if( planes[p][k] >= 0 ){
+                inner += planes[p][k] * box.upper[k];
+                outer += planes[p][k] * box.lower[k];
+            }
+            else{
+                inner += planes[p][k] * box.lower[k];
+                outer += planes[p][k] * box.upper[k];
+            }
+        }
+        if( inner < 0 ){
+            return Containment::OUTSIDE;
+        }
+        if( outer < 0 ){
+            output = Containment::INTERSECTS;
+        }
+    }
+    return output;
+}
+
+/**
+ * Check if a box is hidden below the horizon
+*/
+bool below_horizon( BoundingBox const& box, const double eye[3], const double& radius ){
+
+    const double eye_height = std::max( eye[1], 0.0 );
+    const double box_height = std::max( box.upper[1], 0.0 );
+    const double eye_range = std::sqrt( eye_height * ( 2 * radius + eye_height ));
+    const double box_range = std::sqrt( box_height * ( 2 * radius + box_height ));
+    return box.distance( eye ) > eye_range + box_range;
+}
+
+/**
+ * Select the visible nodes to draw for a view
+*/
+std::vector<int> select_visible( TerrainQuadtree const& tree,
+                                 LodView const& view,
+                                 Frustum const& frustum,
+                                 CullStats* stats ){
+
+    CullStats counters;
+    std::vector<int> output;
+
+    // nodes with a flag telling if they are known to be inside the frustum
+    std::vector<std::pair<int,bool> > stack( 1, std::make_pair( 0, false ));
+    while( stack.empty() == false ){
+        const int index   = stack.back().first;
+        bool inside       = stack.back().second;
+        stack.pop_back();
+        counters.visited++;
+
+        const BoundingBox box = tree.bounds( index );
+        if( inside == false ){
+            const Containment containment = frustum.classify( box );
+            if( containment == Containment::OUTSIDE ){
+                counters.frustum_culled++;
+                continue;
+            }
+            inside = ( containment == Containment::INSIDE );
+        }
+        if( below_horizon( box, view.eye )){
+            counters.horizon_culled++;
+            continue;
+        }
+
+        QuadtreeNode const& node = tree.node( index );
+        const double error = screen_space_error( node.geometric_error, box.distance( view.eye ), view );
+        if( error <= view.pixel_tolerance || node.isLeaf() ){
+            output.push_back( index );
+            counters.selected++;
+            counters.vertices += (size_t)( ( node.window.width()  - 2 ) / node.step + 2 ) *
+                                         ( ( node.window.height() - 2 ) / node.step + 2 );
+            continue;
+        }
+        for( int c=3; c>=0; c-- ){
+            if( node.children[c] >= 0 ){
+                stack.push_back( std::make_pair( node.children[c], inside ));
+            }
+        }
+    }
+
+    if( stats != nullptr ){
+        *stats = counters;
+    }
+    return output;
+}
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
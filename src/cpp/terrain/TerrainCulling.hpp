@@ -0,0 +1,145 @@
+/**
+ * @file    TerrainCulling.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_TERRAINCULLING_HPP__
+#define __SRC_CPP_TERRAIN_TERRAINCULLING_HPP__
+
+/// C++ Standard Libraries
+#include <vector>
+
+/// GeoExplore Libraries
+#include <GeoExplore/terrain/BoundingBox.hpp>
+#include <GeoExplore/terrain/TerrainQuadtree.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/// Mean earth radius in meters, used for horizon culling
+const double EARTH_RADIUS = 6371008.8;
+
+/**
+ * @class Containment
+ *
+ * Position of a box relative to a volume.
+*/
+enum class Containment{
+    OUTSIDE,
+    INTERSECTS,
+    INSIDE,
+}; /// End of Containment Enumeration
+
+
+/**
+ * @class Frustum
+ *
+ * View frustum as six inward facing planes, in grid meters.
+*/
+class Frustum{
+
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param[in] eye     Camera position.
+         * @param[in] forward View direction.  It need not be normalized.
+         * @param[in] up      Up hint.  It must not be parallel to forward.
+         * @param[in] fov_y   Vertical field of view in radians.
+         * @param[in] aspect  Viewport width over height.
+         * @param[in] z_near  Distance to the near plane.
+         * @param[in] z_far   Distance to the far plane.
+        */
+        Frustum( const double eye[3],
+                 const double forward[3],
+                 const double up[3],
+                 const double& fov_y,
+                 const double& aspect,
+                 const double& z_near,
+                 const double& z_far );
+
+        /**
+         * Classify a box against the frustum
+         *
+         * Boxes near a corner of the frustum may be reported as intersecting
+         * when they are outside, never the other way around.
+        */
+        Containment classify( BoundingBox const& box )const;
+
+        /// Planes as (nx, ny, nz, d), with n.p + d >= 0 inside
+        double planes[6][4];
+
+}; /// End of Frustum Class
+
+
+/**
+ * Check if a box is hidden below the horizon of a spherical earth
+ *
+ * Grid heights are taken as heights above the sphere.  The box is hidden
+ * when it is farther than the horizon distance of the eye plus that of its
+ * highest point.
+ *
+ * @param[in] box    Box to test.
+ * @param[in] eye    Camera position.
+ * @param[in] radius Sphere radius.
+*/
+bool below_horizon( BoundingBox const& box, const double eye[3], const double& radius = EARTH_RADIUS );
+
+
+/**
+ * @class CullStats
+ *
+ * Counters from a culled traversal.
+*/
+class CullStats{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        CullStats() : visited(0), frustum_culled(0), horizon_culled(0), selected(0), vertices(0){}
+
+        /// Nodes reached by the traversal
+        int visited;
+
+        /// Nodes skipped with their subtree for lying outside the frustum
+        int frustum_culled;
+
+        /// Nodes skipped with their subtree for lying below the horizon
+        int horizon_culled;
+
+        /// Nodes selected for drawing
+        int selected;
+
+        /// Grid vertices of the selected nodes, without skirts
+        size_t vertices;
+
+}; /// End of CullStats Class
+
+
+/**
+ * Select the visible nodes to draw for a view
+ *
+ * Same refinement as TerrainQuadtree::select, but subtrees outside the
+ * frustum or below the horizon are skipped, and subtrees fully inside the
+ * frustum are not tested again.  The work done depends on what is visible,
+ * not on the size of the grid.
+ *
+ * @param[in]  tree    Quadtree.
+ * @param[in]  view    Camera parameters for the screen space error.
+ * @param[in]  frustum View frustum in grid meters.
+ * @param[out] stats   Optional traversal counters.
+ *
+ * @return Selected node indices.
+*/
+std::vector<int> select_visible( TerrainQuadtree const& tree,
+                                 LodView const& view,
+                                 Frustum const& frustum,
+                                 CullStats* stats = nullptr );
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @file    TerrainMesh.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_TERRAINMESH_HPP__
+#define __SRC_CPP_TERRAIN_TERRAINMESH_HPP__
+
+/// C++ Standard Libraries
+#include <cstdint>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/image/Rect.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * @class TerrainVertex
+ *
+ * Interleaved terrain vertex.  The members map to the V_POSITION,
+ * V_NORMAL and V_UVCOORD attributes of terrain-explore.
+ *
+ * Positions are in meters relative to the mesh origin with x east,
+ * y up and z south, so meshes render right-handed with y up.
+*/
+class TerrainVertex{
+
+    public:
+
+        /// Position
+        float position[3];
+
+        /// Unit normal
+        float normal[3];
+
+        /// Texture coordinate across the mesh window
+        float uv[2];
+
+}; /// End of TerrainVertex Class
+
+
+/**
+ * @class TerrainMesh
+ *
+ * Indexed triangle mesh of one window of an elevation grid.
+*/
+class TerrainMesh{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<TerrainMesh> ptr_t;
+
+        /**
+         * Constructor
+        */
+        TerrainMesh() : step(1), min_height(0), max_height(0){
+            origin[0] = origin[1] = origin[2] = 0;
+        }
+
+        /**
+         * Check if the mesh has triangles
+        */
+        bool empty()const{
+            return indices.empty();
+        }
+
+        /// Posts of the grid covered by the mesh
+        Rect window;
+
+        /// Distance between vertices in posts
+        int step;
+
+        /// Position of the first post in grid meters.  Vertex positions are relative to it.
+        double origin[3];
+
+        /// Lowest vertex height
+        float min_height;
+
+        /// Highest vertex height
+        float max_height;
+
+        /// Vertices
+        std::vector<TerrainVertex> vertices;
+
+        /// Triangle list, counter-clockwise seen from above
+        std::vector<uint32_t> indices;
+
+}; /// End of TerrainMesh Class
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * @file    TerrainMeshBuilder.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "TerrainMeshBuilder.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * Constructor
+*/
+TerrainMeshBuilder::TerrainMeshBuilder( ElevationGrid::ptr_t grid ) : m_grid(grid),
+                                                                      m_vertical_scale(1){
+    if( m_grid == nullptr ){
+        throw GeneralException("Elevation grid is null.", __FILE__, __LINE__);
+    }
+}
+
+/**
+ * Split the grid into tile windows
+*/
+std::vector<Rect> TerrainMeshBuilder::tileWindows( const int& tile_quads )const{
+
+    if( tile_quads <= 0 ){
+        throw GeneralException("Tile size must be positive.", __FILE__, __LINE__);
+    }
+
+    std::vector<Rect> output;
+    const int quads_x = m_grid->cols - 1;
+    const int quads_y = m_grid->rows - 1;
+    for( int y=0; y<quads_y; y+=tile_quads ){
+        for( int x=0; x<quads_x; x+=tile_quads ){
+            output.push_back( Rect( x, y,
+                                    std::min( tile_quads, quads_x - x ) + 1,
+                                    std::min( tile_quads, quads_y - y ) + 1 ));
+        }
+    }
+    return output;
+}
+
+/**
+ * Build the mesh of one window
+*/
+TerrainMesh TerrainMeshBuilder::buildTile( Rect const& window, const int& step )const{
+
+    ElevationGrid const& grid = *m_grid;
+    if( window.width() < 2 || window.height() < 2 || window.inside( grid.rows, grid.cols ) == false ){
+        throw GeneralException("Mesh window must cover at least one quad of the grid.", __FILE__, __LINE__);
+    }
+    const int stride = std::max( step, 1 );
+
+    TerrainMesh output;
+    output.window = window;
+    output.step   = stride;
+    output.origin[0] = window.x() * grid.spacing_x;
+    output.origin[1] = 0;
+    output.origin[2] = window.y() * grid.spacing_y;
+
+    const std::vector<int> xs = sample_posts( window.x(), window.width(),  stride );
+    const std::vector<int> ys = sample_posts( window.y(), window.height(), stride );
+    const int nx = xs.size();
+    const int ny = ys.size();
+
+    // vertices
+    output.vertices.resize( (size_t)nx * ny );
+    output.min_height =  std::numeric_limits<float>::max();
+    output.max_height = -std::numeric_limits<float>::max();
+    const float du = 1.f / ( window.width()  - 1 );
+    const float dv = 1.f / ( window.height() - 1 );
+    for( int j=0; j<ny; j++ ){
+        const int y = ys[j];
+        for( int i=0; i<nx; i++ ){
+            const int x = xs[i];
+            TerrainVertex& vertex = output.vertices[ (size_t)j * nx + i ];
+
+            const float height = grid( x, y ) * m_vertical_scale;
+            vertex.position[0] = ( x - window.x() ) * grid.spacing_x;
+            vertex.position[1] = height;
+            vertex.position[2] = ( y - window.y() ) * grid.spacing_y;
+            output.min_height = std::min( output.min_height, height );
+            output.max_height = std::max( output.max_height, height );
+
+            // central differences over the whole grid, so tile edges agree
+            const int x0 = std::max( x - stride, 0 ), x1 = std::min( x + stride, grid.cols - 1 );
+            const int y0 = std::max( y - stride, 0 ), y1 = std::min( y + stride, grid.rows - 1 );
+            const float dhdx = ( grid( x1, y ) - grid( x0, y )) * m_vertical_scale / (float)( ( x1 - x0 ) * grid.spacing_x );
+            const float dhdz = ( grid( x, y1 ) - grid( x, y0 )) * m_vertical_scale / (float)( ( y1 - y0 ) * grid.spacing_y );
+            const float length = std::sqrt( dhdx * dhdx + 1.f + dhdz * dhdz );
+            vertex.normal[0] = -dhdx / length;
+            vertex.normal[1] =  1.f  / length;
+            vertex.normal[2] = -dhdz / length;
+
+            vertex.uv[0] = ( x - window.x() ) * du;
+            vertex.uv[1] = ( y - window.y() ) * dv;
+        }
+    }
+
+    // two triangles per quad, counter-clockwise seen from above
+    output.indices.reserve( (size_t)( nx - 1 ) * ( ny - 1 ) * 6 );
+    for( int j=0; j+1<ny; j++ ){
+        for( int i=0; i+1<nx; i++ ){
+            const uint32_t v00 = j * nx + i;
+            const uint32_t v10 = v00 + 1;
+            const uint32_t v01 = v00 + nx;
+            const uint32_t v11 = v01 + 1;
+            output.indices.push_back( v00 );
+            output.indices.push_back( v01 );
+            output.indices.push_back( v10 );
+            output.indices.push_back( v10 );
+            output.indices.push_back( v01 );
+            output.indices.push_back( v11 );
+        }
+    }
+    return output;
+}
+
+/**
+ * Build the meshes of many windows in parallel
+*/
+std::vector<TerrainMesh> TerrainMeshBuilder::buildTiles( std::vector<Rect> const& windows,
+                                                         const int& step,
+                                                         const int& threads )const{
+
+    std::vector<TerrainMesh> output( windows.size() );
+    parallel_for( 0, windows.size(), [&]( const size_t& idx, const int& /*thread_id*/ ){
+        output[idx] = buildTile( windows[idx], step );
+    }, threads );
+    return output;
+}
+
+/**
+ * Posts sampled along one axis of a window
+*/
+std::vector<int> sample_posts( const int& first, const int& count, const int& step ){
+
+    std::vector<int> output;
+    const int last = first + count - 1;
+    for( int p=first; p<last; p+=std::max( step, 1 )){
+        output.push_back( p );
+    }
+    output.push_back( last );
+    return output;
+}
+
+/**
+ * Add a skirt around a mesh
+*/
+void add_skirt( TerrainMesh& mesh, const float& depth ){
+
+    if( mesh.empty() ){
+        return;
+    }
+    const int nx = sample_posts( mesh.window.x(), mesh.window.width(),  mesh.step ).size();
+    const int ny = sample_posts( mesh.window.y(), mesh.window.height(), mesh.step ).size();
+
+    // walk the border with the outside on the left: east along the top,
+    // south down the right, west along the bottom and north up the left
+    std::vector<uint32_t> border;
+    for( int i=0; i<nx-1; i++ ){ border.push_back( i ); }
+    for( int j=0; j<ny-1; j++ ){ border.push_back( j * nx + nx - 1 ); }
+    for( int i=nx-1; i>0; i-- ){ border.push_back( ( ny - 1 ) * nx + i ); }
+    for( int j=ny-1; j>0; j-- ){ border.push_back( j * nx ); }
+
+    // lowered copies of the border
+    const uint32_t first = mesh.vertices.size();
+    for( size_t b=0; b<border.size(); b++ ){
+        TerrainVertex vertex = mesh.vertices[ border[b] ];
+        vertex.position[1] -= depth;
+        mesh.vertices.push_back( vertex );
+    }
+    mesh.min_height -= depth;
+
+    // two triangles per border edge
+    for( size_t b=0; b<border.size(); b++ ){
+        const size_t n = ( b + 1 ) % border.size();
+        const uint32_t top0 = border[b],   top1 = border[n];
+        const uint32_t low0 = first + b,   low1 = first + n;
+        mesh.indices.push_back( top0 );
+        mesh.indices.push_back( top1 );
+        mesh.indices.push_back( low0 );
+        mesh.indices.push_back( top1 );
+        mesh.indices.push_back( low1 );
+        mesh.indices.push_back( low0 );
+    }
+}
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
@@ -0,0 +1,130 @@
+/**
+ * @file    TerrainMeshBuilder.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_TERRAINMESHBUILDER_HPP__
+#define __SRC_CPP_TERRAIN_TERRAINMESHBUILDER_HPP__
+
+/// C++ Standard Libraries
+#include <vector>
+
+/// GeoExplore Libraries
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/terrain/ElevationGrid.hpp>
+#include <GeoExplore/terrain/TerrainMesh.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * @class TerrainMeshBuilder
+ *
+ * Turns windows of an elevation grid into indexed triangle meshes.
+ *
+ * Neighboring tiles share their edge posts, and normals are taken from
+ * the whole grid rather than the tile, so adjacent meshes line up with no
+ * seams in position or shading.
+*/
+class TerrainMeshBuilder{
+
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param[in] grid Elevation grid.  It is shared, not copied.
+        */
+        explicit TerrainMeshBuilder( ElevationGrid::ptr_t grid );
+
+        /**
+         * Get the elevation grid
+        */
+        ElevationGrid const& getGrid()const{
+            return *m_grid;
+        }
+
+        /**
+         * Set the factor applied to heights
+        */
+        void setVerticalScale( const float& scale ){
+            m_vertical_scale = scale;
+        }
+
+        /**
+         * Get the factor applied to heights
+        */
+        float getVerticalScale()const{
+            return m_vertical_scale;
+        }
+
+        /**
+         * Split the grid into tile windows
+         *
+         * @param[in] tile_quads Quads along a tile edge.  Tiles have tile_quads+1
+         *                       posts so that neighbors share their edge.
+         *
+         * @return Windows in posts, row-major.
+        */
+        std::vector<Rect> tileWindows( const int& tile_quads )const;
+
+        /**
+         * Build the mesh of one window
+         *
+         * @param[in] window Posts to cover.
+         * @param[in] step   Distance between vertices in posts.  The last row and
+         *                   column of the window are always kept.
+        */
+        TerrainMesh buildTile( Rect const& window, const int& step = 1 )const;
+
+        /**
+         * Build the meshes of many windows in parallel
+         *
+         * @param[in] windows Posts to cover, one mesh each.
+         * @param[in] step    Distance between vertices in posts.
+         * @param[in] threads Number of threads.  Values <= 0 use the default.
+         *
+         * @return Meshes in the order of windows.
+        */
+        std::vector<TerrainMesh> buildTiles( std::vector<Rect> const& windows,
+                                             const int& step = 1,
+                                             const int& threads = 0 )const;
+
+    private:
+
+        /// Elevation grid
+        ElevationGrid::ptr_t m_grid;
+
+        /// Factor applied to heights
+        float m_vertical_scale;
+
+}; /// End of TerrainMeshBuilder Class
+
+
+/**
+ * Posts sampled along one axis of a window
+ *
+ * @param[in] first First post.
+ * @param[in] count Number of posts in the window.
+ * @param[in] step  Distance between samples.
+ *
+ * @return Sampled posts.  The last post is always included.
+*/
+std::vector<int> sample_posts( const int& first, const int& count, const int& step );
+
+/**
+ * Add a skirt around a mesh
+ *
+ * Every border vertex is repeated lower down and joined to the border by a
+ * vertical strip facing outward.  Skirts hide the cracks left where meshes
+ * of different resolution meet.
+ *
+ * @param[in,out] mesh  Mesh built by TerrainMeshBuilder.
+ * @param[in]     depth Distance the skirt hangs below the border.
+*/
+void add_skirt( TerrainMesh& mesh, const float& depth );
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
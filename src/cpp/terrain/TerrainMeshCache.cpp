@@ -0,0 +1,87 @@
+/**
+ * @file    TerrainMeshCache.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "TerrainMeshCache.hpp"
+
+/// C++ Standard Libraries
+#include <cstring>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * Constructor
+*/
+TerrainMeshCache::TerrainMeshCache( TileCache::ptr_t cache, const uint64_t& dataset )
+  : m_cache(cache),
+    m_dataset(dataset)
+{
+    if( m_cache == nullptr ){
+        throw GeneralException("Tile cache is null.", __FILE__, __LINE__);
+    }
+}
+
+/**
+ * Load the mesh of a node
+*/
+QuantizedMesh::ptr_t TerrainMeshCache::load( QuadtreeNode const& node )const{
+
+    const TileKey tile = key( node );
+    TileView view = m_cache->find( tile );
+    if( view.empty() ){
+        return QuantizedMesh::ptr_t();
+    }
+
+    // a damaged payload is a miss, it gets rebuilt and replaced
+    QuantizedMesh::ptr_t output;
+    try{
+        output.reset( new QuantizedMesh( decompress_mesh( view.data, view.size )));
+    }
+    catch( GeneralException const& ){
+        m_cache->erase( tile );
+        return QuantizedMesh::ptr_t();
+    }
+    if( ( output->window == node.window ) == false || output->step != node.step ){
+        m_cache->erase( tile );
+        return QuantizedMesh::ptr_t();
+    }
+    return output;
+}
+
+/**
+ * Store the mesh of a node
+*/
+void TerrainMeshCache::store( QuadtreeNode const& node, QuantizedMesh const& mesh )const{
+    m_cache->store( key( node ), compress_mesh( mesh ));
+}
+
+/**
+ * Load the node metrics of the tree
+*/
+bool TerrainMeshCache::loadMetrics( std::vector<float>& metrics )const{
+
+    TileView view = m_cache->find( TileKey( m_dataset, -1, 0, 0 ));
+    if( view.empty() || view.size % ( 3 * sizeof(float) ) != 0 ){
+        return false;
+    }
+    metrics.resize( view.size / sizeof(float) );
+    std::memcpy( metrics.data(), view.data, view.size );
+    return true;
+}
+
+/**
+ * Store the node metrics of the tree
+*/
+void TerrainMeshCache::storeMetrics( std::vector<float> const& metrics )const{
+    m_cache->store( TileKey( m_dataset, -1, 0, 0 ),
+                    reinterpret_cast<const uint8_t*>( metrics.data() ),
+                    metrics.size() * sizeof(float) );
+}
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
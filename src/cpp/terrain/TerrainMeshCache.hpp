@@ -0,0 +1,94 @@
+/**
+ * @file    TerrainMeshCache.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_TERRAINMESHCACHE_HPP__
+#define __SRC_CPP_TERRAIN_TERRAINMESHCACHE_HPP__
+
+/// C++ Standard Libraries
+#include <cstdint>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/terrain/QuantizedMesh.hpp>
+#include <GeoExplore/terrain/TerrainQuadtree.hpp>
+#include <GeoExplore/terrain/TileCache.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * @class TerrainMeshCache
+ *
+ * Compressed node meshes of one quadtree, kept in a TileCache under
+ * (dataset, level, tile_x, tile_y).  The dataset hash must cover the
+ * elevation model and the quadtree chunk size, since nodes are only
+ * identified by their position in the tree.
+ *
+ * The node metrics of the tree are kept under (dataset, -1, 0, 0), so a
+ * later run can build the tree without measuring the grid again.
+*/
+class TerrainMeshCache{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<TerrainMeshCache> ptr_t;
+
+        /**
+         * Constructor
+         *
+         * @param[in] cache   Tile cache, possibly shared with other datasets.
+         * @param[in] dataset Dataset hash, see dataset_hash.
+        */
+        TerrainMeshCache( TileCache::ptr_t cache, const uint64_t& dataset );
+
+        /**
+         * Get the tile cache key of a node
+        */
+        TileKey key( QuadtreeNode const& node )const{
+            return TileKey( m_dataset, node.level, node.tile_x, node.tile_y );
+        }
+
+        /**
+         * Load the mesh of a node
+         *
+         * @return Null if the node is not cached or its payload is unreadable.
+        */
+        QuantizedMesh::ptr_t load( QuadtreeNode const& node )const;
+
+        /**
+         * Store the mesh of a node, replacing any cached one
+        */
+        void store( QuadtreeNode const& node, QuantizedMesh const& mesh )const;
+
+        /**
+         * Load the node metrics of the tree, see TerrainQuadtree::metrics
+         *
+         * @return False if they are not cached.
+        */
+        bool loadMetrics( std::vector<float>& metrics )const;
+
+        /**
+         * Store the node metrics of the tree
+        */
+        void storeMetrics( std::vector<float> const& metrics )const;
+
+    private:
+
+        /// Tile cache
+        TileCache::ptr_t m_cache;
+
+        /// Dataset hash
+        uint64_t m_dataset;
+
+}; /// End of TerrainMeshCache Class
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,261 @@
+/**
+ * @file    TerrainQuadtree.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "TerrainQuadtree.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+#include <GeoExplore/utilities/ThreadUtilities.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * Constructor
+*/
+TerrainQuadtree::TerrainQuadtree( ElevationGrid::ptr_t grid,
+                                  const int& chunk_quads,
+                                  const int& threads,
+                                  std::vector<float> const& metrics )
+                                    : m_grid(grid),
+                                      m_builder(grid),
+                                      m_chunk_quads(chunk_quads),
+                                      m_depth(1){
+
+    const int quads_x = m_grid->cols - 1;
+    const int quads_y = m_grid->rows - 1;
+    if( quads_x < 1 || quads_y < 1 ){
+        throw GeneralException("Elevation grid must have at least 2x2 posts.", __FILE__, __LINE__);
+    }
+    if( chunk_quads <= 0 ){
+        throw GeneralException("Chunk size must be positive.", __FILE__, __LINE__);
+    }
+
+    // the root covers the whole grid in one chunk
+    while( ( (long long)m_chunk_quads << ( m_depth - 1 )) < std::max( quads_x, quads_y )){
+        m_depth++;
+    }
+    QuadtreeNode root;
+    root.step   = 1 << ( m_depth - 1 );
+    root.window = Rect( 0, 0, m_grid->cols, m_grid->rows );
+    m_nodes.push_back( root );
+
+    // split level by level, dropping children which fall off the grid
+    for( size_t n=0; n<m_nodes.size(); n++ ){
+        if( m_nodes[n].level + 1 >= m_depth ){
+            continue;
+        }
+        const QuadtreeNode parent = m_nodes[n];
+        for( int c=0; c<4; c++ ){
+            QuadtreeNode child;
+            child.level  = parent.level + 1;
+            child.tile_x = 2 * parent.tile_x + ( c & 1 );
+            child.tile_y = 2 * parent.tile_y + ( c >> 1 );
+            child.step   = parent.step / 2;
+            child.parent = n;
+
+            const int footprint = m_chunk_quads * child.step;
+            const int x0 = child.tile_x * footprint;
+            const int y0 = child.tile_y * footprint;
+            if( x0 >= quads_x || y0 >= quads_y ){
+                continue;
+            }
+            child.window = Rect( x0, y0,
+                                 std::min( footprint, quads_x - x0 ) + 1,
+                                 std::min( footprint, quads_y - y0 ) + 1 );
+            m_nodes[n].children[c] = m_nodes.size();
+            m_nodes.push_back( child );
+        }
+    }
+
+    // saved metrics of the same tree
+    if( metrics.size() == 3 * m_nodes.size() ){
+        for( size_t n=0; n<m_nodes.size(); n++ ){
+            m_nodes[n].geometric_error = metrics[3*n];
+            m_nodes[n].min_height      = metrics[3*n+1];
+            m_nodes[n].max_height      = metrics[3*n+2];
+        }
+        return;
+    }
+    measureNodes( threads );
+}
+
+/**
+ * Get the metrics of every node
+*/
+std::vector<float> TerrainQuadtree::metrics()const{
+
+    std::vector<float> output( 3 * m_nodes.size() );
+    for( size_t n=0; n<m_nodes.size(); n++ ){
+        output[3*n]   = m_nodes[n].geometric_error;
+        output[3*n+1] = m_nodes[n].min_height;
+        output[3*n+2] = m_nodes[n].max_height;
+    }
+    return output;
+}
+
+/**
+ * Compute the geometric error and height range of every node
+*/
+void TerrainQuadtree::measureNodes( const int& threads ){
+
+    // measure every node against the full grid, and the height range of the leaves
+    ElevationGrid const& g = *m_grid;
+    parallel_for( 0, m_nodes.size(), [&]( const size_t& n, const int& /*thread_id*/ ){
+        QuadtreeNode& node = m_nodes[n];
+        node.geometric_error = measureError( node );
+        if( node.isLeaf() == false ){
+            return;
+        }
+        node.min_height =  std::numeric_limits<float>::max();
+        node.max_height = -std::numeric_limits<float>::max();
+        for( int y=node.window.y(); y<node.window.y()+node.window.height(); y++ ){
+            for( int x=node.window.x(); x<node.window.x()+node.window.width(); x++ ){
+                node.min_height = std::min( node.min_height, g( x, y ));
+                node.max_height = std::max( node.max_height, g( x, y ));
+            }
+        }
+    }, threads );
+
+    // build the min/max pyramid from the leaves up, parents are never more
+    // accurate than their children
+    for( size_t n=m_nodes.size(); n-- > 0; ){
+        QuadtreeNode& node = m_nodes[n];
+        if( node.isLeaf() == false ){
+            node.min_height =  std::numeric_limits<float>::max();
+            node.max_height = -std::numeric_limits<float>::max();
+            for( int c=0; c<4; c++ ){
+                if( node.children[c] >= 0 ){
+                    QuadtreeNode const& child = m_nodes[node.children[c]];
+                    node.min_height = std::min( node.min_height, child.min_height );
+                    node.max_height = std::max( node.max_height, child.max_height );
+                    node.geometric_error = std::max( node.geometric_error, child.geometric_error );
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Build the skirted meshes of a set of nodes
+*/
+void TerrainQuadtree::buildMeshes( std::vector<int> const& indices, const int& threads ){
+
+    std::vector<int> missing;
+    for( size_t i=0; i<indices.size(); i++ ){
+        if( m_nodes[indices[i]].mesh == nullptr ){
+            missing.push_back( indices[i] );
+        }
+    }
+    parallel_for( 0, missing.size(), [&]( const size_t& i, const int& /*thread_id*/ ){
+        m_nodes[missing[i]].mesh = buildMesh( missing[i] );
+    }, threads );
+}
+
+/**
+ * Build the skirted mesh of a node
+*/
+TerrainMesh::ptr_t TerrainQuadtree::buildMesh( const int& index )const{
+
+    QuadtreeNode const& node = m_nodes[index];
+    TerrainMesh::ptr_t output( new TerrainMesh( m_builder.buildTile( node.window, node.step )));
+
+    // deep enough for a neighbor one level coarser, never flat
+    const float coarser = ( node.parent < 0 ) ? node.geometric_error : m_nodes[node.parent].geometric_error;
+    const float minimum = 0.05 * node.step * std::min( m_grid->spacing_x, m_grid->spacing_y );
+    add_skirt( *output, std::max( 2.f * coarser, minimum ));
+    return output;
+}
+
+/**
+ * Select the nodes to draw for a view
+*/
+std::vector<int> TerrainQuadtree::select( LodView const& view )const{
+
+    std::vector<int> output;
+    std::vector<int> stack( 1, 0 );
+    while( stack.empty() == false ){
+        const int index = stack.back();
+        stack.pop_back();
+
+        QuadtreeNode const& node = m_nodes[index];
+        const double error = screen_space_error( node.geometric_error, distance( index, view.eye ), view );
+        if( error <= view.pixel_tolerance || node.isLeaf() ){
+            output.push_back( index );
+            continue;
+        }
+        for( int c=3; c>=0; c-- ){
+            if( node.children[c] >= 0 ){
+                stack.push_back( node.children[c] );
+            }
+        }
+    }
+    return output;
+}
+
+/**
+ * Get the bounding box of a node
+*/
+BoundingBox TerrainQuadtree::bounds( const int& index )const{
+
+    QuadtreeNode const& node = m_nodes[index];
+    BoundingBox output;
+    output.lower[0] = node.window.x() * m_grid->spacing_x;
+    output.lower[1] = node.min_height;
+    output.lower[2] = node.window.y() * m_grid->spacing_y;
+    output.upper[0] = ( node.window.x() + node.window.width()  - 1 ) * m_grid->spacing_x;
+    output.upper[1] = node.max_height;
+    output.upper[2] = ( node.window.y() + node.window.height() - 1 ) * m_grid->spacing_y;
+    return output;
+}
+
+/**
+ * Compute the geometric error of a node
+*/
+float TerrainQuadtree::measureError( QuadtreeNode const& node )const{
+
+    ElevationGrid const& g = *m_grid;
+    const std::vector<int> xs = sample_posts( node.window.x(), node.window.width(),  node.step );
+    const std::vector<int> ys = sample_posts( node.window.y(), node.window.height(), node.step );
+
+    // interpolate each cell the way the mesh splits it, along the x1,y0 to x0,y1 diagonal
+    float error = 0;
+    for( size_t j=0; j+1<ys.size(); j++ ){
+        const int y0 = ys[j], y1 = ys[j+1];
+        for( size_t i=0; i+1<xs.size(); i++ ){
+            const int x0 = xs[i], x1 = xs[i+1];
+            const float h00 = g( x0, y0 ), h10 = g( x1, y0 );
+            const float h01 = g( x0, y1 ), h11 = g( x1, y1 );
+            for( int y=y0; y<=y1; y++ ){
+                const float v = (float)( y - y0 ) / ( y1 - y0 );
+                for( int x=x0; x<=x1; x++ ){
+                    const float u = (float)( x - x0 ) / ( x1 - x0 );
+                    const float approx = ( u + v <= 1 ) ? h00 + u * ( h10 - h00 ) + v * ( h01 - h00 )
+                                                        : h11 + ( 1 - u ) * ( h01 - h11 ) + ( 1 - v ) * ( h10 - h11 );
+                    error = std::max( error, std::fabs( g( x, y ) - approx ));
+                }
+            }
+        }
+    }
+    return error;
+}
+
+/**
+ * Project a geometric error to the screen
+*/
+double screen_space_error( const double& error, const double& distance, LodView const& view ){
+    if( distance <= 0 ){
+        return std::numeric_limits<double>::infinity();
+    }
+    return error * view.viewport_height / ( 2 * std::tan( view.fov_y / 2 ) * distance );
+}
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
@@ -0,0 +1,278 @@
+/**
+ * @file    TerrainQuadtree.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_TERRAINQUADTREE_HPP__
+#define __SRC_CPP_TERRAIN_TERRAINQUADTREE_HPP__
+
+/// C++ Standard Libraries
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/terrain/BoundingBox.hpp>
+#include <GeoExplore/terrain/ElevationGrid.hpp>
+#include <GeoExplore/terrain/TerrainMesh.hpp>
+#include <GeoExplore/terrain/TerrainMeshBuilder.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * @class QuadtreeNode
+ *
+ * One chunk of the terrain quadtree.  Every node covers its window with
+ * the same number of quads, so deeper nodes are finer.
+*/
+class QuadtreeNode{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        QuadtreeNode() : level(0), tile_x(0), tile_y(0), step(1), parent(-1),
+                         geometric_error(0), min_height(0), max_height(0){
+            children[0] = children[1] = children[2] = children[3] = -1;
+        }
+
+        /**
+         * Check if the node has children
+        */
+        bool isLeaf()const{
+            return children[0] < 0 && children[1] < 0 && children[2] < 0 && children[3] < 0;
+        }
+
+        /// Depth in the tree, 0 at the root
+        int level;
+
+        /// Column of the node among the nodes of its level
+        int tile_x;
+
+        /// Row of the node among the nodes of its level
+        int tile_y;
+
+        /// Posts covered
+        Rect window;
+
+        /// Distance between mesh vertices in posts
+        int step;
+
+        /// Index of the parent, -1 at the root
+        int parent;
+
+        /// Indices of the children, -1 where a child falls off the grid
+        int children[4];
+
+        /// Largest height difference between the node mesh and the full grid,
+        /// never smaller than the error of a child
+        float geometric_error;
+
+        /// Lowest grid height in the window, the minimum of the children
+        float min_height;
+
+        /// Highest grid height in the window, the maximum of the children
+        float max_height;
+
+        /// Simplified mesh, empty until built
+        TerrainMesh::ptr_t mesh;
+
+}; /// End of QuadtreeNode Class
+
+
+/**
+ * @class LodView
+ *
+ * Camera parameters for level of detail selection.  Positions are in grid
+ * meters, x east, y up and z south.
+*/
+class LodView{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        LodView() : viewport_height(1080), fov_y(0.785398), pixel_tolerance(2){
+            eye[0] = eye[1] = eye[2] = 0;
+        }
+
+        /// Camera position
+        double eye[3];
+
+        /// Viewport height in pixels
+        double viewport_height;
+
+        /// Vertical field of view in radians
+        double fov_y;
+
+        /// Largest screen space error allowed, in pixels
+        double pixel_tolerance;
+
+}; /// End of LodView Class
+
+
+/**
+ * @class TerrainQuadtree
+ *
+ * Chunked level of detail over an elevation grid.
+ *
+ * Leaves cover chunk_quads quads at full resolution and every level up
+ * doubles the footprint and the vertex step.  Each node stores the exact
+ * vertical error of its decimated mesh against the full grid, so the view
+ * can refine until that error projects under a pixel tolerance.  Meshes
+ * carry skirts to hide cracks between nodes of different levels.
+*/
+class TerrainQuadtree{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<TerrainQuadtree> ptr_t;
+
+        /**
+         * Constructor
+         *
+         * Builds the node hierarchy and computes every geometric error.
+         * Meshes are built separately with buildMeshes.
+         *
+         * Measuring the errors reads every post once per level, which takes
+         * seconds on large grids.  Metrics saved from an earlier tree over the
+         * same grid and chunk size skip it.
+         *
+         * @param[in] grid        Elevation grid.
+         * @param[in] chunk_quads Quads along the edge of every node mesh.
+         * @param[in] threads     Number of threads.  Values <= 0 use the default.
+         * @param[in] metrics     Output of metrics() from an earlier tree.  Ignored
+         *                        unless it has three values per node.
+        */
+        TerrainQuadtree( ElevationGrid::ptr_t grid,
+                         const int& chunk_quads = 64,
+                         const int& threads = 0,
+                         std::vector<float> const& metrics = std::vector<float>() );
+
+        /**
+         * Get the number of levels
+        */
+        int depth()const{
+            return m_depth;
+        }
+
+        /**
+         * Get the quads along a node mesh edge
+        */
+        int chunkQuads()const{
+            return m_chunk_quads;
+        }
+
+        /**
+         * Get the nodes, root first, level by level
+        */
+        std::vector<QuadtreeNode> const& nodes()const{
+            return m_nodes;
+        }
+
+        /**
+         * Get the geometric error, lowest and highest height of every node,
+         * in node order
+        */
+        std::vector<float> metrics()const;
+
+        /**
+         * Get a node
+        */
+        QuadtreeNode const& node( const int& index )const{
+            return m_nodes[index];
+        }
+
+        /**
+         * Get the mesh builder
+        */
+        TerrainMeshBuilder const& builder()const{
+            return m_builder;
+        }
+
+        /**
+         * Build the skirted meshes of a set of nodes in parallel
+         *
+         * Nodes which already have a mesh are skipped.
+        */
+        void buildMeshes( std::vector<int> const& indices, const int& threads = 0 );
+
+        /**
+         * Build the skirted mesh of a node
+        */
+        TerrainMesh::ptr_t buildMesh( const int& index )const;
+
+        /**
+         * Select the nodes to draw for a view
+         *
+         * Starting at the root, a node is refined while its geometric error,
+         * projected at the distance from the eye to its bounding box, is above
+         * the pixel tolerance.  The selected nodes cover the grid exactly once.
+         *
+         * @return Selected node indices.
+        */
+        std::vector<int> select( LodView const& view )const;
+
+        /**
+         * Get the bounding box of a node in grid meters
+        */
+        BoundingBox bounds( const int& index )const;
+
+        /**
+         * Compute the distance from a point to the bounding box of a node
+        */
+        double distance( const int& index, const double eye[3] )const{
+            return bounds( index ).distance( eye );
+        }
+
+    private:
+
+        /**
+         * Compute the geometric error and height range of every node
+        */
+        void measureNodes( const int& threads );
+
+        /**
+         * Compute the geometric error of a node against the full grid
+        */
+        float measureError( QuadtreeNode const& node )const;
+
+        /// Elevation grid
+        ElevationGrid::ptr_t m_grid;
+
+        /// Mesh builder
+        TerrainMeshBuilder m_builder;
+
+        /// Quads along a node mesh edge
+        int m_chunk_quads;
+
+        /// Number of levels
+        int m_depth;
+
+        /// Nodes, root first
+        std::vector<QuadtreeNode> m_nodes;
+
+}; /// End of TerrainQuadtree Class
+
+
+/**
+ * Project a geometric error to the screen
+ *
+ * @param[in] error    Geometric error in meters.
+ * @param[in] distance Distance to the eye in meters.
+ * @param[in] view     Camera parameters.
+ *
+ * @return Error in pixels.
+*/
+double screen_space_error( const double& error, const double& distance, LodView const& view );
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
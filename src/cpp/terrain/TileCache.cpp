@@ -0,0 +1,461 @@
+/**
+ * @file    TileCache.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "TileCache.hpp"
+
+/// C++ Standard Libraries
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+
+namespace bf=boost::filesystem;
+namespace bi=boost::interprocess;
+
+namespace GEO{
+namespace TERRAIN{
+
+/// Index signature and version
+static const char     INDEX_MAGIC[4] = { 'G', 'X', 'T', 'I' };
+static const uint32_t INDEX_VERSION  = 1;
+
+/// Signature before every payload in the data file
+static const uint32_t RECORD_MAGIC = 0x454c4954;
+
+/// Key copy before every payload: magic, dataset, level, x, y, size
+static const size_t RECORD_HEADER = 4 + 8 + 4 + 4 + 4 + 4;
+
+/// Bytes per index entry: dataset, level, x, y, size, offset
+static const size_t INDEX_ENTRY = 8 + 4 + 4 + 4 + 4 + 8;
+
+/// Data files below this size are never compacted
+static const size_t COMPACT_MIN_BYTES = 1 << 20;
+
+/**
+ * Write a plain value
+*/
+template <typename ValueType>
+static void put( std::ostream& output, ValueType const& value ){
+    output.write( reinterpret_cast<const char*>( &value ), sizeof(ValueType) );
+}
+
+/**
+ * Read a plain value
+*/
+template <typename ValueType>
+static ValueType get( const uint8_t*& input ){
+    ValueType value;
+    std::memcpy( &value, input, sizeof(ValueType) );
+    input += sizeof(ValueType);
+    return value;
+}
+
+/**
+ * Write the key copy of a record
+*/
+static void put_record_header( std::ostream& output, TileKey const& key, const uint32_t& size ){
+    put( output, RECORD_MAGIC );
+    put( output, key.dataset );
+    put( output, (int32_t)key.level );
+    put( output, (int32_t)key.x );
+    put( output, (int32_t)key.y );
+    put( output, size );
+}
+
+/**
+ * Constructor
+*/
+TileCache::TileCache( bf::path const& directory, const size_t& max_bytes )
+  : m_index_path( directory / "tiles.index" ),
+    m_data_path( directory / "tiles.data" ),
+    m_max_bytes( max_bytes ),
+    m_bytes( 0 ),
+    m_file_bytes( 0 ),
+    m_dirty( false ),
+    m_writable( true )
+{
+    boost::system::error_code error;
+    bf::create_directories( directory, error );
+    if( bf::is_directory( directory ) == false ){
+        throw GeneralException("Unable to create tile cache directory " + directory.string(), __FILE__, __LINE__);
+    }
+
+    if( bf::exists( m_data_path )){
+        m_file_bytes = bf::file_size( m_data_path );
+    }
+    readIndex();
+
+    m_data.open( m_data_path.c_str(), std::ios::out | std::ios::binary | std::ios::app );
+    if( m_data.is_open() == false ){
+        throw GeneralException("Unable to open " + m_data_path.string(), __FILE__, __LINE__);
+    }
+    remap();
+}
+
+/**
+ * Destructor
+*/
+TileCache::~TileCache(){
+    try{
+        flush();
+    }
+    catch( ... ){}
+}
+
+/**
+ * Find a tile
+*/
+TileView TileCache::find( TileKey const& key ){
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    TileView output;
+    std::map<TileKey,Entry>::iterator it = m_entries.find( key );
+    if( it == m_entries.end() ){
+        return output;
+    }
+
+    // stored since the last mapping
+    const uint64_t end = it->second.offset + RECORD_HEADER + it->second.size;
+    if( m_region == nullptr || end > m_region->get_size() ){
+        remap();
+    }
+    if( m_region == nullptr || end > m_region->get_size() ){
+        dropEntry( it );
+        return output;
+    }
+
+    // the record must carry the same key
+    const uint8_t* record = static_cast<const uint8_t*>( m_region->get_address() ) + it->second.offset;
+    const uint8_t* cursor = record;
+    const bool valid = get<uint32_t>( cursor ) == RECORD_MAGIC &&
+                       get<uint64_t>( cursor ) == key.dataset &&
+                       get<int32_t>( cursor )  == key.level &&
+                       get<int32_t>( cursor )  == key.x &&
+                       get<int32_t>( cursor )  == key.y &&
+                       get<uint32_t>( cursor ) == it->second.size;
+    if( valid == false ){
+        dropEntry( it );
+        return output;
+    }
+
+    m_lru.splice( m_lru.end(), m_lru, it->second.lru );
+    m_dirty = true;
+    output.region = m_region;
+    output.data = record + RECORD_HEADER;
+    output.size = it->second.size;
+    return output;
+}
+
+/**
+ * Copy a tile
+*/
+bool TileCache::load( TileKey const& key, std::vector<uint8_t>& output ){
+
+    TileView view = find( key );
+    if( view.empty() ){
+        return false;
+    }
+    output.assign( view.data, view.data + view.size );
+    return true;
+}
+
+/**
+ * Store a tile
+*/
+bool TileCache::store( TileKey const& key, const uint8_t* data, const size_t& size ){
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if( m_writable == false || size > m_max_bytes || size > UINT32_MAX ){
+        return false;
+    }
+
+    // make room, oldest first
+    std::map<TileKey,Entry>::iterator existing = m_entries.find( key );
+    if( existing != m_entries.end() ){
+        dropEntry( existing );
+    }
+    while( m_bytes + size > m_max_bytes && m_lru.empty() == false ){
+        dropEntry( m_entries.find( m_lru.front() ));
+    }
+
+    // append the record
+    put_record_header( m_data, key, size );
+    m_data.write( reinterpret_cast<const char*>( data ), size );
+    m_data.flush();
+    if( m_data.good() == false ){
+        disableWrites( "Unable to write " + m_data_path.string() );
+        return false;
+    }
+
+    Entry entry;
+    entry.offset = m_file_bytes;
+    entry.size   = size;
+    entry.lru    = m_lru.insert( m_lru.end(), key );
+    m_entries[key] = entry;
+    m_bytes      += size;
+    m_file_bytes += RECORD_HEADER + size;
+    m_dirty = true;
+
+    // reclaim the dead records
+    const size_t live = m_bytes + m_entries.size() * RECORD_HEADER;
+    if( m_file_bytes >= COMPACT_MIN_BYTES && m_file_bytes - live > m_file_bytes / 2 ){
+        compact();
+    }
+    return true;
+}
+
+/**
+ * Drop a tile
+*/
+void TileCache::erase( TileKey const& key ){
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    std::map<TileKey,Entry>::iterator it = m_entries.find( key );
+    if( it != m_entries.end() ){
+        dropEntry( it );
+    }
+}
+
+/**
+ * Write the index to disk
+*/
+void TileCache::flush(){
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if( m_dirty ){
+        writeIndex();
+    }
+}
+
+/**
+ * Check if stores are accepted
+*/
+bool TileCache::writable(){
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_writable;
+}
+
+/**
+ * Get the number of cached tiles
+*/
+size_t TileCache::size(){
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_entries.size();
+}
+
+/**
+ * Get the live payload bytes
+*/
+size_t TileCache::bytes(){
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_bytes;
+}
+
+/**
+ * Get the data file size
+*/
+size_t TileCache::fileBytes(){
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_file_bytes;
+}
+
+/**
+ * Read the index
+*/
+void TileCache::readIndex(){
+
+    std::ifstream fin( m_index_path.c_str(), std::ios::in | std::ios::binary );
+    if( fin.is_open() == false ){
+        return;
+    }
+    std::vector<uint8_t> bytes( (std::istreambuf_iterator<char>( fin )), std::istreambuf_iterator<char>() );
+
+    // anything unexpected means starting over
+    const size_t header = 4 + 4 + 8;
+    if( bytes.size() < header || std::memcmp( bytes.data(), INDEX_MAGIC, 4 ) != 0 ){
+        return;
+    }
+    const uint8_t* cursor = bytes.data() + 4;
+    if( get<uint32_t>( cursor ) != INDEX_VERSION ){
+        return;
+    }
+    const uint64_t count = get<uint64_t>( cursor );
+    if( bytes.size() != header + count * INDEX_ENTRY ){
+        return;
+    }
+
+    for( uint64_t i=0; i<count; i++ ){
+        TileKey key;
+        key.dataset = get<uint64_t>( cursor );
+        key.level   = get<int32_t>( cursor );
+        key.x       = get<int32_t>( cursor );
+        key.y       = get<int32_t>( cursor );
+        Entry entry;
+        entry.size   = get<uint32_t>( cursor );
+        entry.offset = get<uint64_t>( cursor );
+        if( entry.offset + RECORD_HEADER + entry.size > m_file_bytes || m_entries.count( key ) > 0 ){
+            continue;
+        }
+        entry.lru = m_lru.insert( m_lru.end(), key );
+        m_entries[key] = entry;
+        m_bytes += entry.size;
+    }
+
+    // the limit may have shrunk since the index was written
+    while( m_bytes > m_max_bytes && m_lru.empty() == false ){
+        dropEntry( m_entries.find( m_lru.front() ));
+    }
+}
+
+/**
+ * Write the index
+*/
+void TileCache::writeIndex(){
+
+    // readers only ever see whole files
+    const bf::path temporary = m_index_path.parent_path() / bf::unique_path( "%%%%-%%%%-%%%%.tmp" );
+    {
+        std::ofstream fout( temporary.c_str(), std::ios::out | std::ios::binary );
+        fout.write( INDEX_MAGIC, 4 );
+        put( fout, INDEX_VERSION );
+        put( fout, (uint64_t)m_entries.size() );
+        for( std::list<TileKey>::const_iterator it=m_lru.begin(); it!=m_lru.end(); it++ ){
+            Entry const& entry = m_entries.find( *it )->second;
+            put( fout, it->dataset );
+            put( fout, (int32_t)it->level );
+            put( fout, (int32_t)it->x );
+            put( fout, (int32_t)it->y );
+            put( fout, entry.size );
+            put( fout, entry.offset );
+        }
+        if( fout.good() == false ){
+            fout.close();
+            boost::system::error_code error;
+            bf::remove( temporary, error );
+            throw GeneralException("Unable to write " + m_index_path.string(), __FILE__, __LINE__);
+        }
+    }
+    bf::rename( temporary, m_index_path );
+    m_dirty = false;
+}
+
+/**
+ * Drop a tile
+*/
+void TileCache::dropEntry( std::map<TileKey,Entry>::iterator it ){
+    m_bytes -= it->second.size;
+    m_lru.erase( it->second.lru );
+    m_entries.erase( it );
+    m_dirty = true;
+}
+
+/**
+ * Rewrite the data file with only the live payloads
+*/
+bool TileCache::compact(){
+
+    const bf::path temporary = m_data_path.parent_path() / bf::unique_path( "%%%%-%%%%-%%%%.tmp" );
+    try{
+        remap();
+        const uint8_t* base = static_cast<const uint8_t*>( m_region->get_address() );
+
+        // copy the live records, oldest first, moving the entries only once the copy is whole
+        std::vector<uint64_t> offsets;
+        uint64_t offset = 0;
+        {
+            std::ofstream fout( temporary.c_str(), std::ios::out | std::ios::binary );
+            for( std::list<TileKey>::const_iterator it=m_lru.begin(); it!=m_lru.end(); it++ ){
+                Entry const& entry = m_entries.find( *it )->second;
+                fout.write( reinterpret_cast<const char*>( base + entry.offset ), RECORD_HEADER + entry.size );
+                offsets.push_back( offset );
+                offset += RECORD_HEADER + entry.size;
+            }
+            fout.flush();
+            if( fout.good() == false ){
+                fout.close();
+                boost::system::error_code error;
+                bf::remove( temporary, error );
+                disableWrites( "Unable to compact " + m_data_path.string() );
+                return false;
+            }
+        }
+
+        // outstanding views keep the old mapping alive
+        m_data.close();
+        bf::rename( temporary, m_data_path );
+        size_t i = 0;
+        for( std::list<TileKey>::const_iterator it=m_lru.begin(); it!=m_lru.end(); it++ ){
+            m_entries.find( *it )->second.offset = offsets[i++];
+        }
+        m_file_bytes = offset;
+        remap();
+        m_data.open( m_data_path.c_str(), std::ios::out | std::ios::binary | std::ios::app );
+        if( m_data.is_open() == false ){
+            disableWrites( "Unable to open " + m_data_path.string() );
+            return false;
+        }
+        writeIndex();
+    }
+    catch( std::exception const& e ){
+        boost::system::error_code error;
+        bf::remove( temporary, error );
+        disableWrites( e.what() );
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Log a failed write and stop storing
+*/
+void TileCache::disableWrites( std::string const& message ){
+
+    if( m_writable ){
+        std::cout << "warning: tile cache is read-only from now on. " << message << std::endl;
+    }
+    m_writable = false;
+    m_data.close();
+}
+
+/**
+ * Map the data file again
+*/
+void TileCache::remap(){
+
+    if( m_file_bytes == 0 ){
+        m_region.reset();
+        return;
+    }
+    bi::file_mapping mapping( m_data_path.c_str(), bi::read_only );
+    m_region.reset( new bi::mapped_region( mapping, bi::read_only, 0, m_file_bytes ));
+}
+
+/**
+ * Hash a dataset file and settings
+*/
+uint64_t dataset_hash( bf::path const& pathname, std::string const& settings ){
+
+    const bf::path absolute = bf::absolute( pathname );
+    std::stringstream sin;
+    sin << absolute.string() << '\n'
+        << bf::file_size( absolute ) << '\n'
+        << bf::last_write_time( absolute ) << '\n'
+        << settings;
+
+    // 64-bit FNV-1a
+    const std::string text = sin.str();
+    uint64_t output = 14695981039346656037ULL;
+    for( size_t i=0; i<text.size(); i++ ){
+        output ^= (uint8_t)text[i];
+        output *= 1099511628211ULL;
+    }
+    return output;
+}
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
@@ -0,0 +1,316 @@
+/**
+ * @file    TileCache.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_TILECACHE_HPP__
+#define __SRC_CPP_TERRAIN_TILECACHE_HPP__
+
+/// C++ Standard Libraries
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * @class TileKey
+ *
+ * Identifies a cached tile.
+*/
+class TileKey{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        TileKey() : dataset(0), level(0), x(0), y(0){}
+
+        /**
+         * Constructor
+        */
+        TileKey( const uint64_t& dataset_, const int& level_, const int& x_, const int& y_ )
+          : dataset(dataset_), level(level_), x(x_), y(y_){}
+
+        /**
+         * Compare keys
+        */
+        bool operator == ( TileKey const& rhs )const{
+            return dataset == rhs.dataset && level == rhs.level && x == rhs.x && y == rhs.y;
+        }
+
+        /**
+         * Order keys
+        */
+        bool operator < ( TileKey const& rhs )const{
+            if( dataset != rhs.dataset ){ return dataset < rhs.dataset; }
+            if( level   != rhs.level   ){ return level   < rhs.level;   }
+            if( y       != rhs.y       ){ return y       < rhs.y;       }
+            return x < rhs.x;
+        }
+
+        /// Hash of the dataset and of the settings the tile depends on
+        uint64_t dataset;
+
+        /// Level of detail
+        int level;
+
+        /// Tile column
+        int x;
+
+        /// Tile row
+        int y;
+
+}; /// End of TileKey Class
+
+
+/**
+ * @class TileView
+ *
+ * Read-only view of a cached payload, straight from the memory map.  The
+ * view keeps its mapping alive, so it stays valid after later stores and
+ * evictions.
+*/
+class TileView{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        TileView() : data(nullptr), size(0){}
+
+        /**
+         * Check if the view is empty, as returned for a miss
+        */
+        bool empty()const{
+            return data == nullptr;
+        }
+
+        /// Mapping holding the payload
+        boost::shared_ptr<boost::interprocess::mapped_region> region;
+
+        /// Payload
+        const uint8_t* data;
+
+        /// Payload size in bytes
+        size_t size;
+
+}; /// End of TileView Class
+
+
+/**
+ * @class TileCache
+ *
+ * Persistent tile cache in two files: a data file which payloads are
+ * appended to and which is read through a memory map, and a compact index
+ * of 32 bytes per tile in least recently used order.
+ *
+ * When the live payloads exceed the size limit the least recently used
+ * tiles are dropped, and the data file is compacted once more than half of
+ * it is dead.  Every payload is preceded by a copy of its key, so an index
+ * left stale by a crash only produces misses.
+ *
+ * Stores come from loader threads, so a failed write, as on a full disk,
+ * never throws.  It is logged once and turns the cache read-only, and
+ * later stores return false.
+ *
+ * All methods are thread-safe.
+*/
+class TileCache{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<TileCache> ptr_t;
+
+        /**
+         * Constructor
+         *
+         * @param[in] directory Cache directory.  Created if missing.
+         * @param[in] max_bytes Limit on the live payload bytes.
+        */
+        TileCache( boost::filesystem::path const& directory, const size_t& max_bytes );
+
+        /**
+         * Destructor.  Writes the index.
+        */
+        ~TileCache();
+
+        /**
+         * Find a tile and mark it recently used
+         *
+         * @return Empty view on a miss.
+        */
+        TileView find( TileKey const& key );
+
+        /**
+         * Copy a tile
+         *
+         * @return False on a miss.
+        */
+        bool load( TileKey const& key, std::vector<uint8_t>& output );
+
+        /**
+         * Store a tile, replacing any cached one
+         *
+         * @return False if the payload is larger than the whole cache, or if
+         *         the cache is read-only after a failed write.
+        */
+        bool store( TileKey const& key, const uint8_t* data, const size_t& size );
+
+        /**
+         * Store a tile
+        */
+        bool store( TileKey const& key, std::vector<uint8_t> const& data ){
+            return store( key, data.data(), data.size() );
+        }
+
+        /**
+         * Drop a tile
+        */
+        void erase( TileKey const& key );
+
+        /**
+         * Write the index to disk
+        */
+        void flush();
+
+        /**
+         * Check if stores are accepted, false after a failed write
+        */
+        bool writable();
+
+        /**
+         * Get the number of cached tiles
+        */
+        size_t size();
+
+        /**
+         * Get the live payload bytes
+        */
+        size_t bytes();
+
+        /**
+         * Get the data file size in bytes, including dead payloads
+        */
+        size_t fileBytes();
+
+    private:
+
+        /// Cached tile
+        struct Entry{
+
+            /// Record offset in the data file
+            uint64_t offset;
+
+            /// Payload size
+            uint32_t size;
+
+            /// Position in the LRU list
+            std::list<TileKey>::iterator lru;
+
+        }; /// End of Entry Structure
+
+        /**
+         * Read the index, dropping entries past the end of the data file
+        */
+        void readIndex();
+
+        /**
+         * Write the index.  The caller holds the mutex.
+        */
+        void writeIndex();
+
+        /**
+         * Drop a tile.  The caller holds the mutex.
+        */
+        void dropEntry( std::map<TileKey,Entry>::iterator it );
+
+        /**
+         * Rewrite the data file with only the live payloads.  The caller holds the mutex.
+         *
+         * @return False if the new file could not be written.  The old one is kept.
+        */
+        bool compact();
+
+        /**
+         * Log a failed write and stop storing.  The caller holds the mutex.
+        */
+        void disableWrites( std::string const& message );
+
+        /**
+         * Map the data file again after it grew.  The caller holds the mutex.
+        */
+        void remap();
+
+        /// Do not allow copies
+        TileCache( TileCache const& );
+        TileCache& operator = ( TileCache const& );
+
+        /// Index file
+        boost::filesystem::path m_index_path;
+
+        /// Data file
+        boost::filesystem::path m_data_path;
+
+        /// Live payload limit
+        size_t m_max_bytes;
+
+        /// Live payload bytes
+        size_t m_bytes;
+
+        /// Data file size
+        size_t m_file_bytes;
+
+        /// Tiles
+        std::map<TileKey,Entry> m_entries;
+
+        /// Keys from least to most recently used
+        std::list<TileKey> m_lru;
+
+        /// Appends to the data file
+        std::ofstream m_data;
+
+        /// Current mapping of the data file, null while it is empty
+        boost::shared_ptr<boost::interprocess::mapped_region> m_region;
+
+        /// Set when the index needs writing
+        bool m_dirty;
+
+        /// Cleared by a failed write
+        bool m_writable;
+
+        /// Guards everything
+        std::mutex m_mutex;
+
+}; /// End of TileCache Class
+
+
+/**
+ * Hash a dataset file and the settings derived tiles depend on
+ *
+ * The hash covers the absolute path, size and modification time of the
+ * file, so tiles of an edited dataset are never reused.
+ *
+ * @param[in] pathname Dataset file.
+ * @param[in] settings Anything else the tiles depend on, like a tile size.
+*/
+uint64_t dataset_hash( boost::filesystem::path const& pathname, std::string const& settings = "" );
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * @file    TileStreamer.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "TileStreamer.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * Constructor
+*/
+TileStreamer::TileStreamer( TerrainQuadtree::ptr_t tree,
+                            const int& threads,
+                            const int& capacity )
+                              : m_tree(tree),
+                                m_pending(0),
+                                m_pool(std::max(capacity,1), std::max(capacity,1)){
+
+    if( m_tree == nullptr ){
+        throw GeneralException("Terrain quadtree is null.", __FILE__, __LINE__);
+    }
+    m_state.resize( m_tree->nodes().size(), NONE );
+
+    m_pool.start( std::bind( &TileStreamer::load, this, std::placeholders::_1 ),
+                  &TileStreamer::failed,
+                  threads );
+}
+
+/**
+ * Destructor
+*/
+TileStreamer::~TileStreamer(){
+    stop();
+}
+
+/**
+ * Request a node
+*/
+bool TileStreamer::request( const int& node ){
+
+    if( node < 0 || node >= (int)m_state.size() ){
+        throw GeneralException("Node index out of range.", __FILE__, __LINE__);
+    }
+    if( m_state[node] != NONE || m_pool.request( node ) == false ){
+        return false;
+    }
+    m_state[node] = PENDING;
+    m_pending++;
+    return true;
+}
+
+/**
+ * Forget a node
+*/
+void TileStreamer::release( const int& node ){
+
+    if( m_state[node] == PENDING ){
+        m_pending--;
+    }
+    m_state[node] = NONE;
+}
+
+/**
+ * Collect finished buffers
+*/
+std::vector<TileStagingBuffer::ptr_t> TileStreamer::poll( const size_t& byte_budget ){
+
+    std::vector<TileStagingBuffer::ptr_t> output;
+    size_t used = 0;
+    for(;;){
+
+        TileStagingBuffer::ptr_t buffer = m_held;
+        m_held.reset();
+        if( buffer == nullptr && m_pool.collect( buffer ) == false ){
+            break;
+        }
+
+        // released while in flight, or released and requested again
+        if( m_state[buffer->node] != PENDING ){
+            continue;
+        }
+
+        // keep it for the next frame
+        const size_t bytes = buffer->bytes();
+        if( output.empty() == false && used + bytes > byte_budget ){
+            m_held = buffer;
+            break;
+        }
+        used += bytes;
+        m_state[buffer->node] = buffer->error.empty() ? RESIDENT : NONE;
+        m_pending--;
+        output.push_back( buffer );
+    }
+    return output;
+}
+
+/**
+ * Stop the loader threads
+*/
+void TileStreamer::stop(){
+    m_pool.stop();
+}
+
+/**
+ * Build the buffer of a node
+*/
+TileStagingBuffer::ptr_t TileStreamer::load( const int& node ){
+
+    TileStagingBuffer::ptr_t buffer( new TileStagingBuffer() );
+    buffer->node = node;
+
+    QuadtreeNode const& tile = m_tree->node( node );
+    if( m_mesh_cache != nullptr ){
+        buffer->mesh = m_mesh_cache->load( tile );
+    }
+    if( buffer->mesh == nullptr ){
+        buffer->mesh.reset( new QuantizedMesh( quantize_mesh( *m_tree->buildMesh( node ))));
+        if( m_mesh_cache != nullptr ){
+            m_mesh_cache->store( tile, *buffer->mesh );
+        }
+    }
+    if( m_texture_loader ){
+        m_texture_loader( tile, *buffer );
+    }
+    return buffer;
+}
+
+/**
+ * Build the buffer of a failed node
+*/
+TileStagingBuffer::ptr_t TileStreamer::failed( const int& node, std::string const& error ){
+
+    TileStagingBuffer::ptr_t buffer( new TileStagingBuffer() );
+    buffer->node = node;
+    buffer->error = error;
+    return buffer;
+}
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
@@ -0,0 +1,244 @@
+/**
+ * @file    TileStreamer.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_TILESTREAMER_HPP__
+#define __SRC_CPP_TERRAIN_TILESTREAMER_HPP__
+
+/// C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/terrain/QuantizedMesh.hpp>
+#include <GeoExplore/terrain/TerrainMeshCache.hpp>
+#include <GeoExplore/terrain/TerrainQuadtree.hpp>
+#include <GeoExplore/utilities/LoaderPool.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * @class TileStagingBuffer
+ *
+ * Everything needed to upload one quadtree node to the GPU.  The vertex
+ * and index arrays of the quantized mesh are contiguous and interleaved,
+ * so they go to buffer objects as they are.
+ *
+ * A buffer whose loader failed has no mesh or texture, only the error.
+*/
+class TileStagingBuffer{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<TileStagingBuffer> ptr_t;
+
+        /**
+         * Constructor
+        */
+        TileStagingBuffer() : node(-1), texture_rows(0), texture_cols(0), texture_channels(0){}
+
+        /**
+         * Get the number of bytes to upload
+        */
+        size_t bytes()const{
+            return texels.size() + (( mesh != nullptr ) ? mesh->bytes() : 0 );
+        }
+
+        /// Quadtree node index
+        int node;
+
+        /// Skirted node mesh
+        QuantizedMesh::ptr_t mesh;
+
+        /// Texture pixels, row-major with interleaved channels.  Empty without a texture.
+        std::vector<uint8_t> texels;
+
+        /// Texture rows
+        int texture_rows;
+
+        /// Texture columns
+        int texture_cols;
+
+        /// Texture channels
+        int texture_channels;
+
+        /// Loader error, empty on success
+        std::string error;
+
+}; /// End of TileStagingBuffer Class
+
+
+/**
+ * @class TileStreamer
+ *
+ * Builds quadtree node meshes and textures on background threads and hands
+ * them to the render thread.
+ *
+ * The render thread calls request() for the nodes it wants and poll() once
+ * per frame.  Requests and finished buffers both travel through a
+ * LoaderPool, and poll() never waits, so a frame is never stalled by a
+ * loader.  poll() limits the bytes it returns to a per-frame upload budget.
+ *
+ * request(), release() and poll() must all be called from the same thread.
+*/
+class TileStreamer{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<TileStreamer> ptr_t;
+
+        /// Fills the texture of a staging buffer.  Called on the loader threads.
+        typedef std::function<void( QuadtreeNode const&, TileStagingBuffer& )> texture_loader_t;
+
+        /**
+         * Constructor
+         *
+         * @param[in] tree     Quadtree to stream.
+         * @param[in] threads  Number of loader threads.
+         * @param[in] capacity Maximum number of queued requests and of finished
+         *                     buffers waiting for upload.
+        */
+        TileStreamer( TerrainQuadtree::ptr_t tree,
+                      const int& threads = 2,
+                      const int& capacity = 256 );
+
+        /**
+         * Destructor
+        */
+        ~TileStreamer();
+
+        /**
+         * Set the texture loader.  Must be called before the first request.
+        */
+        void setTextureLoader( texture_loader_t loader ){
+            m_texture_loader = loader;
+        }
+
+        /**
+         * Set the cache of built meshes.  Must be called before the first request.
+         *
+         * Loaders read node meshes from the cache when they can, and store the
+         * ones they have to build.
+        */
+        void setMeshCache( TerrainMeshCache::ptr_t cache ){
+            m_mesh_cache = cache;
+        }
+
+        /**
+         * Request a node
+         *
+         * @return False if the node is already requested or uploaded, or if
+         *         the request queue is full.
+        */
+        bool request( const int& node );
+
+        /**
+         * Forget a node so it can be requested again
+         *
+         * Buffers of released nodes still in flight are dropped by poll().
+        */
+        void release( const int& node );
+
+        /**
+         * Check if a node has been returned by poll() and not released
+        */
+        bool isResident( const int& node )const{
+            return m_state[node] == RESIDENT;
+        }
+
+        /**
+         * Get the number of requested nodes not yet returned by poll()
+        */
+        int pending()const{
+            return m_pending;
+        }
+
+        /**
+         * Collect finished buffers without waiting
+         *
+         * Buffers are returned while their total size fits in the budget.  The
+         * first one is always returned, so a buffer larger than the budget
+         * still gets through.
+         *
+         * @param[in] byte_budget Bytes the caller is willing to upload this frame.
+         *
+         * @return Finished buffers.  Their nodes become resident, except for
+         *         failed buffers, whose nodes can be requested again.
+        */
+        std::vector<TileStagingBuffer::ptr_t> poll( const size_t& byte_budget );
+
+        /**
+         * Wait until a finished buffer is ready for poll().  For callers with
+         * nothing else to do, never the render thread.
+         *
+         * @return False on timeout.
+        */
+        bool wait( const std::chrono::milliseconds& timeout ){
+            return m_held != nullptr || m_pool.wait( timeout );
+        }
+
+        /**
+         * Stop the loader threads.  Queued requests are discarded.
+        */
+        void stop();
+
+    private:
+
+        /// Node states, as seen by the render thread
+        enum NodeState{
+            NONE     = 0,
+            PENDING  = 1,
+            RESIDENT = 2,
+        };
+
+        /**
+         * Build the buffer of a node.  Called on the loader threads.
+        */
+        TileStagingBuffer::ptr_t load( const int& node );
+
+        /**
+         * Build the buffer of a node whose loader failed
+        */
+        static TileStagingBuffer::ptr_t failed( const int& node, std::string const& error );
+
+        /// Do not allow copies
+        TileStreamer( TileStreamer const& );
+        TileStreamer& operator = ( TileStreamer const& );
+
+        /// Quadtree
+        TerrainQuadtree::ptr_t m_tree;
+
+        /// Texture loader
+        texture_loader_t m_texture_loader;
+
+        /// Optional mesh cache
+        TerrainMeshCache::ptr_t m_mesh_cache;
+
+        /// Node states
+        std::vector<char> m_state;
+
+        /// Number of pending nodes
+        int m_pending;
+
+        /// Buffer popped by poll() which did not fit the budget
+        TileStagingBuffer::ptr_t m_held;
+
+        /// Loader threads with the requested nodes and finished buffers
+        LoaderPool<int,TileStagingBuffer::ptr_t> m_pool;
+
+}; /// End of TileStreamer Class
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
@@ -0,0 +1,335 @@
+/**
+ * @file    VirtualTexture.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "VirtualTexture.hpp"
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+
+/// GeoExplore Libraries
+#include <GeoExplore/core/Exceptions.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * Constructor
+*/
+VirtualTexture::VirtualTexture( const int& rows,
+                                const int& cols,
+                                const int& page_size,
+                                const int& atlas_slots,
+                                const int& border,
+                                const int& threads )
+                                  : m_page_size(page_size),
+                                    m_border(border),
+                                    m_atlas_slots(atlas_slots),
+                                    m_dirty_first(0),
+                                    m_dirty_last(-1),
+                                    m_frame(0),
+                                    m_pending(0),
+                                    m_page_dataset(0),
+                                    m_thread_count(std::max(threads,1)),
+                                    m_pool(4096, 256){
+
+    if( rows <= 0 || cols <= 0 || page_size <= 0 || border < 0 ){
+        throw GeneralException("Invalid virtual texture size.", __FILE__, __LINE__);
+    }
+    if( atlas_slots < 2 || atlas_slots > 256 ){
+        throw GeneralException("Virtual texture atlas must have 2 to 256 slots per side.", __FILE__, __LINE__);
+    }
+
+    // halve the image until it fits in one page
+    int level_cols = cols, level_rows = rows, table_rows = 0;
+    for(;;){
+        m_pages_x.push_back( ( level_cols + page_size - 1 ) / page_size );
+        m_pages_y.push_back( ( level_rows + page_size - 1 ) / page_size );
+        m_row_offsets.push_back( table_rows );
+        table_rows += m_pages_y.back();
+        m_state.push_back( std::vector<char>( m_pages_x.back() * m_pages_y.back(), NONE ));
+        m_slots.push_back( std::vector<int>( m_pages_x.back() * m_pages_y.back(), -1 ));
+        if( m_pages_x.back() == 1 && m_pages_y.back() == 1 ){
+            break;
+        }
+        level_cols = ( level_cols + 1 ) / 2;
+        level_rows = ( level_rows + 1 ) / 2;
+    }
+
+    m_table.resize( (size_t)m_pages_x[0] * table_rows, 0 );
+    m_slot_pages.resize( atlas_slots * atlas_slots, VirtualPage( -1, 0, 0 ));
+    m_slot_frames.resize( atlas_slots * atlas_slots, -1 );
+}
+
+/**
+ * Destructor
+*/
+VirtualTexture::~VirtualTexture(){
+    stop();
+}
+
+/**
+ * Set the page loader
+*/
+void VirtualTexture::setPageLoader( page_loader_t loader ){
+
+    if( m_page_loader ){
+        throw GeneralException("Page loader already set.", __FILE__, __LINE__);
+    }
+    m_page_loader = loader;
+    m_pool.start( std::bind( &VirtualTexture::load, this, std::placeholders::_1 ),
+                  &VirtualTexture::failed,
+                  m_thread_count );
+
+    // the coarsest page is the fallback for everything
+    touch( VirtualPage( levels() - 1, 0, 0 ));
+}
+
+/**
+ * Keep loaded pages in a tile cache
+*/
+void VirtualTexture::setPageCache( TileCache::ptr_t cache, const uint64_t& dataset ){
+
+    if( m_page_loader ){
+        throw GeneralException("Page cache must be set before the page loader.", __FILE__, __LINE__);
+    }
+    m_page_cache = cache;
+    m_page_dataset = dataset;
+}
+
+/**
+ * Get the changed page table rows
+*/
+bool VirtualTexture::takeDirtyRows( int& first, int& count ){
+
+    if( m_dirty_first > m_dirty_last ){
+        return false;
+    }
+    first = m_dirty_first;
+    count = m_dirty_last - m_dirty_first + 1;
+    m_dirty_first = 0;
+    m_dirty_last = -1;
+    return true;
+}
+
+/**
+ * Request the pages covering a region
+*/
+void VirtualTexture::request( const int& level, Rect const& region ){
+
+    const int finest = std::max( 0, std::min( level, levels() - 1 ));
+    for( int l=levels()-1; l>=finest; l-- ){
+
+        const int pixels = m_page_size << l;
+        const int x0 = std::max( region.x(), 0 ) / pixels;
+        const int y0 = std::max( region.y(), 0 ) / pixels;
+        const int x1 = std::min( ( region.x() + region.width()  - 1 ) / pixels, m_pages_x[l] - 1 );
+        const int y1 = std::min( ( region.y() + region.height() - 1 ) / pixels, m_pages_y[l] - 1 );
+        for( int y=y0; y<=y1; y++ ){
+            for( int x=x0; x<=x1; x++ ){
+                touch( VirtualPage( l, x, y ));
+            }
+        }
+    }
+}
+
+/**
+ * Place finished pages in the atlas
+*/
+std::vector<PageBuffer::ptr_t> VirtualTexture::poll( const int& max_pages ){
+
+    std::vector<PageBuffer::ptr_t> output;
+    while( (int)output.size() < max_pages ){
+
+        PageBuffer::ptr_t buffer = m_held;
+        m_held.reset();
+        if( buffer == nullptr && m_pool.collect( buffer ) == false ){
+            break;
+        }
+
+        // failed pages go back to unrequested
+        if( buffer->error.empty() == false ){
+            VirtualPage const& page = buffer->page;
+            m_state[page.level][page.y * m_pages_x[page.level] + page.x] = NONE;
+            m_pending--;
+            output.push_back( buffer );
+            continue;
+        }
+
+        // every slot is needed by this frame, try again next frame
+        const int slot = allocateSlot();
+        if( slot < 0 ){
+            m_held = buffer;
+            break;
+        }
+
+        VirtualPage const& page = buffer->page;
+        const int index = page.y * m_pages_x[page.level] + page.x;
+        m_slots[page.level][index] = slot;
+        m_state[page.level][index] = RESIDENT;
+        m_slot_pages[slot] = page;
+        m_slot_frames[slot] = m_frame;
+        m_pending--;
+        updateTable( page );
+
+        buffer->slot = slot;
+        output.push_back( buffer );
+    }
+    return output;
+}
+
+/**
+ * Stop the loader threads
+*/
+void VirtualTexture::stop(){
+    m_pool.stop();
+}
+
+/**
+ * Queue a page and mark it used
+*/
+void VirtualTexture::touch( VirtualPage const& page ){
+
+    const int index = page.y * m_pages_x[page.level] + page.x;
+    const int slot = m_slots[page.level][index];
+    if( slot >= 0 ){
+        m_slot_frames[slot] = m_frame;
+        return;
+    }
+    if( m_state[page.level][index] == NONE && m_page_loader && m_pool.request( page )){
+        m_state[page.level][index] = PENDING;
+        m_pending++;
+    }
+}
+
+/**
+ * Find a slot for a page
+*/
+int VirtualTexture::allocateSlot(){
+
+    // free slot, else the least recently used one not needed this frame
+    int output = -1;
+    for( size_t s=0; s<m_slot_pages.size(); s++ ){
+        if( m_slot_pages[s].level < 0 ){
+            return s;
+        }
+        if( m_slot_pages[s].level == levels() - 1 || m_slot_frames[s] >= m_frame ){
+            continue;
+        }
+        if( output < 0 || m_slot_frames[s] < m_slot_frames[output] ){
+            output = s;
+        }
+    }
+    if( output < 0 ){
+        return -1;
+    }
+
+    // evict its page
+    const VirtualPage evicted = m_slot_pages[output];
+    const int index = evicted.y * m_pages_x[evicted.level] + evicted.x;
+    m_slots[evicted.level][index] = -1;
+    m_state[evicted.level][index] = NONE;
+    m_slot_pages[output] = VirtualPage( -1, 0, 0 );
+    updateTable( evicted );
+    return output;
+}
+
+/**
+ * Recompute the page table under a page
+*/
+void VirtualTexture::updateTable( VirtualPage const& page ){
+
+    const size_t cols = m_pages_x[0];
+    for( int l=page.level; l>=0; l-- ){
+
+        // pages of level l under the page, coarser levels first so parents are current
+        const int scale = 1 << ( page.level - l );
+        const int x1 = std::min( ( page.x + 1 ) * scale, m_pages_x[l] );
+        const int y1 = std::min( ( page.y + 1 ) * scale, m_pages_y[l] );
+        for( int y=page.y*scale; y<y1; y++ ){
+            for( int x=page.x*scale; x<x1; x++ ){
+
+                uint32_t entry = 0;
+                const int slot = m_slots[l][y * m_pages_x[l] + x];
+                if( slot >= 0 ){
+                    entry = (uint32_t)( slot % m_atlas_slots ) |
+                            (uint32_t)( slot / m_atlas_slots ) << 8 |
+                            (uint32_t)l << 16 | 0xff000000u;
+                }
+                else if( l + 1 < levels() ){
+                    entry = m_table[( m_row_offsets[l+1] + y / 2 ) * cols + x / 2];
+                }
+                m_table[( m_row_offsets[l] + y ) * cols + x] = entry;
+            }
+        }
+        const int first = m_row_offsets[l] + page.y * scale;
+        const int last  = m_row_offsets[l] + y1 - 1;
+        if( m_dirty_first > m_dirty_last ){
+            m_dirty_first = first;
+            m_dirty_last  = last;
+        }
+        else{
+            m_dirty_first = std::min( m_dirty_first, first );
+            m_dirty_last  = std::max( m_dirty_last, last );
+        }
+    }
+}
+
+/**
+ * Read a page
+*/
+PageBuffer::ptr_t VirtualTexture::load( VirtualPage const& page ){
+
+    PageBuffer::ptr_t buffer( new PageBuffer() );
+    buffer->page = page;
+    buffer->texels.resize( (size_t)slotSize() * slotSize() * 3, 0 );
+
+    // cached pages are stored ready to upload
+    const TileKey key( m_page_dataset, page.level, page.x, page.y );
+    TileView view;
+    if( m_page_cache != nullptr ){
+        view = m_page_cache->find( key );
+    }
+    if( view.empty() == false && view.size == buffer->texels.size() ){
+        std::copy( view.data, view.data + view.size, buffer->texels.begin() );
+    }
+    else{
+        m_page_loader( page, *buffer );
+        if( m_page_cache != nullptr ){
+            m_page_cache->store( key, buffer->texels );
+        }
+    }
+    return buffer;
+}
+
+/**
+ * Build the buffer of a failed page
+*/
+PageBuffer::ptr_t VirtualTexture::failed( VirtualPage const& page, std::string const& error ){
+
+    PageBuffer::ptr_t buffer( new PageBuffer() );
+    buffer->page = page;
+    buffer->error = error;
+    return buffer;
+}
+
+/**
+ * Choose the virtual texture level for a view
+*/
+int select_page_level( const double& texel_meters,
+                       const double& distance,
+                       LodView const& view,
+                       const int& levels ){
+
+    const double pixel_meters = 2 * std::max( distance, 1e-6 ) * std::tan( view.fov_y / 2 ) / view.viewport_height;
+    const double ratio = pixel_meters / texel_meters;
+    if( ratio <= 1 ){
+        return 0;
+    }
+    return std::min( (int)std::floor( std::log2( ratio ) + 1e-9 ), levels - 1 );
+}
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
@@ -0,0 +1,452 @@
+/**
+ * @file    VirtualTexture.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __SRC_CPP_TERRAIN_VIRTUALTEXTURE_HPP__
+#define __SRC_CPP_TERRAIN_VIRTUALTEXTURE_HPP__
+
+/// C++ Standard Libraries
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/shared_ptr.hpp>
+
+/// GeoExplore Libraries
+#include <GeoExplore/image/Rect.hpp>
+#include <GeoExplore/terrain/TerrainQuadtree.hpp>
+#include <GeoExplore/terrain/TileCache.hpp>
+#include <GeoExplore/utilities/LoaderPool.hpp>
+
+namespace GEO{
+namespace TERRAIN{
+
+/**
+ * @class VirtualPage
+ *
+ * Page of a virtual texture.  Level n pages cover the image downsampled
+ * by 2^n.
+*/
+class VirtualPage{
+
+    public:
+
+        /**
+         * Constructor
+        */
+        VirtualPage() : level(0), x(0), y(0){}
+
+        /**
+         * Constructor
+        */
+        VirtualPage( const int& level_, const int& x_, const int& y_ ) : level(level_), x(x_), y(y_){}
+
+        /**
+         * Compare pages
+        */
+        bool operator == ( VirtualPage const& rhs )const{
+            return level == rhs.level && x == rhs.x && y == rhs.y;
+        }
+
+        /// Mip level
+        int level;
+
+        /// Page column
+        int x;
+
+        /// Page row
+        int y;
+
+}; /// End of VirtualPage Class
+
+
+/**
+ * @class PageBuffer
+ *
+ * Pixels of one page, with its border, ready to copy into an atlas slot.
+ * A page whose loader failed has no slot, only the error.
+*/
+class PageBuffer{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<PageBuffer> ptr_t;
+
+        /**
+         * Constructor
+        */
+        PageBuffer() : slot(-1){}
+
+        /// Page
+        VirtualPage page;
+
+        /// Atlas slot, assigned by VirtualTexture::poll
+        int slot;
+
+        /// RGB pixels, row-major, slot size by slot size
+        std::vector<uint8_t> texels;
+
+        /// Loader error, empty on success
+        std::string error;
+
+}; /// End of PageBuffer Class
+
+
+/**
+ * @class VirtualTexture
+ *
+ * Tiled virtual texture for draping imagery larger than GPU memory.
+ *
+ * The image is cut into square pages at every power of two level.  A fixed
+ * atlas of page slots holds the resident pages, and a page table maps every
+ * page to the slot of its finest resident ancestor, so a lookup always
+ * lands on the best pixels available.  The coarsest level is a single page
+ * which is never evicted.
+ *
+ * The render thread reports the pages each frame needs with request(),
+ * pages are read on background threads by the page loader, and poll()
+ * places finished pages in the atlas, evicting the least recently used
+ * pages not needed by the current frame.
+ *
+ * The page table is one RGBA8 texel per page: slot column, slot row, level
+ * of the page the slot holds, and 255 when valid.  Levels are stacked
+ * vertically, level n starting at tableRowOffset(n).
+ *
+ * All methods except the constructor must be called from the same thread.
+*/
+class VirtualTexture{
+
+    public:
+
+        /// Pointer Type
+        typedef boost::shared_ptr<VirtualTexture> ptr_t;
+
+        /// Fills the texels of a page buffer.  Called on the loader threads.
+        typedef std::function<void( VirtualPage const&, PageBuffer& )> page_loader_t;
+
+        /**
+         * Constructor
+         *
+         * @param[in] rows        Image rows.
+         * @param[in] cols        Image columns.
+         * @param[in] page_size   Page size in pixels, without the border.
+         * @param[in] atlas_slots Slots along each side of the atlas.  At most 256.
+         * @param[in] border      Pixels repeated around each page for filtering.
+         * @param[in] threads     Number of loader threads.
+        */
+        VirtualTexture( const int& rows,
+                        const int& cols,
+                        const int& page_size = 128,
+                        const int& atlas_slots = 32,
+                        const int& border = 1,
+                        const int& threads = 2 );
+
+        /**
+         * Destructor
+        */
+        ~VirtualTexture();
+
+        /**
+         * Set the page loader, start the loader threads and request the
+         * coarsest page.  Must be called once, before the first request.
+        */
+        void setPageLoader( page_loader_t loader );
+
+        /**
+         * Keep loaded pages in a tile cache, so they are read from disk only
+         * once.  Must be called before setPageLoader.
+         *
+         * @param[in] cache   Tile cache, possibly shared with other datasets.
+         * @param[in] dataset Dataset hash, which must cover the page size and border.
+        */
+        void setPageCache( TileCache::ptr_t cache, const uint64_t& dataset );
+
+        /**
+         * Get the number of levels
+        */
+        int levels()const{
+            return (int)m_pages_x.size();
+        }
+
+        /**
+         * Get the page size without the border
+        */
+        int pageSize()const{
+            return m_page_size;
+        }
+
+        /**
+         * Get the page border
+        */
+        int border()const{
+            return m_border;
+        }
+
+        /**
+         * Get the slot size, which is the page size with the border
+        */
+        int slotSize()const{
+            return m_page_size + 2 * m_border;
+        }
+
+        /**
+         * Get the number of slots along each side of the atlas
+        */
+        int atlasSlots()const{
+            return m_atlas_slots;
+        }
+
+        /**
+         * Get the atlas size in pixels
+        */
+        int atlasSize()const{
+            return m_atlas_slots * slotSize();
+        }
+
+        /**
+         * Get the number of page columns of a level
+        */
+        int pagesX( const int& level )const{
+            return m_pages_x[level];
+        }
+
+        /**
+         * Get the number of page rows of a level
+        */
+        int pagesY( const int& level )const{
+            return m_pages_y[level];
+        }
+
+        /**
+         * Get the pixels of a page in level coordinates, with the border.  The
+         * rectangle may extend past the image on the last row and column.
+        */
+        Rect pageRect( VirtualPage const& page )const{
+            return Rect( page.x * m_page_size - m_border, page.y * m_page_size - m_border, slotSize(), slotSize() );
+        }
+
+        /**
+         * Get the first page table row of a level
+        */
+        int tableRowOffset( const int& level )const{
+            return m_row_offsets[level];
+        }
+
+        /**
+         * Get the page table width
+        */
+        int tableCols()const{
+            return m_pages_x[0];
+        }
+
+        /**
+         * Get the page table height
+        */
+        int tableRows()const{
+            return m_row_offsets.back() + m_pages_y.back();
+        }
+
+        /**
+         * Get the page table texels
+        */
+        std::vector<uint32_t> const& table()const{
+            return m_table;
+        }
+
+        /**
+         * Get the page table rows changed since the last call
+         *
+         * @return False if nothing changed.
+        */
+        bool takeDirtyRows( int& first, int& count );
+
+        /**
+         * Check if a page is in the atlas
+        */
+        bool isResident( VirtualPage const& page )const{
+            return m_slots[page.level][page.y * m_pages_x[page.level] + page.x] >= 0;
+        }
+
+        /**
+         * Get the atlas slot of a page, or -1
+        */
+        int slotOf( VirtualPage const& page )const{
+            return m_slots[page.level][page.y * m_pages_x[page.level] + page.x];
+        }
+
+        /**
+         * Get the number of requested pages not yet placed
+        */
+        int pending()const{
+            return m_pending;
+        }
+
+        /**
+         * Start a new frame.  Pages requested before are no longer protected
+         * from eviction.
+        */
+        void nextFrame(){
+            m_frame++;
+        }
+
+        /**
+         * Request the pages covering a region
+         *
+         * The pages of the coarser levels are requested too, so the region
+         * sharpens progressively while it loads.
+         *
+         * @param[in] level  Finest level needed.  Clamped to the valid levels.
+         * @param[in] region Region in full resolution pixels.
+        */
+        void request( const int& level, Rect const& region );
+
+        /**
+         * Place finished pages in the atlas without waiting
+         *
+         * @param[in] max_pages Pages the caller is willing to upload this frame.
+         *
+         * @return Placed pages, with their slots.  Failed pages come back with
+         *         slot -1 and the error, and can be requested again.
+        */
+        std::vector<PageBuffer::ptr_t> poll( const int& max_pages );
+
+        /**
+         * Wait until a loaded page is ready for poll().  For callers with
+         * nothing else to do, never the render thread.
+         *
+         * @return False on timeout.
+        */
+        bool wait( const std::chrono::milliseconds& timeout ){
+            return m_held != nullptr || m_pool.wait( timeout );
+        }
+
+        /**
+         * Stop the loader threads.  Queued requests are discarded.
+        */
+        void stop();
+
+    private:
+
+        /// Page states
+        enum PageState{
+            NONE     = 0,
+            PENDING  = 1,
+            RESIDENT = 2,
+        };
+
+        /**
+         * Queue a page if it is not resident or pending, and mark it used
+        */
+        void touch( VirtualPage const& page );
+
+        /**
+         * Find a slot for a page, evicting if needed
+         *
+         * @return Slot, or -1 if every slot is needed by the current frame.
+        */
+        int allocateSlot();
+
+        /**
+         * Recompute the page table under a page
+        */
+        void updateTable( VirtualPage const& page );
+
+        /**
+         * Read a page, from the cache when possible.  Called on the loader threads.
+        */
+        PageBuffer::ptr_t load( VirtualPage const& page );
+
+        /**
+         * Build the buffer of a page whose loader failed
+        */
+        static PageBuffer::ptr_t failed( VirtualPage const& page, std::string const& error );
+
+        /// Do not allow copies
+        VirtualTexture( VirtualTexture const& );
+        VirtualTexture& operator = ( VirtualTexture const& );
+
+        /// Page size without the border
+        int m_page_size;
+
+        /// Page border
+        int m_border;
+
+        /// Slots along each side of the atlas
+        int m_atlas_slots;
+
+        /// Page columns and rows per level
+        std::vector<int> m_pages_x, m_pages_y;
+
+        /// First page table row of each level
+        std::vector<int> m_row_offsets;
+
+        /// Page table
+        std::vector<uint32_t> m_table;
+
+        /// Changed page table rows, empty when first > last
+        int m_dirty_first, m_dirty_last;
+
+        /// Page states per level
+        std::vector<std::vector<char> > m_state;
+
+        /// Atlas slot of each page per level, -1 if not resident
+        std::vector<std::vector<int> > m_slots;
+
+        /// Page held by each slot, level -1 if free
+        std::vector<VirtualPage> m_slot_pages;
+
+        /// Frame each slot was last needed
+        std::vector<int> m_slot_frames;
+
+        /// Current frame
+        int m_frame;
+
+        /// Number of pending pages
+        int m_pending;
+
+        /// Page loader
+        page_loader_t m_page_loader;
+
+        /// Cache of loaded pages, may be null
+        TileCache::ptr_t m_page_cache;
+
+        /// Dataset hash of the cached pages
+        uint64_t m_page_dataset;
+
+        /// Page popped by poll() which found no free slot
+        PageBuffer::ptr_t m_held;
+
+        /// Number of loader threads to start
+        int m_thread_count;
+
+        /// Loader threads with the requested pages and finished buffers
+        LoaderPool<VirtualPage,PageBuffer::ptr_t> m_pool;
+
+}; /// End of VirtualTexture Class
+
+
+/**
+ * Choose the virtual texture level for a view
+ *
+ * The level is the coarsest whose texels are no larger than a screen pixel
+ * at the given distance.
+ *
+ * @param[in] texel_meters Size of a full resolution texel on the ground.
+ * @param[in] distance     Distance from the eye.
+ * @param[in] view         Camera parameters.
+ * @param[in] levels       Number of levels.
+*/
+int select_page_level( const double& texel_meters,
+                       const double& distance,
+                       LodView const& view,
+                       const int& levels );
+
+} /// End of TERRAIN Namespace
+} /// End of GEO Namespace
+
+#endif
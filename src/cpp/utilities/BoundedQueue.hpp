@@ -0,0 +1,181 @@
+/**
+ * @file    BoundedQueue.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __GEOEXPLORE_UTILITIES_BOUNDEDQUEUE_HPP__
+#define __GEOEXPLORE_UTILITIES_BOUNDEDQUEUE_HPP__
+
+/// C++ Standard Libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace GEO{
+
+/**
+ * @class BoundedQueue
+ *
+ * Lock-free multi-producer multi-consumer queue with a fixed capacity.
+ *
+ * Each cell carries a sequence number which tells producers and consumers
+ * whether the cell is free or full for the current lap around the ring, so
+ * a push or pop is a single compare-and-swap on the shared index.  The
+ * capacity is rounded up to a power of two.
+*/
+template <typename ValueType>
+class BoundedQueue{
+
+    public:
+
+        /**
+         * Constructor
+         *
+         * @param[in] capacity Maximum number of queued values.
+        */
+        BoundedQueue( const size_t& capacity ) : m_enqueue_pos(0), m_dequeue_pos(0){
+
+            // round the capacity to a power of two
+            size_t size = 2;
+            while( size < capacity ){
+                size <<= 1;
+            }
+            m_mask = size - 1;
+
+            m_cells.reset( new Cell[size] );
+            for( size_t i=0; i<size; i++ ){
+                m_cells[i].sequence.store( i, std::memory_order_relaxed );
+            }
+        }
+
+        /**
+         * Push a value
+         *
+         * @return False if the queue is full.
+        */
+        bool try_push( ValueType const& value ){
+            ValueType copy( value );
+            return try_push( std::move(copy) );
+        }
+
+        /**
+         * Push a value
+         *
+         * @return False if the queue is full.  The value is left untouched.
+        */
+        bool try_push( ValueType&& value ){
+
+            Cell* cell;
+            size_t pos = m_enqueue_pos.load( std::memory_order_relaxed );
+            for(;;){
+                cell = &m_cells[pos & m_mask];
+                size_t seq = cell->sequence.load( std::memory_order_acquire );
+                intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+                if( diff == 0 ){
+                    if( m_enqueue_pos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed )){
+                        break;
+                    }
+                }
+                else if( diff < 0 ){
+                    return false;
+                }
+                else{
+                    pos = m_enqueue_pos.load( std::memory_order_relaxed );
+                }
+            }
+
+            cell->data = std::move(value);
+            cell->sequence.store( pos + 1, std::memory_order_release );
+            return true;
+        }
+
+        /**
+         * Pop a value
+         *
+         * @return False if the queue is empty.
+        */
+        bool try_pop( ValueType& value ){
+
+            Cell* cell;
+            size_t pos = m_dequeue_pos.load( std::memory_order_relaxed );
+            for(;;){
+                cell = &m_cells[pos & m_mask];
+                size_t seq = cell->sequence.load( std::memory_order_acquire );
+                intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+                if( diff == 0 ){
+                    if( m_dequeue_pos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed )){
+                        break;
+                    }
+                }
+                else if( diff < 0 ){
+                    return false;
+                }
+                else{
+                    pos = m_dequeue_pos.load( std::memory_order_relaxed );
+                }
+            }
+
+            value = std::move( cell->data );
+            cell->data = ValueType();
+            cell->sequence.store( pos + m_mask + 1, std::memory_order_release );
+            return true;
+        }
+
+        /**
+         * Return the capacity of the queue
+        */
+        size_t capacity()const{
+            return m_mask + 1;
+        }
+
+        /**
+         * Return the approximate number of queued values
+        */
+        size_t size()const{
+            size_t tail = m_enqueue_pos.load( std::memory_order_relaxed );
+            size_t head = m_dequeue_pos.load( std::memory_order_relaxed );
+            return ( tail > head ) ? ( tail - head ) : 0;
+        }
+
+    private:
+
+        /// Do not allow copies
+        BoundedQueue( BoundedQueue const& );
+        BoundedQueue& operator = ( BoundedQueue const& );
+
+        /**
+         * Queue cell
+        */
+        struct Cell{
+            std::atomic<size_t> sequence;
+            ValueType data;
+        };
+
+        /// Cache line size used to keep the indices apart
+        static const size_t CACHE_LINE_SIZE = 64;
+
+        /// Ring buffer
+        std::unique_ptr<Cell[]> m_cells;
+
+        /// Index mask
+        size_t m_mask;
+
+        char m_pad0[CACHE_LINE_SIZE];
+
+        /// Producer index
+        std::atomic<size_t> m_enqueue_pos;
+
+        char m_pad1[CACHE_LINE_SIZE];
+
+        /// Consumer index
+        std::atomic<size_t> m_dequeue_pos;
+
+        char m_pad2[CACHE_LINE_SIZE];
+
+}; /// End of BoundedQueue Class
+
+} /// End of GEO Namespace
+
+#endif
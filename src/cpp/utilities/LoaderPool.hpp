@@ -0,0 +1,260 @@
+/**
+ * @file    LoaderPool.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __GEOEXPLORE_UTILITIES_LOADERPOOL_HPP__
+#define __GEOEXPLORE_UTILITIES_LOADERPOOL_HPP__
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// GeoExplore Libraries
+#include <GeoExplore/utilities/BoundedQueue.hpp>
+
+namespace GEO{
+
+/**
+ * @class LoaderPool
+ *
+ * Background threads turning requests into results for a thread which
+ * must never wait, such as a render thread.
+ *
+ * Requests and results travel through lock-free bounded queues.  Loader
+ * threads sleep on a condition until a request is queued, and while the
+ * result queue is full until a result is collected, so idle loaders cost
+ * nothing.
+ *
+ * Every request produces exactly one result.  When the loader throws, the
+ * failure function builds the result from the request and the error
+ * message, so the caller always learns what happened to a request.
+*/
+template <typename RequestType, typename ResultType>
+class LoaderPool{
+
+    public:
+
+        /// Builds the result of a request.  Called on the loader threads.
+        typedef std::function<ResultType( RequestType const& )> loader_t;
+
+        /// Builds the result of a request whose loader threw
+        typedef std::function<ResultType( RequestType const&, std::string const& )> failure_t;
+
+        /**
+         * Constructor
+         *
+         * @param[in] request_capacity Maximum number of queued requests.
+         * @param[in] result_capacity  Maximum number of results waiting to be collected.
+        */
+        LoaderPool( const size_t& request_capacity,
+                    const size_t& result_capacity )
+                      : m_requests(std::max(request_capacity,(size_t)1)),
+                        m_results(std::max(result_capacity,(size_t)1)),
+                        m_queued(0),
+                        m_taken(0),
+                        m_produced(0),
+                        m_collected(0),
+                        m_stop(false){}
+
+        /**
+         * Destructor
+        */
+        ~LoaderPool(){
+            stop();
+        }
+
+        /**
+         * Start the loader threads.  Must be called once.
+         *
+         * @param[in] loader  Builds results.
+         * @param[in] failure Builds the result of a failed request.
+         * @param[in] threads Number of loader threads.
+        */
+        void start( loader_t loader, failure_t failure, const int& threads ){
+            m_loader = loader;
+            m_failure = failure;
+            for( int i=0; i<std::max(threads,1); i++ ){
+                m_threads.push_back( std::thread( &LoaderPool::worker_loop, this ));
+            }
+        }
+
+        /**
+         * Queue a request
+         *
+         * @return False if the request queue is full.
+        */
+        bool request( RequestType const& value ){
+            if( m_requests.try_push( value ) == false ){
+                return false;
+            }
+            m_queued++;
+            wake( m_request_ready );
+            return true;
+        }
+
+        /**
+         * Collect a result without waiting
+         *
+         * @return False if no result is ready.
+        */
+        bool collect( ResultType& value ){
+            if( m_results.try_pop( value ) == false ){
+                return false;
+            }
+            m_collected++;
+            wake( m_result_room );
+            return true;
+        }
+
+        /**
+         * Wait until a result is ready to collect
+         *
+         * @return False on timeout or once stopped.
+        */
+        bool wait( const std::chrono::milliseconds& timeout ){
+            std::unique_lock<std::mutex> lock( m_mutex );
+            return m_result_ready.wait_for( lock, timeout, [this](){
+                return m_produced > m_collected || m_stop;
+            }) && m_stop == false;
+        }
+
+        /**
+         * Stop the loader threads.  Queued requests are discarded.
+        */
+        void stop(){
+            {
+                std::lock_guard<std::mutex> lock( m_mutex );
+                m_stop = true;
+            }
+            m_request_ready.notify_all();
+            m_result_room.notify_all();
+            m_result_ready.notify_all();
+            for( size_t i=0; i<m_threads.size(); i++ ){
+                m_threads[i].join();
+            }
+            m_threads.clear();
+        }
+
+    private:
+
+        /**
+         * Loader thread loop
+        */
+        void worker_loop(){
+
+            RequestType value;
+            for(;;){
+
+                // sleep until a request arrives
+                if( m_requests.try_pop( value ) == false ){
+                    std::unique_lock<std::mutex> lock( m_mutex );
+                    m_request_ready.wait( lock, [this](){
+                        return m_queued > m_taken || m_stop;
+                    });
+                    if( m_stop ){
+                        return;
+                    }
+                    continue;
+                }
+                m_taken++;
+
+                ResultType result;
+                try{
+                    result = m_loader( value );
+                }
+                catch( std::exception const& e ){
+                    result = m_failure( value, e.what() );
+                }
+                catch( ... ){
+                    result = m_failure( value, "Unknown loader error." );
+                }
+
+                // hand it over, waiting while the result queue is full
+                while( m_results.try_push( std::move(result) ) == false ){
+                    std::unique_lock<std::mutex> lock( m_mutex );
+                    m_result_room.wait( lock, [this](){
+                        // a result may be collected before its loader counts it
+                        const size_t produced  = m_produced;
+                        const size_t collected = m_collected;
+                        return produced < collected || produced - collected < m_results.capacity() || m_stop;
+                    });
+                    if( m_stop ){
+                        return;
+                    }
+                }
+                m_produced++;
+                wake( m_result_ready );
+            }
+        }
+
+        /**
+         * Notify a condition after a count it waits on has changed
+         *
+         * Taking the mutex first means a waiter is either still checking its
+         * predicate, and sees the change, or already asleep and is woken.
+        */
+        void wake( std::condition_variable& condition ){
+            {
+                std::lock_guard<std::mutex> lock( m_mutex );
+            }
+            condition.notify_one();
+        }
+
+        /// Do not allow copies
+        LoaderPool( LoaderPool const& );
+        LoaderPool& operator = ( LoaderPool const& );
+
+        /// Builds results
+        loader_t m_loader;
+
+        /// Builds the results of failed requests
+        failure_t m_failure;
+
+        /// Queued requests
+        BoundedQueue<RequestType> m_requests;
+
+        /// Finished results
+        BoundedQueue<ResultType> m_results;
+
+        /// Number of requests pushed and popped
+        std::atomic<size_t> m_queued;
+        std::atomic<size_t> m_taken;
+
+        /// Number of results pushed and popped
+        std::atomic<size_t> m_produced;
+        std::atomic<size_t> m_collected;
+
+        /// Loader threads
+        std::vector<std::thread> m_threads;
+
+        /// Stop flag
+        std::atomic<bool> m_stop;
+
+        /// Mutex used only for waiting
+        std::mutex m_mutex;
+
+        /// Signalled when a request is queued
+        std::condition_variable m_request_ready;
+
+        /// Signalled when a result is collected
+        std::condition_variable m_result_room;
+
+        /// Signalled when a result is queued
+        std::condition_variable m_result_ready;
+
+}; /// End of LoaderPool Class
+
+} /// End of GEO Namespace
+
+#endif
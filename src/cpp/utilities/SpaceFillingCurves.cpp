@@ -0,0 +1,117 @@
+/**
+ * @file    SpaceFillingCurves.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "SpaceFillingCurves.hpp"
+
+namespace GEO{
+
+/**
+ * Spread the lower 32 bits of a value to the even bits
+*/
+static uint64_t spread_bits( const uint32_t& value ){
+    uint64_t v = value;
+    v = ( v | ( v << 16 )) & 0x0000FFFF0000FFFFULL;
+    v = ( v | ( v <<  8 )) & 0x00FF00FF00FF00FFULL;
+    v = ( v | ( v <<  4 )) & 0x0F0F0F0F0F0F0F0FULL;
+    v = ( v | ( v <<  2 )) & 0x3333333333333333ULL;
+    v = ( v | ( v <<  1 )) & 0x5555555555555555ULL;
+    return v;
+}
+
+/**
+ * Collect the even bits of a value
+*/
+static uint32_t compact_bits( const uint64_t& value ){
+    uint64_t v = value & 0x5555555555555555ULL;
+    v = ( v | ( v >>  1 )) & 0x3333333333333333ULL;
+    v = ( v | ( v >>  2 )) & 0x0F0F0F0F0F0F0F0FULL;
+    v = ( v | ( v >>  4 )) & 0x00FF00FF00FF00FFULL;
+    v = ( v | ( v >>  8 )) & 0x0000FFFF0000FFFFULL;
+    v = ( v | ( v >> 16 )) & 0x00000000FFFFFFFFULL;
+    return (uint32_t)v;
+}
+
+/**
+ * Morton Encode
+*/
+uint64_t morton_encode( const uint32_t& x, const uint32_t& y ){
+    return spread_bits(x) | ( spread_bits(y) << 1 );
+}
+
+/**
+ * Morton Decode
+*/
+void morton_decode( const uint64_t& code, uint32_t& x, uint32_t& y ){
+    x = compact_bits( code );
+    y = compact_bits( code >> 1 );
+}
+
+/**
+ * Hilbert Decode
+*/
+void hilbert_decode( const int& order, const uint64_t& d, uint32_t& x, uint32_t& y ){
+
+    uint64_t t = d;
+    x = 0;
+    y = 0;
+    for( uint64_t s=1; s < ( 1ULL << order ); s <<= 1 ){
+        uint32_t rx = 1 & ( t / 2 );
+        uint32_t ry = 1 & ( t ^ rx );
+
+        // rotate the quadrant
+        if( ry == 0 ){
+            if( rx == 1 ){
+                x = s - 1 - x;
+                y = s - 1 - y;
+            }
+            uint32_t tmp = x;
+            x = y;
+            y = tmp;
+        }
+        x += s * rx;
+        y += s * ry;
+        t /= 4;
+    }
+}
+
+/**
+ * Hilbert Encode
+*/
+uint64_t hilbert_encode( const int& order, const uint32_t& x, const uint32_t& y ){
+
+    uint64_t d = 0;
+    uint32_t px = x, py = y;
+    const uint32_t n = 1U << order;
+    for( uint32_t s = n/2; s > 0; s /= 2 ){
+        uint32_t rx = ( px & s ) > 0;
+        uint32_t ry = ( py & s ) > 0;
+        d += (uint64_t)s * s * (( 3 * rx ) ^ ry );
+
+        // rotate the quadrant
+        if( ry == 0 ){
+            if( rx == 1 ){
+                px = n - 1 - px;
+                py = n - 1 - py;
+            }
+            uint32_t tmp = px;
+            px = py;
+            py = tmp;
+        }
+    }
+    return d;
+}
+
+/**
+ * Compute the curve order
+*/
+int curve_order( const uint32_t& cols, const uint32_t& rows ){
+    int order = 0;
+    while( ( 1U << order ) < cols || ( 1U << order ) < rows ){
+        order++;
+    }
+    return order;
+}
+
+} /// End of GEO Namespace
@@ -0,0 +1,52 @@
+/**
+ * @file    SpaceFillingCurves.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __GEOEXPLORE_UTILITIES_SPACEFILLINGCURVES_HPP__
+#define __GEOEXPLORE_UTILITIES_SPACEFILLINGCURVES_HPP__
+
+/// C++ Standard Libraries
+#include <cstdint>
+
+namespace GEO{
+
+/**
+ * Interleave the bits of x and y into a Morton (Z-order) code
+*/
+uint64_t morton_encode( const uint32_t& x, const uint32_t& y );
+
+/**
+ * Split a Morton code into x and y
+*/
+void morton_decode( const uint64_t& code, uint32_t& x, uint32_t& y );
+
+/**
+ * Convert a position on a Hilbert curve into x and y
+ *
+ * @param[in]  order Curve covers a 2^order by 2^order grid.
+ * @param[in]  d     Distance along the curve.
+ * @param[out] x     Column.
+ * @param[out] y     Row.
+*/
+void hilbert_decode( const int& order, const uint64_t& d, uint32_t& x, uint32_t& y );
+
+/**
+ * Convert x and y into a position on a Hilbert curve
+ *
+ * @param[in] order Curve covers a 2^order by 2^order grid.
+ * @param[in] x     Column.
+ * @param[in] y     Row.
+ *
+ * @return Distance along the curve.
+*/
+uint64_t hilbert_encode( const int& order, const uint32_t& x, const uint32_t& y );
+
+/**
+ * Return the smallest order whose curve covers a grid of the given size
+*/
+int curve_order( const uint32_t& cols, const uint32_t& rows );
+
+} /// End of GEO Namespace
+
+#endif
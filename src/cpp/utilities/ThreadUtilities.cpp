@@ -0,0 +1,23 @@
+/**
+ * @file    ThreadUtilities.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include "ThreadUtilities.hpp"
+
+namespace GEO{
+
+/**
+ * Get the default number of worker threads
+*/
+int default_thread_count(){
+
+    unsigned int count = std::thread::hardware_concurrency();
+    if( count == 0 ){
+        return 1;
+    }
+    return (int)count;
+}
+
+} /// End of GEO Namespace
+
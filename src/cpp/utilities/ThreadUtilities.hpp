@@ -0,0 +1,114 @@
+/**
+ * @file    ThreadUtilities.hpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#ifndef __GEOEXPLORE_UTILITIES_THREADUTILITIES_HPP__
+#define __GEOEXPLORE_UTILITIES_THREADUTILITIES_HPP__
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace GEO{
+
+/**
+ * Get the default number of worker threads
+ *
+ * @return hardware concurrency, or 1 if it cannot be determined.
+*/
+int default_thread_count();
+
+/**
+ * Run a function over the range [begin, end) using a set of worker threads.
+ *
+ * Work is handed out in chunks from a shared counter, so uneven work items
+ * (such as files of different sizes) are balanced across threads.  The first
+ * exception thrown by a worker is rethrown on the calling thread after all
+ * workers have joined.
+ *
+ * @param[in] begin       First index.
+ * @param[in] end         One past the last index.
+ * @param[in] func        Callable as func(index, thread_id).
+ * @param[in] num_threads Number of threads to use.  Values <= 0 use the default.
+ * @param[in] chunk_size  Number of indices claimed at a time.
+*/
+template <typename FunctionType>
+void parallel_for( const size_t& begin,
+                   const size_t& end,
+                   FunctionType  func,
+                   int           num_threads = 0,
+                   const size_t& chunk_size = 1 ){
+
+    // nothing to do
+    if( end <= begin ){
+        return;
+    }
+
+    // compute the number of threads to launch
+    if( num_threads <= 0 ){
+        num_threads = default_thread_count();
+    }
+    const size_t chunk = std::max<size_t>( chunk_size, 1 );
+    const size_t chunk_count = (end - begin + chunk - 1) / chunk;
+    num_threads = (int)std::min<size_t>( num_threads, chunk_count );
+
+    // run inline if we only have one thread
+    if( num_threads <= 1 ){
+        for( size_t i=begin; i<end; i++ ){
+            func( i, 0 );
+        }
+        return;
+    }
+
+    // shared work counter and first error
+    std::atomic<size_t> next_index( begin );
+    std::atomic<bool>   error_flag( false );
+    std::vector<std::exception_ptr> errors( num_threads );
+
+    // worker body
+    auto worker = [&]( const int thread_id ){
+        try{
+            while( error_flag.load() == false ){
+
+                // claim the next chunk
+                size_t start = next_index.fetch_add( chunk );
+                if( start >= end ){
+                    break;
+                }
+                size_t stop = std::min( start + chunk, end );
+                for( size_t i=start; i<stop; i++ ){
+                    func( i, thread_id );
+                }
+            }
+        } catch (...){
+            errors[thread_id] = std::current_exception();
+            error_flag = true;
+        }
+    };
+
+    // launch the workers, using the calling thread as worker 0
+    std::vector<std::thread> threads;
+    for( int t=1; t<num_threads; t++ ){
+        threads.push_back( std::thread( worker, t ));
+    }
+    worker( 0 );
+    for( size_t t=0; t<threads.size(); t++ ){
+        threads[t].join();
+    }
+
+    // rethrow the first error
+    for( size_t t=0; t<errors.size(); t++ ){
+        if( errors[t] ){
+            std::rethrow_exception( errors[t] );
+        }
+    }
+}
+
+} /// End of GEO Namespace
+
+#endif
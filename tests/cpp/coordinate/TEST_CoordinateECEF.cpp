@@ -0,0 +1,152 @@
+/**
+ * @file    TEST_CoordinateECEF.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cmath>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test the ECEF coordinate class
+*/
+TEST( CoordinateECEF, Constructors ){
+
+    GEO::CoordinateECEF_d test01;
+    ASSERT_NEAR( test01.x(), 0, 1e-9 );
+    ASSERT_NEAR( test01.y(), 0, 1e-9 );
+    ASSERT_NEAR( test01.z(), 0, 1e-9 );
+    ASSERT_EQ( test01.datum(), GEO::Datum::WGS84 );
+    ASSERT_EQ( test01.type(), GEO::CoordinateType::ECEF );
+    ASSERT_EQ( GEO::CoordinateType2String( test01.type() ), "ECEF" );
+
+    GEO::CoordinateECEF_d test02( 1, 2, 3, GEO::Datum::NAD83 );
+    GEO::CoordinateECEF_d::ptr_t test03 = test02.clone();
+    ASSERT_NEAR( test03->x(), 1, 1e-9 );
+    ASSERT_NEAR( test03->y(), 2, 1e-9 );
+    ASSERT_NEAR( test03->z(), 3, 1e-9 );
+    ASSERT_EQ( test03->datum(), GEO::Datum::NAD83 );
+}
+
+/**
+ * Test converting single points
+*/
+TEST( CoordinateECEF, Convert ){
+
+    double x, y, z, latitude, longitude, altitude;
+
+    // the axes
+    GEO::geodetic_to_ecef( 0, 0, 0, x, y, z );
+    ASSERT_NEAR( x, 6378137, 1e-6 );
+    ASSERT_NEAR( y, 0, 1e-6 );
+    ASSERT_NEAR( z, 0, 1e-6 );
+    GEO::geodetic_to_ecef( 0, 90, 100, x, y, z );
+    ASSERT_NEAR( x, 0, 1e-6 );
+    ASSERT_NEAR( y, 6378237, 1e-6 );
+    GEO::geodetic_to_ecef( 90, 0, 0, x, y, z );
+    ASSERT_NEAR( x, 0, 1e-6 );
+    ASSERT_NEAR( z, 6356752.314245, 1e-6 );
+
+    GEO::ecef_to_geodetic( 0, 0, -6356752.314245 - 50, latitude, longitude, altitude );
+    ASSERT_NEAR( latitude, -90, 1e-12 );
+    ASSERT_NEAR( altitude, 50, 1e-6 );
+
+    // from the mantle out past geostationary orbit
+    const double altitudes[] = { -6300000, -50000, -100, 0, 100, 9000, 400000, 36000000 };
+    for( size_t h=0; h<sizeof(altitudes)/sizeof(altitudes[0]); h++ ){
+        for( double lat=-90; lat<=90; lat+=2.5 ){
+            for( double lon=-180; lon<180; lon+=7.5 ){
+                GEO::geodetic_to_ecef( lat, lon, altitudes[h], x, y, z );
+                GEO::ecef_to_geodetic( x, y, z, latitude, longitude, altitude );
+                ASSERT_NEAR( latitude, lat, 1e-9 ) << lat << ", " << lon << ", " << altitudes[h];
+                ASSERT_NEAR( altitude, altitudes[h], 1e-5 ) << lat << ", " << lon << ", " << altitudes[h];
+                if( std::fabs( lat ) < 90 ){
+                    ASSERT_NEAR( longitude, lon, 1e-9 ) << lat << ", " << lon << ", " << altitudes[h];
+                }
+            }
+        }
+    }
+
+    // near the center of the Earth latitudes are ambiguous, check the position instead
+    const double points[][3] = { { 10000, 0, 0 }, { 30000, 20000, 0 }, { 0, 0, 1000 }, { 5000, 0, 1 }, { 0, 0, 0 } };
+    for( size_t i=0; i<sizeof(points)/sizeof(points[0]); i++ ){
+        GEO::ecef_to_geodetic( points[i][0], points[i][1], points[i][2], latitude, longitude, altitude );
+        ASSERT_LT( altitude, -6300000 );
+        GEO::geodetic_to_ecef( latitude, longitude, altitude, x, y, z );
+        ASSERT_NEAR( x, points[i][0], 1e-5 ) << i;
+        ASSERT_NEAR( y, points[i][1], 1e-5 ) << i;
+        ASSERT_NEAR( z, points[i][2], 1e-5 ) << i;
+    }
+}
+
+/**
+ * Test the batch conversions
+*/
+TEST( CoordinateECEF, Batch ){
+
+    const size_t count = 10000;
+    std::vector<double> latitudes( count ), longitudes( count ), altitudes( count );
+    for( size_t i=0; i<count; i++ ){
+        latitudes[i]  = -89.5 + std::fmod( i * 0.37, 179.0 );
+        longitudes[i] = -179.5 + std::fmod( i * 1.13, 359.0 );
+        altitudes[i]  = std::fmod( i * 17.0, 20000.0 ) - 500;
+    }
+
+    std::vector<double> x( count ), y( count ), z( count );
+    GEO::geodetic_to_ecef( count, latitudes.data(), longitudes.data(), altitudes.data(), x.data(), y.data(), z.data(), 4 );
+
+    std::vector<double> lat( count ), lon( count ), alt( count );
+    GEO::ecef_to_geodetic( count, x.data(), y.data(), z.data(), lat.data(), lon.data(), alt.data(), 4 );
+
+    double ex, ey, ez;
+    for( size_t i=0; i<count; i++ ){
+        GEO::geodetic_to_ecef( latitudes[i], longitudes[i], altitudes[i], ex, ey, ez );
+        ASSERT_EQ( x[i], ex );
+        ASSERT_EQ( y[i], ey );
+        ASSERT_EQ( z[i], ez );
+        ASSERT_NEAR( lat[i], latitudes[i], 1e-9 );
+        ASSERT_NEAR( lon[i], longitudes[i], 1e-9 );
+        ASSERT_NEAR( alt[i], altitudes[i], 1e-6 );
+    }
+}
+
+/**
+ * Test conversions through the coordinate classes
+*/
+TEST( CoordinateECEF, Conversion ){
+
+    GEO::CoordinateECEF_d ecef = GEO::convert_Geodetic2ECEF( GEO::CoordinateGeodetic_d( 0, 0, 10 ));
+    ASSERT_NEAR( ecef.x(), 6378147, 1e-6 );
+    GEO::CoordinateGeodetic_d geodetic = GEO::convert_ECEF2Geodetic( ecef );
+    ASSERT_NEAR( geodetic.latitude(), 0, 1e-12 );
+    ASSERT_NEAR( geodetic.altitude(), 10, 1e-6 );
+
+    // through the coordinate pointers, MGRS passes through geodetic at the corner of its square
+    GEO::CoordinateBase_d::ptr_t input( new GEO::CoordinateMGRS_d( "18SUJ2339407396", 10 ));
+    GEO::CoordinateBase_d::ptr_t output = GEO::convert_coordinate<double>( input, GEO::CoordinateType::ECEF, GEO::Datum::WGS84 );
+    ASSERT_EQ( output->type(), GEO::CoordinateType::ECEF );
+    ecef = *boost::static_pointer_cast<GEO::CoordinateECEF_d>( output );
+    geodetic = GEO::convert_MGRS2Geodetic( *boost::static_pointer_cast<GEO::CoordinateMGRS_d>( input ));
+    ASSERT_NEAR( ecef.x(), GEO::convert_Geodetic2ECEF( geodetic ).x(), 1e-6 );
+    ASSERT_NEAR( ecef.y(), GEO::convert_Geodetic2ECEF( geodetic ).y(), 1e-6 );
+    ASSERT_NEAR( ecef.z(), GEO::convert_Geodetic2ECEF( geodetic ).z(), 1e-6 );
+
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::Geodetic, GEO::Datum::WGS84 );
+    ASSERT_EQ( output->type(), GEO::CoordinateType::Geodetic );
+    ASSERT_NEAR( output->altitude(), 10, 1e-6 );
+
+    GEO::CoordinateBase_d::ptr_t mgrs = GEO::convert_coordinate<double>( output, GEO::CoordinateType::MGRS, GEO::Datum::WGS84 );
+    ASSERT_EQ( boost::static_pointer_cast<GEO::CoordinateMGRS_d>( mgrs )->toString( 4 ), "18SUJ23390739" );
+
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::ECEF, GEO::Datum::WGS84 );
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::ECEF, GEO::Datum::WGS84 );
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateECEF_d>( output )->x(), ecef.x(), 1e-6 );
+
+    // datum changes are not supported
+    ASSERT_THROW( GEO::convert_coordinate<double>( input, GEO::CoordinateType::ECEF, GEO::Datum::NAD83 ), GEO::GeneralException );
+}
@@ -0,0 +1,163 @@
+/**
+ * @file    TEST_CoordinateLocal.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cmath>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test the axes of the tangent frames
+*/
+TEST( CoordinateLocal, Frame ){
+
+    double a, b, c, x, y, z;
+
+    // at 0,0 east is +y, north is +z and up is +x
+    GEO::LocalTangentFrame enu( 0, 0, 0 );
+    ASSERT_EQ( enu.type(), GEO::CoordinateType::ENU );
+    enu.fromECEF( 6378137 + 10, 5, 7, a, b, c );
+    ASSERT_NEAR( a, 5, 1e-9 );
+    ASSERT_NEAR( b, 7, 1e-9 );
+    ASSERT_NEAR( c, 10, 1e-9 );
+
+    GEO::LocalTangentFrame ned( 0, 0, 0, GEO::CoordinateType::NED );
+    ned.fromECEF( 6378137 + 10, 5, 7, a, b, c );
+    ASSERT_NEAR( a, 7, 1e-9 );
+    ASSERT_NEAR( b, 5, 1e-9 );
+    ASSERT_NEAR( c, -10, 1e-9 );
+
+    ASSERT_THROW( GEO::LocalTangentFrame( 0, 0, 0, GEO::CoordinateType::UTM ), GEO::GeneralException );
+
+    // a point straight above the reference is only up
+    GEO::LocalTangentFrame frame( 38.8977, -77.0365, 17 );
+    frame.fromGeodetic( 38.8977, -77.0365, 117, a, b, c );
+    ASSERT_NEAR( a, 0, 1e-6 );
+    ASSERT_NEAR( b, 0, 1e-6 );
+    ASSERT_NEAR( c, 100, 1e-6 );
+
+    // a point to the north is mostly north, and below the plane
+    frame.fromGeodetic( 38.9977, -77.0365, 17, a, b, c );
+    ASSERT_NEAR( a, 0, 1e-6 );
+    ASSERT_NEAR( b, 11100, 100 );
+    ASSERT_LT( c, -5 );
+
+    // round trips
+    frame.toECEF( 1234.5, -678.9, 42, x, y, z );
+    frame.fromECEF( x, y, z, a, b, c );
+    ASSERT_NEAR( a, 1234.5, 1e-6 );
+    ASSERT_NEAR( b, -678.9, 1e-6 );
+    ASSERT_NEAR( c, 42, 1e-6 );
+
+    double latitude, longitude, altitude;
+    frame.toGeodetic( 0, 0, 0, latitude, longitude, altitude );
+    ASSERT_NEAR( latitude, 38.8977, 1e-9 );
+    ASSERT_NEAR( longitude, -77.0365, 1e-9 );
+    ASSERT_NEAR( altitude, 17, 1e-6 );
+}
+
+/**
+ * Test the batch transforms against the single point ones
+*/
+TEST( CoordinateLocal, Batch ){
+
+    const size_t count = 10000;
+    std::vector<double> latitudes( count ), longitudes( count ), altitudes( count );
+    for( size_t i=0; i<count; i++ ){
+        latitudes[i]  = 38.5 + std::fmod( i * 0.0037, 1.0 );
+        longitudes[i] = -77.5 + std::fmod( i * 0.0113, 1.0 );
+        altitudes[i]  = std::fmod( i * 1.7, 2000.0 );
+    }
+
+    const GEO::CoordinateType types[] = { GEO::CoordinateType::ENU, GEO::CoordinateType::NED };
+    for( int t=0; t<2; t++ ){
+
+        GEO::LocalTangentFrame frame( 38.8977, -77.0365, 17, types[t] );
+
+        std::vector<double> a( count ), b( count ), c( count );
+        frame.fromGeodetic( count, latitudes.data(), longitudes.data(), altitudes.data(), a.data(), b.data(), c.data(), 4 );
+
+        std::vector<double> x( count ), y( count ), z( count );
+        frame.toECEF( count, a.data(), b.data(), c.data(), x.data(), y.data(), z.data(), 4 );
+
+        std::vector<double> a2( count ), b2( count ), c2( count );
+        frame.fromECEF( count, x.data(), y.data(), z.data(), a2.data(), b2.data(), c2.data(), 4 );
+
+        std::vector<double> lat( count ), lon( count ), alt( count );
+        frame.toGeodetic( count, a.data(), b.data(), c.data(), lat.data(), lon.data(), alt.data(), 4 );
+
+        double ea, eb, ec;
+        for( size_t i=0; i<count; i++ ){
+            frame.fromGeodetic( latitudes[i], longitudes[i], altitudes[i], ea, eb, ec );
+            ASSERT_NEAR( a[i], ea, 1e-9 );
+            ASSERT_NEAR( b[i], eb, 1e-9 );
+            ASSERT_NEAR( c[i], ec, 1e-9 );
+            ASSERT_NEAR( a2[i], ea, 1e-6 );
+            ASSERT_NEAR( b2[i], eb, 1e-6 );
+            ASSERT_NEAR( c2[i], ec, 1e-6 );
+            ASSERT_NEAR( lat[i], latitudes[i], 1e-9 );
+            ASSERT_NEAR( lon[i], longitudes[i], 1e-9 );
+            ASSERT_NEAR( alt[i], altitudes[i], 1e-6 );
+        }
+    }
+}
+
+/**
+ * Test conversions through the coordinate classes
+*/
+TEST( CoordinateLocal, Conversion ){
+
+    const GEO::CoordinateGeodetic_d reference( 38.8977, -77.0365, 17 );
+    const GEO::CoordinateGeodetic_d point( 38.8977, -77.0365, 117 );
+
+    GEO::CoordinateENU_d enu = GEO::convert_Geodetic2ENU( point, reference );
+    ASSERT_EQ( enu.type(), GEO::CoordinateType::ENU );
+    ASSERT_EQ( GEO::CoordinateType2String( enu.type() ), "ENU" );
+    ASSERT_NEAR( enu.east(), 0, 1e-6 );
+    ASSERT_NEAR( enu.north(), 0, 1e-6 );
+    ASSERT_NEAR( enu.up(), 100, 1e-6 );
+    ASSERT_NEAR( enu.reference().latitude(), 38.8977, 1e-12 );
+
+    GEO::CoordinateNED_d ned = GEO::convert_Geodetic2NED( point, reference );
+    ASSERT_EQ( ned.type(), GEO::CoordinateType::NED );
+    ASSERT_NEAR( ned.down(), -100, 1e-6 );
+
+    GEO::CoordinateGeodetic_d geodetic = GEO::convert_NED2Geodetic( ned );
+    ASSERT_NEAR( geodetic.latitude(), 38.8977, 1e-9 );
+    ASSERT_NEAR( geodetic.altitude(), 117, 1e-6 );
+
+    GEO::CoordinateECEF_d ecef = GEO::convert_ENU2ECEF( GEO::CoordinateENU_d( 10, 20, 30, reference ));
+    enu = GEO::convert_ECEF2ENU( ecef, reference );
+    ASSERT_NEAR( enu.east(), 10, 1e-6 );
+    ASSERT_NEAR( enu.north(), 20, 1e-6 );
+    ASSERT_NEAR( enu.up(), 30, 1e-6 );
+    ned = GEO::convert_ECEF2NED( ecef, reference );
+    ASSERT_NEAR( ned.north(), 20, 1e-6 );
+    ASSERT_NEAR( ned.east(), 10, 1e-6 );
+    ASSERT_NEAR( ned.down(), -30, 1e-6 );
+
+    // through the coordinate pointers
+    GEO::CoordinateBase_d::ptr_t input( new GEO::CoordinateGeodetic_d( point ));
+    ASSERT_THROW( GEO::convert_coordinate<double>( input, GEO::CoordinateType::ENU, GEO::Datum::WGS84 ), GEO::GeneralException );
+
+    GEO::CoordinateBase_d::ptr_t output = GEO::convert_coordinate<double>( input, GEO::CoordinateType::NED, reference );
+    ASSERT_EQ( output->type(), GEO::CoordinateType::NED );
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateNED_d>( output )->down(), -100, 1e-6 );
+
+    // one local frame to another passes through geodetic
+    const GEO::CoordinateGeodetic_d other( 38.8977, -77.0365, 67 );
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::ENU, other );
+    ASSERT_EQ( output->type(), GEO::CoordinateType::ENU );
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateENU_d>( output )->up(), 50, 1e-6 );
+
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::ECEF, other );
+    ASSERT_EQ( output->type(), GEO::CoordinateType::ECEF );
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::Geodetic, GEO::Datum::WGS84 );
+    ASSERT_NEAR( output->altitude(), 117, 1e-6 );
+}
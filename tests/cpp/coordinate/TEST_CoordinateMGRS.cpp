@@ -0,0 +1,278 @@
+/**
+ * @file    TEST_CoordinateMGRS.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Encode a point as a string
+*/
+static std::string encode( const double& latitude, const double& longitude, const int& precision = 5 ){
+    char output[GEO::MGRS_MAX_LENGTH+1];
+    const size_t length = GEO::encode_mgrs( latitude, longitude, precision, output );
+    return std::string( output, length );
+}
+
+/**
+ * Test the UTM and UPS projections
+*/
+TEST( CoordinateMGRS, Projections ){
+
+    int zone;
+    bool north;
+    double easting, northing, latitude, longitude;
+
+    // the white house
+    ASSERT_TRUE( GEO::geodetic_to_utm_ups( 38.8977, -77.0365, zone, north, easting, northing ));
+    ASSERT_EQ( zone, 18 );
+    ASSERT_TRUE( north );
+    ASSERT_NEAR( easting,  323394.3, 0.5 );
+    ASSERT_NEAR( northing, 4307395.6, 0.5 );
+
+    // the origin of zone 31, and the equator south of it
+    ASSERT_TRUE( GEO::geodetic_to_utm_ups( 0, 0, zone, north, easting, northing ));
+    ASSERT_EQ( zone, 31 );
+    ASSERT_NEAR( easting, 166021.443, 0.001 );
+    ASSERT_NEAR( northing, 0, 0.001 );
+    ASSERT_TRUE( GEO::geodetic_to_utm_ups( -1e-9, 3, zone, north, easting, northing ));
+    ASSERT_FALSE( north );
+    ASSERT_NEAR( easting, 500000, 0.001 );
+    ASSERT_NEAR( northing, 10000000, 0.001 );
+
+    // the poles sit at the UPS origin
+    ASSERT_TRUE( GEO::geodetic_to_utm_ups( 90, 0, zone, north, easting, northing ));
+    ASSERT_EQ( zone, 0 );
+    ASSERT_NEAR( easting,  2000000, 0.001 );
+    ASSERT_NEAR( northing, 2000000, 0.001 );
+
+    // the zone exceptions
+    ASSERT_TRUE( GEO::geodetic_to_utm_ups( 60, 5, zone, north, easting, northing ));
+    ASSERT_EQ( zone, 32 );
+    ASSERT_TRUE( GEO::geodetic_to_utm_ups( 78, 10, zone, north, easting, northing ));
+    ASSERT_EQ( zone, 33 );
+    ASSERT_TRUE( GEO::geodetic_to_utm_ups( 78, 8, zone, north, easting, northing ));
+    ASSERT_EQ( zone, 31 );
+
+    ASSERT_FALSE( GEO::geodetic_to_utm_ups( 91, 0, zone, north, easting, northing ));
+    ASSERT_FALSE( GEO::geodetic_to_utm_ups( NAN, 0, zone, north, easting, northing ));
+
+    // both projections invert to well under a millimeter
+    for( int lat=-89; lat<=89; lat+=4 ){
+        for( int lon=-179; lon<180; lon+=7 ){
+            ASSERT_TRUE( GEO::geodetic_to_utm_ups( lat + 0.25, lon + 0.5, zone, north, easting, northing ));
+            ASSERT_TRUE( GEO::utm_ups_to_geodetic( zone, north, easting, northing, latitude, longitude ));
+            ASSERT_NEAR( latitude, lat + 0.25, 1e-9 );
+            ASSERT_NEAR( longitude, lon + 0.5, 1e-9 );
+        }
+    }
+}
+
+/**
+ * Test formatting MGRS strings
+*/
+TEST( CoordinateMGRS, Encode ){
+
+    ASSERT_EQ( encode( 38.8977, -77.0365 ), "18SUJ2339407395" );
+    ASSERT_EQ( encode( 38.8977, -77.0365, 3 ), "18SUJ233073" );
+    ASSERT_EQ( encode( 38.8977, -77.0365, 0 ), "18SUJ" );
+    ASSERT_EQ( encode( 0, 0 ), "31NAA6602100000" );
+
+    // single digit zones are padded
+    ASSERT_EQ( encode( 19.0, -155.5 ).substr( 0, 3 ), "05Q" );
+
+    // polar squares
+    ASSERT_EQ( encode(  90, 0 ), "ZAH0000000000" );
+    ASSERT_EQ( encode( -90, 0 ), "BAN0000000000" );
+    ASSERT_EQ( encode(  85, -45 ).substr( 0, 1 ), "Y" );
+    ASSERT_EQ( encode( -85, -45 ).substr( 0, 1 ), "A" );
+
+    // band X runs to 84 degrees
+    ASSERT_EQ( encode( 83.9, 10 ).substr( 0, 3 ), "33X" );
+    ASSERT_EQ( encode( 84.0, 10 ).substr( 0, 1 ), "Z" );
+    ASSERT_EQ( encode( 91, 0 ), "" );
+
+    // the class formats the same way
+    GEO::CoordinateMGRS_d coordinate = GEO::convert_Geodetic2MGRS( GEO::CoordinateGeodetic_d( 38.8977, -77.0365, 17 ));
+    ASSERT_EQ( coordinate.zone(), 18 );
+    ASSERT_EQ( coordinate.band(), 'S' );
+    ASSERT_EQ( coordinate.column(), 'U' );
+    ASSERT_EQ( coordinate.row(), 'J' );
+    ASSERT_NEAR( coordinate.altitude(), 17, 1e-9 );
+    ASSERT_EQ( coordinate.toString(), "18SUJ2339407395" );
+    ASSERT_EQ( coordinate.toString( 1 ), "18SUJ20" );
+    ASSERT_EQ( coordinate.type(), GEO::CoordinateType::MGRS );
+    ASSERT_EQ( GEO::CoordinateType2String( coordinate.type() ), "MGRS" );
+}
+
+/**
+ * Test parsing MGRS strings
+*/
+TEST( CoordinateMGRS, Decode ){
+
+    GEO::CoordinateMGRS_d coordinate( "18s uj 23394 07396" );
+    ASSERT_EQ( coordinate.zone(), 18 );
+    ASSERT_EQ( coordinate.band(), 'S' );
+    ASSERT_EQ( coordinate.column(), 'U' );
+    ASSERT_EQ( coordinate.row(), 'J' );
+    ASSERT_NEAR( coordinate.easting(), 23394, 1e-9 );
+    ASSERT_NEAR( coordinate.northing(), 7396, 1e-9 );
+    ASSERT_EQ( coordinate.precision(), 5 );
+    ASSERT_EQ( coordinate.toString(), "18SUJ2339407396" );
+
+    // the south-west corner of the square
+    GEO::CoordinateGeodetic_d geodetic = GEO::convert_MGRS2Geodetic( coordinate );
+    ASSERT_NEAR( geodetic.latitude(),  38.8977, 1e-5 );
+    ASSERT_NEAR( geodetic.longitude(), -77.0365, 1e-5 );
+
+    // every precision
+    const char* strings[] = { "18SUJ", "18SUJ20", "18SUJ2307", "18SUJ233073", "18SUJ23390739", "18SUJ2339407396" };
+    for( int p=0; p<=5; p++ ){
+        GEO::CoordinateMGRS_d parsed( strings[p] );
+        ASSERT_EQ( parsed.precision(), p );
+        ASSERT_EQ( parsed.toString(), strings[p] );
+        const double size = 100000 / std::pow( 10.0, p );
+        ASSERT_NEAR( parsed.easting(),  std::floor( 23394 / size ) * size, 1e-6 );
+        ASSERT_NEAR( parsed.northing(), std::floor(  7396 / size ) * size, 1e-6 );
+    }
+
+    // one digit zones and polar strings
+    double latitude, longitude;
+    ASSERT_TRUE( GEO::decode_mgrs( "4QFJ1234567890", 14, latitude, longitude ));
+    ASSERT_NEAR( latitude, 21.41, 0.01 );
+    ASSERT_NEAR( longitude, -157.92, 0.01 );
+    ASSERT_TRUE( GEO::decode_mgrs( "ZAH0000000000", 13, latitude, longitude ));
+    ASSERT_NEAR( latitude, 90, 1e-9 );
+    ASSERT_TRUE( GEO::decode_mgrs( "BAN0000000000", 13, latitude, longitude ));
+    ASSERT_NEAR( latitude, -90, 1e-9 );
+
+    // malformed strings and letters outside the zone
+    const char* invalid[] = { "", "18", "18S", "18SU", "18SUJ1", "18SUJ123456789012", "18IUJ", "18SAJ", "18SUW",
+                              "61SUJ", "118SUJ", "ZAZ", "ZIH", "18ZUJ", "AAN00", "18SUJ12x4" };
+    for( size_t i=0; i<sizeof(invalid)/sizeof(invalid[0]); i++ ){
+        ASSERT_FALSE( GEO::decode_mgrs( invalid[i], std::strlen( invalid[i] ), latitude, longitude )) << invalid[i];
+    }
+    ASSERT_THROW( GEO::CoordinateMGRS_d( "18SUJ123" ), GEO::GeneralException );
+}
+
+/**
+ * Test converting between MGRS and UTM
+*/
+TEST( CoordinateMGRS, UTM ){
+
+    // northern hemisphere
+    GEO::CoordinateUTM_d utm = GEO::convert_MGRS2UTM( GEO::CoordinateMGRS_d( "18SUJ2339407396" ));
+    ASSERT_EQ( utm.zone(), 18 );
+    ASSERT_NEAR( utm.easting(),  323394, 1e-6 );
+    ASSERT_NEAR( utm.northing(), 4307396, 1e-6 );
+    ASSERT_EQ( GEO::convert_UTM2MGRS( utm ).toString(), "18SUJ2339407396" );
+
+    // southern northings are negative
+    GEO::CoordinateMGRS_d sydney = GEO::convert_Geodetic2MGRS( GEO::CoordinateGeodetic_d( -33.8568, 151.2153 ));
+    ASSERT_EQ( sydney.toString().substr( 0, 5 ), "56HLH" );
+    utm = GEO::convert_MGRS2UTM( sydney );
+    ASSERT_EQ( utm.zone(), 56 );
+    ASSERT_LT( utm.northing(), 0 );
+    ASSERT_EQ( GEO::convert_UTM2MGRS( utm ).toString(), sydney.toString() );
+
+    // polar coordinates have no zone
+    ASSERT_THROW( GEO::convert_MGRS2UTM( GEO::CoordinateMGRS_d( "ZAH0000000000" )), GEO::GeneralException );
+
+    // through the coordinate pointers
+    GEO::CoordinateBase_d::ptr_t input( new GEO::CoordinateMGRS_d( "18SUJ2339407396", 17 ));
+    GEO::CoordinateBase_d::ptr_t output = GEO::convert_coordinate<double>( input, GEO::CoordinateType::UTM, GEO::Datum::WGS84 );
+    ASSERT_EQ( output->type(), GEO::CoordinateType::UTM );
+    ASSERT_NEAR( output->altitude(), 17, 1e-9 );
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::MGRS, GEO::Datum::WGS84 );
+    ASSERT_EQ( output->type(), GEO::CoordinateType::MGRS );
+    ASSERT_EQ( boost::static_pointer_cast<GEO::CoordinateMGRS_d>( output )->toString(), "18SUJ2339407396" );
+}
+
+/**
+ * Test that points land back in the square they were encoded in, everywhere
+*/
+TEST( CoordinateMGRS, RoundTrip ){
+
+    for( double lat=-89.9; lat<90; lat+=1.7 ){
+        for( double lon=-179.9; lon<180; lon+=2.3 ){
+
+            const std::string text = encode( lat, lon );
+            ASSERT_FALSE( text.empty() );
+
+            // the corner of the square is at most a meter off, in grid units
+            int zone0, zone1, precision;
+            bool north0, north1;
+            char band, column, row;
+            double e0, n0, e1, n1, easting, northing;
+            ASSERT_TRUE( GEO::parse_mgrs( text.c_str(), text.size(), zone1, band, column, row, easting, northing, precision )) << text;
+            ASSERT_TRUE( GEO::mgrs_to_utm_ups( zone1, band, column, row, easting, northing, north1, e1, n1 )) << text;
+            GEO::geodetic_to_utm_ups( lat, lon, zone0, north0, e0, n0 );
+            ASSERT_EQ( zone0, zone1 ) << text;
+            ASSERT_EQ( north0, north1 ) << text;
+            ASSERT_GE( e0 - e1, 0 ) << text;
+            ASSERT_LT( e0 - e1, 1 ) << text;
+            ASSERT_GE( n0 - n1, 0 ) << text;
+            ASSERT_LT( n0 - n1, 1 ) << text;
+
+            // and decodes next to the point
+            double latitude, longitude;
+            ASSERT_TRUE( GEO::decode_mgrs( text.c_str(), text.size(), latitude, longitude )) << text;
+            ASSERT_NEAR( latitude, lat, 1e-4 ) << text;
+        }
+    }
+}
+
+/**
+ * Test the batch encoder and decoder
+*/
+TEST( CoordinateMGRS, Batch ){
+
+    const size_t count = 20000;
+    std::vector<double> latitudes( count ), longitudes( count );
+    for( size_t i=0; i<count; i++ ){
+        latitudes[i]  = -89.5 + std::fmod( i * 0.7919, 179.0 );
+        longitudes[i] = -180 + std::fmod( i * 1.3137, 360.0 );
+    }
+    latitudes[5] = 100;
+
+    // fixed size records
+    const size_t stride = GEO::MGRS_MAX_LENGTH + 1;
+    std::vector<char> records( count * stride );
+    ASSERT_EQ( GEO::encode_mgrs( count, latitudes.data(), longitudes.data(), 5, records.data(), stride, 4 ), count - 1 );
+    ASSERT_EQ( records[5 * stride], '\0' );
+    for( size_t i=0; i<count; i+=97 ){
+        ASSERT_EQ( std::string( &records[i * stride] ), encode( latitudes[i], longitudes[i] ));
+    }
+
+    std::vector<double> decoded_lat( count ), decoded_lon( count );
+    ASSERT_EQ( GEO::decode_mgrs( count, records.data(), stride, decoded_lat.data(), decoded_lon.data(), 4 ), count - 1 );
+    ASSERT_TRUE( std::isnan( decoded_lat[5] ));
+    for( size_t i=0; i<count; i+=97 ){
+        double latitude, longitude;
+        ASSERT_TRUE( GEO::decode_mgrs( &records[i * stride], stride, latitude, longitude ));
+        ASSERT_EQ( decoded_lat[i], latitude );
+        ASSERT_EQ( decoded_lon[i], longitude );
+    }
+
+    // terminated strings
+    std::vector<const char*> strings( count );
+    for( size_t i=0; i<count; i++ ){
+        strings[i] = &records[i * stride];
+    }
+    std::vector<double> string_lat( count ), string_lon( count );
+    ASSERT_EQ( GEO::decode_mgrs( count, strings.data(), string_lat.data(), string_lon.data() ), count - 1 );
+    for( size_t i=0; i<count; i+=97 ){
+        ASSERT_EQ( string_lat[i], decoded_lat[i] );
+    }
+
+    ASSERT_THROW( GEO::encode_mgrs( count, latitudes.data(), longitudes.data(), 5, records.data(), 8 ), GEO::GeneralException );
+}
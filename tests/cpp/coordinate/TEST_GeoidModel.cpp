@@ -0,0 +1,196 @@
+/**
+ * @file    TEST_GeoidModel.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Post value of the test grid in centimeters, linear in the row and column
+*/
+static int test_post( const int& row, const int& col ){
+    return 1000 + 50 * row - 20 * col;
+}
+
+/**
+ * Write a 15 degree grid in the WW15MGH.DAC layout
+*/
+static void write_grid( boost::filesystem::path const& pathname, const int& rows, const int& cols ){
+    std::ofstream fout( pathname.c_str(), std::ios::binary );
+    for( int r=0; r<rows; r++ ){
+        for( int c=0; c<cols; c++ ){
+            const int16_t value = test_post( r, c );
+            const char bytes[2] = { (char)( ( value >> 8 ) & 0xff ), (char)( value & 0xff ) };
+            fout.write( bytes, 2 );
+        }
+    }
+}
+
+/**
+ * Test loading and sampling the grid
+*/
+TEST( GeoidModel, Undulation ){
+
+    const boost::filesystem::path pathname = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    write_grid( pathname, 13, 24 );
+
+    GEO::GeoidModel model( pathname );
+    ASSERT_EQ( model.rows(), 13 );
+    ASSERT_EQ( model.cols(), 24 );
+    ASSERT_NEAR( model.spacing(), 15, 1e-12 );
+
+    const GEO::GeoidInterpolation methods[] = { GEO::GeoidInterpolation::BILINEAR, GEO::GeoidInterpolation::BICUBIC };
+    for( int m=0; m<2; m++ ){
+
+        // posts, with rows from the north pole and columns from the prime meridian
+        for( int r=0; r<13; r++ ){
+            for( int c=0; c<24; c++ ){
+                ASSERT_NEAR( model.undulation( 90 - 15 * r, 15 * c, methods[m] ), test_post( r, c ) * 0.01, 1e-9 );
+            }
+        }
+
+        // both methods reproduce a linear surface away from the seam and the poles
+        ASSERT_NEAR( model.undulation( 90 - 15 * 4.3, 15 * 7.6, methods[m] ), ( 1000 + 50 * 4.3 - 20 * 7.6 ) * 0.01, 1e-9 );
+
+        // longitudes wrap
+        ASSERT_NEAR( model.undulation( 30, 15 * 2.5 + 360, methods[m] ), model.undulation( 30, 15 * 2.5, methods[m] ), 1e-9 );
+        ASSERT_NEAR( model.undulation( 30, 15 * 2.5 - 720, methods[m] ), model.undulation( 30, 15 * 2.5, methods[m] ), 1e-9 );
+
+        ASSERT_TRUE( std::isnan( model.undulation( NAN, 0, methods[m] )));
+    }
+
+    // across the seam bilinear averages the last and first columns, the cubic
+    // sees the jump and overshoots it
+    ASSERT_NEAR( model.undulation( 45, -7.5 ), ( test_post( 3, 23 ) + test_post( 3, 0 )) * 0.005, 1e-9 );
+    ASSERT_NEAR( model.undulation( 45, -7.5, GEO::GeoidInterpolation::BICUBIC ),
+                 ( -test_post( 3, 22 ) + 9 * test_post( 3, 23 ) + 9 * test_post( 3, 0 ) - test_post( 3, 1 )) * 0.01 / 16, 1e-9 );
+
+    // latitudes clamp at the poles
+    ASSERT_NEAR( model.undulation( 90, 15 * 3 ), test_post( 0, 3 ) * 0.01, 1e-9 );
+    ASSERT_NEAR( model.undulation( -90, 15 * 3 ), test_post( 12, 3 ) * 0.01, 1e-9 );
+
+    // heights
+    ASSERT_NEAR( model.toOrthometric( 30, 45, 100 ), 100 - test_post( 4, 3 ) * 0.01, 1e-9 );
+    ASSERT_NEAR( model.toEllipsoidal( 30, 45, 100 ), 100 + test_post( 4, 3 ) * 0.01, 1e-9 );
+
+    boost::filesystem::remove( pathname );
+}
+
+/**
+ * Test the batch lookups against the single point ones
+*/
+TEST( GeoidModel, Batch ){
+
+    const boost::filesystem::path pathname = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    write_grid( pathname, 13, 24 );
+    GEO::GeoidModel model( pathname );
+
+    const size_t count = 10000;
+    std::vector<double> latitudes( count ), longitudes( count ), heights( count, 100 );
+    for( size_t i=0; i<count; i++ ){
+        latitudes[i]  = -90 + std::fmod( i * 0.37, 180.0 );
+        longitudes[i] = -180 + std::fmod( i * 1.13, 360.0 );
+    }
+
+    std::vector<double> undulations( count );
+    model.undulation( count, latitudes.data(), longitudes.data(), undulations.data(), GEO::GeoidInterpolation::BICUBIC, 4 );
+    model.toOrthometric( count, latitudes.data(), longitudes.data(), heights.data(), GEO::GeoidInterpolation::BICUBIC, 4 );
+    for( size_t i=0; i<count; i++ ){
+        ASSERT_EQ( undulations[i], model.undulation( latitudes[i], longitudes[i], GEO::GeoidInterpolation::BICUBIC ));
+        ASSERT_NEAR( heights[i], 100 - undulations[i], 1e-9 );
+    }
+
+    model.toEllipsoidal( count, latitudes.data(), longitudes.data(), heights.data(), GEO::GeoidInterpolation::BICUBIC, 4 );
+    for( size_t i=0; i<count; i++ ){
+        ASSERT_NEAR( heights[i], 100, 1e-9 );
+    }
+
+    boost::filesystem::remove( pathname );
+}
+
+/**
+ * Test files which are not global grids
+*/
+TEST( GeoidModel, Invalid ){
+
+    const boost::filesystem::path pathname = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    ASSERT_THROW( GEO::GeoidModel model( pathname ), GEO::GeneralException );
+
+    write_grid( pathname, 13, 23 );
+    ASSERT_THROW( GEO::GeoidModel model( pathname ), GEO::GeneralException );
+
+    std::ofstream( pathname.c_str(), std::ios::trunc ).close();
+    ASSERT_THROW( GEO::GeoidModel model( pathname ), GEO::GeneralException );
+
+    boost::filesystem::remove( pathname );
+}
+
+/**
+ * Test EGM96 altitudes in convert_coordinate
+*/
+TEST( GeoidModel, Conversion ){
+
+    const boost::filesystem::path pathname = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    write_grid( pathname, 13, 24 );
+
+    GEO::CoordinateBase_d::ptr_t input( new GEO::CoordinateGeodetic_d( 30, 45, 100, GEO::Datum::WGS84 ));
+    GEO::GeoidModel::setDefault( GEO::GeoidModel::ptr_t() );
+    ASSERT_THROW( GEO::convert_coordinate<double>( input, GEO::CoordinateType::Geodetic, GEO::Datum::EGM96 ), GEO::GeneralException );
+
+    GEO::GeoidModel::setDefault( GEO::GeoidModel::ptr_t( new GEO::GeoidModel( pathname )));
+    const double undulation = test_post( 4, 3 ) * 0.01;
+
+    // ellipsoidal to orthometric and back
+    GEO::CoordinateBase_d::ptr_t output = GEO::convert_coordinate<double>( input, GEO::CoordinateType::Geodetic, GEO::Datum::EGM96 );
+    ASSERT_EQ( output->type(), GEO::CoordinateType::Geodetic );
+    ASSERT_EQ( output->datum(), GEO::Datum::EGM96 );
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateGeodetic_d>( output )->latitude(), 30, 1e-12 );
+    ASSERT_NEAR( output->altitude(), 100 - undulation, 1e-9 );
+
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::Geodetic, GEO::Datum::WGS84 );
+    ASSERT_EQ( output->datum(), GEO::Datum::WGS84 );
+    ASSERT_NEAR( output->altitude(), 100, 1e-9 );
+
+    // Cartesian positions stay on the ellipsoid
+    GEO::CoordinateBase_d::ptr_t orthometric( new GEO::CoordinateGeodetic_d( 30, 45, 100 - undulation, GEO::Datum::EGM96 ));
+    output = GEO::convert_coordinate<double>( orthometric, GEO::CoordinateType::ECEF, GEO::Datum::WGS84 );
+    GEO::CoordinateECEF_d expected = GEO::convert_Geodetic2ECEF( GEO::CoordinateGeodetic_d( 30, 45, 100 ));
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateECEF_d>( output )->x(), expected.x(), 1e-6 );
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateECEF_d>( output )->z(), expected.z(), 1e-6 );
+
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::Geodetic, GEO::Datum::EGM96 );
+    ASSERT_NEAR( output->altitude(), 100 - undulation, 1e-6 );
+
+    // they do without a datum change too
+    output = GEO::convert_coordinate<double>( orthometric, GEO::CoordinateType::ECEF, GEO::Datum::EGM96 );
+    ASSERT_EQ( output->datum(), GEO::Datum::EGM96 );
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateECEF_d>( output )->x(), expected.x(), 1e-6 );
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateECEF_d>( output )->z(), expected.z(), 1e-6 );
+    ASSERT_NEAR( orthometric->altitude(), 100 - undulation, 1e-12 );
+
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::Geodetic, GEO::Datum::EGM96 );
+    ASSERT_EQ( output->datum(), GEO::Datum::EGM96 );
+    ASSERT_NEAR( output->altitude(), 100 - undulation, 1e-6 );
+
+    // and between WGS84 and EGM96 ECEF the position does not move
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::ECEF, GEO::Datum::EGM96 );
+    output = GEO::convert_coordinate<double>( output, GEO::CoordinateType::ECEF, GEO::Datum::WGS84 );
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateECEF_d>( output )->x(), expected.x(), 1e-6 );
+    ASSERT_NEAR( boost::static_pointer_cast<GEO::CoordinateECEF_d>( output )->z(), expected.z(), 1e-6 );
+
+    ASSERT_EQ( GEO::Datum2WKT_string( GEO::Datum::EGM96 ), "WGS84" );
+
+    GEO::GeoidModel::setDefault( GEO::GeoidModel::ptr_t() );
+    boost::filesystem::remove( pathname );
+}
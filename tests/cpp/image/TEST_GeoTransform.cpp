@@ -0,0 +1,85 @@
+/**
+ * @file    TEST_GeoTransform.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test the affine mapping and its inverse
+*/
+TEST( GeoTransform, RoundTrip ){
+
+    ASSERT_FALSE( GEO::GeoTransform().isValid() );
+
+    // rotated transform in UTM
+    const double coefficients[6] = { 500000, 0.5, 0.1, 4000000, 0.05, -0.5 };
+    GEO::GeoTransform geotransform( coefficients, GEO::CoordinateFrame( 11, true ));
+    ASSERT_TRUE( geotransform.isValid() );
+    ASSERT_EQ( geotransform.getFrame().type, GEO::CoordinateType::UTM );
+
+    std::vector<double> cols, rows;
+    for( int i=0; i<10000; i++ ){
+        cols.push_back( i % 137 + 0.5 );
+        rows.push_back( i / 137 + 0.25 );
+    }
+
+    std::vector<GEO::CoordinateUTM_d> world;
+    geotransform.pixelToWorld( cols, rows, world );
+    ASSERT_EQ( world.size(), cols.size() );
+    ASSERT_EQ( world[0].zone(), 11 );
+    ASSERT_NEAR( world[140].easting(),  500000 + cols[140] * 0.5  + rows[140] * 0.1, 1e-6 );
+    ASSERT_NEAR( world[140].northing(), 4000000 + cols[140] * 0.05 - rows[140] * 0.5, 1e-6 );
+
+    std::vector<double> cols2, rows2;
+    geotransform.worldToPixel( world, cols2, rows2 );
+    ASSERT_EQ( cols2.size(), cols.size() );
+    for( size_t i=0; i<cols.size(); i++ ){
+        ASSERT_NEAR( cols2[i], cols[i], 1e-6 );
+        ASSERT_NEAR( rows2[i], rows[i], 1e-6 );
+    }
+
+    // coordinates must match the frame
+    std::vector<GEO::CoordinateGeodetic_d> geodetic;
+    ASSERT_THROW( geotransform.pixelToWorld( cols, rows, geodetic ), GEO::GeneralException );
+    world[5].zone() = 12;
+    ASSERT_THROW( geotransform.worldToPixel( world, cols2, rows2 ), GEO::GeneralException );
+}
+
+/**
+ * Test windows of a transform
+*/
+TEST( GeoTransform, Window ){
+
+    const double coefficients[6] = { -120, 0.001, 0, 40, 0, -0.001 };
+    GEO::GeoTransform geotransform( coefficients, GEO::CoordinateFrame( GEO::Datum::WGS84 ));
+
+    // a window pixel lands on the same place as the parent pixel
+    GEO::GeoTransform window = geotransform.window( GEO::Rect( 100, 50, 20, 20 ), 2 );
+    double col = 3, row = 4, x0, y0, x1, y1;
+    window.pixelToWorld( 1, &col, &row, &x0, &y0 );
+    col = 100 + 3*2;
+    row = 50 + 4*2;
+    geotransform.pixelToWorld( 1, &col, &row, &x1, &y1 );
+    ASSERT_NEAR( x0, x1, 1e-12 );
+    ASSERT_NEAR( y0, y1, 1e-12 );
+
+    // views carry the shifted transform
+    GEO::Image<GEO::PixelGray_u8> image( 200, 300 );
+    image.setGeoTransform( geotransform );
+    GEO::ImageView<GEO::PixelGray_u8> view = GEO::make_view( image, GEO::Rect( 100, 50, 20, 20 ));
+    std::vector<GEO::CoordinateGeodetic_d> world( 1, GEO::CoordinateGeodetic_d( 40 - 0.0505, -120 + 0.1005 ));
+    std::vector<double> cols, rows;
+    view.worldToPixel( world, cols, rows );
+    ASSERT_NEAR( cols[0], 0.5, 1e-6 );
+    ASSERT_NEAR( rows[0], 0.5, 1e-6 );
+    image.worldToPixel( world, cols, rows );
+    ASSERT_NEAR( cols[0], 100.5, 1e-6 );
+    ASSERT_NEAR( rows[0],  50.5, 1e-6 );
+}
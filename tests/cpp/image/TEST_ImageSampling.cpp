@@ -0,0 +1,105 @@
+/**
+ * @file    TEST_ImageSampling.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test grouping points by tile
+*/
+TEST( ImageSampling, GroupPointsByTile ){
+
+    std::vector<double> cols = { 300.5,  10.5, 700.0,  20.0, -1.0, 5.0 };
+    std::vector<double> rows = {  10.5, 600.5,  30.0,   2.0,  3.0, 1000.0 };
+    std::vector<size_t> order;
+    std::vector<GEO::SampleTile> tiles;
+    GEO::group_points_by_tile( 800, 800, 256, cols, rows, order, tiles );
+
+    // points outside the image are dropped, the rest are grouped in morton order
+    ASSERT_EQ( order.size(), 4 );
+    ASSERT_EQ( tiles.size(), 4 );
+    ASSERT_EQ( tiles[0].tile_x, 0 );
+    ASSERT_EQ( tiles[0].tile_y, 0 );
+    ASSERT_EQ( order[tiles[0].begin], 3 );
+    ASSERT_EQ( tiles[1].tile_x, 1 );
+    ASSERT_EQ( tiles[1].tile_y, 0 );
+    ASSERT_EQ( tiles[2].tile_x, 2 );
+    ASSERT_EQ( order[tiles[2].begin], 2 );
+    ASSERT_EQ( tiles[3].tile_y, 2 );
+    ASSERT_EQ( order[tiles[3].begin], 1 );
+}
+
+/**
+ * Test nearest and bilinear sampling against a ramp
+*/
+TEST( ImageSampling, SampleRamp ){
+
+    // value = 2*col + 3*row at each pixel center
+    GEO::Image<GEO::PixelGray_df> image( 600, 700 );
+    for( int r=0; r<image.rows(); r++ ){
+        for( int c=0; c<image.cols(); c++ ){
+            image( r, c ) = 2*c + 3*r;
+        }
+    }
+
+    std::vector<double> cols, rows;
+    srand( 7 );
+    for( int i=0; i<20000; i++ ){
+        cols.push_back( 0.5 + ( rand() % 69900 ) / 100.0 );
+        rows.push_back( 0.5 + ( rand() % 59900 ) / 100.0 );
+    }
+    cols.push_back( 800 );
+    rows.push_back( 10 );
+
+    // bilinear reproduces the ramp inside the pixel centers
+    std::vector<double> output;
+    GEO::sample( image, cols, rows, GEO::Interpolation::BILINEAR, output, 4 );
+    ASSERT_EQ( output.size(), cols.size() );
+    for( size_t i=0; i+1<cols.size(); i++ ){
+        ASSERT_NEAR( output[i], 2*( cols[i] - 0.5 ) + 3*( rows[i] - 0.5 ), 1e-9 );
+    }
+    ASSERT_TRUE( std::isnan( output.back() ));
+
+    // nearest returns the containing pixel
+    GEO::sample( image, cols, rows, GEO::Interpolation::NEAREST, output, 3 );
+    for( size_t i=0; i+1<cols.size(); i++ ){
+        ASSERT_EQ( output[i], 2*std::floor( cols[i] ) + 3*std::floor( rows[i] ));
+    }
+}
+
+/**
+ * Test sampling color images at world coordinates
+*/
+TEST( ImageSampling, SampleWorldCoordinates ){
+
+    GEO::Image<GEO::PixelRGB_u8> image( 20, 30 );
+    for( int r=0; r<image.rows(); r++ ){
+        for( int c=0; c<image.cols(); c++ ){
+            image( r, c ) = GEO::PixelRGB_u8( c, r, 7 );
+        }
+    }
+    const double coefficients[6] = { -120, 0.1, 0, 40, 0, -0.1 };
+    image.setGeoTransform( GEO::GeoTransform( coefficients, GEO::CoordinateFrame( GEO::Datum::WGS84 )));
+
+    std::vector<GEO::CoordinateGeodetic_d> points;
+    points.push_back( GEO::CoordinateGeodetic_d( 40 - 0.55, -120 + 1.05 ));
+    points.push_back( GEO::CoordinateGeodetic_d( 40 - 1.55, -120 + 2.55 ));
+
+    std::vector<double> output;
+    GEO::sample( image, points, GEO::Interpolation::NEAREST, output );
+    ASSERT_EQ( output.size(), 6 );
+    ASSERT_EQ( output[0], 10 );
+    ASSERT_EQ( output[1],  5 );
+    ASSERT_EQ( output[2],  7 );
+    ASSERT_EQ( output[3], 25 );
+    ASSERT_EQ( output[4], 15 );
+}
@@ -0,0 +1,127 @@
+/**
+ * @file    TEST_ImageStatistics.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cmath>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test merging accumulators
+*/
+TEST( ImageStatistics, AccumulatorMerge ){
+
+    // split a sequence in two and compare with the whole
+    GEO::BandAccumulator whole( 10, 0, 10 ), left( 10, 0, 10 ), right( 10, 0, 10 );
+    whole.addMoments( 9, 5, 60, 1, 9 );
+    left.addMoments( 4, 2.5, 5, 1, 4 );
+    right.addMoments( 5, 7, 10, 5, 9 );
+    left.merge( right );
+
+    GEO::StatisticsOptions options;
+    GEO::BandStatistics a = whole.finalize( options );
+    GEO::BandStatistics b = left.finalize( options );
+    ASSERT_EQ( b.valid_count, 9 );
+    ASSERT_NEAR( b.mean, a.mean, 1e-12 );
+    ASSERT_NEAR( b.stddev, a.stddev, 1e-12 );
+    ASSERT_EQ( b.min, 1 );
+    ASSERT_EQ( b.max, 9 );
+
+    // different histograms cannot be merged
+    GEO::BandAccumulator other( 5, 0, 10 );
+    ASSERT_THROW( whole.merge( other ), GEO::GeneralException );
+}
+
+/**
+ * Test the statistics of an interleaved image
+*/
+TEST( ImageStatistics, ComputeStatistics ){
+
+    // large enough to be split across threads
+    GEO::Image<GEO::PixelRGB_u8> image;
+    image.setResource( GEO::MemoryResource<GEO::PixelRGB_u8>( 600, 500 ));
+    for( int r=0; r<image.rows(); r++ ){
+    for( int c=0; c<image.cols(); c++ ){
+        image(r,c) = GEO::PixelRGB_u8( c % 100, r % 200, 7 );
+    }}
+
+    std::vector<GEO::BandStatistics> stats = GEO::compute_statistics( image );
+    ASSERT_EQ( stats.size(), 3 );
+
+    // red is uniform over [0,99]
+    ASSERT_EQ( stats[0].valid_count, 300000 );
+    ASSERT_EQ( stats[0].min, 0 );
+    ASSERT_EQ( stats[0].max, 99 );
+    ASSERT_NEAR( stats[0].mean, 49.5, 1e-9 );
+    ASSERT_NEAR( stats[0].stddev, std::sqrt( (100.0*100.0 - 1) / 12 ), 1e-6 );
+    ASSERT_EQ( stats[0].histogram.size(), 256 );
+    ASSERT_EQ( stats[0].histogram[42], 3000 );
+    ASSERT_EQ( stats[0].percentiles.size(), 3 );
+    ASSERT_NEAR( stats[0].percentile( 50 ), 50, 1 );
+    ASSERT_NEAR( stats[0].percentiles[2], 98, 1 );
+
+    // green is uniform over [0,199]
+    ASSERT_NEAR( stats[1].mean, 99.5, 1e-9 );
+
+    // blue is constant
+    ASSERT_EQ( stats[2].stddev, 0 );
+    ASSERT_EQ( stats[2].percentile( 2 ), 7 );
+
+    // a single thread gives the same result
+    GEO::StatisticsOptions serial;
+    serial.num_threads = 1;
+    std::vector<GEO::BandStatistics> serial_stats = GEO::compute_statistics( image, serial );
+    ASSERT_EQ( serial_stats[0].valid_count, stats[0].valid_count );
+    ASSERT_NEAR( serial_stats[1].mean, stats[1].mean, 1e-9 );
+    ASSERT_TRUE( serial_stats[0].histogram == stats[0].histogram );
+    ASSERT_EQ( stats[2].percentile( 98 ), 7 );
+
+    // mask zeros
+    GEO::StatisticsOptions options;
+    options.use_nodata = true;
+    options.nodata_value = 0;
+    stats = GEO::compute_statistics( image, options );
+    ASSERT_EQ( stats[0].nodata_count, 3000 );
+    ASSERT_EQ( stats[0].valid_count, 297000 );
+    ASSERT_EQ( stats[0].min, 1 );
+    ASSERT_NEAR( stats[0].mean, 50, 1e-9 );
+
+    // approximate statistics visit fewer pixels
+    options.use_nodata = false;
+    options.approximate = true;
+    options.approximate_pixels = 10000;
+    stats = GEO::compute_statistics( image, options );
+    ASSERT_LT( stats[0].valid_count, 20000 );
+    ASSERT_GT( stats[0].valid_count, 5000 );
+    ASSERT_NEAR( stats[0].mean, 49.5, 3 );
+}
+
+/**
+ * Test the statistics of free-range multiband images
+*/
+TEST( ImageStatistics, ComputeMultibandStatistics ){
+
+    GEO::MultibandImage_df image( 100, 80, 2 );
+    for( int y=0; y<image.rows(); y++ ){
+    for( int x=0; x<image.cols(); x++ ){
+        image( x, y, 0 ) = x * 100.0 - 3000;
+        image( x, y, 1 ) = ( x == 5 ) ? NAN : 1.5;
+    }}
+
+    std::vector<GEO::BandStatistics> stats = GEO::compute_statistics( image );
+    ASSERT_EQ( stats[0].min, -3000 );
+    ASSERT_EQ( stats[0].max, 4900 );
+    ASSERT_NEAR( stats[0].mean, 950, 1e-9 );
+    ASSERT_NEAR( stats[0].percentile( 50 ), 950, 100 );
+
+    // NaN samples are masked
+    ASSERT_EQ( stats[1].nodata_count, 100 );
+    ASSERT_EQ( stats[1].valid_count, 7900 );
+    ASSERT_EQ( stats[1].mean, 1.5 );
+}
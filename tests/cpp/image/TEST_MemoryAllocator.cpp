@@ -0,0 +1,133 @@
+/**
+ * @file    TEST_MemoryAllocator.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cstdint>
+#include <cstring>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Pixel which counts its constructions
+*/
+struct CountedPixel{
+    CountedPixel(){ count++; }
+    static int count;
+};
+int CountedPixel::count = 0;
+
+/**
+ * Plain pixel with no constructor
+*/
+struct PlainPixel{
+    uint16_t data[3];
+};
+
+/**
+ * Test the heap allocator alignment and construction rules
+*/
+TEST( MemoryAllocator, AllocatePixels ){
+
+    // non-trivial pixels are constructed
+    CountedPixel::count = 0;
+    {
+        boost::shared_ptr<CountedPixel[]> pixels = GEO::allocate_pixels<CountedPixel>( 100 );
+        ASSERT_EQ( CountedPixel::count, 100 );
+        ASSERT_EQ( ((uintptr_t)pixels.get()) % GEO::PIXEL_BUFFER_ALIGNMENT, 0 );
+    }
+
+    // trivial pixels are not
+    boost::shared_ptr<PlainPixel[]> plain = GEO::allocate_pixels<PlainPixel>( 1000 );
+    plain[999].data[2] = 7;
+    ASSERT_EQ( plain[999].data[2], 7 );
+
+    // empty arrays are null
+    ASSERT_TRUE( GEO::allocate_pixels<PlainPixel>( 0 ) == nullptr );
+}
+
+/**
+ * Test the tile pool reuses released blocks
+*/
+TEST( MemoryAllocator, TilePool ){
+
+    boost::shared_ptr<GEO::TilePoolAllocator> pool( new GEO::TilePoolAllocator( 1 << 20 ));
+
+    GEO::PixelGray_u8* first;
+    {
+        GEO::MemoryResource<GEO::PixelGray_u8> tile( 64, 64, pool );
+        first = tile.getPixelData().get();
+        ASSERT_EQ( pool->cachedBytes(), 0 );
+    }
+    ASSERT_GT( pool->cachedBytes(), 0 );
+
+    // a tile of the same size gets the same buffer
+    GEO::MemoryResource<GEO::PixelGray_u8> tile( 64, 64, pool );
+    ASSERT_EQ( tile.getPixelData().get(), first );
+    ASSERT_EQ( pool->cachedBytes(), 0 );
+
+    // clones use the same allocator
+    GEO::MemoryResource<GEO::PixelGray_u8> copy = tile.clone();
+    ASSERT_TRUE( copy.getAllocator() == tile.getAllocator() );
+
+    // blocks above the cache limit are freed
+    {
+        GEO::MemoryResource<GEO::PixelGray_u8> large( 2048, 2048, pool );
+    }
+    ASSERT_LE( pool->cachedBytes(), 1 << 20 );
+    pool->release();
+    ASSERT_EQ( pool->cachedBytes(), 0 );
+}
+
+/**
+ * Test the huge page allocator keeps released mappings
+*/
+TEST( MemoryAllocator, HugePages ){
+
+    boost::shared_ptr<GEO::HugePageAllocator> allocator( new GEO::HugePageAllocator() );
+
+    GEO::PixelRGB_u8* first;
+    {
+        GEO::MemoryResource<GEO::PixelRGB_u8> image( 1024, 1024, allocator );
+        first = image.getPixelData().get();
+        image(1023,1023) = GEO::PixelRGB_u8( 1, 2, 3 );
+        ASSERT_EQ( image(1023,1023)[2], 3 );
+    }
+    ASSERT_GE( allocator->cachedBytes(), 1024*1024*sizeof(GEO::PixelRGB_u8) );
+
+    GEO::MemoryResource<GEO::PixelRGB_u8> image( 1024, 1024, allocator );
+    ASSERT_EQ( image.getPixelData().get(), first );
+
+    // mappings start on a huge page
+    ASSERT_EQ( (uintptr_t)first % GEO::HugePageAllocator::HUGE_PAGE_SIZE, 0u );
+    GEO::HugePageAllocator prefaulted( 0, true );
+    void* block = prefaulted.allocate( 3 * GEO::HugePageAllocator::HUGE_PAGE_SIZE + 1 );
+    ASSERT_EQ( (uintptr_t)block % GEO::HugePageAllocator::HUGE_PAGE_SIZE, 0u );
+    static_cast<char*>( block )[ 4 * GEO::HugePageAllocator::HUGE_PAGE_SIZE - 1 ] = 1;
+    prefaulted.deallocate( block, 3 * GEO::HugePageAllocator::HUGE_PAGE_SIZE + 1 );
+
+    // small buffers come from the heap
+    GEO::MemoryResource<GEO::PixelRGB_u8> small( 10, 10, allocator );
+    ASSERT_TRUE( small.getPixelData() != nullptr );
+}
+
+/**
+ * Test changing the default allocator
+*/
+TEST( MemoryAllocator, DefaultAllocator ){
+
+    boost::shared_ptr<GEO::TilePoolAllocator> pool( new GEO::TilePoolAllocator() );
+    GEO::set_default_allocator( pool );
+    {
+        GEO::MemoryResource<GEO::PixelGray_u8> tile( 16, 16 );
+    }
+    ASSERT_GT( pool->cachedBytes(), 0 );
+
+    GEO::set_default_allocator( GEO::MemoryAllocator::ptr_t() );
+    ASSERT_TRUE( GEO::default_allocator() != pool );
+}
+
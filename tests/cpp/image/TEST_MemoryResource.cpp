@@ -51,3 +51,60 @@ TEST( MemoryResource, AssignmentOperator ){
 }
 
 
+
+/**
+ * Test the deep copy, fill and conversion functions
+*/
+TEST( MemoryResource, CloneFillConvert ){
+
+    // large enough to be split across threads
+    GEO::MemoryResource<GEO::PixelRGB_u8> resource01( 2048, 1500 );
+    resource01.fill( GEO::PixelRGB_u8( 10, 20, 30 ));
+    resource01(1499,2047) = GEO::PixelRGB_u8( 1, 2, 3 );
+
+    GEO::MemoryResource<GEO::PixelRGB_u8> resource02 = resource01.clone();
+    ASSERT_NE( resource02.getPixelData().get(), resource01.getPixelData().get() );
+    ASSERT_TRUE( resource02(0,0) == GEO::PixelRGB_u8( 10, 20, 30 ));
+    ASSERT_TRUE( resource02(1499,2047) == GEO::PixelRGB_u8( 1, 2, 3 ));
+
+    // copy a window
+    GEO::MemoryResource<GEO::PixelRGB_u8> window;
+    resource01.copyTo( window, GEO::Rect( 1490, 2040, 10, 8 ));
+    ASSERT_EQ( window.rows(), 8 );
+    ASSERT_EQ( window.cols(), 10 );
+    ASSERT_TRUE( window(9,7) == GEO::PixelRGB_u8( 1, 2, 3 ));
+    ASSERT_TRUE( window(0,0) == GEO::PixelRGB_u8( 10, 20, 30 ));
+    ASSERT_THROW( resource01.copyTo( window, GEO::Rect( 1495, 0, 10, 8 )), GEO::GeneralException );
+
+    // convert
+    GEO::MemoryResource<GEO::PixelGray_u8> gray = resource01.convertTo<GEO::PixelGray_u8>();
+    ASSERT_EQ( gray.rows(), 2048 );
+    ASSERT_EQ( gray(0,0)[0], 20 );
+    ASSERT_EQ( gray(1499,2047)[0], 2 );
+}
+
+/**
+ * Test copy on write
+*/
+TEST( MemoryResource, CopyOnWrite ){
+
+    GEO::MemoryResource<GEO::PixelGray_u8> resource01(10,10);
+    resource01.fill( 5 );
+
+    // the copy shares the buffer until it is written
+    GEO::MemoryResource<GEO::PixelGray_u8> resource02 = resource01;
+    ASSERT_TRUE( resource01.isShared() );
+    ASSERT_EQ( resource01.getPixelData().get(), resource02.getPixelData().get() );
+
+    resource02(3,3) = 9;
+    ASSERT_FALSE( resource01.isShared() );
+    ASSERT_NE( resource01.getPixelData().get(), resource02.getPixelData().get() );
+    ASSERT_EQ( resource01(3,3)[0], 5 );
+    ASSERT_EQ( resource02(3,3)[0], 9 );
+    ASSERT_EQ( resource02(4,4)[0], 5 );
+
+    // writing through an unshared buffer does not copy
+    GEO::PixelGray_u8* buffer = resource02.getPixelData().get();
+    resource02(4,4) = 1;
+    ASSERT_EQ( resource02.getPixelData().get(), buffer );
+}
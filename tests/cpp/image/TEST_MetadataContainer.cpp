@@ -0,0 +1,106 @@
+/**
+ * @file    TEST_MetadataContainer.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <string>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test key interning
+*/
+TEST( MetadataKey, Interning ){
+
+    GEO::MetadataKey a( "NITF_IID1" );
+    GEO::MetadataKey b( std::string("NITF_") + "IID1" );
+    GEO::MetadataKey c( "TRE", "NITF_IID1" );
+    ASSERT_TRUE( a == b );
+    ASSERT_FALSE( a == c );
+    ASSERT_EQ( a.str(), "NITF_IID1" );
+    ASSERT_EQ( c.str(), "TRE:NITF_IID1" );
+    ASSERT_TRUE( GEO::MetadataKey( "", "NITF_IID1" ) == a );
+}
+
+/**
+ * Test the flat map
+*/
+TEST( MetadataContainer, SetAndGet ){
+
+    GEO::MetadataContainer metadata;
+    ASSERT_EQ( metadata.size(), 0 );
+
+    metadata.setValue( GEO::MetadataKey( "AREA_OR_POINT" ), "Area" );
+    metadata.setValue( GEO::MetadataKey( GEO::METADATA_DOMAIN_TRE, "USE00A" ), "00000000000" );
+    metadata.setValue( GEO::MetadataKey( GEO::METADATA_DOMAIN_RPC, "LINE_OFF" ), "2048" );
+    metadata.setValue( GEO::MetadataKey( "AREA_OR_POINT" ), "Point" );
+    ASSERT_EQ( metadata.size(), 3 );
+
+    ASSERT_TRUE( metadata.contains( GEO::MetadataKey( "AREA_OR_POINT" )));
+    ASSERT_FALSE( metadata.contains( GEO::MetadataKey( "MISSING" )));
+    ASSERT_EQ( metadata.getValue( GEO::MetadataKey( "AREA_OR_POINT" )), "Point" );
+    ASSERT_EQ( metadata.getValue( GEO::MetadataKey( "MISSING" )), "" );
+
+    // domains
+    std::vector<std::pair<std::string,std::string> > rpc = metadata.getDomain( GEO::METADATA_DOMAIN_RPC );
+    ASSERT_EQ( rpc.size(), 1 );
+    ASSERT_EQ( rpc[0].first, "LINE_OFF" );
+    ASSERT_EQ( rpc[0].second, "2048" );
+    ASSERT_EQ( metadata.getDomain( "" ).size(), 1 );
+}
+
+/**
+ * Test lazy number parsing
+*/
+TEST( MetadataContainer, Numbers ){
+
+    GEO::MetadataContainer metadata;
+    GEO::MetadataKey key( GEO::METADATA_DOMAIN_RPC, "LINE_NUM_COEFF" );
+    metadata.setValue( key, "1.5 -2e-3, +4" );
+
+    // parsed once and then shared
+    GEO::MetadataContainer::numbers_t numbers = metadata.getNumbers( key );
+    ASSERT_EQ( numbers->size(), 3 );
+    ASSERT_NEAR( (*numbers)[1], -0.002, 1e-12 );
+    ASSERT_EQ( metadata.getNumbers( key ).get(), numbers.get() );
+    ASSERT_EQ( metadata.getNumber( key, 2 ), 4 );
+    ASSERT_EQ( metadata.getNumber( key, 3, -1 ), -1 );
+
+    // replacing the value drops the cached parse
+    metadata.setValue( key, "7" );
+    ASSERT_EQ( metadata.getNumbers( key )->size(), 1 );
+    ASSERT_EQ( numbers->size(), 3 );
+
+    // geotransform
+    double transform[6];
+    ASSERT_FALSE( metadata.getGeoTransform( transform ));
+    metadata.setValue( GEO::MetadataKey( GEO::METADATA_GEOTRANSFORM ), "-120 0.01 0 39 0 -0.01" );
+    ASSERT_TRUE( metadata.getGeoTransform( transform ));
+    ASSERT_EQ( transform[0], -120 );
+    ASSERT_EQ( transform[5], -0.01 );
+}
+
+/**
+ * Test that copies and views share the metadata
+*/
+TEST( MetadataContainer, SharedByImages ){
+
+    GEO::Image<GEO::PixelRGB_u8> image( 10, 20 );
+    ASSERT_TRUE( image.getMetadata() == nullptr );
+
+    GEO::MetadataContainer::ptr_t metadata( new GEO::MetadataContainer() );
+    metadata->setValue( GEO::MetadataKey( GEO::METADATA_SRS ), "WGS84" );
+    image.setMetadata( metadata );
+
+    GEO::Image<GEO::PixelRGB_u8> copy = image;
+    GEO::ImageView<GEO::PixelRGB_u8> view = GEO::make_view( image, GEO::Rect( 2, 2, 5, 5 ));
+    GEO::ImageView<GEO::PixelRGB_u8> subview = GEO::make_view( view, GEO::Rect( 1, 1, 2, 2 ));
+    ASSERT_EQ( copy.getMetadata().get(), metadata.get() );
+    ASSERT_EQ( view.getMetadata().get(), metadata.get() );
+    ASSERT_EQ( subview.getMetadata().get(), metadata.get() );
+}
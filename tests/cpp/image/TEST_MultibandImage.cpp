@@ -0,0 +1,95 @@
+/**
+ * @file    TEST_MultibandImage.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cstdint>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test the band layout
+*/
+TEST( MultibandImage, BandLayout ){
+
+    GEO::MultibandImage_u16 image( 5, 11, 224 );
+    ASSERT_EQ( image.rows(), 5 );
+    ASSERT_EQ( image.cols(), 11 );
+    ASSERT_EQ( image.bands(), 224 );
+    ASSERT_FALSE( image.empty() );
+    ASSERT_TRUE( GEO::MultibandImage_u16().empty() );
+
+    // every band is aligned and holds the full image
+    for( int b=0; b<image.bands(); b++ ){
+        GEO::BandSpan<uint16_t> band = image.band(b);
+        ASSERT_EQ( band.size(), 55 );
+        ASSERT_EQ( ((uintptr_t)band.data()) % GEO::PIXEL_BUFFER_ALIGNMENT, 0 );
+        for( uint16_t& sample : band ){
+            sample = b;
+        }
+    }
+    ASSERT_THROW( image.band(224), GEO::GeneralException );
+
+    // gather a spectrum
+    image( 3, 2, 100 ) = 4000;
+    std::vector<uint16_t> spectrum( image.bands() );
+    image.getPixel( 3, 2, spectrum.data() );
+    ASSERT_EQ( spectrum[0], 0 );
+    ASSERT_EQ( spectrum[99], 99 );
+    ASSERT_EQ( spectrum[100], 4000 );
+
+    // clones do not share samples
+    GEO::MultibandImage_u16 copy = image.clone();
+    copy( 3, 2, 100 ) = 1;
+    ASSERT_EQ( image( 3, 2, 100 ), 4000 );
+}
+
+/**
+ * Test the band reductions
+*/
+TEST( MultibandImage, Reductions ){
+
+    // odd sizes exercise the loop remainder
+    GEO::MultibandImage_u8 image( 301, 203, 8 );
+    for( int b=0; b<image.bands(); b++ ){
+        for( int y=0; y<image.rows(); y++ ){
+        for( int x=0; x<image.cols(); x++ ){
+            image( x, y, b ) = ( x + y + b ) % 7;
+        }}
+    }
+    image( 17, 9, 5 ) = 200;
+
+    std::vector<GEO::BandSummary> summary = GEO::summarize_bands( image );
+    ASSERT_EQ( summary.size(), 8 );
+    for( int b=0; b<image.bands(); b++ ){
+
+        // compare against a plain loop
+        double sum = 0, mn = 255, mx = 0;
+        for( uint8_t const& value : image.band(b) ){
+            sum += value;
+            mn = std::min<double>( mn, value );
+            mx = std::max<double>( mx, value );
+        }
+        ASSERT_EQ( summary[b].count, 301*203 );
+        ASSERT_EQ( summary[b].min, mn );
+        ASSERT_EQ( summary[b].max, mx );
+        ASSERT_NEAR( summary[b].sum, sum, 0.5 );
+        ASSERT_NEAR( summary[b].mean, sum / (301*203), 0.0001 );
+    }
+    ASSERT_EQ( summary[5].max, 200 );
+
+    // normalized difference style weights
+    std::vector<double> weights( 8, 0 );
+    weights[3] = 1;
+    weights[2] = -0.5;
+    std::vector<double> output;
+    GEO::weighted_band_sum( image, weights, output );
+    ASSERT_EQ( output.size(), 301*203 );
+    ASSERT_NEAR( output[9*203 + 20], image(20,9,3) - 0.5*image(20,9,2), 0.0001 );
+    ASSERT_THROW( GEO::weighted_band_sum( image, std::vector<double>(3), output ), GEO::GeneralException );
+}
@@ -210,3 +210,31 @@ TEST( PixelTypes, PixelCast ){
 }
 
 
+
+/**
+ * Test the PixelN Type
+*/
+TEST( PixelN, Constructors ){
+
+    // default pixels are filled with the channel minimum
+    GEO::PixelN_u8<8> pixel01;
+    ASSERT_EQ( pixel01.dims(), 8 );
+    ASSERT_EQ( GEO::PixelN_u8<8>::BANDS, 8 );
+    for( int i=0; i<8; i++ ){
+        ASSERT_EQ( pixel01[i], 0 );
+    }
+
+    // set the bands
+    GEO::PixelN_u16<5> pixel02( 7 );
+    pixel02[4] = 4000;
+    ASSERT_EQ( pixel02[0], 7 );
+    ASSERT_EQ( pixel02.data()[4], 4000 );
+    ASSERT_FALSE( pixel02 == GEO::PixelN_u16<5>( 7 ));
+
+    // cast between channel types
+    GEO::PixelN_u8<4> pixel03( 255 );
+    pixel03[1] = 0;
+    GEO::PixelN_d<4> result03 = GEO::pixel_cast<GEO::PixelN_d<4> >( pixel03 );
+    ASSERT_NEAR( result03[0], 1, 0.0001 );
+    ASSERT_NEAR( result03[1], 0, 0.0001 );
+}
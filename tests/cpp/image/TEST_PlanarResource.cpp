@@ -0,0 +1,79 @@
+/**
+ * @file    TEST_PlanarResource.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cstdint>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test the band layout
+*/
+TEST( PlanarResource, BandLayout ){
+
+    GEO::PlanarResource<GEO::PixelRGB_u16> resource( 7, 9 );
+    ASSERT_EQ( resource.rows(), 7 );
+    ASSERT_EQ( resource.cols(), 9 );
+    ASSERT_EQ( resource.channels(), 3 );
+
+    // every band is aligned and holds the full image
+    for( int b=0; b<3; b++ ){
+        GEO::BandSpan<uint16_t> band = resource.band(b);
+        ASSERT_EQ( band.size(), 63 );
+        ASSERT_EQ( ((uintptr_t)band.data()) % GEO::PIXEL_BUFFER_ALIGNMENT, 0 );
+        for( uint16_t& sample : band ){
+            sample = b;
+        }
+    }
+    ASSERT_THROW( resource.band(3), GEO::GeneralException );
+
+    // pixels are gathered from the bands
+    resource.setPixel( 2, 3, GEO::PixelRGB_u16( 100, 200, 300 ));
+    GEO::PlanarResource<GEO::PixelRGB_u16> const& cresource = resource;
+    ASSERT_TRUE( cresource(2,3) == GEO::PixelRGB_u16( 100, 200, 300 ));
+    ASSERT_TRUE( cresource(0,0) == GEO::PixelRGB_u16( 0, 1, 2 ));
+    ASSERT_EQ( resource.band(2)(2,3), 300 );
+    ASSERT_THROW( resource(0,0) = GEO::PixelRGB_u16(), std::runtime_error );
+}
+
+/**
+ * Test the interleave and deinterleave conversions
+*/
+TEST( PlanarResource, Interleave ){
+
+    // large enough to be split across threads
+    GEO::MemoryAllocator::ptr_t pool( new GEO::TilePoolAllocator() );
+    GEO::MemoryResource<GEO::PixelRGB_u8> interleaved( 1024, 3000, pool );
+    for( int y=0; y<interleaved.rows(); y++ ){
+    for( int x=0; x<interleaved.cols(); x++ ){
+        interleaved(x,y) = GEO::PixelRGB_u8( x % 256, y % 256, (x+y) % 256 );
+    }}
+
+    GEO::PlanarResource<GEO::PixelRGB_u8> planar = GEO::deinterleave( interleaved );
+    ASSERT_EQ( planar.band(0)(300,5), 300 % 256 );
+    ASSERT_EQ( planar.band(1)(300,5), 5 );
+    ASSERT_EQ( planar.band(2)(300,5), 305 % 256 );
+
+    const GEO::MemoryResource<GEO::PixelRGB_u8> round_trip = GEO::interleave( planar );
+    for( int i=0; i<interleaved.rows()*interleaved.cols(); i+=997 ){
+        ASSERT_TRUE( round_trip[i] == interleaved[i] );
+    }
+
+    // both directions keep the allocator
+    ASSERT_EQ( planar.getAllocator(), pool );
+    ASSERT_EQ( round_trip.getAllocator(), pool );
+
+    // planar images are read by value through const and non-const images
+    GEO::PlanarImage<GEO::PixelRGB_u8> image;
+    image.setResource( planar.clone() );
+    GEO::PlanarImage<GEO::PixelRGB_u8> const& cimage = image;
+    ASSERT_TRUE( cimage(5,300) == interleaved(300,5) );
+    ASSERT_TRUE( image(5,300) == interleaved(300,5) );
+    ASSERT_TRUE( image[5*interleaved.cols() + 300] == interleaved(300,5) );
+}
+
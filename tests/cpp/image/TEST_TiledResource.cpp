@@ -0,0 +1,117 @@
+/**
+ * @file    TEST_TiledResource.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cstdint>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test the tile layout of a grid which is not a power of two
+*/
+TEST( TiledResource, ComputeTileLayout ){
+
+    std::vector<uint32_t> slots, order;
+    GEO::compute_tile_layout( 3, 2, GEO::TileLayout::MORTON, slots, order );
+    ASSERT_EQ( slots.size(), 6 );
+
+    // z-order: (0,0) (1,0) (0,1) (1,1) (2,0) (2,1)
+    const uint32_t expected[6] = { 0, 1, 3, 4, 2, 5 };
+    for( int s=0; s<6; s++ ){
+        ASSERT_EQ( order[s], expected[s] );
+        ASSERT_EQ( slots[order[s]], s );
+    }
+
+    // consecutive hilbert tiles are always neighbors
+    GEO::compute_tile_layout( 8, 8, GEO::TileLayout::HILBERT, slots, order );
+    for( int s=1; s<64; s++ ){
+        const int dx = (int)( order[s] % 8 ) - (int)( order[s-1] % 8 );
+        const int dy = (int)( order[s] / 8 ) - (int)( order[s-1] / 8 );
+        ASSERT_EQ( std::abs(dx) + std::abs(dy), 1 );
+    }
+}
+
+/**
+ * Test pixel access and conversion
+*/
+TEST( TiledResource, PixelAccess ){
+
+    // row-major source with a partial edge tile
+    GEO::MemoryResource<GEO::PixelRGB_u8> source( 70, 150 );
+    for( int y=0; y<source.rows(); y++ ){
+        for( int x=0; x<source.cols(); x++ ){
+            source( x, y ) = GEO::PixelRGB_u8( x % 256, y, ( x + y ) % 256 );
+        }
+    }
+
+    for( GEO::TileLayout layout : { GEO::TileLayout::MORTON, GEO::TileLayout::HILBERT } ){
+
+        GEO::TiledResource<GEO::PixelRGB_u8,32> tiled( source, layout );
+        ASSERT_EQ( tiled.rows(), 70 );
+        ASSERT_EQ( tiled.cols(), 150 );
+        ASSERT_EQ( tiled.tileCount(), 15 );
+
+        GEO::TiledResource<GEO::PixelRGB_u8,32> const& ctiled = tiled;
+        const GEO::MemoryResource<GEO::PixelRGB_u8>& csource = source;
+        for( int y=0; y<70; y++ ){
+            for( int x=0; x<150; x++ ){
+                ASSERT_TRUE( ctiled( x, y ) == csource( x, y ));
+            }
+        }
+        ASSERT_TRUE( ctiled[ 69*150 + 149 ] == csource( 149, 69 ));
+
+        // writes land in place and survive the round trip
+        tiled( 149, 69 ) = GEO::PixelRGB_u8( 1, 2, 3 );
+        GEO::MemoryResource<GEO::PixelRGB_u8> output = tiled.toMemoryResource();
+        const GEO::MemoryResource<GEO::PixelRGB_u8>& coutput = output;
+        ASSERT_TRUE( coutput( 149, 69 ) == GEO::PixelRGB_u8( 1, 2, 3 ));
+        ASSERT_TRUE( coutput( 33, 65 ) == csource( 33, 65 ));
+
+        // copies share, clones do not
+        GEO::TiledResource<GEO::PixelRGB_u8,32> copy = tiled;
+        GEO::TiledResource<GEO::PixelRGB_u8,32> clone = tiled.clone();
+        tiled( 0, 0 ) = GEO::PixelRGB_u8( 9, 9, 9 );
+        ASSERT_TRUE( copy( 0, 0 ) == GEO::PixelRGB_u8( 9, 9, 9 ));
+        ASSERT_TRUE( clone( 0, 0 ) == GEO::PixelRGB_u8( 0, 0, 0 ));
+    }
+}
+
+/**
+ * Test walking the tiles
+*/
+TEST( TiledResource, TileIteration ){
+
+    GEO::TiledImage<GEO::PixelGray_u16> image( 200, 130 );
+    GEO::TiledResource<GEO::PixelGray_u16> resource = image.getResource();
+    ASSERT_EQ( resource.tileSize(), 64 );
+    ASSERT_EQ( resource.tileCount(), 12 );
+
+    // tiles are contiguous and follow each other in memory
+    size_t pixels = 0;
+    const GEO::PixelGray_u16* previous = nullptr;
+    for( GEO::PixelTile<GEO::PixelGray_u16> tile : resource ){
+        if( previous != nullptr ){
+            ASSERT_EQ( tile.data() - previous, 64*64 );
+        }
+        previous = tile.data();
+        pixels += tile.window().width() * tile.window().height();
+    }
+    ASSERT_EQ( pixels, 200*130 );
+
+    // every pixel is visited once
+    std::set<int> visited;
+    resource.forEachPixel( [&]( const int& x, const int& y, GEO::PixelGray_u16& pixel ){
+        pixel = x + y;
+        visited.insert( y * 130 + x );
+    });
+    ASSERT_EQ( visited.size(), 200*130 );
+    ASSERT_EQ( image( 150, 100 )[0], 250 );
+}
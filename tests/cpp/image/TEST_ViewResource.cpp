@@ -0,0 +1,110 @@
+/**
+ * @file    TEST_ViewResource.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test the Rect intersection and bounds checks
+*/
+TEST( Rect, Operators ){
+
+    GEO::Rect rect01( 10, 20, 30, 40 );
+    ASSERT_EQ( rect01.area(), 1200 );
+    ASSERT_TRUE( rect01.inside( 60, 40 ));
+    ASSERT_FALSE( rect01.inside( 59, 40 ));
+
+    GEO::Rect rect02 = rect01 & GEO::Rect( 0, 0, 20, 30 );
+    ASSERT_TRUE( rect02 == GEO::Rect( 10, 20, 10, 10 ));
+    ASSERT_TRUE( ( rect01 & GEO::Rect( 100, 100, 5, 5 )).empty() );
+}
+
+/**
+ * Test a view shares the parent buffer
+*/
+TEST( ViewResource, SharedBuffer ){
+
+    // create an image with the pixel index in each value
+    GEO::Image<GEO::PixelGray_u8> image( 20, 30 );
+    for( int r=0; r<image.rows(); r++ ){
+    for( int c=0; c<image.cols(); c++ ){
+        image(r,c) = GEO::PixelGray_u8( (r*image.cols() + c) % 256 );
+    }}
+
+    // create the view
+    GEO::ImageView<GEO::PixelGray_u8> view = GEO::make_view( image, GEO::Rect( 5, 2, 10, 8 ));
+    ASSERT_EQ( view.rows(), 8 );
+    ASSERT_EQ( view.cols(), 10 );
+    ASSERT_EQ( view.getResource().stride(), 30 );
+    ASSERT_TRUE( view.getResource().isValid() );
+
+    for( int r=0; r<view.rows(); r++ ){
+    for( int c=0; c<view.cols(); c++ ){
+        ASSERT_TRUE( view(r,c) == image(r+2,c+5) );
+    }}
+
+    // writes go to the parent
+    view(1,1) = GEO::PixelGray_u8(255);
+    ASSERT_EQ( image(3,6)[0], 255 );
+
+    // nested views keep the parent stride
+    GEO::ImageView<GEO::PixelGray_u8> nested = GEO::make_view( view, GEO::Rect( 1, 1, 2, 2 ));
+    ASSERT_EQ( nested(0,0)[0], 255 );
+    ASSERT_TRUE( nested(1,1) == image(4,7) );
+
+    // deep copies are contiguous
+    GEO::MemoryResource<GEO::PixelGray_u8> copy = view.getResource().clone();
+    ASSERT_EQ( copy.rows(), 8 );
+    ASSERT_EQ( copy.cols(), 10 );
+    ASSERT_TRUE( copy(9,7) == image(9,14) );
+
+    // windows outside the parent are rejected
+    ASSERT_THROW( GEO::make_view( image, GEO::Rect( 25, 0, 10, 10 )), GEO::GeneralException );
+}
+
+/**
+ * Test a view does not keep the parent buffer alive
+*/
+TEST( ViewResource, Validity ){
+
+    GEO::ImageView<GEO::PixelRGB_u8> view;
+    ASSERT_FALSE( view.getResource().isValid() );
+    {
+        GEO::Image<GEO::PixelRGB_u8> image( 10, 10 );
+        view = GEO::make_view( image, GEO::Rect( 0, 0, 5, 5 ));
+        ASSERT_TRUE( view.getResource().isValid() );
+    }
+    ASSERT_FALSE( view.getResource().isValid() );
+}
+
+
+/**
+ * Test writes through a view do not reach copies of the parent
+*/
+TEST( ViewResource, CopyOnWrite ){
+
+    GEO::Image<GEO::PixelGray_u8> image( 10, 10 );
+    image.resource().fill( GEO::PixelGray_u8(1) );
+    const GEO::Image<GEO::PixelGray_u8>& cimage = image;
+
+    // a copy taken before the view keeps its pixels
+    GEO::Image<GEO::PixelGray_u8> before = image;
+    const GEO::Image<GEO::PixelGray_u8>& cbefore = before;
+    GEO::ImageView<GEO::PixelGray_u8> view = GEO::make_view( image, GEO::Rect( 2, 2, 5, 5 ));
+    view(0,0) = GEO::PixelGray_u8(7);
+    ASSERT_EQ( cimage(2,2)[0], 7 );
+    ASSERT_EQ( cbefore(2,2)[0], 1 );
+
+    // so does a copy taken while the view is alive
+    GEO::Image<GEO::PixelGray_u8> during = image;
+    const GEO::Image<GEO::PixelGray_u8>& cduring = during;
+    view(1,1) = GEO::PixelGray_u8(9);
+    ASSERT_EQ( cimage(3,3)[0], 9 );
+    ASSERT_EQ( cduring(3,3)[0], 1 );
+    ASSERT_EQ( cduring(2,2)[0], 7 );
+    ASSERT_EQ( cbefore(3,3)[0], 1 );
+}
@@ -0,0 +1,98 @@
+/**
+ * @file    TEST_AsyncTileReader.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test the tile windows cover the image once
+*/
+TEST( AsyncTileReader, ComputeTileWindows ){
+
+    std::vector<GEO::Rect> raster = GEO::IO::GDAL::compute_tile_windows( 100, 70, 32, 32, GEO::IO::GDAL::TileAccessPattern::RASTER_ORDER );
+    std::vector<GEO::Rect> hilbert = GEO::IO::GDAL::compute_tile_windows( 100, 70, 32, 32, GEO::IO::GDAL::TileAccessPattern::HILBERT_ORDER );
+    ASSERT_EQ( raster.size(), 12 );
+    ASSERT_EQ( hilbert.size(), 12 );
+
+    // raster order walks the rows
+    ASSERT_TRUE( raster[1] == GEO::Rect( 32, 0, 32, 32 ));
+    ASSERT_TRUE( raster[2] == GEO::Rect( 64, 0, 6, 32 ));
+    ASSERT_TRUE( raster[11] == GEO::Rect( 64, 96, 6, 4 ));
+
+    // both orders cover the same pixels
+    int area = 0;
+    for( size_t i=0; i<hilbert.size(); i++ ){
+        area += hilbert[i].area();
+        ASSERT_TRUE( hilbert[i].inside( 100, 70 ));
+    }
+    ASSERT_EQ( area, 7000 );
+    ASSERT_TRUE( hilbert[0] == GEO::Rect( 0, 0, 32, 32 ));
+}
+
+/**
+ * Test reading every tile matches a full read
+*/
+TEST( AsyncTileReader, ReadTiles ){
+
+    const std::string pathname = "../../tests/data/dem/n39_w120_3arc_v1.bil";
+    GEO::MemoryResource<GEO::PixelGray_df> full = GEO::IO::GDAL::load_image<GEO::PixelGray_df>( pathname );
+
+    GEO::IO::GDAL::AsyncTileReader<GEO::PixelGray_df> reader( pathname, 256, 256, GEO::IO::GDAL::TileAccessPattern::HILBERT_ORDER, 4, 3 );
+
+    std::vector<bool> seen( reader.size(), false );
+    GEO::IO::GDAL::ImageTile<GEO::PixelGray_df> tile;
+    while( reader.next( tile ) ){
+
+        ASSERT_FALSE( seen[tile.index()] );
+        seen[tile.index()] = true;
+
+        GEO::Rect window = tile.window();
+        ASSERT_TRUE( window == reader.windows()[tile.index()] );
+        ASSERT_EQ( tile.resource().rows(), window.height() );
+        ASSERT_EQ( tile.resource().cols(), window.width() );
+        ASSERT_TRUE( tile.resource()( window.width()-1, window.height()-1 ) == full( window.x() + window.width()-1, window.y() + window.height()-1 ));
+    }
+
+    for( size_t i=0; i<seen.size(); i++ ){
+        ASSERT_TRUE( seen[i] );
+    }
+}
+
+/**
+ * Test errors on the I/O threads reach the consumer
+*/
+TEST( AsyncTileReader, ExplicitWindowsError ){
+
+    std::vector<GEO::Rect> windows;
+    windows.push_back( GEO::Rect( 0, 0, 10, 10 ));
+    windows.push_back( GEO::Rect( 5000, 0, 10, 10 ));
+
+    GEO::IO::GDAL::AsyncTileReader<GEO::PixelGray_df> reader( "../../tests/data/dem/n39_w120_3arc_v1.bil", windows, 2, 1 );
+    GEO::IO::GDAL::ImageTile<GEO::PixelGray_df> tile;
+    ASSERT_TRUE( reader.next( tile ));
+    ASSERT_THROW( reader.next( tile ), GEO::GeneralException );
+}
+
+
+/**
+ * Test a one tile queue shared by several I/O threads drains every tile
+*/
+TEST( AsyncTileReader, SingleSlotQueue ){
+
+    const std::string pathname = "../../tests/data/dem/n39_w120_3arc_v1.bil";
+
+    for( int pass=0; pass<20; pass++ ){
+        GEO::IO::GDAL::AsyncTileReader<GEO::PixelGray_df> reader( pathname, 64, 64, GEO::IO::GDAL::TileAccessPattern::RASTER_ORDER, 1, 6 );
+
+        size_t count = 0;
+        GEO::IO::GDAL::ImageTile<GEO::PixelGray_df> tile;
+        while( reader.next( tile ) ){
+            count++;
+        }
+        ASSERT_EQ( count, reader.size() );
+    }
+}
@@ -0,0 +1,56 @@
+/**
+ * @file    TEST_GDAL_DatasetInfo.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test reading the header of a single file
+*/
+TEST( GDAL_DatasetInfo, ReadDatasetInfo ){
+
+    // the BIL header lives in a side-car file
+    GEO::IO::GDAL::DatasetInfo info = GEO::IO::GDAL::read_dataset_info( "../../tests/data/dem/n39_w120_3arc_v1.bil" );
+    GEO::IO::GDAL::ImageDriverGDAL driver( "../../tests/data/dem/n39_w120_3arc_v1.bil" );
+    driver.open();
+    ASSERT_TRUE( info.isValid() );
+    ASSERT_EQ( info.driver, "EHdr" );
+    ASSERT_EQ( info.rows, driver.rows() );
+    ASSERT_EQ( info.cols, driver.cols() );
+    ASSERT_EQ( info.bands.size(), 1 );
+    ASSERT_GT( info.bands[0].block_cols, 0 );
+    ASSERT_GT( info.bands[0].block_rows, 0 );
+    ASSERT_TRUE( info.has_geotransform );
+
+    // color images
+    info = GEO::IO::GDAL::read_dataset_info( "../../tests/data/images/Lenna.jpg" );
+    ASSERT_TRUE( info.isValid() );
+    ASSERT_EQ( info.bands.size(), 3 );
+    ASSERT_EQ( info.bands[0].data_type, "Byte" );
+}
+
+/**
+ * Test reading many headers at once
+*/
+TEST( GDAL_DatasetInfo, ReadDatasetInfoList ){
+
+    std::vector<boost::filesystem::path> paths;
+    paths.push_back( "../../tests/data/dem/n39_w120_3arc_v1.bil" );
+    paths.push_back( "../../tests/data/images/Lenna.jpg" );
+    paths.push_back( "../../tests/data/images/does_not_exist.tif" );
+
+    std::vector<GEO::IO::GDAL::DatasetInfo> info = GEO::IO::GDAL::read_dataset_info( paths, 2 );
+    ASSERT_EQ( info.size(), 3 );
+    ASSERT_TRUE( info[0].isValid() );
+    ASSERT_EQ( info[0].rows, GEO::IO::GDAL::read_dataset_info( paths[0] ).rows );
+    ASSERT_EQ( info[1].bands.size(), 3 );
+    ASSERT_FALSE( info[2].isValid() );
+    ASSERT_EQ( info[2].path, paths[2] );
+}
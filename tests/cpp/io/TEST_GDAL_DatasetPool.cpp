@@ -0,0 +1,139 @@
+/**
+ * @file    TEST_GDAL_DatasetPool.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <atomic>
+#include <thread>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Test lending and reusing datasets
+*/
+TEST( GDAL_DatasetPool, AcquireRelease ){
+
+    const std::string lenna_path = "../../tests/data/images/Lenna.jpg";
+    GEO::IO::GDAL::DatasetPool pool( 4 );
+
+    // two borrowers get their own dataset
+    GEO::IO::GDAL::DatasetPool::handle_t first  = pool.acquire( lenna_path );
+    GEO::IO::GDAL::DatasetPool::handle_t second = pool.acquire( lenna_path );
+    ASSERT_TRUE( first != nullptr );
+    ASSERT_TRUE( second != nullptr );
+    ASSERT_NE( first.get(), second.get() );
+    ASSERT_EQ( pool.openCount(), 2 );
+    ASSERT_EQ( pool.idleCount(), 0 );
+
+    // a returned dataset is handed out again
+    GDALDataset* dataset = first.get();
+    first.reset();
+    ASSERT_EQ( pool.idleCount(), 1 );
+    first = pool.acquire( lenna_path );
+    ASSERT_EQ( first.get(), dataset );
+    ASSERT_EQ( pool.openCount(), 2 );
+
+    // files GDAL cannot read do not take a slot
+    ASSERT_TRUE( pool.acquire( "../../tests/data/does_not_exist.tif" ) == nullptr );
+    ASSERT_EQ( pool.openCount(), 2 );
+
+    first.reset();
+    second.reset();
+    pool.clear();
+    ASSERT_EQ( pool.openCount(), 0 );
+}
+
+/**
+ * Test the cap on open datasets
+*/
+TEST( GDAL_DatasetPool, MaxOpen ){
+
+    const std::string lenna_path = "../../tests/data/images/Lenna.jpg";
+    const std::string dem_path   = "../../tests/data/dem/n39_w120_3arc_v1.bil";
+    GEO::IO::GDAL::DatasetPool pool( 1 );
+
+    // idle datasets of other files are closed to make room
+    pool.acquire( lenna_path ).reset();
+    ASSERT_EQ( pool.idleCount(), 1 );
+    GEO::IO::GDAL::DatasetPool::handle_t dem = pool.acquire( dem_path );
+    ASSERT_TRUE( dem != nullptr );
+    ASSERT_EQ( pool.openCount(), 1 );
+    ASSERT_EQ( pool.idleCount(), 0 );
+
+    // other threads wait while every dataset is lent out
+    std::atomic<bool> acquired( false );
+    std::thread waiter( [&](){
+        GEO::IO::GDAL::DatasetPool::handle_t lenna = pool.acquire( lenna_path );
+        acquired = ( lenna != nullptr );
+    });
+    while( pool.waitingCount() == 0 ){
+        std::this_thread::yield();
+    }
+    ASSERT_FALSE( acquired );
+    dem.reset();
+    waiter.join();
+    ASSERT_TRUE( acquired );
+    ASSERT_EQ( pool.openCount(), 1 );
+
+    // a thread holding a dataset goes over the cap instead of waiting on itself
+    dem = pool.acquire( dem_path );
+    GEO::IO::GDAL::DatasetPool::handle_t nested = pool.acquire( lenna_path );
+    ASSERT_TRUE( nested != nullptr );
+    ASSERT_EQ( pool.openCount(), 2 );
+
+    // while other threads give up after the timeout
+    pool.setWaitTimeout( 0.01 );
+    std::atomic<bool> timed_out( false );
+    std::thread other( [&](){
+        try{
+            pool.acquire( lenna_path );
+        } catch( GEO::GeneralException const& ){
+            timed_out = true;
+        }
+    });
+    other.join();
+    ASSERT_TRUE( timed_out );
+
+    // datasets over the cap are closed when returned
+    nested.reset();
+    ASSERT_EQ( pool.openCount(), 1 );
+    dem.reset();
+    ASSERT_EQ( pool.openCount(), 1 );
+
+    // raising the cap keeps the idle dataset, clearing closes it
+    pool.setMaxOpen( 8 );
+    ASSERT_EQ( pool.getMaxOpen(), 8 );
+    ASSERT_EQ( pool.idleCount(), 1 );
+    pool.clear();
+    ASSERT_EQ( pool.openCount(), 0 );
+}
+
+/**
+ * Test that drivers return their dataset when closed
+*/
+TEST( GDAL_DatasetPool, DriverClose ){
+
+    GEO::IO::GDAL::DatasetPool& pool = GEO::IO::GDAL::DatasetPool::instance();
+    pool.clear();
+    const size_t open_count = pool.openCount();
+
+    GEO::IO::GDAL::ImageDriverGDAL driver( "../../tests/data/images/Lenna.jpg" );
+    driver.open();
+    ASSERT_TRUE( driver.isOpen() );
+    ASSERT_EQ( pool.openCount(), open_count + 1 );
+
+    driver.close();
+    ASSERT_FALSE( driver.isOpen() );
+    ASSERT_EQ( pool.idleCount(), 1 );
+
+    // the next driver on the same file reuses it
+    GEO::IO::GDAL::ImageDriverGDAL other( "../../tests/data/images/Lenna.jpg" );
+    other.open();
+    ASSERT_TRUE( other.isOpen() );
+    ASSERT_EQ( pool.openCount(), open_count + 1 );
+    ASSERT_EQ( pool.idleCount(), 0 );
+}
@@ -73,3 +73,303 @@ TEST( GDAL_Driver, ChannelType2GDALType ){
 
 
 }
+
+/**
+ * Test reading a window and an overview level
+*/
+TEST( GDAL_Driver, LoadImageWindow ){
+
+    // read the full image for reference
+    GEO::MemoryResource<GEO::PixelRGB_u8> full = GEO::IO::GDAL::load_image<GEO::PixelRGB_u8>( "../../tests/data/images/Lenna.jpg" );
+
+    // read a window
+    GEO::Rect window( 100, 200, 64, 32 );
+    GEO::MemoryResource<GEO::PixelRGB_u8> chip = GEO::IO::GDAL::load_image<GEO::PixelRGB_u8>( "../../tests/data/images/Lenna.jpg", window );
+    ASSERT_EQ( chip.rows(), 32 );
+    ASSERT_EQ( chip.cols(), 64 );
+    for( int y=0; y<chip.rows(); y++ ){
+    for( int x=0; x<chip.cols(); x++ ){
+        ASSERT_TRUE( chip(x,y) == full( x + window.x(), y + window.y() ));
+    }}
+
+    // read an odd sized window at overview level 2
+    GEO::Image<GEO::PixelGray_u8> reduced;
+    GEO::IO::read_image( "../../tests/data/dem/n39_w120_3arc_v1.bil", GEO::Rect( 0, 0, 101, 50 ), reduced, 2 );
+    ASSERT_EQ( reduced.rows(), 13 );
+    ASSERT_EQ( reduced.cols(), 26 );
+
+    // windows outside of the image are rejected
+    ASSERT_THROW( GEO::IO::GDAL::load_image<GEO::PixelRGB_u8>( "../../tests/data/images/Lenna.jpg", GEO::Rect( 500, 0, 64, 64 )), GEO::GeneralException );
+}
+
+/**
+ * Test reading bands directly into planar storage
+*/
+TEST( GDAL_Driver, LoadPlanarImage ){
+
+    // signed 16 bit postings are read by GDAL straight into the double bands
+    GEO::PlanarImage<GEO::PixelGray_df> dem;
+    GEO::IO::read_image( "../../tests/data/dem/n39_w120_3arc_v1.bil", dem );
+    GEO::PlanarImage<GEO::PixelGray_df> const& cdem = dem;
+    GEO::MemoryResource<GEO::PixelGray_df> reference = GEO::IO::GDAL::load_image<GEO::PixelGray_df>( "../../tests/data/dem/n39_w120_3arc_v1.bil" );
+    ASSERT_EQ( dem.rows(), reference.rows() );
+    ASSERT_EQ( dem.cols(), reference.cols() );
+    ASSERT_TRUE( cdem(100,200) == reference(200,100) );
+
+    // 8 bit color bands
+    const GEO::PlanarResource<GEO::PixelRGB_u8> lenna = GEO::IO::GDAL::load_planar_image<GEO::PixelRGB_u8>( "../../tests/data/images/Lenna.jpg" );
+    GEO::MemoryResource<GEO::PixelRGB_u8> lenna_ref = GEO::IO::GDAL::load_image<GEO::PixelRGB_u8>( "../../tests/data/images/Lenna.jpg" );
+    ASSERT_EQ( lenna.channels(), 3 );
+    ASSERT_TRUE( lenna(31,17) == lenna_ref(31,17) );
+}
+
+/**
+ * Test that signed 16 bit samples keep their sign
+*/
+TEST( GDAL_Driver, LoadSignedImage ){
+
+    // the dem is SIGNEDINT with voids at -32767
+    GEO::Image<GEO::PixelGray_df> dem;
+    GEO::IO::read_image( "../../tests/data/dem/n39_w120_3arc_v1.bil", dem );
+    const GEO::Image<GEO::PixelGray_df>& cdem = dem;
+    ASSERT_EQ( cdem(6,916)[0], -32767 );
+    ASSERT_EQ( cdem(7,917)[0], -32767 );
+
+    // and nothing wraps above the highest posting
+    for( int r=0; r<dem.rows(); r++ ){
+    for( int c=0; c<dem.cols(); c++ ){
+        ASSERT_LE( cdem(r,c)[0], 3272 );
+    }}
+}
+
+/**
+ * Test that metadata is read with the pixels
+*/
+TEST( GDAL_Driver, LoadImageMetadata ){
+
+    // the dem carries a geographic geotransform
+    GEO::MetadataContainer::ptr_t metadata;
+    GEO::MemoryResource<GEO::PixelGray_df> dem = GEO::IO::GDAL::load_image<GEO::PixelGray_df>( "../../tests/data/dem/n39_w120_3arc_v1.bil", &metadata );
+    ASSERT_TRUE( metadata != nullptr );
+    double transform[6];
+    ASSERT_TRUE( metadata->getGeoTransform( transform ));
+    ASSERT_NEAR( transform[0], -120, 0.01 );
+    ASSERT_NEAR( transform[3],   40, 0.01 );
+    ASSERT_TRUE( metadata->contains( GEO::MetadataKey( GEO::METADATA_SRS )));
+
+    // read_image attaches it to the image
+    GEO::Image<GEO::PixelGray_df> image;
+    GEO::IO::read_image( "../../tests/data/dem/n39_w120_3arc_v1.bil", image );
+    ASSERT_TRUE( image.getMetadata() != nullptr );
+    ASSERT_EQ( image.getMetadata()->getValue( GEO::MetadataKey( GEO::METADATA_GEOTRANSFORM )),
+               metadata->getValue( GEO::MetadataKey( GEO::METADATA_GEOTRANSFORM )));
+}
+
+/**
+ * Test that images carry their geotransform
+*/
+TEST( GDAL_Driver, LoadImageGeoTransform ){
+
+    GEO::Image<GEO::PixelGray_df> dem;
+    GEO::IO::read_image( "../../tests/data/dem/n39_w120_3arc_v1.bil", dem );
+    ASSERT_TRUE( dem.getGeoTransform().isValid() );
+    ASSERT_EQ( dem.getGeoTransform().getFrame().type, GEO::CoordinateType::Geodetic );
+
+    // a posting in the middle of the tile maps back to its pixel
+    std::vector<GEO::CoordinateGeodetic_d> points( 1, GEO::CoordinateGeodetic_d( 39.5, -119.5 ));
+    std::vector<double> cols, rows;
+    dem.worldToPixel( points, cols, rows );
+    ASSERT_NEAR( cols[0], 600.5, 0.01 );
+    ASSERT_NEAR( rows[0], 600.5, 0.01 );
+
+    // windows are shifted to the window origin
+    GEO::Image<GEO::PixelGray_df> window;
+    GEO::IO::read_image( "../../tests/data/dem/n39_w120_3arc_v1.bil", GEO::Rect( 500, 500, 200, 200 ), window );
+    window.worldToPixel( points, cols, rows );
+    ASSERT_NEAR( cols[0], 100.5, 0.01 );
+    ASSERT_NEAR( rows[0], 100.5, 0.01 );
+}
+
+/**
+ * Test sampling an image file at a list of points
+*/
+TEST( GDAL_Driver, SampleImage ){
+
+    const std::string dem_path = "../../tests/data/dem/n39_w120_3arc_v1.bil";
+    GEO::Image<GEO::PixelGray_df> dem;
+    GEO::IO::read_image( dem_path, dem );
+
+    // a track crossing several tiles
+    std::vector<GEO::CoordinateGeodetic_d> track;
+    for( int i=0; i<5000; i++ ){
+        track.push_back( GEO::CoordinateGeodetic_d( 39.99 - i * 0.0002, -119.99 + i * 0.00019 ));
+    }
+
+    // reading the file by tile matches sampling the loaded image
+    std::vector<double> expected, output;
+    GEO::sample( dem, track, GEO::Interpolation::BILINEAR, expected );
+    GEO::IO::GDAL::sample_image<GEO::PixelGray_df>( dem_path, track, GEO::Interpolation::BILINEAR, output, 3 );
+    ASSERT_EQ( output.size(), expected.size() );
+    for( size_t i=0; i<output.size(); i++ ){
+        ASSERT_NEAR( output[i], expected[i], 1e-9 );
+    }
+}
+
+/**
+ * Test loading every band of an image
+*/
+TEST( GDAL_Driver, LoadMultibandImage ){
+
+    const std::string lenna_path = "../../tests/data/images/Lenna.jpg";
+    GEO::MemoryResource<GEO::PixelRGB_u8> reference = GEO::IO::GDAL::load_image<GEO::PixelRGB_u8>( lenna_path );
+
+    // runtime band count
+    GEO::MultibandImage_u8 image;
+    GEO::IO::read_image( lenna_path, image );
+    ASSERT_EQ( image.bands(), 3 );
+    ASSERT_EQ( image.rows(), reference.rows() );
+    ASSERT_EQ( image.cols(), reference.cols() );
+    for( int b=0; b<3; b++ ){
+        ASSERT_EQ( image( 31, 17, b ), reference(31,17)[b] );
+    }
+
+    // compile-time band count
+    GEO::MemoryResource<GEO::PixelN_u8<3> > pixels = GEO::IO::GDAL::load_image<GEO::PixelN_u8<3> >( lenna_path );
+    for( int b=0; b<3; b++ ){
+        ASSERT_EQ( pixels(31,17)[b], reference(31,17)[b] );
+    }
+
+    // buffer bands past the image bands are zeroed
+    GEO::PlanarBuffer<uint8_t> buffer( reference.rows(), reference.cols(), 5 );
+    std::fill( buffer.band(3).begin(), buffer.band(4).end(), 0xAB );
+    GEO::IO::GDAL::ImageDriverGDAL driver( lenna_path );
+    driver.open();
+    driver.getBands<GEO::ChannelTypeUInt8>( buffer, GEO::Rect( 0, 0, reference.cols(), reference.rows() ));
+    ASSERT_EQ( buffer.band(2)(17,31), reference(17,31)[2] );
+    ASSERT_EQ( buffer.band(3)(17,31), 0 );
+    ASSERT_EQ( buffer.band(4)(400,500), 0 );
+}
+
+/**
+ * Test computing statistics of an image file
+*/
+TEST( GDAL_Driver, ComputeImageStatistics ){
+
+    // the dem voids are masked by its no-data value
+    const std::string dem_path = "../../tests/data/dem/n39_w120_3arc_v1.bil";
+    GEO::MultibandImage_df dem = GEO::IO::GDAL::load_multiband_image<GEO::ChannelTypeDoubleFree>( dem_path );
+    GEO::StatisticsOptions dem_options;
+    dem_options.use_nodata = true;
+    dem_options.nodata_value = -32767;
+    std::vector<GEO::BandStatistics> reference = GEO::compute_statistics( dem, dem_options );
+    ASSERT_GT( reference[0].nodata_count, 0 );
+
+    // full statistics stream the file
+    std::vector<GEO::BandStatistics> stats = GEO::IO::GDAL::compute_image_statistics<GEO::ChannelTypeDoubleFree>( dem_path );
+    ASSERT_EQ( stats.size(), 1 );
+    ASSERT_EQ( stats[0].nodata_count, reference[0].nodata_count );
+    ASSERT_EQ( stats[0].valid_count, reference[0].valid_count );
+    ASSERT_GT( stats[0].min, -32767 );
+    ASSERT_EQ( stats[0].min, reference[0].min );
+    ASSERT_EQ( stats[0].max, reference[0].max );
+    ASSERT_NEAR( stats[0].mean, reference[0].mean, 1e-6 );
+    ASSERT_NEAR( stats[0].stddev, reference[0].stddev, 1e-6 );
+
+    // approximate statistics read a reduced image
+    GEO::StatisticsOptions options;
+    options.approximate = true;
+    options.approximate_pixels = 10000;
+    stats = GEO::IO::GDAL::compute_image_statistics<GEO::ChannelTypeDoubleFree>( dem_path, options );
+    ASSERT_LE( stats[0].valid_count, 20000 );
+    ASSERT_GT( stats[0].min, -32767 );
+    ASSERT_NEAR( stats[0].mean, reference[0].mean, reference[0].stddev * 0.1 );
+
+    // each band is binned over its own range
+    const std::string lenna_path = "../../tests/data/images/Lenna.jpg";
+    GEO::MultibandImage_df lenna = GEO::IO::GDAL::load_multiband_image<GEO::ChannelTypeDoubleFree>( lenna_path );
+    reference = GEO::compute_statistics( lenna );
+    stats = GEO::IO::GDAL::compute_image_statistics<GEO::ChannelTypeDoubleFree>( lenna_path );
+    ASSERT_EQ( stats.size(), 3 );
+    for( int b=0; b<3; b++ ){
+        ASSERT_EQ( stats[b].histogram_min, reference[b].histogram_min );
+        ASSERT_EQ( stats[b].histogram_max, reference[b].histogram_max );
+        ASSERT_TRUE( stats[b].histogram == reference[b].histogram );
+    }
+    ASSERT_NE( stats[0].histogram_min, stats[2].histogram_min );
+}
+
+/**
+ * Test splitting a window on block boundaries
+*/
+TEST( GDAL_Driver, SplitBlockRanges ){
+
+    // many block rows only split rows
+    std::vector<GEO::Rect> ranges = GEO::IO::GDAL::split_block_ranges( GEO::Rect( 10, 5, 1000, 700 ), 64, 256, 4 );
+    ASSERT_EQ( ranges.size(), 4 );
+    int rows = 0;
+    for( size_t i=0; i<ranges.size(); i++ ){
+        ASSERT_EQ( ranges[i].x(), 10 );
+        ASSERT_EQ( ranges[i].width(), 1000 );
+        ASSERT_EQ( ranges[i].y(), 5 + rows );
+        if( i > 0 ){
+            ASSERT_EQ( ranges[i].y() % 64, 0 );
+        }
+        rows += ranges[i].height();
+    }
+    ASSERT_EQ( rows, 700 );
+
+    // a single row of tiles splits on columns
+    ranges = GEO::IO::GDAL::split_block_ranges( GEO::Rect( 0, 0, 4096, 1024 ), 1024, 1024, 8 );
+    ASSERT_EQ( ranges.size(), 4 );
+    ASSERT_EQ( ranges[2].x(), 2048 );
+    ASSERT_EQ( ranges[2].width(), 1024 );
+    ASSERT_EQ( ranges[2].height(), 1024 );
+
+    // a single block cannot be split
+    ASSERT_EQ( GEO::IO::GDAL::split_block_ranges( GEO::Rect( 0, 0, 512, 512 ), 512, 512, 8 ).size(), 1 );
+}
+
+/**
+ * Test decoding a window on several threads
+*/
+TEST( GDAL_Driver, ReadPixelsParallel ){
+
+    const std::string lenna_path = "../../tests/data/images/Lenna.jpg";
+    GEO::MemoryResource<GEO::PixelRGB_u8> reference = GEO::IO::GDAL::load_image<GEO::PixelRGB_u8>( lenna_path );
+    const GEO::MemoryResource<GEO::PixelRGB_u8>& creference = reference;
+
+    GEO::IO::GDAL::ImageDriverGDAL driver( lenna_path );
+    driver.open();
+    ASSERT_TRUE( driver.isOpen() );
+
+    GEO::Rect window( 30, 20, 400, 300 );
+    boost::shared_ptr<GEO::PixelRGB_u8[]> pixels = GEO::allocate_pixels<GEO::PixelRGB_u8>( 400 * 300 );
+    GEO::IO::GDAL::read_pixels_parallel( lenna_path, driver, window, pixels, 4 );
+    for( int y=0; y<window.height(); y++ ){
+    for( int x=0; x<window.width(); x++ ){
+        ASSERT_TRUE( pixels[y * window.width() + x] == creference( x + window.x(), y + window.y() ));
+    }}
+}
+
+/**
+ * Test reading single pixels into pixel types with fewer channels
+*/
+TEST( GDAL_Driver, GetPixelFewerChannels ){
+
+    const std::string lenna_path = "../../tests/data/images/Lenna.jpg";
+    GEO::MemoryResource<GEO::PixelRGB_u8> reference = GEO::IO::GDAL::load_image<GEO::PixelRGB_u8>( lenna_path );
+    const GEO::MemoryResource<GEO::PixelRGB_u8>& creference = reference;
+
+    GEO::IO::GDAL::ImageDriverGDAL driver( lenna_path );
+    driver.open();
+    ASSERT_TRUE( driver.isOpen() );
+
+    // a gray pixel keeps the first band
+    GEO::PixelGray_u8 gray = driver.getPixel<GEO::PixelGray_u8>( 31, 17 );
+    ASSERT_EQ( gray[0], creference(31,17)[0] );
+
+    // a two channel pixel keeps the first two bands
+    GEO::PixelN_u8<2> pair = driver.getPixel<GEO::PixelN_u8<2> >( 31, 17 );
+    ASSERT_EQ( pair[0], creference(31,17)[0] );
+    ASSERT_EQ( pair[1], creference(31,17)[1] );
+}
@@ -5,6 +5,9 @@
 */
 #include <gtest/gtest.h>
 
+/// C++ Standard Libraries
+#include <fstream>
+
 /// GeoExplore
 #include <GeoExplore.hpp>
 
@@ -60,3 +63,22 @@ TEST( ImageIO, ReadDiskImage ){
 }
 
 
+/**
+ * Test reading a file GDAL cannot open
+*/
+TEST( ImageIO, ReadCorruptImage ){
+
+    const boost::filesystem::path pathname = boost::filesystem::temp_directory_path() / ( boost::filesystem::unique_path().string() + ".ntf" );
+    {
+        std::ofstream fout( pathname.c_str() );
+        fout << "not an image";
+    }
+
+    GEO::Image<GEO::PixelGray_u8> image;
+    ASSERT_THROW( GEO::IO::read_image( pathname, image ), GEO::GeneralException );
+    ASSERT_THROW( GEO::IO::read_image( pathname, GEO::Rect( 0, 0, 1, 1 ), image ), GEO::GeneralException );
+    GEO::PlanarImage<GEO::PixelGray_u8> planar;
+    ASSERT_THROW( GEO::IO::read_image( pathname, planar ), GEO::GeneralException );
+    boost::filesystem::remove( pathname );
+}
+
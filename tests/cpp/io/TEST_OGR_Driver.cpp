@@ -5,6 +5,9 @@
 */
 #include <gtest/gtest.h>
 
+/// C++ Standard Libraries
+#include <vector>
+
 /// GeoExplore Libraries
 #include <GeoExplore.hpp>
 
@@ -58,3 +61,34 @@ TEST( OGR_Driver, convert_Geodetic2UTM ){
 }
 
 
+/**
+ * Transform arrays of coordinates with a reusable transformer
+*/
+TEST( OGR_Driver, CoordinateTransformer ){
+
+    GEO::OGR::CoordinateTransformer transformer( GEO::CoordinateFrame( GEO::Datum::WGS84 ),
+                                                 GEO::CoordinateFrame( 18, true, GEO::Datum::WGS84 ));
+
+    // the batch matches the single point conversion
+    std::vector<double> x( 1000 ), y( 1000 );
+    for( size_t i=0; i<x.size(); i++ ){
+        x[i] = -77.0365 + i * 1e-4;
+        y[i] =  38.8977 + i * 1e-4;
+    }
+    std::vector<double> lon = x, lat = y;
+    transformer.transform( x.size(), &x[0], &y[0] );
+
+    double easting, northing, altitude;
+    GEO::OGR::convert_Geodetic2UTM_fixedZone( lat[500], lon[500], 0, GEO::Datum::WGS84, GEO::Datum::WGS84, 18,
+                                              easting, northing, altitude );
+    ASSERT_NEAR( x[500], easting, 0.001 );
+    ASSERT_NEAR( y[500], northing, 0.001 );
+    ASSERT_NEAR( x[0], 323394, 1 );
+    ASSERT_NEAR( y[0], 4307396, 1 );
+
+    // identical frames leave the points alone
+    GEO::OGR::CoordinateTransformer identity( GEO::CoordinateFrame( GEO::Datum::WGS84 ), GEO::CoordinateFrame( GEO::Datum::WGS84 ));
+    identity.transform( lon.size(), &lon[0], &lat[0] );
+    ASSERT_EQ( lon[10], -77.0365 + 10 * 1e-4 );
+}
+
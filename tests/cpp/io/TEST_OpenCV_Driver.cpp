@@ -10,6 +10,7 @@
 
 /// OpenCV
 #include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
 
 
 /**
@@ -18,6 +19,134 @@
 TEST( OpenCV_Driver, PixelType2OpenCVType ){
 
     ASSERT_EQ( GEO::IO::OPENCV::PixelType2OpenCVType<GEO::PixelRGB_d>(), CV_8UC3);
+    ASSERT_EQ( GEO::IO::OPENCV::PixelType2OpenCVType<GEO::PixelGray_u8>(), CV_8UC1);
+    ASSERT_EQ( GEO::IO::OPENCV::PixelType2OpenCVType<GEO::PixelRGB_u16>(), CV_16UC3);
 
 }
 
+/**
+ * Test the driver accessors
+*/
+TEST( OpenCV_Driver, DriverAccessors ){
+
+    GEO::IO::OPENCV::ImageDriverOpenCV driver("../../tests/data/images/Lenna.jpg");
+
+    ASSERT_EQ( driver.type(), GEO::ImageDriverType::OPENCV );
+    ASSERT_EQ( driver.rows(), 512 );
+    ASSERT_EQ( driver.cols(), 512 );
+    ASSERT_TRUE( driver.isOpen() );
+
+    driver.close();
+    ASSERT_FALSE( driver.isOpen() );
+}
+
+/**
+ * Test loading an image into a memory resource
+*/
+TEST( OpenCV_Driver, LoadImage ){
+
+    GEO::MemoryResource<GEO::PixelRGB_u8> resource = GEO::IO::OPENCV::load_image<GEO::PixelRGB_u8>("../../tests/data/images/Lenna.jpg");
+    ASSERT_EQ( resource.rows(), 512 );
+    ASSERT_EQ( resource.cols(), 512 );
+
+    // Lenna is mostly red
+    double red = 0, blue = 0;
+    for( int i=0; i<resource.rows()*resource.cols(); i++ ){
+        red  += resource[i].r();
+        blue += resource[i].b();
+    }
+    ASSERT_GT( red, blue );
+
+    // compare against the OpenCV decode
+    cv::Mat reference = cv::imread("../../tests/data/images/Lenna.jpg");
+    ASSERT_EQ( resource(10,20).r(), reference.at<cv::Vec3b>(20,10)[2] );
+    ASSERT_EQ( resource(10,20).g(), reference.at<cv::Vec3b>(20,10)[1] );
+    ASSERT_EQ( resource(10,20).b(), reference.at<cv::Vec3b>(20,10)[0] );
+
+}
+
+/**
+ * Test reduced decoding
+*/
+TEST( OpenCV_Driver, LoadImageReduced ){
+
+    GEO::Image<GEO::PixelGray_u8> image;
+    GEO::IO::read_image("../../tests/data/images/Lenna.jpg", image, GEO::IO::OPENCV::DecodeScale::QUARTER );
+    ASSERT_EQ( image.rows(), 128 );
+    ASSERT_EQ( image.cols(), 128 );
+
+    // a second read of the same size reuses the buffer
+    GEO::PixelGray_u8* buffer = image.getResource().getPixelData().get();
+    GEO::IO::read_image("../../tests/data/images/Lenna.jpg", image, GEO::IO::OPENCV::DecodeScale::QUARTER );
+    ASSERT_EQ( image.getResource().getPixelData().get(), buffer );
+
+}
+
+/**
+ * Test the parallel batch decode
+*/
+TEST( OpenCV_Driver, ReadImagesBatch ){
+
+    std::vector<boost::filesystem::path> pathnames( 8, "../../tests/data/images/Lenna.jpg");
+    std::vector<GEO::Image<GEO::PixelRGB_d> > images;
+
+    GEO::IO::read_images( pathnames, images, GEO::IO::OPENCV::DecodeScale::HALF, 4 );
+    ASSERT_EQ( images.size(), pathnames.size() );
+    for( size_t i=0; i<images.size(); i++ ){
+        ASSERT_EQ( images[i].rows(), 256 );
+        ASSERT_EQ( images[i].cols(), 256 );
+        ASSERT_TRUE( images[i](5,5) == images[0](5,5) );
+    }
+
+    // missing files are reported before decoding
+    pathnames.push_back("../../tests/data/images/missing.jpg");
+    ASSERT_THROW( GEO::IO::read_images( pathnames, images ), std::runtime_error );
+}
+
+/**
+ * Test reading a window with reduced decoding
+*/
+TEST( OpenCV_Driver, ReadImageWindow ){
+
+    GEO::Image<GEO::PixelRGB_u8> full;
+    GEO::IO::read_image("../../tests/data/images/Lenna.jpg", full );
+
+    GEO::Image<GEO::PixelRGB_u8> chip;
+    GEO::IO::read_image("../../tests/data/images/Lenna.jpg", GEO::Rect( 10, 300, 40, 20 ), chip );
+    ASSERT_EQ( chip.rows(), 20 );
+    ASSERT_EQ( chip.cols(), 40 );
+    ASSERT_TRUE( chip(0,0) == full(300,10) );
+    ASSERT_TRUE( chip(19,39) == full(319,49) );
+
+    // overview levels past the reduced decoders are area averaged
+    GEO::IO::read_image("../../tests/data/images/Lenna.jpg", GEO::Rect( 0, 0, 512, 512 ), chip, 1 );
+    ASSERT_EQ( chip.rows(), 256 );
+    GEO::IO::read_image("../../tests/data/images/Lenna.jpg", GEO::Rect( 0, 0, 512, 512 ), chip, 5 );
+    ASSERT_EQ( chip.rows(), 16 );
+    ASSERT_EQ( chip.cols(), 16 );
+}
+
+
+/**
+ * Test gray pixels hold luminance rather than a single color channel
+*/
+TEST( OpenCV_Driver, LoadImageGray ){
+
+    const std::string lenna_path = "../../tests/data/images/Lenna.jpg";
+
+    // loading decodes straight to grayscale
+    GEO::MemoryResource<GEO::PixelGray_u8> resource = GEO::IO::OPENCV::load_image<GEO::PixelGray_u8>( lenna_path );
+    cv::Mat reference = cv::imread( lenna_path, cv::IMREAD_GRAYSCALE );
+    ASSERT_EQ( resource(10,20)[0], reference.at<uchar>(20,10) );
+
+    // the driver decodes color and converts
+    cv::Mat color = cv::imread( lenna_path, cv::IMREAD_COLOR );
+    cv::Mat luminance;
+    cv::cvtColor( color, luminance, cv::COLOR_BGR2GRAY );
+    GEO::IO::OPENCV::ImageDriverOpenCV driver( lenna_path );
+    ASSERT_EQ( driver.getPixel<GEO::PixelGray_u8>( 10, 20 )[0], luminance.at<uchar>(20,10) );
+
+    boost::shared_ptr<GEO::PixelGray_u8[]> pixels( new GEO::PixelGray_u8[512*512] );
+    driver.getPixels( pixels, 512*512 );
+    ASSERT_EQ( pixels[20*512+10][0], luminance.at<uchar>(20,10) );
+}
@@ -0,0 +1,184 @@
+/**
+ * @file    TEST_QuantizedMesh.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Build a skirted mesh over rolling hills with 30 meter posts
+*/
+static GEO::TERRAIN::TerrainMesh make_hills(){
+    GEO::TERRAIN::ElevationGrid::ptr_t grid( new GEO::TERRAIN::ElevationGrid( 65, 65, 30, 30 ));
+    for( int y=0; y<grid->rows; y++ ){
+        for( int x=0; x<grid->cols; x++ ){
+            (*grid)( x, y ) = 500 + 150 * std::sin( x * 0.1 ) * std::cos( y * 0.07 );
+        }
+    }
+    GEO::TERRAIN::TerrainMeshBuilder builder( grid );
+    GEO::TERRAIN::TerrainMesh output = builder.buildTile( GEO::Rect( 0, 0, 65, 65 ));
+    GEO::TERRAIN::add_skirt( output, 20 );
+    return output;
+}
+
+/**
+ * Test octahedron normal encoding
+*/
+TEST( QuantizedMesh, OctNormals ){
+
+    // sweep the whole sphere, including the lower half
+    for( int a=0; a<36; a++ ){
+        for( int b=-17; b<=17; b++ ){
+            const float normal[3] = { float( std::cos( b * M_PI / 36 ) * std::cos( a * M_PI / 18 )),
+                                      float( std::sin( b * M_PI / 36 )),
+                                      float( std::cos( b * M_PI / 36 ) * std::sin( a * M_PI / 18 )) };
+            int8_t encoded[2];
+            float decoded[3];
+            GEO::TERRAIN::oct_encode( normal, encoded );
+            GEO::TERRAIN::oct_decode( encoded, decoded );
+
+            // 8 bits per component is good to about a degree
+            const float dot = normal[0] * decoded[0] + normal[1] * decoded[1] + normal[2] * decoded[2];
+            ASSERT_NEAR( decoded[0] * decoded[0] + decoded[1] * decoded[1] + decoded[2] * decoded[2], 1, 1e-5 );
+            ASSERT_GT( dot, std::cos( 1.5 * M_PI / 180 ));
+        }
+    }
+
+    // straight up and straight down
+    const float up[3] = { 0, 1, 0 }, down[3] = { 0, -1, 0 };
+    int8_t encoded[2];
+    float decoded[3];
+    GEO::TERRAIN::oct_encode( up, encoded );
+    GEO::TERRAIN::oct_decode( encoded, decoded );
+    ASSERT_NEAR( decoded[1], 1, 1e-6 );
+    GEO::TERRAIN::oct_encode( down, encoded );
+    GEO::TERRAIN::oct_decode( encoded, decoded );
+    ASSERT_NEAR( decoded[1], -1, 1e-6 );
+}
+
+/**
+ * Test quantizing and expanding a mesh
+*/
+TEST( QuantizedMesh, Quantize ){
+
+    const GEO::TERRAIN::TerrainMesh mesh = make_hills();
+    const GEO::TERRAIN::QuantizedMesh quantized = GEO::TERRAIN::quantize_mesh( mesh );
+    ASSERT_EQ( sizeof(GEO::TERRAIN::QuantizedVertex), 8 );
+    ASSERT_EQ( quantized.vertices.size(), mesh.vertices.size() );
+    ASSERT_EQ( quantized.window, mesh.window );
+
+    // a quarter of the vertex bytes and half of the index bytes
+    const size_t raw_bytes = mesh.vertices.size() * sizeof(GEO::TERRAIN::TerrainVertex) + mesh.indices.size() * 4;
+    ASSERT_EQ( quantized.bytes(), mesh.vertices.size() * 8 + mesh.indices.size() * 2 );
+    ASSERT_LT( quantized.bytes() * 2, raw_bytes );
+
+    // positions are within half a step of the per-tile grid
+    const GEO::TERRAIN::TerrainMesh expanded = GEO::TERRAIN::dequantize_mesh( quantized );
+    ASSERT_EQ( expanded.indices, mesh.indices );
+    for( size_t i=0; i<mesh.vertices.size(); i++ ){
+        for( int k=0; k<3; k++ ){
+            ASSERT_LE( std::fabs( expanded.vertices[i].position[k] - mesh.vertices[i].position[k] ), quantized.scale[k] * 0.51 + 1e-4 );
+        }
+        ASSERT_NEAR( expanded.vertices[i].uv[0], mesh.vertices[i].uv[0], 1e-4 );
+        ASSERT_NEAR( expanded.vertices[i].uv[1], mesh.vertices[i].uv[1], 1e-4 );
+    }
+
+    // the 1920 m tile with 320 m of relief resolves to a few millimeters
+    ASSERT_LT( quantized.scale[0], 0.03 );
+    ASSERT_LT( quantized.scale[1], 0.01 );
+
+    // too many vertices for 16-bit indices
+    GEO::TERRAIN::TerrainMesh large;
+    large.vertices.resize( 70000 );
+    ASSERT_THROW( GEO::TERRAIN::quantize_mesh( large ), GEO::GeneralException );
+}
+
+/**
+ * Test compressing and decompressing a mesh
+*/
+TEST( QuantizedMesh, Compress ){
+
+    const GEO::TERRAIN::QuantizedMesh mesh = GEO::TERRAIN::quantize_mesh( make_hills() );
+    const std::vector<uint8_t> bytes = GEO::TERRAIN::compress_mesh( mesh );
+    ASSERT_LT( bytes.size() * 2, mesh.bytes() );
+
+    const GEO::TERRAIN::QuantizedMesh output = GEO::TERRAIN::decompress_mesh( bytes );
+    ASSERT_EQ( output.window, mesh.window );
+    ASSERT_EQ( output.step, mesh.step );
+    ASSERT_EQ( output.min_height, mesh.min_height );
+    ASSERT_EQ( output.max_height, mesh.max_height );
+    ASSERT_EQ( output.indices, mesh.indices );
+    ASSERT_EQ( output.vertices.size(), mesh.vertices.size() );
+    for( int k=0; k<3; k++ ){
+        ASSERT_EQ( output.origin[k], mesh.origin[k] );
+        ASSERT_EQ( output.offset[k], mesh.offset[k] );
+        ASSERT_EQ( output.scale[k], mesh.scale[k] );
+    }
+    for( size_t i=0; i<mesh.vertices.size(); i++ ){
+        ASSERT_EQ( std::vector<uint16_t>( output.vertices[i].position, output.vertices[i].position + 3 ),
+                   std::vector<uint16_t>( mesh.vertices[i].position, mesh.vertices[i].position + 3 ));
+        ASSERT_EQ( output.vertices[i].normal[0], mesh.vertices[i].normal[0] );
+        ASSERT_EQ( output.vertices[i].normal[1], mesh.vertices[i].normal[1] );
+    }
+
+    // damaged data is rejected
+    std::vector<uint8_t> damaged( bytes.begin(), bytes.begin() + bytes.size() / 2 );
+    ASSERT_THROW( GEO::TERRAIN::decompress_mesh( damaged ), GEO::GeneralException );
+    damaged = bytes;
+    damaged[0] = 'X';
+    ASSERT_THROW( GEO::TERRAIN::decompress_mesh( damaged ), GEO::GeneralException );
+
+    // an inflated size past the counts is rejected before allocating it
+    damaged = bytes;
+    const uint32_t stream_size = 0xFFFFFFF0;
+    std::memcpy( &damaged[92], &stream_size, sizeof(stream_size) );
+    ASSERT_THROW( GEO::TERRAIN::decompress_mesh( damaged ), GEO::GeneralException );
+}
+
+/**
+ * Test the on-disk mesh cache
+*/
+TEST( QuantizedMesh, MeshCache ){
+
+    const boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    GEO::TERRAIN::TileCache::ptr_t tiles( new GEO::TERRAIN::TileCache( directory, 1 << 24 ));
+    GEO::TERRAIN::TerrainMeshCache cache( tiles, 42 );
+
+    GEO::TERRAIN::QuadtreeNode node;
+    node.level  = 2;
+    node.tile_x = 1;
+    node.tile_y = 3;
+    node.window = GEO::Rect( 0, 0, 65, 65 );
+    ASSERT_EQ( cache.key( node ), GEO::TERRAIN::TileKey( 42, 2, 1, 3 ));
+    ASSERT_TRUE( cache.load( node ) == nullptr );
+
+    const GEO::TERRAIN::QuantizedMesh mesh = GEO::TERRAIN::quantize_mesh( make_hills() );
+    cache.store( node, mesh );
+    GEO::TERRAIN::QuantizedMesh::ptr_t loaded = cache.load( node );
+    ASSERT_TRUE( loaded != nullptr );
+    ASSERT_EQ( GEO::TERRAIN::compress_mesh( *loaded ), GEO::TERRAIN::compress_mesh( mesh ));
+
+    // a node with another window is a miss
+    node.window = GEO::Rect( 64, 0, 65, 65 );
+    ASSERT_TRUE( cache.load( node ) == nullptr );
+
+    // so is a damaged payload, which is dropped
+    node.window = GEO::Rect( 0, 0, 65, 65 );
+    const std::string damaged = "GXQM";
+    tiles->store( cache.key( node ), (const uint8_t*)damaged.data(), damaged.size() );
+    ASSERT_TRUE( cache.load( node ) == nullptr );
+    ASSERT_EQ( tiles->size(), 0 );
+    boost::filesystem::remove_all( directory );
+}
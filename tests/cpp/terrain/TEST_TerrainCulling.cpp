@@ -0,0 +1,145 @@
+/**
+ * @file    TEST_TerrainCulling.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Build a rolling quadtree with 30 meter posts
+*/
+static GEO::TERRAIN::TerrainQuadtree make_hills( const int& size ){
+    GEO::TERRAIN::ElevationGrid::ptr_t grid( new GEO::TERRAIN::ElevationGrid( size, size, 30, 30 ));
+    for( int y=0; y<size; y++ ){
+        for( int x=0; x<size; x++ ){
+            (*grid)( x, y ) = 200 + 150 * std::sin( x * 0.02 ) * std::cos( y * 0.015 ) + 10 * std::sin( x * 0.7 ) * std::cos( y * 0.9 );
+        }
+    }
+    return GEO::TERRAIN::TerrainQuadtree( grid, 32 );
+}
+
+/**
+ * Make a box
+*/
+static GEO::TERRAIN::BoundingBox make_box( double x0, double y0, double z0, double x1, double y1, double z1 ){
+    GEO::TERRAIN::BoundingBox box;
+    box.lower[0] = x0; box.lower[1] = y0; box.lower[2] = z0;
+    box.upper[0] = x1; box.upper[1] = y1; box.upper[2] = z1;
+    return box;
+}
+
+/**
+ * Test classifying boxes against a frustum
+*/
+TEST( TerrainCulling, Frustum ){
+
+    // looking north, 90 degrees wide and high
+    const double eye[3]     = { 0, 0, 0 };
+    const double forward[3] = { 0, 0, -1 };
+    const double up[3]      = { 0, 1, 0 };
+    GEO::TERRAIN::Frustum frustum( eye, forward, up, M_PI / 2, 1, 1, 100 );
+
+    ASSERT_EQ( frustum.classify( make_box( -1, -1, -20, 1, 1, -10 )), GEO::TERRAIN::Containment::INSIDE );
+    ASSERT_EQ( frustum.classify( make_box( -1, -1, 10, 1, 1, 20 )), GEO::TERRAIN::Containment::OUTSIDE );
+    ASSERT_EQ( frustum.classify( make_box( -1, -1, -200, 1, 1, -150 )), GEO::TERRAIN::Containment::OUTSIDE );
+    ASSERT_EQ( frustum.classify( make_box( 15, -1, -12, 20, 1, -10 )), GEO::TERRAIN::Containment::OUTSIDE );
+    ASSERT_EQ( frustum.classify( make_box( 5, -1, -12, 20, 1, -10 )), GEO::TERRAIN::Containment::INTERSECTS );
+    ASSERT_EQ( frustum.classify( make_box( -1, -1, -120, 1, 1, -50 )), GEO::TERRAIN::Containment::INTERSECTS );
+
+    // the aspect ratio widens the frustum
+    GEO::TERRAIN::Frustum wide( eye, forward, up, M_PI / 2, 2, 1, 100 );
+    ASSERT_EQ( wide.classify( make_box( 15, -1, -12, 20, 1, -10 )), GEO::TERRAIN::Containment::INSIDE );
+}
+
+/**
+ * Test the horizon of a spherical earth
+*/
+TEST( TerrainCulling, Horizon ){
+
+    // from 100 m the horizon is about 35.7 km away
+    const double eye[3] = { 0, 100, 0 };
+    ASSERT_FALSE( GEO::TERRAIN::below_horizon( make_box( 20000, 0, 0, 21000, 0, 1000 ), eye ));
+    ASSERT_TRUE ( GEO::TERRAIN::below_horizon( make_box( 50000, 0, 0, 51000, 0, 1000 ), eye ));
+
+    // a 1000 m ridge shows above it up to 148 km away
+    ASSERT_FALSE( GEO::TERRAIN::below_horizon( make_box( 50000, 0, 0, 51000, 1000, 1000 ), eye ));
+    ASSERT_TRUE ( GEO::TERRAIN::below_horizon( make_box( 150000, 0, 0, 151000, 1000, 1000 ), eye ));
+}
+
+/**
+ * Test the culled selection against the plain selection
+*/
+TEST( TerrainCulling, SelectVisible ){
+
+    GEO::TERRAIN::TerrainQuadtree tree = make_hills( 513 );
+    GEO::TERRAIN::LodView view;
+
+    // looking straight down from far away everything is inside
+    const double down[3]  = { 0, -1, 0 };
+    const double north[3] = { 0, 0, -1 };
+    const double high[3]  = { 7680, 60000, 7680 };
+    std::copy( high, high + 3, view.eye );
+    GEO::TERRAIN::Frustum all( high, down, north, view.fov_y, 1, 10, 1e6 );
+    GEO::TERRAIN::CullStats stats;
+    ASSERT_EQ( GEO::TERRAIN::select_visible( tree, view, all, &stats ), tree.select( view ));
+    ASSERT_EQ( stats.frustum_culled, 0 );
+
+    // looking south-east across the grid from a corner
+    view.eye[0] = 1000;
+    view.eye[1] = 800;
+    view.eye[2] = 1000;
+    const double forward[3] = { 1, -0.1, 1 };
+    const double up[3]      = { 0, 1, 0 };
+    GEO::TERRAIN::Frustum frustum( view.eye, forward, up, view.fov_y, 16.0 / 9, 10, 8000 );
+    std::vector<int> visible = GEO::TERRAIN::select_visible( tree, view, frustum, &stats );
+    std::vector<int> selected = tree.select( view );
+    ASSERT_GT( stats.frustum_culled, 0 );
+    ASSERT_EQ( stats.selected, (int)visible.size() );
+    ASSERT_LT( visible.size(), selected.size() );
+
+    // culling only removes nodes, and never one in view
+    std::sort( selected.begin(), selected.end() );
+    for( size_t i=0; i<visible.size(); i++ ){
+        ASSERT_TRUE( std::binary_search( selected.begin(), selected.end(), visible[i] ));
+        ASSERT_NE( frustum.classify( tree.bounds( visible[i] )), GEO::TERRAIN::Containment::OUTSIDE );
+    }
+}
+
+/**
+ * Test the culled traversal against datasets of growing size
+ *
+ * The camera sees the same 8 km around the same corner of every grid, so
+ * the culled traversal should do the same work however large the grid is.
+*/
+TEST( TerrainCulling, Scaling ){
+
+    GEO::TERRAIN::LodView view;
+    view.eye[0] = 1000;
+    view.eye[1] = 800;
+    view.eye[2] = 1000;
+    const double forward[3] = { 1, -0.1, 1 };
+    const double up[3]      = { 0, 1, 0 };
+    GEO::TERRAIN::Frustum frustum( view.eye, forward, up, view.fov_y, 16.0 / 9, 10, 8000 );
+
+    const int sizes[3] = { 513, 1025, 2049 };
+    GEO::TERRAIN::CullStats stats[3];
+    for( int s=0; s<3; s++ ){
+        GEO::TERRAIN::TerrainQuadtree tree = make_hills( sizes[s] );
+        std::vector<int> visible = GEO::TERRAIN::select_visible( tree, view, frustum, &stats[s] );
+        ASSERT_LT( visible.size(), tree.select( view ).size() );
+    }
+
+    // the drawn set is the same, the extra visits are the levels above it
+    ASSERT_EQ( stats[1].selected, stats[0].selected );
+    ASSERT_EQ( stats[2].selected, stats[0].selected );
+    ASSERT_EQ( stats[2].vertices, stats[0].vertices );
+    ASSERT_LE( stats[2].visited, stats[0].visited + 16 );
+}
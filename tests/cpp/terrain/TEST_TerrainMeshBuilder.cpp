@@ -0,0 +1,167 @@
+/**
+ * @file    TEST_TerrainMeshBuilder.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Build a grid over a tilted plane, h = 0.5*x - 0.25*y in meters
+*/
+static GEO::TERRAIN::ElevationGrid::ptr_t make_plane( const int& rows, const int& cols ){
+    GEO::TERRAIN::ElevationGrid::ptr_t grid( new GEO::TERRAIN::ElevationGrid( rows, cols, 2, 4 ));
+    for( int y=0; y<rows; y++ ){
+        for( int x=0; x<cols; x++ ){
+            (*grid)( x, y ) = 0.5 * x * 2 - 0.25 * y * 4;
+        }
+    }
+    return grid;
+}
+
+/**
+ * Test building elevation grids from images
+*/
+TEST( TerrainMeshBuilder, MakeElevationGrid ){
+
+    GEO::Image<GEO::PixelGray_df> dem( 30, 40 );
+    for( int r=0; r<dem.rows(); r++ ){
+        for( int c=0; c<dem.cols(); c++ ){
+            dem( r, c ) = r * 100 + c;
+        }
+    }
+    dem( 3, 4 ) = std::nan("");
+
+    // without a geotransform posts are a meter apart
+    GEO::TERRAIN::ElevationGrid::ptr_t grid = GEO::TERRAIN::make_elevation_grid( dem );
+    ASSERT_EQ( grid->rows, 30 );
+    ASSERT_EQ( grid->cols, 40 );
+    ASSERT_EQ( grid->spacing_x, 1 );
+    ASSERT_EQ( (*grid)( 7, 12 ), 1207 );
+    ASSERT_EQ( grid->clamped( -5, 100 ), 2900 );
+
+    // voids are interpolated along their row
+    ASSERT_EQ( (*grid)( 4, 3 ), 304 );
+
+    // including the no-data value of the metadata, and along columns for empty rows
+    GEO::MetadataContainer::ptr_t metadata( new GEO::MetadataContainer() );
+    metadata->setValue( GEO::MetadataKey( GEO::METADATA_NODATA ), "-32767" );
+    dem.setMetadata( metadata );
+    for( int c=0; c<dem.cols(); c++ ){
+        dem( 10, c ) = -32767;
+    }
+    dem( 20, 0 ) = -32767;
+    dem( 20, 1 ) = -32767;
+    grid = GEO::TERRAIN::make_elevation_grid( dem );
+    ASSERT_EQ( (*grid)( 6, 10 ), 1006 );
+    ASSERT_EQ( (*grid)( 0, 20 ), 2002 );
+    ASSERT_EQ( (*grid)( 1, 20 ), 2002 );
+    ASSERT_EQ( (*grid)( 4, 3 ), 304 );
+    dem.setMetadata( GEO::MetadataContainer::ptr_t() );
+
+    // geographic spacing is converted at the center latitude
+    const double coefficients[6] = { -120, 1.0/1200, 0, 60 + 15.0/1200, 0, -1.0/1200 };
+    dem.setGeoTransform( GEO::GeoTransform( coefficients, GEO::CoordinateFrame( GEO::Datum::WGS84 )));
+    grid = GEO::TERRAIN::make_elevation_grid( dem );
+    ASSERT_NEAR( grid->spacing_y, 92.766, 0.01 );
+    ASSERT_NEAR( grid->spacing_x, 92.766 * 0.5, 0.01 );
+
+    // the repository DEM has voids at -32767
+    GEO::Image<GEO::PixelGray_df> srtm;
+    GEO::IO::read_image( "../../tests/data/dem/n39_w120_3arc_v1.bil", srtm );
+    grid = GEO::TERRAIN::make_elevation_grid( srtm );
+    ASSERT_GT( *std::min_element( grid->heights.begin(), grid->heights.end() ), 0 );
+    const float left  = (*grid)( 915, 6 );
+    const float right = (*grid)( 918, 6 );
+    ASSERT_GE( (*grid)( 916, 6 ), std::min( left, right ));
+    ASSERT_LE( (*grid)( 916, 6 ), std::max( left, right ));
+}
+
+/**
+ * Test the geometry of a single tile
+*/
+TEST( TerrainMeshBuilder, BuildTile ){
+
+    GEO::TERRAIN::TerrainMeshBuilder builder( make_plane( 20, 30 ));
+    GEO::TERRAIN::TerrainMesh mesh = builder.buildTile( GEO::Rect( 4, 2, 11, 6 ));
+    ASSERT_EQ( mesh.vertices.size(), 66 );
+    ASSERT_EQ( mesh.indices.size(), 10 * 5 * 6 );
+    ASSERT_EQ( mesh.origin[0], 8 );
+    ASSERT_EQ( mesh.origin[2], 8 );
+
+    // positions are relative to the window, heights are absolute
+    GEO::TERRAIN::TerrainVertex const& corner = mesh.vertices.back();
+    ASSERT_FLOAT_EQ( corner.position[0], 20 );
+    ASSERT_FLOAT_EQ( corner.position[1], 14 - 7 );
+    ASSERT_FLOAT_EQ( corner.position[2], 20 );
+    ASSERT_FLOAT_EQ( corner.uv[0], 1 );
+    ASSERT_FLOAT_EQ( corner.uv[1], 1 );
+    ASSERT_FLOAT_EQ( mesh.min_height, 4 - 7 );
+    ASSERT_FLOAT_EQ( mesh.max_height, 14 - 2 );
+
+    // the plane normal is (-0.5, 1, 0.25) normalized everywhere
+    const float length = std::sqrt( 0.25f + 1 + 0.0625f );
+    for( size_t i=0; i<mesh.vertices.size(); i++ ){
+        ASSERT_NEAR( mesh.vertices[i].normal[0], -0.5f  / length, 1e-5 );
+        ASSERT_NEAR( mesh.vertices[i].normal[1],  1.f   / length, 1e-5 );
+        ASSERT_NEAR( mesh.vertices[i].normal[2],  0.25f / length, 1e-5 );
+    }
+
+    // every triangle faces up
+    for( size_t t=0; t<mesh.indices.size(); t+=3 ){
+        const float* a = mesh.vertices[ mesh.indices[t]   ].position;
+        const float* b = mesh.vertices[ mesh.indices[t+1] ].position;
+        const float* c = mesh.vertices[ mesh.indices[t+2] ].position;
+        const float ny = ( b[2] - a[2] ) * ( c[0] - a[0] ) - ( b[0] - a[0] ) * ( c[2] - a[2] );
+        ASSERT_GT( ny, 0 );
+    }
+
+    // decimated meshes keep the window edges
+    mesh = builder.buildTile( GEO::Rect( 4, 2, 11, 6 ), 4 );
+    ASSERT_EQ( mesh.vertices.size(), 4 * 3 );
+    ASSERT_FLOAT_EQ( mesh.vertices.back().position[0], 20 );
+
+    ASSERT_THROW( builder.buildTile( GEO::Rect( 25, 0, 10, 5 )), GEO::GeneralException );
+}
+
+/**
+ * Test that neighboring tiles share their edges
+*/
+TEST( TerrainMeshBuilder, BuildTiles ){
+
+    GEO::TERRAIN::ElevationGrid::ptr_t grid( new GEO::TERRAIN::ElevationGrid( 70, 90, 30, 30 ));
+    for( int y=0; y<grid->rows; y++ ){
+        for( int x=0; x<grid->cols; x++ ){
+            (*grid)( x, y ) = 100 * std::sin( x * 0.1 ) * std::cos( y * 0.07 );
+        }
+    }
+    GEO::TERRAIN::TerrainMeshBuilder builder( grid );
+
+    std::vector<GEO::Rect> windows = builder.tileWindows( 32 );
+    ASSERT_EQ( windows.size(), 9 );
+    ASSERT_EQ( windows[1], GEO::Rect( 32, 0, 33, 33 ));
+    ASSERT_EQ( windows[8], GEO::Rect( 64, 64, 26, 6 ));
+
+    std::vector<GEO::TERRAIN::TerrainMesh> meshes = builder.buildTiles( windows, 1, 4 );
+    ASSERT_EQ( meshes.size(), windows.size() );
+
+    // the right column of tile 0 matches the left column of tile 1
+    GEO::TERRAIN::TerrainMesh const& left  = meshes[0];
+    GEO::TERRAIN::TerrainMesh const& right = meshes[1];
+    for( int j=0; j<33; j++ ){
+        GEO::TERRAIN::TerrainVertex const& a = left.vertices[ j * 33 + 32 ];
+        GEO::TERRAIN::TerrainVertex const& b = right.vertices[ j * 33 ];
+        ASSERT_FLOAT_EQ( a.position[0] + left.origin[0], b.position[0] + right.origin[0] );
+        ASSERT_FLOAT_EQ( a.position[1], b.position[1] );
+        for( int k=0; k<3; k++ ){
+            ASSERT_FLOAT_EQ( a.normal[k], b.normal[k] );
+        }
+    }
+}
@@ -0,0 +1,202 @@
+/**
+ * @file    TEST_TerrainQuadtree.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cmath>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Build a grid with a smooth bump in the middle of a tilted plane
+*/
+static GEO::TERRAIN::ElevationGrid::ptr_t make_bump( const int& rows, const int& cols, const double& height ){
+    GEO::TERRAIN::ElevationGrid::ptr_t grid( new GEO::TERRAIN::ElevationGrid( rows, cols, 10, 10 ));
+    for( int y=0; y<rows; y++ ){
+        for( int x=0; x<cols; x++ ){
+            const double dx = x - cols / 2.0, dy = y - rows / 2.0;
+            (*grid)( x, y ) = 0.3 * x - 0.2 * y + height * std::exp( -( dx * dx + dy * dy ) / 200.0 );
+        }
+    }
+    return grid;
+}
+
+/**
+ * Test the node hierarchy
+*/
+TEST( TerrainQuadtree, Structure ){
+
+    GEO::TERRAIN::TerrainQuadtree tree( make_bump( 129, 129, 0 ), 32 );
+    ASSERT_EQ( tree.depth(), 3 );
+    ASSERT_EQ( tree.nodes().size(), 1 + 4 + 16 );
+    ASSERT_EQ( tree.node(0).step, 4 );
+    ASSERT_EQ( tree.node(0).window, GEO::Rect( 0, 0, 129, 129 ));
+    ASSERT_EQ( tree.node(4).window, GEO::Rect( 64, 64, 65, 65 ));
+    ASSERT_EQ( tree.nodes().back().window, GEO::Rect( 96, 96, 33, 33 ));
+    ASSERT_TRUE( tree.nodes().back().isLeaf() );
+
+    // a plane is represented exactly at every level
+    for( size_t n=0; n<tree.nodes().size(); n++ ){
+        ASSERT_NEAR( tree.node(n).geometric_error, 0, 1e-4 );
+    }
+
+    // children falling off a ragged grid are dropped
+    GEO::TERRAIN::TerrainQuadtree ragged( make_bump( 40, 100, 0 ), 32 );
+    ASSERT_EQ( ragged.depth(), 3 );
+    ASSERT_EQ( ragged.node(0).children[2], -1 );
+    ASSERT_EQ( ragged.node(0).children[3], -1 );
+    ASSERT_EQ( ragged.nodes().back().window, GEO::Rect( 96, 32, 4, 8 ));
+}
+
+/**
+ * Test building a tree from saved node metrics
+*/
+TEST( TerrainQuadtree, Metrics ){
+
+    GEO::TERRAIN::ElevationGrid::ptr_t grid = make_bump( 129, 129, 50 );
+    GEO::TERRAIN::TerrainQuadtree tree( grid, 32 );
+    std::vector<float> metrics = tree.metrics();
+    ASSERT_EQ( metrics.size(), 3 * tree.nodes().size() );
+
+    // metrics round trip through the mesh cache
+    const boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    {
+        GEO::TERRAIN::TileCache::ptr_t tiles( new GEO::TERRAIN::TileCache( directory, 1 << 20 ));
+        GEO::TERRAIN::TerrainMeshCache cache( tiles, 7 );
+        std::vector<float> loaded;
+        ASSERT_FALSE( cache.loadMetrics( loaded ));
+        cache.storeMetrics( metrics );
+        ASSERT_TRUE( cache.loadMetrics( loaded ));
+        ASSERT_EQ( loaded, metrics );
+        ASSERT_TRUE( cache.load( tree.node(0) ) == nullptr );
+    }
+    boost::filesystem::remove_all( directory );
+
+    // the saved metrics are used as they are
+    metrics[0] = 1234;
+    GEO::TERRAIN::TerrainQuadtree restored( grid, 32, 0, metrics );
+    ASSERT_EQ( restored.metrics(), metrics );
+    ASSERT_EQ( restored.node(0).geometric_error, 1234 );
+
+    // metrics of another tree are measured again
+    metrics.pop_back();
+    GEO::TERRAIN::TerrainQuadtree measured( grid, 32, 0, metrics );
+    ASSERT_EQ( measured.metrics(), tree.metrics() );
+}
+
+/**
+ * Test the geometric errors
+*/
+TEST( TerrainQuadtree, GeometricError ){
+
+    GEO::TERRAIN::TerrainQuadtree tree( make_bump( 129, 129, 50 ), 16, 4 );
+    ASSERT_EQ( tree.depth(), 4 );
+
+    for( size_t n=0; n<tree.nodes().size(); n++ ){
+        GEO::TERRAIN::QuadtreeNode const& node = tree.node(n);
+
+        // full resolution leaves are exact
+        if( node.isLeaf() ){
+            ASSERT_NEAR( node.geometric_error, 0, 1e-4 );
+        }
+        else{
+            for( int c=0; c<4; c++ ){
+                ASSERT_GE( node.geometric_error, tree.node( node.children[c] ).geometric_error );
+            }
+        }
+    }
+    ASSERT_GT( tree.node(0).geometric_error, 0.5 );
+}
+
+/**
+ * Test the view dependent selection
+*/
+TEST( TerrainQuadtree, Select ){
+
+    GEO::TERRAIN::TerrainQuadtree tree( make_bump( 129, 129, 50 ), 16, 4 );
+
+    // far away the root is enough
+    GEO::TERRAIN::LodView view;
+    view.eye[0] = 640;
+    view.eye[1] = 1e6;
+    view.eye[2] = 640;
+    std::vector<int> selected = tree.select( view );
+    ASSERT_EQ( selected.size(), 1 );
+    ASSERT_EQ( selected[0], 0 );
+
+    // low over the bump the nodes under the eye are refined the most
+    view.eye[0] = 645;
+    view.eye[1] = 100;
+    view.eye[2] = 645;
+    selected = tree.select( view );
+    ASSERT_GT( selected.size(), 1 );
+
+    std::vector<int> coverage( 128 * 128, 0 );
+    int finest = -1, coarsest = 100;
+    for( size_t s=0; s<selected.size(); s++ ){
+        GEO::TERRAIN::QuadtreeNode const& node = tree.node( selected[s] );
+        for( int y=node.window.y(); y<node.window.y()+node.window.height()-1; y++ ){
+            for( int x=node.window.x(); x<node.window.x()+node.window.width()-1; x++ ){
+                coverage[ y * 128 + x ]++;
+            }
+        }
+        if( node.window.x() == 64 && node.window.y() == 64 ){
+            finest = node.level;
+        }
+        coarsest = std::min( coarsest, node.level );
+    }
+
+    // every quad is drawn exactly once
+    for( size_t q=0; q<coverage.size(); q++ ){
+        ASSERT_EQ( coverage[q], 1 );
+    }
+    ASSERT_GT( finest, coarsest );
+
+    // the screen space error falls with distance
+    ASSERT_NEAR( GEO::TERRAIN::screen_space_error( 1, 100, view ) * 2,
+                 GEO::TERRAIN::screen_space_error( 1,  50, view ), 1e-9 );
+}
+
+/**
+ * Test the skirted node meshes
+*/
+TEST( TerrainQuadtree, Skirts ){
+
+    GEO::TERRAIN::TerrainQuadtree tree( make_bump( 65, 65, 50 ), 16 );
+    std::vector<int> indices( 1, 0 );
+    indices.push_back( 1 );
+    tree.buildMeshes( indices, 2 );
+    ASSERT_TRUE( tree.node(2).mesh == nullptr );
+
+    // a 17x17 post mesh with 64 border vertices and 128 skirt triangles
+    GEO::TERRAIN::TerrainMesh const& mesh = *tree.node(1).mesh;
+    ASSERT_EQ( mesh.vertices.size(), 17 * 17 + 64 );
+    ASSERT_EQ( mesh.indices.size(), 16 * 16 * 6 + 64 * 6 );
+
+    // skirts hang twice the parent error below the border
+    const float depth = 2 * tree.node(0).geometric_error;
+    ASSERT_FLOAT_EQ( mesh.vertices[ 17 * 17 ].position[1], mesh.vertices[0].position[1] - depth );
+
+    // every skirt triangle faces away from the mesh center
+    const float center[2] = { 160, 160 };
+    for( size_t t=16 * 16 * 6; t<mesh.indices.size(); t+=3 ){
+        const float* a = mesh.vertices[ mesh.indices[t]   ].position;
+        const float* b = mesh.vertices[ mesh.indices[t+1] ].position;
+        const float* c = mesh.vertices[ mesh.indices[t+2] ].position;
+        const float ux = b[0] - a[0], uy = b[1] - a[1], uz = b[2] - a[2];
+        const float vx = c[0] - a[0], vy = c[1] - a[1], vz = c[2] - a[2];
+        const float nx = uy * vz - uz * vy;
+        const float nz = ux * vy - uy * vx;
+        const float mx = ( a[0] + b[0] + c[0] ) / 3 - center[0];
+        const float mz = ( a[2] + b[2] + c[2] ) / 3 - center[1];
+        ASSERT_GT( nx * mx + nz * mz, 0 );
+    }
+}
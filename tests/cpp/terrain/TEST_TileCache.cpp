@@ -0,0 +1,228 @@
+/**
+ * @file    TEST_TileCache.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <csignal>
+#include <fstream>
+#include <vector>
+
+/// POSIX
+#include <sys/resource.h>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Make a payload of a given size
+*/
+static std::vector<uint8_t> make_payload( const size_t& size, const int& seed ){
+    std::vector<uint8_t> output( size );
+    for( size_t i=0; i<size; i++ ){
+        output[i] = ( i * 31 + seed * 7 ) & 0xff;
+    }
+    return output;
+}
+
+/**
+ * Test storing and finding tiles
+*/
+TEST( TileCache, StoreFind ){
+
+    const boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    {
+        GEO::TERRAIN::TileCache cache( directory, 1 << 20 );
+        const GEO::TERRAIN::TileKey a( 1, 0, 0, 0 ), b( 1, 1, 2, 3 ), c( 2, 1, 2, 3 );
+        ASSERT_TRUE( cache.find( a ).empty() );
+
+        ASSERT_TRUE( cache.store( a, make_payload( 100, 1 )));
+        ASSERT_TRUE( cache.store( b, make_payload( 200, 2 )));
+        ASSERT_EQ( cache.size(), 2 );
+        ASSERT_EQ( cache.bytes(), 300 );
+
+        // views point into the mapping
+        GEO::TERRAIN::TileView view = cache.find( b );
+        ASSERT_FALSE( view.empty() );
+        ASSERT_EQ( std::vector<uint8_t>( view.data, view.data + view.size ), make_payload( 200, 2 ));
+
+        // another dataset is another tile
+        ASSERT_TRUE( cache.find( c ).empty() );
+
+        // replacing a tile
+        std::vector<uint8_t> loaded;
+        ASSERT_TRUE( cache.store( a, make_payload( 50, 3 )));
+        ASSERT_TRUE( cache.load( a, loaded ));
+        ASSERT_EQ( loaded, make_payload( 50, 3 ));
+        ASSERT_EQ( cache.bytes(), 250 );
+
+        // the old view survives later stores
+        ASSERT_EQ( std::vector<uint8_t>( view.data, view.data + view.size ), make_payload( 200, 2 ));
+
+        cache.erase( b );
+        ASSERT_TRUE( cache.find( b ).empty() );
+        ASSERT_FALSE( cache.store( c, make_payload( 2 << 20, 4 )));
+    }
+    boost::filesystem::remove_all( directory );
+}
+
+/**
+ * Test reopening the cache
+*/
+TEST( TileCache, Persistence ){
+
+    const boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    {
+        GEO::TERRAIN::TileCache cache( directory, 1 << 20 );
+        for( int i=0; i<10; i++ ){
+            cache.store( GEO::TERRAIN::TileKey( 5, 3, i, 0 ), make_payload( 1000 + i, i ));
+        }
+    }
+    {
+        GEO::TERRAIN::TileCache cache( directory, 1 << 20 );
+        ASSERT_EQ( cache.size(), 10 );
+        for( int i=0; i<10; i++ ){
+            std::vector<uint8_t> loaded;
+            ASSERT_TRUE( cache.load( GEO::TERRAIN::TileKey( 5, 3, i, 0 ), loaded ));
+            ASSERT_EQ( loaded, make_payload( 1000 + i, i ));
+        }
+    }
+
+    // a damaged index starts over
+    {
+        std::ofstream fout( ( directory / "tiles.index" ).c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+        fout << "GXTI";
+    }
+    {
+        GEO::TERRAIN::TileCache cache( directory, 1 << 20 );
+        ASSERT_EQ( cache.size(), 0 );
+        ASSERT_TRUE( cache.find( GEO::TERRAIN::TileKey( 5, 3, 0, 0 )).empty() );
+    }
+    boost::filesystem::remove_all( directory );
+}
+
+/**
+ * Test a write failing, here on the file size limit
+*/
+TEST( TileCache, FailedWrite ){
+
+    const boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    {
+        GEO::TERRAIN::TileCache cache( directory, 1 << 24 );
+        ASSERT_TRUE( cache.store( GEO::TERRAIN::TileKey( 1, 0, 0, 0 ), make_payload( 1000, 1 )));
+
+        // writes past the limit fail with EFBIG instead of raising SIGXFSZ
+        struct rlimit saved, limit;
+        ASSERT_EQ( getrlimit( RLIMIT_FSIZE, &saved ), 0 );
+        limit = saved;
+        limit.rlim_cur = 1 << 16;
+        void (*handler)(int) = std::signal( SIGXFSZ, SIG_IGN );
+        ASSERT_EQ( setrlimit( RLIMIT_FSIZE, &limit ), 0 );
+
+        // a miss, not an exception, and the cache turns read-only
+        const bool stored = cache.store( GEO::TERRAIN::TileKey( 1, 0, 1, 0 ), make_payload( 1 << 17, 2 ));
+        setrlimit( RLIMIT_FSIZE, &saved );
+        std::signal( SIGXFSZ, handler );
+        ASSERT_FALSE( stored );
+        ASSERT_FALSE( cache.writable() );
+        ASSERT_FALSE( cache.store( GEO::TERRAIN::TileKey( 1, 0, 2, 0 ), make_payload( 10, 3 )));
+
+        // tiles stored before still read back
+        std::vector<uint8_t> loaded;
+        ASSERT_FALSE( cache.load( GEO::TERRAIN::TileKey( 1, 0, 1, 0 ), loaded ));
+        ASSERT_TRUE( cache.load( GEO::TERRAIN::TileKey( 1, 0, 0, 0 ), loaded ));
+        ASSERT_EQ( loaded, make_payload( 1000, 1 ));
+    }
+
+    // the next run writes again, after the partial record
+    {
+        GEO::TERRAIN::TileCache cache( directory, 1 << 24 );
+        ASSERT_TRUE( cache.writable() );
+        ASSERT_EQ( cache.size(), 1 );
+        ASSERT_TRUE( cache.store( GEO::TERRAIN::TileKey( 1, 0, 1, 0 ), make_payload( 500, 4 )));
+        std::vector<uint8_t> loaded;
+        ASSERT_TRUE( cache.load( GEO::TERRAIN::TileKey( 1, 0, 1, 0 ), loaded ));
+        ASSERT_EQ( loaded, make_payload( 500, 4 ));
+    }
+    boost::filesystem::remove_all( directory );
+}
+
+/**
+ * Test the size limit and compaction
+*/
+TEST( TileCache, Eviction ){
+
+    const boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    {
+        // room for four tiles
+        GEO::TERRAIN::TileCache cache( directory, 4 * 100000 );
+        for( int i=0; i<4; i++ ){
+            cache.store( GEO::TERRAIN::TileKey( 1, 0, i, 0 ), make_payload( 100000, i ));
+        }
+
+        // using the first tile makes the second the oldest
+        ASSERT_FALSE( cache.find( GEO::TERRAIN::TileKey( 1, 0, 0, 0 )).empty() );
+        cache.store( GEO::TERRAIN::TileKey( 1, 0, 4, 0 ), make_payload( 100000, 4 ));
+        ASSERT_EQ( cache.size(), 4 );
+        ASSERT_FALSE( cache.find( GEO::TERRAIN::TileKey( 1, 0, 0, 0 )).empty() );
+        ASSERT_TRUE( cache.find( GEO::TERRAIN::TileKey( 1, 0, 1, 0 )).empty() );
+        ASSERT_LE( cache.bytes(), 4 * 100000 );
+
+        // churning compacts the data file once it passes 1 MB
+        for( int i=5; i<40; i++ ){
+            cache.store( GEO::TERRAIN::TileKey( 1, 0, i, 0 ), make_payload( 100000, i ));
+            ASSERT_LE( cache.fileBytes(), ( 1 << 20 ) + 100028 );
+        }
+        for( int i=36; i<40; i++ ){
+            std::vector<uint8_t> loaded;
+            ASSERT_TRUE( cache.load( GEO::TERRAIN::TileKey( 1, 0, i, 0 ), loaded ));
+            ASSERT_EQ( loaded, make_payload( 100000, i ));
+        }
+    }
+
+    // the compacted file reopens
+    {
+        GEO::TERRAIN::TileCache cache( directory, 4 * 100000 );
+        ASSERT_EQ( cache.size(), 4 );
+        std::vector<uint8_t> loaded;
+        ASSERT_TRUE( cache.load( GEO::TERRAIN::TileKey( 1, 0, 39, 0 ), loaded ));
+        ASSERT_EQ( loaded, make_payload( 100000, 39 ));
+    }
+
+    // a smaller limit drops the oldest tiles
+    {
+        GEO::TERRAIN::TileCache cache( directory, 2 * 100000 );
+        ASSERT_EQ( cache.size(), 2 );
+        ASSERT_FALSE( cache.find( GEO::TERRAIN::TileKey( 1, 0, 39, 0 )).empty() );
+    }
+    boost::filesystem::remove_all( directory );
+}
+
+/**
+ * Test hashing datasets
+*/
+TEST( TileCache, DatasetHash ){
+
+    const boost::filesystem::path pathname = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    {
+        std::ofstream fout( pathname.c_str() );
+        fout << "elevation";
+    }
+    const uint64_t hash = GEO::TERRAIN::dataset_hash( pathname );
+    ASSERT_EQ( GEO::TERRAIN::dataset_hash( pathname ), hash );
+    ASSERT_NE( GEO::TERRAIN::dataset_hash( pathname, "chunk=32" ), hash );
+    ASSERT_NE( GEO::TERRAIN::dataset_hash( pathname, "chunk=32" ), GEO::TERRAIN::dataset_hash( pathname, "chunk=64" ));
+
+    // editing the file changes it
+    {
+        std::ofstream fout( pathname.c_str(), std::ios::app );
+        fout << " model";
+    }
+    ASSERT_NE( GEO::TERRAIN::dataset_hash( pathname ), hash );
+    boost::filesystem::remove( pathname );
+}
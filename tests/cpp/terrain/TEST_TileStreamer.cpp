@@ -0,0 +1,217 @@
+/**
+ * @file    TEST_TileStreamer.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Build a quadtree over a wavy grid
+*/
+static GEO::TERRAIN::TerrainQuadtree::ptr_t make_tree(){
+    GEO::TERRAIN::ElevationGrid::ptr_t grid( new GEO::TERRAIN::ElevationGrid( 129, 129, 30, 30 ));
+    for( int y=0; y<grid->rows; y++ ){
+        for( int x=0; x<grid->cols; x++ ){
+            (*grid)( x, y ) = 100 * std::sin( x * 0.1 ) * std::cos( y * 0.07 );
+        }
+    }
+    return GEO::TERRAIN::TerrainQuadtree::ptr_t( new GEO::TERRAIN::TerrainQuadtree( grid, 32 ));
+}
+
+/**
+ * Poll until nothing is pending
+*/
+static std::vector<GEO::TERRAIN::TileStagingBuffer::ptr_t> drain( GEO::TERRAIN::TileStreamer& streamer,
+                                                                  const size_t& budget,
+                                                                  int& frames ){
+    std::vector<GEO::TERRAIN::TileStagingBuffer::ptr_t> output;
+    frames = 0;
+    while( streamer.pending() > 0 ){
+        std::vector<GEO::TERRAIN::TileStagingBuffer::ptr_t> buffers = streamer.poll( budget );
+        output.insert( output.end(), buffers.begin(), buffers.end() );
+        if( buffers.empty() ){
+            streamer.wait( std::chrono::seconds(5) );
+        }
+        else{
+            frames++;
+        }
+    }
+    return output;
+}
+
+/**
+ * Test streaming every node
+*/
+TEST( TileStreamer, StreamNodes ){
+
+    GEO::TERRAIN::TerrainQuadtree::ptr_t tree = make_tree();
+    GEO::TERRAIN::TileStreamer streamer( tree, 3 );
+    for( size_t n=0; n<tree->nodes().size(); n++ ){
+        ASSERT_TRUE( streamer.request( n ));
+    }
+    ASSERT_FALSE( streamer.request( 0 ));
+    ASSERT_EQ( streamer.pending(), (int)tree->nodes().size() );
+
+    int frames;
+    std::vector<GEO::TERRAIN::TileStagingBuffer::ptr_t> buffers = drain( streamer, 1 << 30, frames );
+    ASSERT_EQ( buffers.size(), tree->nodes().size() );
+
+    // every buffer holds the skirted node mesh
+    for( size_t b=0; b<buffers.size(); b++ ){
+        const int node = buffers[b]->node;
+        ASSERT_TRUE( streamer.isResident( node ));
+        GEO::TERRAIN::TerrainMesh::ptr_t expected = tree->buildMesh( node );
+        ASSERT_EQ( buffers[b]->mesh->window, expected->window );
+        ASSERT_EQ( GEO::TERRAIN::dequantize_mesh( *buffers[b]->mesh ).indices, expected->indices );
+        ASSERT_EQ( buffers[b]->bytes(), expected->vertices.size() * 8 + expected->indices.size() * 2 );
+    }
+
+    // released nodes can be requested again
+    ASSERT_FALSE( streamer.request( 3 ));
+    streamer.release( 3 );
+    ASSERT_FALSE( streamer.isResident( 3 ));
+    ASSERT_TRUE( streamer.request( 3 ));
+    buffers = drain( streamer, 1 << 30, frames );
+    ASSERT_EQ( buffers.size(), 1 );
+    ASSERT_EQ( buffers[0]->node, 3 );
+}
+
+/**
+ * Test the per-frame upload budget
+*/
+TEST( TileStreamer, UploadBudget ){
+
+    // one loader, so buffers arrive in request order
+    GEO::TERRAIN::TerrainQuadtree::ptr_t tree = make_tree();
+    GEO::TERRAIN::TileStreamer streamer( tree, 1 );
+    for( size_t n=5; n<tree->nodes().size(); n++ ){
+        streamer.request( n );
+    }
+
+    // leaves are 33x33 posts plus skirts, about 23 kB each
+    const size_t leaf_bytes = ( 33 * 33 + 128 ) * 8 + ( 32 * 32 + 128 ) * 6 * 2;
+    int frames;
+    std::vector<GEO::TERRAIN::TileStagingBuffer::ptr_t> buffers = drain( streamer, leaf_bytes * 3, frames );
+    ASSERT_EQ( buffers.size(), 16 );
+    ASSERT_GE( frames, 6 );
+    ASSERT_EQ( buffers[0]->bytes(), leaf_bytes );
+
+    // a budget below one buffer still lets one through per frame
+    for( size_t n=5; n<tree->nodes().size(); n++ ){
+        streamer.release( n );
+        streamer.request( n );
+    }
+    buffers = drain( streamer, 1, frames );
+    ASSERT_EQ( buffers.size(), 16 );
+    ASSERT_EQ( frames, 16 );
+
+    // buffers released in flight are dropped, node 0 is done before node 1 arrives
+    streamer.request( 0 );
+    streamer.release( 0 );
+    streamer.request( 1 );
+    buffers = drain( streamer, 1 << 30, frames );
+    ASSERT_EQ( buffers.size(), 1 );
+    ASSERT_EQ( buffers[0]->node, 1 );
+    ASSERT_FALSE( streamer.isResident( 0 ));
+}
+
+/**
+ * Test reading and filling the mesh cache
+*/
+TEST( TileStreamer, MeshCache ){
+
+    GEO::TERRAIN::TerrainQuadtree::ptr_t tree = make_tree();
+    const boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    GEO::TERRAIN::TileCache::ptr_t tiles( new GEO::TERRAIN::TileCache( directory, 1 << 24 ));
+    GEO::TERRAIN::TerrainMeshCache::ptr_t cache( new GEO::TERRAIN::TerrainMeshCache( tiles, 7 ));
+
+    // the first pass builds and stores every node
+    int frames;
+    std::vector<GEO::TERRAIN::TileStagingBuffer::ptr_t> built, cached;
+    {
+        GEO::TERRAIN::TileStreamer streamer( tree, 2 );
+        streamer.setMeshCache( cache );
+        for( size_t n=0; n<tree->nodes().size(); n++ ){
+            streamer.request( n );
+        }
+        built = drain( streamer, 1 << 30, frames );
+    }
+    ASSERT_EQ( tiles->size(), tree->nodes().size() );
+    for( size_t n=0; n<tree->nodes().size(); n++ ){
+        ASSERT_TRUE( cache->load( tree->node( n )) != nullptr );
+    }
+
+    // the second pass reads the same meshes back
+    {
+        GEO::TERRAIN::TileStreamer streamer( tree, 2 );
+        streamer.setMeshCache( cache );
+        for( size_t n=0; n<tree->nodes().size(); n++ ){
+            streamer.request( n );
+        }
+        cached = drain( streamer, 1 << 30, frames );
+    }
+    ASSERT_EQ( cached.size(), built.size() );
+    for( size_t b=0; b<cached.size(); b++ ){
+        GEO::TERRAIN::QuantizedMesh::ptr_t expected;
+        for( size_t c=0; c<built.size(); c++ ){
+            if( built[c]->node == cached[b]->node ){
+                expected = built[c]->mesh;
+            }
+        }
+        ASSERT_EQ( GEO::TERRAIN::compress_mesh( *cached[b]->mesh ), GEO::TERRAIN::compress_mesh( *expected ));
+    }
+    cache.reset();
+    tiles.reset();
+    boost::filesystem::remove_all( directory );
+}
+
+/**
+ * Test texture loading and error reporting
+*/
+TEST( TileStreamer, TextureLoader ){
+
+    GEO::TERRAIN::TerrainQuadtree::ptr_t tree = make_tree();
+    GEO::TERRAIN::TileStreamer streamer( tree, 2 );
+    streamer.setTextureLoader( []( GEO::TERRAIN::QuadtreeNode const& node, GEO::TERRAIN::TileStagingBuffer& buffer ){
+        if( node.level == 0 ){
+            throw GEO::GeneralException("Missing texture.", __FILE__, __LINE__);
+        }
+        buffer.texture_rows = node.window.height();
+        buffer.texture_cols = node.window.width();
+        buffer.texture_channels = 3;
+        buffer.texels.assign( buffer.texture_rows * buffer.texture_cols * 3, node.level );
+    });
+
+    streamer.request( 1 );
+    int frames;
+    std::vector<GEO::TERRAIN::TileStagingBuffer::ptr_t> buffers = drain( streamer, 1 << 30, frames );
+    ASSERT_EQ( buffers.size(), 1 );
+    ASSERT_EQ( buffers[0]->texels.size(), 65 * 65 * 3 );
+    ASSERT_EQ( buffers[0]->texels[0], 1 );
+
+    // loader errors reach the render thread as failed buffers
+    ASSERT_TRUE( streamer.request( 0 ));
+    buffers = drain( streamer, 1 << 30, frames );
+    ASSERT_EQ( buffers.size(), 1 );
+    ASSERT_EQ( buffers[0]->node, 0 );
+    ASSERT_TRUE( buffers[0]->mesh == nullptr );
+    ASSERT_NE( buffers[0]->error.find( "Missing texture." ), std::string::npos );
+
+    // and the node can be requested again
+    ASSERT_FALSE( streamer.isResident( 0 ));
+    ASSERT_EQ( streamer.pending(), 0 );
+    ASSERT_TRUE( streamer.request( 0 ));
+    ASSERT_EQ( drain( streamer, 1 << 30, frames ).size(), 1 );
+}
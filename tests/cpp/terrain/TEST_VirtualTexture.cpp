@@ -0,0 +1,283 @@
+/**
+ * @file    TEST_VirtualTexture.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+*/
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+/// Boost C++ Libraries
+#include <boost/filesystem.hpp>
+
+/// GeoExplore Library
+#include <GeoExplore.hpp>
+
+/**
+ * Fill pages with their level
+*/
+static void fill_level( GEO::TERRAIN::VirtualPage const& page, GEO::TERRAIN::PageBuffer& buffer ){
+    buffer.texels.assign( buffer.texels.size(), page.level );
+}
+
+/**
+ * Poll until nothing is pending
+*/
+static std::vector<GEO::TERRAIN::PageBuffer::ptr_t> drain( GEO::TERRAIN::VirtualTexture& texture ){
+    std::vector<GEO::TERRAIN::PageBuffer::ptr_t> output;
+    for( int tries=0; texture.pending() > 0 && tries < 5000; tries++ ){
+        std::vector<GEO::TERRAIN::PageBuffer::ptr_t> pages = texture.poll( 64 );
+        output.insert( output.end(), pages.begin(), pages.end() );
+        if( pages.empty() && texture.wait( std::chrono::seconds(5) ) == false ){
+            break;
+        }
+    }
+    return output;
+}
+
+/**
+ * Decode a page table entry
+*/
+static void decode( const uint32_t& entry, int& slot_x, int& slot_y, int& level ){
+    slot_x = entry & 0xff;
+    slot_y = ( entry >> 8 ) & 0xff;
+    level  = ( entry >> 16 ) & 0xff;
+}
+
+/**
+ * Test the level and page table layout
+*/
+TEST( VirtualTexture, Layout ){
+
+    GEO::TERRAIN::VirtualTexture texture( 1000, 3000, 128, 4 );
+    ASSERT_EQ( texture.levels(), 6 );
+    ASSERT_EQ( texture.pagesX(0), 24 );
+    ASSERT_EQ( texture.pagesY(0), 8 );
+    ASSERT_EQ( texture.pagesX(1), 12 );
+    ASSERT_EQ( texture.pagesY(1), 4 );
+    ASSERT_EQ( texture.pagesX(5), 1 );
+    ASSERT_EQ( texture.pagesY(5), 1 );
+    ASSERT_EQ( texture.tableCols(), 24 );
+    ASSERT_EQ( texture.tableRowOffset(1), 8 );
+    ASSERT_EQ( texture.tableRows(), 8 + 4 + 2 + 1 + 1 + 1 );
+    ASSERT_EQ( texture.table().size(), 24 * 17 );
+    ASSERT_EQ( texture.slotSize(), 130 );
+    ASSERT_EQ( texture.atlasSize(), 520 );
+    ASSERT_EQ( texture.pageRect( GEO::TERRAIN::VirtualPage( 1, 2, 3 )), GEO::Rect( 255, 383, 130, 130 ));
+
+    // nothing is valid before the first page arrives
+    for( size_t i=0; i<texture.table().size(); i++ ){
+        ASSERT_EQ( texture.table()[i], 0 );
+    }
+    ASSERT_THROW( GEO::TERRAIN::VirtualTexture( 100, 100, 128, 300 ), GEO::GeneralException );
+}
+
+/**
+ * Test requesting pages and the page table fallback
+*/
+TEST( VirtualTexture, RequestPages ){
+
+    GEO::TERRAIN::VirtualTexture texture( 1000, 3000, 128, 8 );
+    texture.setPageLoader( fill_level );
+
+    // the coarsest page arrives by itself and covers everything
+    std::vector<GEO::TERRAIN::PageBuffer::ptr_t> pages = drain( texture );
+    ASSERT_EQ( pages.size(), 1 );
+    ASSERT_EQ( pages[0]->page, GEO::TERRAIN::VirtualPage( 5, 0, 0 ));
+    ASSERT_EQ( pages[0]->texels.size(), 130 * 130 * 3 );
+    ASSERT_EQ( pages[0]->texels[0], 5 );
+    int first, count;
+    ASSERT_TRUE( texture.takeDirtyRows( first, count ));
+    ASSERT_EQ( first, 0 );
+    ASSERT_EQ( count, texture.tableRows() );
+    ASSERT_FALSE( texture.takeDirtyRows( first, count ));
+    for( size_t i=0; i<texture.table().size(); i++ ){
+        const int row = i / texture.tableCols(), col = i % texture.tableCols();
+        int level = 0;
+        while( level + 1 < texture.levels() && row >= texture.tableRowOffset( level + 1 )){
+            level++;
+        }
+        if( col < texture.pagesX( level )){
+            int sx, sy, sl;
+            decode( texture.table()[i], sx, sy, sl );
+            ASSERT_EQ( sl, 5 );
+            ASSERT_EQ( texture.table()[i] >> 24, 255 );
+        }
+    }
+
+    // one full resolution page and its ancestors
+    texture.nextFrame();
+    texture.request( 0, GEO::Rect( 300, 400, 10, 10 ));
+    ASSERT_EQ( texture.pending(), 5 );
+    pages = drain( texture );
+    ASSERT_EQ( pages.size(), 5 );
+    for( int l=0; l<5; l++ ){
+        const GEO::TERRAIN::VirtualPage page( l, 300 / ( 128 << l ), 400 / ( 128 << l ));
+        ASSERT_TRUE( texture.isResident( page ));
+
+        // the page points at its own slot
+        const int slot = texture.slotOf( page );
+        int sx, sy, sl;
+        decode( texture.table()[( texture.tableRowOffset(l) + page.y ) * texture.tableCols() + page.x], sx, sy, sl );
+        ASSERT_EQ( sx + sy * 8, slot );
+        ASSERT_EQ( sl, l );
+    }
+
+    // its neighbours fall back to the finest resident ancestor
+    int sx, sy, sl;
+    decode( texture.table()[( texture.tableRowOffset(0) + 3 ) * texture.tableCols() + 3], sx, sy, sl );
+    ASSERT_EQ( sl, 1 );
+    decode( texture.table()[( texture.tableRowOffset(0) + 7 ) * texture.tableCols() + 20], sx, sy, sl );
+    ASSERT_EQ( sl, 5 );
+
+    // resident pages are not requested again
+    texture.request( 0, GEO::Rect( 300, 400, 10, 10 ));
+    ASSERT_EQ( texture.pending(), 0 );
+}
+
+/**
+ * Test the fixed atlas budget
+*/
+TEST( VirtualTexture, Eviction ){
+
+    // four slots, one of them pinned to the coarsest page
+    GEO::TERRAIN::VirtualTexture texture( 1024, 1024, 128, 2 );
+    texture.setPageLoader( fill_level );
+    drain( texture );
+    ASSERT_EQ( texture.levels(), 4 );
+
+    // three level 2 pages fit
+    const GEO::TERRAIN::VirtualPage a( 2, 0, 0 ), b( 2, 1, 0 ), c( 2, 0, 1 ), d( 2, 1, 1 );
+    texture.nextFrame();
+    texture.request( 2, GEO::Rect(   0,   0, 1, 1 ));
+    texture.request( 2, GEO::Rect( 512,   0, 1, 1 ));
+    texture.request( 2, GEO::Rect(   0, 512, 1, 1 ));
+    ASSERT_EQ( texture.pending(), 3 );
+    drain( texture );
+    ASSERT_TRUE( texture.isResident( a ) && texture.isResident( b ) && texture.isResident( c ));
+
+    // a fourth one needed in the same frame waits for room
+    texture.request( 2, GEO::Rect( 512, 512, 1, 1 ));
+    ASSERT_TRUE( texture.wait( std::chrono::seconds(5) ));
+    ASSERT_TRUE( texture.poll( 64 ).empty() );
+    ASSERT_EQ( texture.pending(), 1 );
+
+    // next frame the least recently used page goes
+    texture.nextFrame();
+    texture.request( 2, GEO::Rect( 0,   0, 1, 1 ));
+    texture.request( 2, GEO::Rect( 0, 512, 1, 1 ));
+    std::vector<GEO::TERRAIN::PageBuffer::ptr_t> pages = texture.poll( 64 );
+    ASSERT_EQ( pages.size(), 1 );
+    ASSERT_EQ( pages[0]->page, d );
+    ASSERT_TRUE( texture.isResident( a ));
+    ASSERT_FALSE( texture.isResident( b ));
+    ASSERT_TRUE( texture.isResident( c ));
+    ASSERT_TRUE( texture.isResident( d ));
+    ASSERT_TRUE( texture.isResident( GEO::TERRAIN::VirtualPage( 3, 0, 0 )));
+
+    // the pages under the evicted one fall back to the coarsest page
+    int sx, sy, sl;
+    decode( texture.table()[( texture.tableRowOffset(0) + 0 ) * texture.tableCols() + 7], sx, sy, sl );
+    ASSERT_EQ( sl, 3 );
+    decode( texture.table()[( texture.tableRowOffset(0) + 7 ) * texture.tableCols() + 7], sx, sy, sl );
+    ASSERT_EQ( sl, 2 );
+}
+
+/**
+ * Test reading pages back from the tile cache
+*/
+TEST( VirtualTexture, PageCache ){
+
+    const boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    GEO::TERRAIN::TileCache::ptr_t cache( new GEO::TERRAIN::TileCache( directory, 1 << 24 ));
+    std::atomic<int> loads( 0 );
+    GEO::TERRAIN::VirtualTexture::page_loader_t loader = [&loads]( GEO::TERRAIN::VirtualPage const& page, GEO::TERRAIN::PageBuffer& buffer ){
+        loads++;
+        fill_level( page, buffer );
+    };
+
+    for( int pass=0; pass<2; pass++ ){
+        GEO::TERRAIN::VirtualTexture texture( 1000, 3000, 128, 8 );
+        texture.setPageCache( cache, 99 );
+        texture.setPageLoader( loader );
+        texture.nextFrame();
+        texture.request( 0, GEO::Rect( 300, 400, 10, 10 ));
+        std::vector<GEO::TERRAIN::PageBuffer::ptr_t> pages = drain( texture );
+        ASSERT_EQ( pages.size(), 6 );
+        for( size_t p=0; p<pages.size(); p++ ){
+            ASSERT_EQ( pages[p]->texels[0], pages[p]->page.level );
+        }
+
+        // only the first pass reads the image
+        ASSERT_EQ( loads, 6 );
+        ASSERT_EQ( cache->size(), 6 );
+        ASSERT_THROW( texture.setPageCache( cache, 99 ), GEO::GeneralException );
+    }
+    cache.reset();
+    boost::filesystem::remove_all( directory );
+}
+
+/**
+ * Test pages whose loader fails
+*/
+TEST( VirtualTexture, LoaderError ){
+
+    GEO::TERRAIN::VirtualTexture texture( 1024, 1024, 128, 4 );
+    std::atomic<bool> broken( true );
+    texture.setPageLoader( [&broken]( GEO::TERRAIN::VirtualPage const& page, GEO::TERRAIN::PageBuffer& buffer ){
+        if( page.level == 0 && broken ){
+            throw GEO::GeneralException("Unreadable page.", __FILE__, __LINE__);
+        }
+        fill_level( page, buffer );
+    });
+    drain( texture );
+
+    // the failed page comes back without a slot
+    const GEO::TERRAIN::VirtualPage page( 0, 2, 3 );
+    texture.nextFrame();
+    texture.request( 0, GEO::Rect( 300, 400, 1, 1 ));
+    std::vector<GEO::TERRAIN::PageBuffer::ptr_t> pages = drain( texture );
+    ASSERT_EQ( pages.size(), 3 );
+    for( size_t p=0; p<pages.size(); p++ ){
+        ASSERT_EQ( pages[p]->error.empty(), pages[p]->page.level != 0 );
+        if( pages[p]->page.level == 0 ){
+            ASSERT_EQ( pages[p]->page, page );
+            ASSERT_EQ( pages[p]->slot, -1 );
+            ASSERT_NE( pages[p]->error.find( "Unreadable page." ), std::string::npos );
+        }
+    }
+    ASSERT_FALSE( texture.isResident( page ));
+    ASSERT_EQ( texture.pending(), 0 );
+
+    // and is requested again by the next frame that needs it
+    broken = false;
+    texture.nextFrame();
+    texture.request( 0, GEO::Rect( 300, 400, 1, 1 ));
+    ASSERT_EQ( texture.pending(), 1 );
+    pages = drain( texture );
+    ASSERT_EQ( pages.size(), 1 );
+    ASSERT_TRUE( pages[0]->error.empty() );
+    ASSERT_TRUE( texture.isResident( page ));
+}
+
+/**
+ * Test choosing the level for a view
+*/
+TEST( VirtualTexture, SelectLevel ){
+
+    GEO::TERRAIN::LodView view;
+    view.viewport_height = 1000;
+    view.fov_y = 2 * std::atan( 0.5 );
+
+    // at 1000 m a pixel covers 1 m
+    ASSERT_EQ( GEO::TERRAIN::select_page_level( 1.0,  1000, view, 10 ), 0 );
+    ASSERT_EQ( GEO::TERRAIN::select_page_level( 0.25, 1000, view, 10 ), 2 );
+    ASSERT_EQ( GEO::TERRAIN::select_page_level( 0.3,  1000, view, 10 ), 1 );
+    ASSERT_EQ( GEO::TERRAIN::select_page_level( 0.25, 100,  view, 10 ), 0 );
+    ASSERT_EQ( GEO::TERRAIN::select_page_level( 0.001, 1e6, view, 10 ), 9 );
+}
@@ -0,0 +1,83 @@
+/**
+ * @file    TEST_BoundedQueue.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <GeoExplore.hpp>
+
+/**
+ * Test the queue capacity and ordering
+ */
+TEST( BoundedQueue, SingleThread ){
+
+    GEO::BoundedQueue<int> queue(5);
+    ASSERT_EQ( queue.capacity(), 8 );
+
+    // fill the queue
+    for( int i=0; i<8; i++ ){
+        ASSERT_TRUE( queue.try_push(i) );
+    }
+    ASSERT_FALSE( queue.try_push(8) );
+    ASSERT_EQ( queue.size(), 8 );
+
+    // values come back in order
+    int value;
+    for( int i=0; i<8; i++ ){
+        ASSERT_TRUE( queue.try_pop(value) );
+        ASSERT_EQ( value, i );
+    }
+    ASSERT_FALSE( queue.try_pop(value) );
+}
+
+/**
+ * Test multiple producers and consumers
+ */
+TEST( BoundedQueue, MultiThread ){
+
+    const int producers = 4;
+    const int consumers = 4;
+    const int count = 20000;
+
+    GEO::BoundedQueue<int> queue(64);
+    std::atomic<long long> sum(0);
+    std::atomic<int> received(0);
+
+    std::vector<std::thread> threads;
+    for( int p=0; p<producers; p++ ){
+        threads.push_back( std::thread( [&](){
+            for( int i=1; i<=count; i++ ){
+                while( queue.try_push(i) == false ){
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+    for( int c=0; c<consumers; c++ ){
+        threads.push_back( std::thread( [&](){
+            int value;
+            while( received.load() < producers*count ){
+                if( queue.try_pop(value) ){
+                    sum += value;
+                    received++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+    for( size_t i=0; i<threads.size(); i++ ){
+        threads[i].join();
+    }
+
+    // every value was received exactly once
+    ASSERT_EQ( received.load(), producers*count );
+    ASSERT_EQ( sum.load(), (long long)producers * count * (count+1) / 2 );
+}
+
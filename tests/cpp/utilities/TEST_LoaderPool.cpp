@@ -0,0 +1,99 @@
+/**
+ * @file    TEST_LoaderPool.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <GeoExplore.hpp>
+
+/**
+ * Test that every request produces one result, failed or not
+ */
+TEST( LoaderPool, Results ){
+
+    GEO::LoaderPool<int,std::string> pool( 64, 4 );
+    pool.start( []( const int& value ) -> std::string {
+                    if( value % 7 == 0 ){
+                        throw std::runtime_error("multiple of seven");
+                    }
+                    return std::to_string( value );
+                },
+                []( const int& value, std::string const& error ){
+                    return "failed " + std::to_string( value ) + ": " + error;
+                },
+                3 );
+
+    // nothing to wait for yet
+    ASSERT_FALSE( pool.wait( std::chrono::milliseconds(10) ));
+
+    // more requests than result slots, so loaders wait for room
+    for( int i=0; i<50; i++ ){
+        ASSERT_TRUE( pool.request( i ));
+    }
+    std::vector<std::string> results;
+    std::string result;
+    while( results.size() < 50 ){
+        ASSERT_TRUE( pool.wait( std::chrono::seconds(5) ));
+        while( pool.collect( result )){
+            results.push_back( result );
+        }
+    }
+    ASSERT_FALSE( pool.collect( result ));
+
+    std::sort( results.begin(), results.end() );
+    for( int i=0; i<50; i++ ){
+        const std::string expected = ( i % 7 == 0 ) ? "failed " + std::to_string( i ) + ": multiple of seven"
+                                                    : std::to_string( i );
+        ASSERT_TRUE( std::binary_search( results.begin(), results.end(), expected ));
+    }
+}
+
+/**
+ * Test stopping with loaders waiting for room
+ */
+TEST( LoaderPool, Stop ){
+
+    GEO::LoaderPool<int,int> pool( 64, 2 );
+    pool.start( []( const int& value ){ return value; },
+                []( const int& value, std::string const& error ){ return -1; },
+                2 );
+    for( int i=0; i<20; i++ ){
+        ASSERT_TRUE( pool.request( i ));
+    }
+    ASSERT_TRUE( pool.wait( std::chrono::seconds(5) ));
+    pool.stop();
+    ASSERT_FALSE( pool.wait( std::chrono::seconds(5) ));
+}
+
+/**
+ * Test a one result queue shared by several loaders drains every request
+ */
+TEST( LoaderPool, SingleSlotResults ){
+
+    for( int pass=0; pass<20; pass++ ){
+        GEO::LoaderPool<int,int> pool( 256, 1 );
+        pool.start( []( const int& value ){ return value; },
+                    []( const int& /*value*/, std::string const& /*error*/ ){ return -1; },
+                    6 );
+        for( int i=0; i<200; i++ ){
+            ASSERT_TRUE( pool.request( i ));
+        }
+
+        int count = 0;
+        int result;
+        while( count < 200 ){
+            ASSERT_TRUE( pool.wait( std::chrono::seconds(5) ));
+            while( pool.collect( result )){
+                count++;
+            }
+        }
+    }
+}
@@ -0,0 +1,56 @@
+/**
+ * @file    TEST_SpaceFillingCurves.cpp
+ * @author  Marvin Smith
+ * @date    10/19/2026
+ */
+#include <gtest/gtest.h>
+
+/// C++ Standard Libraries
+#include <cstdlib>
+#include <set>
+
+#include <GeoExplore.hpp>
+
+/**
+ * Test the Morton code round trip
+ */
+TEST( SpaceFillingCurves, Morton ){
+
+    ASSERT_EQ( GEO::morton_encode( 0, 0 ), 0 );
+    ASSERT_EQ( GEO::morton_encode( 1, 0 ), 1 );
+    ASSERT_EQ( GEO::morton_encode( 0, 1 ), 2 );
+    ASSERT_EQ( GEO::morton_encode( 3, 3 ), 15 );
+
+    uint32_t x, y;
+    GEO::morton_decode( GEO::morton_encode( 123456, 654321 ), x, y );
+    ASSERT_EQ( x, 123456 );
+    ASSERT_EQ( y, 654321 );
+}
+
+/**
+ * Test the Hilbert curve visits each cell once with unit steps
+ */
+TEST( SpaceFillingCurves, Hilbert ){
+
+    const int order = 4;
+    std::set<uint64_t> visited;
+    uint32_t px = 0, py = 0;
+    for( uint64_t d=0; d<(1ULL << (2*order)); d++ ){
+
+        uint32_t x, y;
+        GEO::hilbert_decode( order, d, x, y );
+        ASSERT_EQ( GEO::hilbert_encode( order, x, y ), d );
+        visited.insert( GEO::morton_encode( x, y ));
+
+        if( d > 0 ){
+            ASSERT_EQ( std::abs((int)x - (int)px) + std::abs((int)y - (int)py), 1 );
+        }
+        px = x;
+        py = y;
+    }
+    ASSERT_EQ( visited.size(), 256 );
+
+    ASSERT_EQ( GEO::curve_order( 1, 1 ), 0 );
+    ASSERT_EQ( GEO::curve_order( 5, 3 ), 3 );
+}
+